@@ -0,0 +1,132 @@
+/*
+	Benchmark: reading of big associative containers.
+*/
+
+#include <json_dto/pub.hpp>
+
+#include <bench/common/bench.hpp>
+
+#include <cstdio>
+#include <cstdlib>
+#include <iostream>
+#include <map>
+#include <set>
+#include <string>
+#include <unordered_map>
+
+// Reading without reserve() and emplace_hint(), as json_dto did before.
+template< typename C >
+void
+read_map_plainly( C & cnt, const rapidjson::Value & object )
+{
+	cnt.clear();
+	for( auto it = object.MemberBegin(); it != object.MemberEnd(); ++it )
+	{
+		typename C::key_type key;
+		typename C::mapped_type value;
+		json_dto::read_json_value( key, it->name );
+		json_dto::read_json_value( value, it->value );
+		cnt.emplace( std::move(key), std::move(value) );
+	}
+}
+
+template< typename C >
+void
+read_set_plainly( C & cnt, const rapidjson::Value & object )
+{
+	cnt.clear();
+	for( auto it = object.Begin(); it != object.End(); ++it )
+	{
+		typename C::value_type value;
+		json_dto::read_json_value( value, *it );
+		cnt.emplace( std::move(value) );
+	}
+}
+
+template< typename C >
+void
+run_map( const char * name, std::size_t iterations, std::size_t items )
+{
+	using namespace json_dto_bench;
+
+	C source;
+	char key[ 32 ];
+	for( std::size_t i = 0u; i != items; ++i )
+	{
+		// Keys are zero-padded to keep the same order in std::map.
+		std::snprintf( key, sizeof(key), "key-%08zu", i );
+		source.emplace( key, static_cast< int >( i ) );
+	}
+
+	const auto json = json_dto::to_json( source );
+	rapidjson::Document document;
+	document.Parse( json.data(), json.size() );
+
+	// A new container is created for every reading.
+	measure( ( std::string{ name } + " (plain emplace)" ).c_str(),
+			iterations, json.size(),
+			[&] {
+				C target;
+				read_map_plainly( target, document );
+				do_not_optimize( target );
+			} );
+	measure( ( std::string{ name } + " (from_json)" ).c_str(),
+			iterations, json.size(),
+			[&] {
+				C target;
+				json_dto::from_json( document, target );
+				do_not_optimize( target );
+			} );
+}
+
+template< typename C >
+void
+run_set( const char * name, std::size_t iterations, std::size_t items )
+{
+	using namespace json_dto_bench;
+
+	C source;
+	for( std::size_t i = 0u; i != items; ++i )
+		source.emplace( static_cast< int >( i ) );
+
+	const auto json = json_dto::to_json( source );
+	rapidjson::Document document;
+	document.Parse( json.data(), json.size() );
+
+	// A new container is created for every reading.
+	measure( ( std::string{ name } + " (plain emplace)" ).c_str(),
+			iterations, json.size(),
+			[&] {
+				C target;
+				read_set_plainly( target, document );
+				do_not_optimize( target );
+			} );
+	measure( ( std::string{ name } + " (from_json)" ).c_str(),
+			iterations, json.size(),
+			[&] {
+				C target;
+				json_dto::from_json( document, target );
+				do_not_optimize( target );
+			} );
+}
+
+int
+main( int argc, char ** argv )
+{
+	const std::size_t iterations = argc > 1 ?
+			static_cast< std::size_t >( std::atoll( argv[ 1 ] ) ) : 20u;
+	const std::size_t items = argc > 2 ?
+			static_cast< std::size_t >( std::atoll( argv[ 2 ] ) ) : 100000u;
+
+	std::cout << "items: " << items << ", iterations: " << iterations
+			<< std::endl;
+
+	run_map< std::map< std::string, int > >(
+			"std::map", iterations, items );
+	run_map< std::unordered_map< std::string, int > >(
+			"std::unordered_map", iterations, items );
+	run_set< std::set< int > >(
+			"std::set", iterations, items );
+
+	return 0;
+}
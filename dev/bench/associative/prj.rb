@@ -0,0 +1,11 @@
+require 'mxx_ru/cpp'
+
+MxxRu::Cpp::exe_target {
+
+  target 'bench.associative'
+
+  required_prj 'rapidjson_mxxru/prj.rb'
+
+  cpp_source 'main.cpp'
+  cpp_source '../common/alloc_counter.cpp'
+}
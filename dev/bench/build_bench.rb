@@ -0,0 +1,15 @@
+#!/usr/bin/ruby
+require 'mxx_ru/cpp'
+
+MxxRu::Cpp::composite_target {
+  required_prj( "bench/sax_output/prj.rb" )
+  required_prj( "bench/sax_input/prj.rb" )
+  required_prj( "bench/member_index/prj.rb" )
+  required_prj( "bench/parse_context/prj.rb" )
+  required_prj( "bench/serializer/prj.rb" )
+  required_prj( "bench/insitu/prj.rb" )
+  required_prj( "bench/numeric_arrays/prj.rb" )
+  required_prj( "bench/associative/prj.rb" )
+  required_prj( "bench/suite/prj.rb" )
+  required_prj( "bench/inside_array/prj.rb" )
+}
@@ -0,0 +1,86 @@
+/*
+	json_dto benchmarks: counting of dynamic allocations.
+*/
+
+#include <bench/common/alloc_counter.hpp>
+
+#include <atomic>
+#include <cstdlib>
+#include <new>
+
+namespace json_dto_bench
+{
+
+namespace
+{
+
+std::atomic< std::uint64_t > g_allocations{ 0u };
+
+} /* namespace anonymous */
+
+std::uint64_t
+allocations_count() noexcept
+{
+	return g_allocations.load( std::memory_order_relaxed );
+}
+
+} /* namespace json_dto_bench */
+
+#if defined( __GLIBC__ ) && !defined( __SANITIZE_ADDRESS__ )
+
+// RapidJSON's CrtAllocator uses malloc/realloc directly, so the whole
+// malloc family has to be intercepted.
+extern "C"
+{
+
+void * __libc_malloc( std::size_t );
+void * __libc_calloc( std::size_t, std::size_t );
+void * __libc_realloc( void *, std::size_t );
+
+void *
+malloc( std::size_t size )
+{
+	json_dto_bench::g_allocations.fetch_add( 1u, std::memory_order_relaxed );
+	return __libc_malloc( size );
+}
+
+void *
+calloc( std::size_t count, std::size_t size )
+{
+	json_dto_bench::g_allocations.fetch_add( 1u, std::memory_order_relaxed );
+	return __libc_calloc( count, size );
+}
+
+void *
+realloc( void * ptr, std::size_t size )
+{
+	json_dto_bench::g_allocations.fetch_add( 1u, std::memory_order_relaxed );
+	return __libc_realloc( ptr, size );
+}
+
+} /* extern "C" */
+
+#else
+
+void *
+operator new( std::size_t size )
+{
+	json_dto_bench::g_allocations.fetch_add( 1u, std::memory_order_relaxed );
+	if( void * p = std::malloc( size ? size : 1u ) )
+		return p;
+	throw std::bad_alloc{};
+}
+
+void
+operator delete( void * p ) noexcept
+{
+	std::free( p );
+}
+
+void
+operator delete( void * p, std::size_t ) noexcept
+{
+	std::free( p );
+}
+
+#endif
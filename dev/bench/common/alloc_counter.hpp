@@ -0,0 +1,22 @@
+/*
+	json_dto benchmarks: counting of dynamic allocations.
+*/
+
+#pragma once
+
+#include <cstdint>
+
+namespace json_dto_bench
+{
+
+//! Total count of dynamic allocations made by the process.
+/*!
+ * @note
+ * The counter is updated by replacement of malloc/calloc/realloc
+ * (when glibc is used without AddressSanitizer) or by replacement of
+ * global operator new (in other cases). See alloc_counter.cpp.
+ */
+std::uint64_t
+allocations_count() noexcept;
+
+} /* namespace json_dto_bench */
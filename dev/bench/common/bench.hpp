@@ -0,0 +1,88 @@
+/*
+	json_dto benchmarks: simple measurement helpers.
+*/
+
+#pragma once
+
+#include <bench/common/alloc_counter.hpp>
+
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <string>
+
+namespace json_dto_bench
+{
+
+//! Results of a single measurement.
+struct result_t
+{
+	double m_ns_per_op;
+	double m_mb_per_sec;
+	double m_allocs_per_op;
+};
+
+//! Prevent the compiler from optimizing out the result of an operation.
+template< typename T >
+inline void
+do_not_optimize( const T & v ) noexcept
+{
+#if defined( __GNUC__ )
+	asm volatile( "" : : "g"( &v ) : "memory" );
+#else
+	static volatile const void * sink;
+	sink = &v;
+#endif
+}
+
+/*!
+ * @brief Run @a op @a iterations times and print the results.
+ *
+ * @a bytes_per_op is the size of JSON consumed or produced by one
+ * call to @a op. It's used for MB/s calculation.
+ */
+template< typename Op >
+result_t
+measure(
+	const char * name,
+	std::size_t iterations,
+	std::size_t bytes_per_op,
+	Op && op )
+{
+	// Warming up.
+	for( std::size_t i = 0u, n = iterations / 10u + 1u; i != n; ++i )
+		op();
+
+	const auto allocs_before = allocations_count();
+	const auto started_at = std::chrono::steady_clock::now();
+
+	for( std::size_t i = 0u; i != iterations; ++i )
+		op();
+
+	const auto finished_at = std::chrono::steady_clock::now();
+	const auto allocs_after = allocations_count();
+
+	const double ns = static_cast< double >(
+			std::chrono::duration_cast< std::chrono::nanoseconds >(
+					finished_at - started_at ).count() );
+
+	result_t result;
+	result.m_ns_per_op = ns / static_cast< double >( iterations );
+	result.m_mb_per_sec = ns > 0.0 ?
+			( static_cast< double >( bytes_per_op ) *
+				static_cast< double >( iterations ) / ( 1024.0 * 1024.0 ) ) /
+			( ns / 1e9 ) : 0.0;
+	result.m_allocs_per_op =
+			static_cast< double >( allocs_after - allocs_before ) /
+			static_cast< double >( iterations );
+
+	std::printf( "%-40s %12.1f ns/op %10.1f MB/s %10.2f allocs/op\n",
+			name,
+			result.m_ns_per_op,
+			result.m_mb_per_sec,
+			result.m_allocs_per_op );
+
+	return result;
+}
+
+} /* namespace json_dto_bench */
@@ -0,0 +1,118 @@
+/*
+	Benchmark: reading and writing of members packed into arrays
+	by inside_array::reader_writer and inside_array::static_reader_writer.
+*/
+
+#include <json_dto/pub.hpp>
+
+#include <bench/common/bench.hpp>
+
+#include <cstdlib>
+#include <iostream>
+#include <string>
+#include <vector>
+
+// A quote is represented as an array: [time, bid, ask, bid_size, ask_size].
+template< bool Static >
+struct quote_t
+{
+	std::int64_t m_time{};
+	double m_bid{};
+	double m_ask{};
+	std::int32_t m_bid_size{};
+	std::int32_t m_ask_size{};
+
+	template< typename... Members >
+	static auto
+	make_reader_writer( std::true_type, Members && ...members )
+	{
+		return json_dto::inside_array::static_reader_writer(
+				std::forward<Members>(members)... );
+	}
+
+	template< typename... Members >
+	static auto
+	make_reader_writer( std::false_type, Members && ...members )
+	{
+		return json_dto::inside_array::reader_writer(
+				std::forward<Members>(members)... );
+	}
+
+	template< typename Json_Io >
+	void
+	json_io( Json_Io & io )
+	{
+		io & json_dto::mandatory(
+				make_reader_writer( std::integral_constant< bool, Static >{},
+					json_dto::inside_array::member( m_time ),
+					json_dto::inside_array::member( m_bid ),
+					json_dto::inside_array::member( m_ask ),
+					json_dto::inside_array::member( m_bid_size ),
+					json_dto::inside_array::member( m_ask_size ) ),
+				"q", *this );
+	}
+};
+
+template< bool Static >
+void
+run( const char * name, std::size_t iterations, std::size_t items )
+{
+	using namespace json_dto_bench;
+
+	std::vector< quote_t< Static > > source( items );
+	for( std::size_t i = 0u; i != items; ++i )
+	{
+		auto & q = source[ i ];
+		q.m_time = 1600000000000 + static_cast< std::int64_t >( i );
+		q.m_bid = 100.25 + static_cast< double >( i % 100u ) / 8.0;
+		q.m_ask = q.m_bid + 0.125;
+		q.m_bid_size = static_cast< std::int32_t >( i % 1000u );
+		q.m_ask_size = static_cast< std::int32_t >( i % 700u );
+	}
+
+	const auto json = json_dto::to_json( source );
+	rapidjson::Document document;
+	document.Parse( json.data(), json.size() );
+
+	std::vector< quote_t< Static > > target;
+	measure( ( std::string{ name } + " (read DOM)" ).c_str(),
+			iterations, json.size(),
+			[&] {
+				json_dto::from_json( document, target );
+				do_not_optimize( target );
+			} );
+
+	rapidjson::Document output;
+	measure( ( std::string{ name } + " (write DOM)" ).c_str(),
+			iterations, json.size(),
+			[&] {
+				output.GetAllocator().Clear();
+				json_dto::write_json_value(
+						source, output, output.GetAllocator() );
+				do_not_optimize( output );
+			} );
+
+	json_dto::serializer_t serializer;
+	measure( ( std::string{ name } + " (to_json)" ).c_str(),
+			iterations, json.size(),
+			[&] {
+				do_not_optimize( serializer.to_json( source ) );
+			} );
+}
+
+int
+main( int argc, char ** argv )
+{
+	const std::size_t iterations = argc > 1 ?
+			static_cast< std::size_t >( std::atoll( argv[ 1 ] ) ) : 50u;
+	const std::size_t items = argc > 2 ?
+			static_cast< std::size_t >( std::atoll( argv[ 2 ] ) ) : 100000u;
+
+	std::cout << "items: " << items << ", iterations: " << iterations
+			<< std::endl;
+
+	run< false >( "reader_writer", iterations, items );
+	run< true >( "static_reader_writer", iterations, items );
+
+	return 0;
+}
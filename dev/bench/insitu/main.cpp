@@ -0,0 +1,150 @@
+/*
+	Benchmark: parsing with copied strings vs in-situ parsing.
+*/
+
+#include <json_dto/pub.hpp>
+
+#include <bench/common/bench.hpp>
+
+#include <cstdlib>
+#include <iostream>
+#include <string>
+#include <vector>
+
+struct entry_t
+{
+	std::string m_key;
+	std::string m_value;
+
+	template< typename Json_Io >
+	void
+	json_io( Json_Io & io )
+	{
+		io
+			& json_dto::mandatory( "key", m_key )
+			& json_dto::mandatory( "value", m_value );
+	}
+};
+
+struct document_t
+{
+	std::string m_title;
+	std::string m_body;
+	std::vector< std::string > m_lines;
+	std::vector< entry_t > m_entries;
+
+	template< typename Json_Io >
+	void
+	json_io( Json_Io & io )
+	{
+		io
+			& json_dto::mandatory( "title", m_title )
+			& json_dto::mandatory( "body", m_body )
+			& json_dto::mandatory( "lines", m_lines )
+			& json_dto::mandatory( "entries", m_entries );
+	}
+};
+
+// The same document with fields that refer to the source.
+struct entry_view_t
+{
+	json_dto::string_view_t m_key;
+	json_dto::string_view_t m_value;
+
+	template< typename Json_Io >
+	void
+	json_io( Json_Io & io )
+	{
+		io
+			& json_dto::mandatory( "key", m_key )
+			& json_dto::mandatory( "value", m_value );
+	}
+};
+
+struct document_view_t
+{
+	json_dto::string_view_t m_title;
+	json_dto::string_view_t m_body;
+	std::vector< json_dto::string_view_t > m_lines;
+	std::vector< entry_view_t > m_entries;
+
+	template< typename Json_Io >
+	void
+	json_io( Json_Io & io )
+	{
+		io
+			& json_dto::mandatory( "title", m_title )
+			& json_dto::mandatory( "body", m_body )
+			& json_dto::mandatory( "lines", m_lines )
+			& json_dto::mandatory( "entries", m_entries );
+	}
+};
+
+document_t
+make_document()
+{
+	document_t doc;
+	doc.m_title = "A string-heavy document";
+	for( int i = 0; i != 16; ++i )
+		doc.m_body += "Lorem ipsum dolor sit amet, \"consectetur\" adipiscing elit. ";
+	for( int i = 0; i != 32; ++i )
+		doc.m_lines.push_back( "line #" + std::to_string( i ) +
+				": sed do eiusmod tempor incididunt ut labore" );
+	for( int i = 0; i != 16; ++i )
+		doc.m_entries.push_back( entry_t{
+				"key-" + std::to_string( i ),
+				"value\twith\tescapes and some more text " + std::to_string( i ) } );
+
+	return doc;
+}
+
+int
+main( int argc, char ** argv )
+{
+	using namespace json_dto_bench;
+
+	const std::size_t iterations = argc > 1 ?
+			static_cast< std::size_t >( std::atoll( argv[ 1 ] ) ) : 100000u;
+
+	const auto json = json_dto::to_json( make_document() );
+
+	std::string buffer = json;
+	if( json != json_dto::to_json( json_dto::from_json_insitu< document_t >(
+			&buffer[ 0 ], buffer.size() ) ) )
+	{
+		std::cerr << "from_json and from_json_insitu results differ!"
+				<< std::endl;
+		return 1;
+	}
+
+	std::cout << "document size: " << json.size() << " bytes, iterations: "
+			<< iterations << std::endl;
+
+	document_t doc;
+	measure( "from_json", iterations, json.size(),
+			[&json, &doc] { json_dto::from_json( json, doc ); } );
+
+	// The buffer has to be restored before every parsing. It's a part
+	// of the measurement because a real application has to receive
+	// a message into a buffer anyway.
+	measure( "from_json_insitu (copy + parse)", iterations, json.size(),
+			[&json, &buffer, &doc] {
+				buffer.assign( json );
+				json_dto::from_json_insitu( &buffer[ 0 ], buffer.size(), doc );
+			} );
+
+	document_view_t view;
+	measure( "from_json_insitu (string_view_t fields)",
+			iterations, json.size(),
+			[&json, &buffer, &view] {
+				buffer.assign( json );
+				json_dto::from_json_insitu( &buffer[ 0 ], buffer.size(), view );
+			} );
+	measure( "make_parsed (string_view_t fields)", iterations, json.size(),
+			[&json] {
+				do_not_optimize(
+						json_dto::make_parsed< document_view_t >( json ) );
+			} );
+
+	return 0;
+}
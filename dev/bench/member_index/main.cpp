@@ -0,0 +1,146 @@
+/*
+	Benchmark: FindMember for every field vs single-pass reading of members.
+	Members of the wide DTO come in the order of declaration and
+	in the reverse order.
+*/
+
+#include <json_dto/pub.hpp>
+
+#include <bench/common/bench.hpp>
+
+#include <array>
+#include <cstdlib>
+#include <iostream>
+#include <string>
+#include <vector>
+
+// A DTO with many fields.
+struct wide_t
+{
+	static constexpr std::size_t size = 100u;
+
+	std::array< int, size > m_values{};
+
+	template< typename Json_Io >
+	void
+	json_io( Json_Io & io )
+	{
+		static const auto names = [] {
+				std::array< std::string, size > result;
+				for( std::size_t i = 0u; i != size; ++i )
+					result[ i ] = "field_number_" + std::to_string( i );
+				return result;
+			}();
+
+		for( std::size_t i = 0u; i != size; ++i )
+			io & json_dto::mandatory(
+					json_dto::string_ref_t{ names[ i ].c_str() }, m_values[ i ] );
+	}
+};
+
+// A small DTO.
+struct item_t
+{
+	std::int64_t m_id{};
+	std::string m_name;
+	double m_price{};
+	bool m_available{};
+
+	template< typename Json_Io >
+	void
+	json_io( Json_Io & io )
+	{
+		io
+			& json_dto::mandatory( "id", m_id )
+			& json_dto::mandatory( "name", m_name )
+			& json_dto::mandatory( "price", m_price )
+			& json_dto::optional( "available", m_available, false );
+	}
+};
+
+// Reading via json_input_t without single-pass lookup.
+// Every binder calls FindMember.
+template< typename T >
+void
+read_via_find_member( const rapidjson::Value & object, T & dto )
+{
+	json_dto::json_input_t input{ object };
+	json_io( input, dto );
+}
+
+int
+main( int argc, char ** argv )
+{
+	using namespace json_dto_bench;
+
+	const std::size_t iterations = argc > 1 ?
+			static_cast< std::size_t >( std::atoll( argv[ 1 ] ) ) : 100000u;
+
+	wide_t wide;
+	for( std::size_t i = 0u; i != wide_t::size; ++i )
+		wide.m_values[ i ] = static_cast< int >( i );
+	const auto wide_json = json_dto::to_json( wide );
+
+	std::vector< item_t > items( 100u );
+	const auto items_json = json_dto::to_json( items );
+
+	rapidjson::Document wide_doc;
+	wide_doc.Parse( wide_json.c_str() );
+
+	std::string reversed_json = "{";
+	for( std::size_t i = wide_t::size; i != 0u; --i )
+	{
+		reversed_json += "\"field_number_" + std::to_string( i - 1u ) + "\":" +
+				std::to_string( i - 1u );
+		reversed_json += 1u == i ? "}" : ",";
+	}
+	rapidjson::Document reversed_doc;
+	reversed_doc.Parse( reversed_json.c_str() );
+	rapidjson::Document items_doc;
+	items_doc.Parse( items_json.c_str() );
+
+	std::cout << "iterations: " << iterations << std::endl;
+
+	measure( "wide DTO: FindMember", iterations, wide_json.size(),
+			[&] {
+				wide_t r;
+				read_via_find_member( wide_doc, r );
+				do_not_optimize( r );
+			} );
+	measure( "wide DTO: single pass", iterations, wide_json.size(),
+			[&] {
+				wide_t r;
+				json_dto::from_json( wide_doc, r );
+				do_not_optimize( r );
+			} );
+
+	measure( "reversed wide DTO: FindMember", iterations, reversed_json.size(),
+			[&] {
+				wide_t r;
+				read_via_find_member( reversed_doc, r );
+				do_not_optimize( r );
+			} );
+	measure( "reversed wide DTO: single pass", iterations, reversed_json.size(),
+			[&] {
+				wide_t r;
+				json_dto::from_json( reversed_doc, r );
+				do_not_optimize( r );
+			} );
+
+	measure( "100 small DTOs: FindMember", iterations, items_json.size(),
+			[&] {
+				item_t r;
+				for( auto it = items_doc.Begin(); it != items_doc.End(); ++it )
+					read_via_find_member( *it, r );
+				do_not_optimize( r );
+			} );
+	measure( "100 small DTOs: single pass", iterations, items_json.size(),
+			[&] {
+				item_t r;
+				for( auto it = items_doc.Begin(); it != items_doc.End(); ++it )
+					json_dto::from_json( *it, r );
+				do_not_optimize( r );
+			} );
+
+	return 0;
+}
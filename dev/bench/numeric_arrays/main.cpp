@@ -0,0 +1,137 @@
+/*
+	Benchmark: reading and writing of big arrays of numbers.
+*/
+
+#include <json_dto/pub.hpp>
+
+#include <bench/common/bench.hpp>
+
+#include <cstdlib>
+#include <iostream>
+#include <string>
+#include <vector>
+
+// A Reader_Writer that does the same as default_reader_writer_t but
+// doesn't allow the fast path for arrays of numbers.
+struct generic_reader_writer_t
+{
+	template< typename T >
+	void
+	read( T & v, const rapidjson::Value & from ) const
+	{
+		json_dto::read_json_value( v, from );
+	}
+
+	template< typename T >
+	void
+	write(
+		const T & v,
+		rapidjson::Value & to,
+		rapidjson::MemoryPoolAllocator<> & allocator ) const
+	{
+		json_dto::write_json_value( v, to, allocator );
+	}
+};
+
+template< typename Item_Reader_Writer >
+struct telemetry_t
+{
+	std::vector< double > m_samples;
+	std::vector< std::int32_t > m_counters;
+
+	template< typename Json_Io >
+	void
+	json_io( Json_Io & io )
+	{
+		io
+			& json_dto::mandatory(
+					json_dto::apply_to_content_t< Item_Reader_Writer >{},
+					"samples", m_samples )
+			& json_dto::mandatory(
+					json_dto::apply_to_content_t< Item_Reader_Writer >{},
+					"counters", m_counters );
+	}
+};
+
+using fast_telemetry_t = telemetry_t< json_dto::default_reader_writer_t >;
+using generic_telemetry_t = telemetry_t< generic_reader_writer_t >;
+
+template< typename Telemetry >
+Telemetry
+make_telemetry( std::size_t items )
+{
+	Telemetry result;
+	for( std::size_t i = 0u; i != items; ++i )
+	{
+		result.m_samples.push_back( 0.25 * static_cast< double >( i ) );
+		result.m_counters.push_back(
+				static_cast< std::int32_t >( i * 7919u % 100000u ) - 50000 );
+	}
+
+	return result;
+}
+
+template< typename Telemetry >
+void
+run( const std::string & suffix,
+	std::size_t iterations, std::size_t items )
+{
+	using namespace json_dto_bench;
+
+	const auto telemetry = make_telemetry< Telemetry >( items );
+	const auto json = json_dto::to_json( telemetry );
+
+	rapidjson::Document document;
+	document.Parse( json.data(), json.size() );
+
+	Telemetry target;
+	measure( ( "read from DOM " + suffix ).c_str(), iterations, json.size(),
+			[&document, &target] {
+				json_dto::from_json( document, target );
+				do_not_optimize( target );
+			} );
+
+	measure( ( "write to DOM " + suffix ).c_str(), iterations, json.size(),
+			[&telemetry] {
+				rapidjson::Document out;
+				json_dto::json_output_t output{ out, out.GetAllocator() };
+				output << telemetry;
+				do_not_optimize( out );
+			} );
+
+	measure( ( "read via SAX " + suffix ).c_str(), iterations, json.size(),
+			[&json, &target] {
+				json_dto::from_json_sax( json, target );
+				do_not_optimize( target );
+			} );
+
+	measure( ( "write via SAX " + suffix ).c_str(), iterations, json.size(),
+			[&telemetry] {
+				auto out = json_dto::to_json_sax( telemetry );
+				do_not_optimize( out );
+			} );
+}
+
+int
+main( int argc, char ** argv )
+{
+	const std::size_t iterations = argc > 1 ?
+			static_cast< std::size_t >( std::atoll( argv[ 1 ] ) ) : 100u;
+	const std::size_t items = argc > 2 ?
+			static_cast< std::size_t >( std::atoll( argv[ 2 ] ) ) : 100000u;
+
+	if( json_dto::to_json( make_telemetry< fast_telemetry_t >( 100u ) ) !=
+			json_dto::to_json( make_telemetry< generic_telemetry_t >( 100u ) ) )
+	{
+		std::cerr << "fast and generic results differ!" << std::endl;
+		return 1;
+	}
+
+	std::cout << "items: " << items << ", iterations: " << iterations
+			<< std::endl;
+
+	run< generic_telemetry_t >( "(generic)", iterations, items );
+	run< fast_telemetry_t >( "(numbers)", iterations, items );
+
+	return 0;
+}
@@ -0,0 +1,151 @@
+/*
+	Benchmark: deserialization with and without parse_context_t.
+*/
+
+#include <json_dto/pub.hpp>
+
+#include <bench/common/bench.hpp>
+
+#include <cstdlib>
+#include <iostream>
+#include <map>
+#include <sstream>
+#include <string>
+#include <vector>
+
+struct attachment_t
+{
+	std::string m_name;
+	std::uint64_t m_size;
+	json_dto::nullable_t< std::string > m_mime_type;
+
+	template< typename Json_Io >
+	void
+	json_io( Json_Io & io )
+	{
+		io
+			& json_dto::mandatory( "name", m_name )
+			& json_dto::mandatory( "size", m_size )
+			& json_dto::mandatory( "mime_type", m_mime_type );
+	}
+};
+
+struct message_t
+{
+	std::string m_from;
+	std::string m_to;
+	std::int64_t m_when;
+	std::string m_text;
+	std::vector< std::string > m_tags;
+	std::vector< attachment_t > m_attachments;
+	std::map< std::string, std::string > m_headers;
+	std::vector< double > m_scores;
+	int m_priority{ 0 };
+
+	template< typename Json_Io >
+	void
+	json_io( Json_Io & io )
+	{
+		io
+			& json_dto::mandatory( "from", m_from )
+			& json_dto::mandatory( "to", m_to )
+			& json_dto::mandatory( "when", m_when )
+			& json_dto::mandatory( "text", m_text )
+			& json_dto::mandatory( "tags", m_tags )
+			& json_dto::mandatory( "attachments", m_attachments )
+			& json_dto::mandatory( "headers", m_headers )
+			& json_dto::mandatory( "scores", m_scores )
+			& json_dto::optional( "priority", m_priority, 0 );
+	}
+};
+
+message_t
+make_message()
+{
+	message_t msg;
+	msg.m_from = "json_dto@example.com";
+	msg.m_to = "everyone@example.com";
+	msg.m_when = 1474884330;
+	msg.m_text = "Hello, World! This is a message with a moderate amount of text.";
+	msg.m_tags = { "greeting", "test", "benchmark" };
+	for( int i = 0; i != 8; ++i )
+	{
+		attachment_t a;
+		a.m_name = "attachment-" + std::to_string( i ) + ".bin";
+		a.m_size = 1024u * static_cast< std::uint64_t >( i + 1 );
+		if( i % 2 )
+			a.m_mime_type = json_dto::nullable_t< std::string >{
+					"application/octet-stream" };
+		msg.m_attachments.push_back( std::move( a ) );
+	}
+	msg.m_headers = {
+		{ "Content-Language", "en" },
+		{ "X-Mailer", "json_dto" },
+		{ "X-Priority", "3" } };
+	for( int i = 0; i != 32; ++i )
+		msg.m_scores.push_back( 0.125 * i );
+	msg.m_priority = 3;
+
+	return msg;
+}
+
+int
+main( int argc, char ** argv )
+{
+	using namespace json_dto_bench;
+
+	const std::size_t iterations = argc > 1 ?
+			static_cast< std::size_t >( std::atoll( argv[ 1 ] ) ) : 100000u;
+
+	const auto json = json_dto::to_json( make_message() );
+
+	std::cout << "message size: " << json.size() << " bytes, iterations: "
+			<< iterations << std::endl;
+
+	json_dto::parse_context_t ctx;
+
+	measure( "parse: rapidjson::Document", iterations, json.size(),
+			[&json] {
+				rapidjson::Document document;
+				document.Parse( json.data(), json.size() );
+				do_not_optimize( document );
+			} );
+	measure( "parse: parse_context_t", iterations, json.size(),
+			[&json, &ctx] {
+				do_not_optimize( ctx.parse( json_dto::make_string_ref( json ) ) );
+			} );
+
+	message_t msg;
+	measure( "from_json (reused object)", iterations, json.size(),
+			[&json, &msg] { json_dto::from_json( json, msg ); } );
+	measure( "from_json with context (reused object)", iterations, json.size(),
+			[&json, &msg, &ctx] { json_dto::from_json( ctx, json, msg ); } );
+	measure( "from_json with context and reuse_mode_t", iterations, json.size(),
+			[&json, &msg, &ctx] {
+				json_dto::reuse_mode_t reuse;
+				json_dto::from_json( ctx, json, msg );
+			} );
+
+	std::istringstream in;
+	measure( "from_stream (reused object)", iterations, json.size(),
+			[&json, &in, &msg] {
+				in.clear();
+				in.str( json );
+				json_dto::from_stream( in, msg );
+			} );
+	measure( "from_stream with context (reused object)", iterations, json.size(),
+			[&json, &in, &msg, &ctx] {
+				in.clear();
+				in.str( json );
+				json_dto::from_stream( ctx, in, msg );
+			} );
+
+	const auto & stats = ctx.stats();
+	std::cout << "parse_context_t: documents: " << stats.m_documents
+			<< ", bytes in use: " << stats.m_bytes_in_use
+			<< ", bytes retained: " << stats.m_bytes_retained
+			<< ", chunks allocated: " << stats.m_chunks_allocated
+			<< ", overflows: " << stats.m_overflows << std::endl;
+
+	return 0;
+}
@@ -0,0 +1,142 @@
+/*
+	Benchmark: DOM-based vs SAX-based deserialization.
+*/
+
+#include <json_dto/pub.hpp>
+
+#include <bench/common/bench.hpp>
+
+#include <cstdlib>
+#include <iostream>
+#include <map>
+#include <sstream>
+#include <string>
+#include <vector>
+
+struct attachment_t
+{
+	std::string m_name;
+	std::uint64_t m_size;
+	json_dto::nullable_t< std::string > m_mime_type;
+
+	template< typename Json_Io >
+	void
+	json_io( Json_Io & io )
+	{
+		io
+			& json_dto::mandatory( "name", m_name )
+			& json_dto::mandatory( "size", m_size )
+			& json_dto::mandatory( "mime_type", m_mime_type );
+	}
+};
+
+struct message_t
+{
+	std::string m_from;
+	std::string m_to;
+	std::int64_t m_when;
+	std::string m_text;
+	std::vector< std::string > m_tags;
+	std::vector< attachment_t > m_attachments;
+	std::map< std::string, std::string > m_headers;
+	std::vector< double > m_scores;
+	int m_priority{ 0 };
+
+	template< typename Json_Io >
+	void
+	json_io( Json_Io & io )
+	{
+		io
+			& json_dto::mandatory( "from", m_from )
+			& json_dto::mandatory( "to", m_to )
+			& json_dto::mandatory( "when", m_when )
+			& json_dto::mandatory( "text", m_text )
+			& json_dto::mandatory( "tags", m_tags )
+			& json_dto::mandatory( "attachments", m_attachments )
+			& json_dto::mandatory( "headers", m_headers )
+			& json_dto::mandatory( "scores", m_scores )
+			& json_dto::optional( "priority", m_priority, 0 );
+	}
+};
+
+message_t
+make_message()
+{
+	message_t msg;
+	msg.m_from = "json_dto@example.com";
+	msg.m_to = "everyone@example.com";
+	msg.m_when = 1474884330;
+	msg.m_text = "Hello, World! This is a message with a moderate amount of text.";
+	msg.m_tags = { "greeting", "test", "benchmark" };
+	for( int i = 0; i != 8; ++i )
+	{
+		attachment_t a;
+		a.m_name = "attachment-" + std::to_string( i ) + ".bin";
+		a.m_size = 1024u * static_cast< std::uint64_t >( i + 1 );
+		if( i % 2 )
+			a.m_mime_type = json_dto::nullable_t< std::string >{
+					"application/octet-stream" };
+		msg.m_attachments.push_back( std::move( a ) );
+	}
+	msg.m_headers = {
+		{ "Content-Language", "en" },
+		{ "X-Mailer", "json_dto" },
+		{ "X-Priority", "3" } };
+	for( int i = 0; i != 32; ++i )
+		msg.m_scores.push_back( 0.125 * i );
+	msg.m_priority = 3;
+
+	return msg;
+}
+
+int
+main( int argc, char ** argv )
+{
+	using namespace json_dto_bench;
+
+	const std::size_t iterations = argc > 1 ?
+			static_cast< std::size_t >( std::atoll( argv[ 1 ] ) ) : 100000u;
+
+	const auto json = json_dto::to_json( make_message() );
+
+	if( json != json_dto::to_json(
+			json_dto::from_json_sax< message_t >( json ) ) )
+	{
+		std::cerr << "DOM and SAX results differ!" << std::endl;
+		return 1;
+	}
+
+	std::cout << "message size: " << json.size() << " bytes, iterations: "
+			<< iterations << std::endl;
+
+	measure( "from_json (DOM)", iterations, json.size(),
+			[&json] {
+				do_not_optimize( json_dto::from_json< message_t >( json ) );
+			} );
+	measure( "from_json_sax", iterations, json.size(),
+			[&json] {
+				do_not_optimize( json_dto::from_json_sax< message_t >( json ) );
+			} );
+
+	message_t msg;
+	measure( "from_json (DOM, reused object)", iterations, json.size(),
+			[&json, &msg] { json_dto::from_json( json, msg ); } );
+	measure( "from_json_sax (reused object)", iterations, json.size(),
+			[&json, &msg] { json_dto::from_json_sax( json, msg ); } );
+
+	std::istringstream in;
+	measure( "from_stream (DOM)", iterations, json.size(),
+			[&json, &in, &msg] {
+				in.clear();
+				in.str( json );
+				json_dto::from_stream( in, msg );
+			} );
+	measure( "from_stream_sax", iterations, json.size(),
+			[&json, &in, &msg] {
+				in.clear();
+				in.str( json );
+				json_dto::from_stream_sax( in, msg );
+			} );
+
+	return 0;
+}
@@ -0,0 +1,727 @@
+/*
+	Benchmark: reading and writing of DTOs of different shapes.
+
+	The shapes follow the tutorials: flat scalars, nested objects,
+	std::list/std::map (tutorial17), nullable_t (tutorial6), inside_array
+	(tutorial22.1) and big arrays of numbers. Every shape is measured for
+	from_json, to_json, from_stream and to_stream. One operation is one
+	message, so ns/op is the time per message.
+
+	Hand-written parsers and writers on top of rapidjson's SAX API are
+	measured for flat scalars and arrays of numbers as a baseline.
+
+	Usage: bench.suite [MB-per-measurement]
+*/
+
+#include <json_dto/pub.hpp>
+
+#include <rapidjson/reader.h>
+#include <rapidjson/stringbuffer.h>
+#include <rapidjson/writer.h>
+
+#include <bench/common/bench.hpp>
+
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <list>
+#include <map>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <tuple>
+#include <vector>
+
+//
+// Flat scalars (tutorial1, tutorial2).
+//
+struct flat_t
+{
+	std::string m_from;
+	std::string m_to;
+	std::int64_t m_when{};
+	std::string m_text;
+	std::uint32_t m_id{};
+	bool m_urgent{};
+	double m_score{};
+	int m_priority{};
+
+	template< typename Json_Io >
+	void
+	json_io( Json_Io & io )
+	{
+		io
+			& json_dto::mandatory( "from", m_from )
+			& json_dto::mandatory( "to", m_to )
+			& json_dto::mandatory( "when", m_when )
+			& json_dto::mandatory( "text", m_text )
+			& json_dto::mandatory( "id", m_id )
+			& json_dto::mandatory( "urgent", m_urgent )
+			& json_dto::mandatory( "score", m_score )
+			& json_dto::optional( "priority", m_priority, 0 );
+	}
+};
+
+flat_t
+make_flat()
+{
+	flat_t msg;
+	msg.m_from = "json_dto@example.com";
+	msg.m_to = "everyone@example.com";
+	msg.m_when = 1474884330;
+	msg.m_text = "Hello, World! This is a message with a moderate amount of text.";
+	msg.m_id = 4242u;
+	msg.m_urgent = true;
+	msg.m_score = 0.875;
+	msg.m_priority = 3;
+
+	return msg;
+}
+
+//
+// Nested objects (tutorial3, tutorial4).
+//
+struct user_t
+{
+	std::string m_name;
+	std::uint64_t m_id{};
+	bool m_active{};
+
+	template< typename Json_Io >
+	void
+	json_io( Json_Io & io )
+	{
+		io
+			& json_dto::mandatory( "name", m_name )
+			& json_dto::mandatory( "id", m_id )
+			& json_dto::mandatory( "active", m_active );
+	}
+};
+
+struct location_t
+{
+	double m_lat{};
+	double m_lon{};
+	std::string m_city;
+
+	template< typename Json_Io >
+	void
+	json_io( Json_Io & io )
+	{
+		io
+			& json_dto::mandatory( "lat", m_lat )
+			& json_dto::mandatory( "lon", m_lon )
+			& json_dto::mandatory( "city", m_city );
+	}
+};
+
+struct nested_t
+{
+	user_t m_from;
+	std::vector< user_t > m_to;
+	location_t m_location;
+	std::int64_t m_when{};
+	std::string m_text;
+
+	template< typename Json_Io >
+	void
+	json_io( Json_Io & io )
+	{
+		io
+			& json_dto::mandatory( "from", m_from )
+			& json_dto::mandatory( "to", m_to )
+			& json_dto::mandatory( "location", m_location )
+			& json_dto::mandatory( "when", m_when )
+			& json_dto::mandatory( "text", m_text );
+	}
+};
+
+nested_t
+make_nested()
+{
+	nested_t msg;
+	msg.m_from = user_t{ "json_dto", 1u, true };
+	for( std::uint64_t i = 0u; i != 8u; ++i )
+		msg.m_to.push_back(
+				user_t{ "user-" + std::to_string( i ), 100u + i, i % 2u == 0u } );
+	msg.m_location = location_t{ 55.7558, 37.6173, "Moscow" };
+	msg.m_when = 1474884330;
+	msg.m_text = "A message for a group of users.";
+
+	return msg;
+}
+
+//
+// std::list and std::map (tutorial17).
+//
+struct property_info_t
+{
+	bool m_mandatory{};
+	int m_priority{};
+	std::string m_default;
+	std::string m_value;
+
+	// Default values of optional fields are compared before writing.
+	friend bool
+	operator==( const property_info_t & a, const property_info_t & b )
+	{
+		const auto tie = []( const property_info_t & v ) {
+			return std::tie( v.m_mandatory, v.m_priority, v.m_default, v.m_value );
+		};
+
+		return tie( a ) == tie( b );
+	}
+
+	template< typename Json_Io >
+	void
+	json_io( Json_Io & io )
+	{
+		io
+			& json_dto::optional( "mandatory", m_mandatory, false )
+			& json_dto::mandatory( "priority", m_priority )
+			& json_dto::optional( "default", m_default, std::string{} )
+			& json_dto::mandatory( "value", m_value );
+	}
+};
+
+struct properties_t
+{
+	std::string m_title;
+	std::string m_body;
+	std::list< std::string > m_hash_tags;
+	std::map< std::string, property_info_t > m_properties;
+
+	template< typename Json_Io >
+	void
+	json_io( Json_Io & io )
+	{
+		io
+			& json_dto::mandatory( "title", m_title )
+			& json_dto::mandatory( "body", m_body )
+			& json_dto::optional( "hash-tags", m_hash_tags,
+					decltype(m_hash_tags){} )
+			& json_dto::optional( "properties", m_properties,
+					decltype(m_properties){} );
+	}
+};
+
+properties_t
+make_properties()
+{
+	properties_t msg;
+	msg.m_title = "Welcome!";
+	msg.m_body = "This is a demo for json_dto";
+	msg.m_hash_tags = { "demo", "json_dto", "rapidjson", "moderncpp" };
+	for( int i = 0; i != 16; ++i )
+	{
+		property_info_t info;
+		info.m_mandatory = i % 3 == 0;
+		info.m_priority = i;
+		if( i % 2 )
+			info.m_default = "none";
+		info.m_value = "value-" + std::to_string( i );
+		msg.m_properties.emplace( "property-" + std::to_string( i ), info );
+	}
+
+	return msg;
+}
+
+//
+// nullable_t (tutorial6).
+//
+struct journal_record_t
+{
+	std::string m_text;
+	json_dto::nullable_t< std::int32_t > m_log_level;
+	json_dto::nullable_t< std::string > m_comment;
+	json_dto::nullable_t< double > m_ratio;
+	json_dto::nullable_t< std::vector< int > > m_codes;
+
+	template< typename Json_Io >
+	void
+	json_io( Json_Io & io )
+	{
+		io
+			& json_dto::mandatory( "text", m_text )
+			& json_dto::mandatory( "log_level", m_log_level )
+			& json_dto::mandatory( "comment", m_comment )
+			& json_dto::mandatory( "ratio", m_ratio )
+			& json_dto::mandatory( "codes", m_codes );
+	}
+};
+
+using journal_t = std::vector< journal_record_t >;
+
+journal_t
+make_journal()
+{
+	journal_t journal;
+	for( int i = 0; i != 16; ++i )
+	{
+		journal_record_t r;
+		r.m_text = "record " + std::to_string( i );
+		if( i % 2 )
+		{
+			r.m_log_level = json_dto::nullable_t< std::int32_t >{ i };
+			r.m_ratio = json_dto::nullable_t< double >{ 0.5 * i };
+		}
+		else
+		{
+			r.m_comment = json_dto::nullable_t< std::string >{ "even record" };
+			r.m_codes = json_dto::nullable_t< std::vector< int > >{
+					std::vector< int >{ i, i + 1, i + 2 } };
+		}
+		journal.push_back( std::move( r ) );
+	}
+
+	return journal;
+}
+
+//
+// inside_array (tutorial22.1).
+//
+struct position_t
+{
+	double m_x{};
+	double m_y{};
+	std::string m_label;
+};
+
+struct sample_t
+{
+	position_t m_position;
+	std::int64_t m_time{};
+
+	template< typename Json_Io >
+	void
+	json_io( Json_Io & io )
+	{
+		io
+			& json_dto::mandatory(
+					json_dto::inside_array::reader_writer(
+						json_dto::inside_array::member( m_position.m_x ),
+						json_dto::inside_array::member( m_position.m_y ),
+						json_dto::inside_array::member( m_position.m_label ) ),
+					"pos", m_position )
+			& json_dto::mandatory( "time", m_time );
+	}
+};
+
+struct track_t
+{
+	std::string m_name;
+	std::vector< sample_t > m_samples;
+
+	template< typename Json_Io >
+	void
+	json_io( Json_Io & io )
+	{
+		io
+			& json_dto::mandatory( "name", m_name )
+			& json_dto::mandatory( "samples", m_samples );
+	}
+};
+
+track_t
+make_track()
+{
+	track_t track;
+	track.m_name = "track";
+	for( int i = 0; i != 64; ++i )
+	{
+		sample_t s;
+		s.m_position = position_t{ 0.5 * i, -0.25 * i, "p" + std::to_string( i ) };
+		s.m_time = 1474884330 + i;
+		track.m_samples.push_back( std::move( s ) );
+	}
+
+	return track;
+}
+
+//
+// Big arrays of numbers.
+//
+struct telemetry_t
+{
+	std::vector< double > m_samples;
+	std::vector< std::int32_t > m_counters;
+
+	template< typename Json_Io >
+	void
+	json_io( Json_Io & io )
+	{
+		io
+			& json_dto::mandatory( "samples", m_samples )
+			& json_dto::mandatory( "counters", m_counters );
+	}
+};
+
+telemetry_t
+make_telemetry()
+{
+	telemetry_t result;
+	for( std::size_t i = 0u; i != 10000u; ++i )
+	{
+		result.m_samples.push_back( 0.25 * static_cast< double >( i ) );
+		result.m_counters.push_back(
+				static_cast< std::int32_t >( i * 7919u % 100000u ) - 50000 );
+	}
+
+	return result;
+}
+
+//
+// Hand-written baselines on top of rapidjson's SAX API.
+//
+
+bool
+is_key( const char * str, rapidjson::SizeType length, const char * key )
+{
+	return std::strlen( key ) == length && 0 == std::memcmp( str, key, length );
+}
+
+std::string
+to_string( const rapidjson::StringBuffer & buffer )
+{
+	return std::string{ buffer.GetString(), buffer.GetSize() };
+}
+
+// Reader of flat_t. Every value is checked for the expected type.
+class flat_handler_t
+	:	public rapidjson::BaseReaderHandler< rapidjson::UTF8<>, flat_handler_t >
+{
+	enum class field_t
+	{
+		none, from, to, when, text, id, urgent, score, priority
+	};
+
+	flat_t & m_msg;
+	field_t m_field{ field_t::none };
+
+	bool
+	integer( std::int64_t v )
+	{
+		switch( m_field )
+		{
+			case field_t::when: m_msg.m_when = v; return true;
+			case field_t::id:
+				m_msg.m_id = static_cast< std::uint32_t >( v );
+				return v >= 0 && v <= 0xFFFFFFFF;
+			case field_t::priority: m_msg.m_priority = static_cast< int >( v ); return true;
+			case field_t::score: m_msg.m_score = static_cast< double >( v ); return true;
+			default: return false;
+		}
+	}
+
+public:
+	explicit flat_handler_t( flat_t & msg ) : m_msg{ msg } {}
+
+	bool StartObject() { return m_field == field_t::none; }
+	bool EndObject( rapidjson::SizeType ) { return true; }
+
+	bool
+	Key( const char * str, rapidjson::SizeType length, bool )
+	{
+		if( is_key( str, length, "from" ) ) m_field = field_t::from;
+		else if( is_key( str, length, "to" ) ) m_field = field_t::to;
+		else if( is_key( str, length, "when" ) ) m_field = field_t::when;
+		else if( is_key( str, length, "text" ) ) m_field = field_t::text;
+		else if( is_key( str, length, "id" ) ) m_field = field_t::id;
+		else if( is_key( str, length, "urgent" ) ) m_field = field_t::urgent;
+		else if( is_key( str, length, "score" ) ) m_field = field_t::score;
+		else if( is_key( str, length, "priority" ) ) m_field = field_t::priority;
+		else return false;
+
+		return true;
+	}
+
+	bool
+	String( const char * str, rapidjson::SizeType length, bool )
+	{
+		switch( m_field )
+		{
+			case field_t::from: m_msg.m_from.assign( str, length ); return true;
+			case field_t::to: m_msg.m_to.assign( str, length ); return true;
+			case field_t::text: m_msg.m_text.assign( str, length ); return true;
+			default: return false;
+		}
+	}
+
+	bool
+	Bool( bool v )
+	{
+		m_msg.m_urgent = v;
+		return m_field == field_t::urgent;
+	}
+
+	bool
+	Double( double v )
+	{
+		m_msg.m_score = v;
+		return m_field == field_t::score;
+	}
+
+	bool Int( int v ) { return integer( v ); }
+	bool Uint( unsigned v ) { return integer( v ); }
+	bool Int64( std::int64_t v ) { return integer( v ); }
+	bool Uint64( std::uint64_t v ) { return integer( static_cast< std::int64_t >( v ) ); }
+
+	bool Default() { return false; }
+};
+
+flat_t
+read_flat_by_sax( const std::string & json )
+{
+	flat_t msg;
+	flat_handler_t handler{ msg };
+	rapidjson::StringStream stream{ json.c_str() };
+	rapidjson::Reader reader;
+	if( !reader.Parse( stream, handler ) )
+		throw std::runtime_error{ "unable to parse flat_t" };
+
+	return msg;
+}
+
+std::string
+write_flat_by_sax( const flat_t & msg )
+{
+	rapidjson::StringBuffer buffer;
+	rapidjson::Writer< rapidjson::StringBuffer > writer{ buffer };
+
+	writer.StartObject();
+	writer.Key( "from" );
+	writer.String( msg.m_from.data(),
+			static_cast< rapidjson::SizeType >( msg.m_from.size() ) );
+	writer.Key( "to" );
+	writer.String( msg.m_to.data(),
+			static_cast< rapidjson::SizeType >( msg.m_to.size() ) );
+	writer.Key( "when" );
+	writer.Int64( msg.m_when );
+	writer.Key( "text" );
+	writer.String( msg.m_text.data(),
+			static_cast< rapidjson::SizeType >( msg.m_text.size() ) );
+	writer.Key( "id" );
+	writer.Uint( msg.m_id );
+	writer.Key( "urgent" );
+	writer.Bool( msg.m_urgent );
+	writer.Key( "score" );
+	writer.Double( msg.m_score );
+	writer.Key( "priority" );
+	writer.Int( msg.m_priority );
+	writer.EndObject();
+
+	return to_string( buffer );
+}
+
+// Reader of telemetry_t.
+class telemetry_handler_t
+	:	public rapidjson::BaseReaderHandler<
+			rapidjson::UTF8<>, telemetry_handler_t >
+{
+	telemetry_t & m_telemetry;
+	std::vector< double > * m_samples{};
+	std::vector< std::int32_t > * m_counters{};
+
+	bool
+	number( double v )
+	{
+		if( !m_samples )
+			return false;
+		m_samples->push_back( v );
+		return true;
+	}
+
+	bool
+	integer( std::int64_t v )
+	{
+		if( m_counters )
+		{
+			m_counters->push_back( static_cast< std::int32_t >( v ) );
+			return v >= INT32_MIN && v <= INT32_MAX;
+		}
+		return number( static_cast< double >( v ) );
+	}
+
+public:
+	explicit telemetry_handler_t( telemetry_t & telemetry )
+		:	m_telemetry{ telemetry }
+	{}
+
+	bool StartObject() { return true; }
+	bool EndObject( rapidjson::SizeType ) { return true; }
+	bool StartArray() { return m_samples || m_counters; }
+
+	bool
+	EndArray( rapidjson::SizeType )
+	{
+		m_samples = nullptr;
+		m_counters = nullptr;
+		return true;
+	}
+
+	bool
+	Key( const char * str, rapidjson::SizeType length, bool )
+	{
+		if( is_key( str, length, "samples" ) )
+			m_samples = &m_telemetry.m_samples;
+		else if( is_key( str, length, "counters" ) )
+			m_counters = &m_telemetry.m_counters;
+		else
+			return false;
+
+		return true;
+	}
+
+	bool Double( double v ) { return number( v ); }
+	bool Int( int v ) { return integer( v ); }
+	bool Uint( unsigned v ) { return integer( v ); }
+	bool Int64( std::int64_t v ) { return integer( v ); }
+	bool Uint64( std::uint64_t v ) { return integer( static_cast< std::int64_t >( v ) ); }
+
+	bool Default() { return false; }
+};
+
+telemetry_t
+read_telemetry_by_sax( const std::string & json )
+{
+	telemetry_t telemetry;
+	telemetry_handler_t handler{ telemetry };
+	rapidjson::StringStream stream{ json.c_str() };
+	rapidjson::Reader reader;
+	if( !reader.Parse( stream, handler ) )
+		throw std::runtime_error{ "unable to parse telemetry_t" };
+
+	return telemetry;
+}
+
+std::string
+write_telemetry_by_sax( const telemetry_t & telemetry )
+{
+	rapidjson::StringBuffer buffer;
+	rapidjson::Writer< rapidjson::StringBuffer > writer{ buffer };
+
+	writer.StartObject();
+	writer.Key( "samples" );
+	writer.StartArray();
+	for( const auto v : telemetry.m_samples )
+		writer.Double( v );
+	writer.EndArray();
+	writer.Key( "counters" );
+	writer.StartArray();
+	for( const auto v : telemetry.m_counters )
+		writer.Int( v );
+	writer.EndArray();
+	writer.EndObject();
+
+	return to_string( buffer );
+}
+
+//
+// Measurements.
+//
+
+std::size_t
+iterations_for( std::size_t bytes_per_measurement, std::size_t message_size )
+{
+	const auto iterations = bytes_per_measurement / message_size;
+	return iterations ? iterations : 1u;
+}
+
+template< typename Dto >
+void
+run( const char * shape, std::size_t bytes_per_measurement, const Dto & dto )
+{
+	using namespace json_dto_bench;
+
+	const auto json = json_dto::to_json( dto );
+	const auto iterations = iterations_for( bytes_per_measurement, json.size() );
+	const std::string prefix{ shape };
+
+	std::cout << shape << ": " << json.size() << " bytes, iterations: "
+			<< iterations << std::endl;
+
+	measure( ( prefix + ": from_json" ).c_str(), iterations, json.size(),
+			[&json] {
+				do_not_optimize( json_dto::from_json< Dto >( json ) );
+			} );
+	measure( ( prefix + ": to_json" ).c_str(), iterations, json.size(),
+			[&dto] {
+				do_not_optimize( json_dto::to_json( dto ) );
+			} );
+
+	std::istringstream in;
+	measure( ( prefix + ": from_stream" ).c_str(), iterations, json.size(),
+			[&json, &in] {
+				in.clear();
+				in.str( json );
+				do_not_optimize( json_dto::from_stream< Dto >( in ) );
+			} );
+
+	std::ostringstream out;
+	measure( ( prefix + ": to_stream" ).c_str(), iterations, json.size(),
+			[&dto, &out] {
+				out.str( std::string{} );
+				json_dto::to_stream( out, dto );
+				do_not_optimize( out );
+			} );
+}
+
+template< typename Dto, typename Reader, typename Writer >
+bool
+run_baseline(
+	const char * shape,
+	std::size_t bytes_per_measurement,
+	const Dto & dto,
+	Reader && reader,
+	Writer && writer )
+{
+	using namespace json_dto_bench;
+
+	const auto json = json_dto::to_json( dto );
+	if( json != writer( dto ) || json != json_dto::to_json( reader( json ) ) )
+	{
+		std::cerr << shape << ": json_dto and SAX baseline results differ!"
+				<< std::endl;
+		return false;
+	}
+
+	const auto iterations = iterations_for( bytes_per_measurement, json.size() );
+	const std::string prefix{ shape };
+
+	measure( ( prefix + ": rapidjson SAX reader" ).c_str(),
+			iterations, json.size(),
+			[&json, &reader] { do_not_optimize( reader( json ) ); } );
+	measure( ( prefix + ": rapidjson SAX writer" ).c_str(),
+			iterations, json.size(),
+			[&dto, &writer] { do_not_optimize( writer( dto ) ); } );
+
+	return true;
+}
+
+int
+main( int argc, char ** argv )
+{
+	const std::size_t megabytes = argc > 1 ?
+			static_cast< std::size_t >( std::atoll( argv[ 1 ] ) ) : 64u;
+	const std::size_t bytes = megabytes * 1024u * 1024u;
+
+	std::cout << "MB per measurement: " << megabytes << std::endl;
+
+	run( "flat", bytes, make_flat() );
+	if( !run_baseline( "flat", bytes, make_flat(),
+			read_flat_by_sax, write_flat_by_sax ) )
+		return 1;
+
+	run( "nested", bytes, make_nested() );
+	run( "list/map", bytes, make_properties() );
+	run( "nullable", bytes, make_journal() );
+	run( "inside_array", bytes, make_track() );
+
+	run( "numbers", bytes, make_telemetry() );
+	if( !run_baseline( "numbers", bytes, make_telemetry(),
+			read_telemetry_by_sax, write_telemetry_by_sax ) )
+		return 1;
+
+	return 0;
+}
@@ -0,0 +1,14 @@
+IF (NOT BENCH)
+	message(FATAL_ERROR "BENCH is not defined!")
+ENDIF ()
+
+IF(NOT BENCH_SRCFILES)
+	SET(BENCH_SRCFILES main.cpp)
+ENDIF()
+
+add_executable(${BENCH}
+	${BENCH_SRCFILES}
+	${CMAKE_SOURCE_DIR}/bench/common/alloc_counter.cpp)
+
+TARGET_LINK_LIBRARIES(${BENCH} PRIVATE json-dto::json-dto)
+TARGET_INCLUDE_DIRECTORIES(${BENCH} PRIVATE ${CMAKE_SOURCE_DIR})
@@ -0,0 +1,920 @@
+/*
+	json_dto
+*/
+
+/*!
+	Serialization of DTOs into MessagePack and back.
+
+	@since v.0.3.5
+*/
+
+#pragma once
+
+#include <json_dto/pub.hpp>
+
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <string>
+#include <vector>
+
+namespace json_dto
+{
+
+namespace details
+{
+
+namespace msgpack
+{
+
+//! Max nesting of arrays and maps accepted by the decoder.
+constexpr unsigned max_depth = 512u;
+
+//
+// encoding
+//
+
+template< typename Int >
+void
+put_big_endian( std::string & to, Int v )
+{
+	char bytes[ sizeof( Int ) ];
+	for( std::size_t i = 0u; i != sizeof( Int ); ++i )
+		bytes[ i ] = static_cast< char >( static_cast< unsigned char >(
+				v >> ( ( sizeof( Int ) - 1u - i ) * 8u ) ) );
+
+	to.append( bytes, sizeof( Int ) );
+}
+
+inline void
+put_header( std::string & to, unsigned char marker )
+{
+	to.push_back( static_cast< char >( marker ) );
+}
+
+template< typename Int >
+void
+put_header( std::string & to, unsigned char marker, Int v )
+{
+	put_header( to, marker );
+	put_big_endian( to, v );
+}
+
+inline void
+write_uint( std::string & to, std::uint64_t v )
+{
+	if( v < 0x80u )
+		put_header( to, static_cast< unsigned char >( v ) );
+	else if( v <= 0xffu )
+		put_header( to, 0xcc, static_cast< std::uint8_t >( v ) );
+	else if( v <= 0xffffu )
+		put_header( to, 0xcd, static_cast< std::uint16_t >( v ) );
+	else if( v <= 0xffffffffu )
+		put_header( to, 0xce, static_cast< std::uint32_t >( v ) );
+	else
+		put_header( to, 0xcf, v );
+}
+
+inline void
+write_int( std::string & to, std::int64_t v )
+{
+	if( v >= 0 )
+	{
+		write_uint( to, static_cast< std::uint64_t >( v ) );
+		return;
+	}
+
+	const auto bits = static_cast< std::uint64_t >( v );
+
+	if( v >= -32 )
+		put_header( to, static_cast< unsigned char >( bits ) );
+	else if( v >= std::numeric_limits< std::int8_t >::min() )
+		put_header( to, 0xd0, static_cast< std::uint8_t >( bits ) );
+	else if( v >= std::numeric_limits< std::int16_t >::min() )
+		put_header( to, 0xd1, static_cast< std::uint16_t >( bits ) );
+	else if( v >= std::numeric_limits< std::int32_t >::min() )
+		put_header( to, 0xd2, static_cast< std::uint32_t >( bits ) );
+	else
+		put_header( to, 0xd3, bits );
+}
+
+// float32 is used if it holds the value exactly.
+inline void
+write_double( std::string & to, double v )
+{
+	if( std::isfinite( v ) &&
+			std::fabs( v ) <= std::numeric_limits< float >::max() &&
+			static_cast< double >( static_cast< float >( v ) ) == v )
+	{
+		const float f = static_cast< float >( v );
+		std::uint32_t bits;
+		std::memcpy( &bits, &f, sizeof( bits ) );
+		put_header( to, 0xca, bits );
+	}
+	else
+	{
+		std::uint64_t bits;
+		std::memcpy( &bits, &v, sizeof( bits ) );
+		put_header( to, 0xcb, bits );
+	}
+}
+
+inline void
+write_size(
+	std::string & to,
+	std::size_t size,
+	unsigned char fix_marker,
+	std::size_t fix_limit,
+	unsigned char marker8,
+	unsigned char marker16 )
+{
+	if( size < fix_limit )
+		put_header( to, static_cast< unsigned char >( fix_marker | size ) );
+	else if( marker8 && size <= 0xffu )
+		put_header( to, marker8, static_cast< std::uint8_t >( size ) );
+	else if( size <= 0xffffu )
+		put_header( to, marker16, static_cast< std::uint16_t >( size ) );
+	else
+		put_header( to,
+				static_cast< unsigned char >( marker16 + 1u ),
+				static_cast< std::uint32_t >( size ) );
+}
+
+inline void
+write_string( std::string & to, const char * str, std::size_t length )
+{
+	write_size( to, length, 0xa0, 32u, 0xd9, 0xda );
+	to.append( str, length );
+}
+
+//
+// writer_t
+//
+
+//! SAX writer that produces MessagePack.
+/*!
+ * It has the same interface as rapidjson::Writer, so DTOs are written
+ * into it by the SAX output of json_dto.
+ *
+ * The size of an array or a map is known only at the end, so a one-byte
+ * header is written at the start and it's replaced by a longer one
+ * if there are 16 or more items.
+ */
+class writer_t
+{
+	public:
+		explicit writer_t( std::string & to ) noexcept
+			:	m_to{ to }
+		{}
+
+		bool Null() { put_header( m_to, 0xc0 ); return value_written(); }
+
+		bool
+		Bool( bool v )
+		{
+			put_header( m_to, v ? 0xc3 : 0xc2 );
+			return value_written();
+		}
+
+		bool Int( int v ) { return Int64( v ); }
+		bool Uint( unsigned v ) { return Uint64( v ); }
+
+		bool
+		Int64( std::int64_t v )
+		{
+			write_int( m_to, v );
+			return value_written();
+		}
+
+		bool
+		Uint64( std::uint64_t v )
+		{
+			write_uint( m_to, v );
+			return value_written();
+		}
+
+		bool
+		Double( double v )
+		{
+			write_double( m_to, v );
+			return value_written();
+		}
+
+		bool
+		RawNumber( const char * str, rapidjson::SizeType length, bool copy )
+		{
+			return String( str, length, copy );
+		}
+
+		bool
+		String( const char * str, rapidjson::SizeType length, bool = false )
+		{
+			write_string( m_to, str, length );
+			return value_written();
+		}
+
+		bool
+		Key( const char * str, rapidjson::SizeType length, bool = false )
+		{
+			write_string( m_to, str, length );
+			return true;
+		}
+
+		bool StartObject() { return start( 0x80 ); }
+
+		bool
+		EndObject( rapidjson::SizeType = 0u )
+		{
+			return end( 0x80, 0xde );
+		}
+
+		bool StartArray() { return start( 0x90 ); }
+
+		bool
+		EndArray( rapidjson::SizeType = 0u )
+		{
+			return end( 0x90, 0xdc );
+		}
+
+		//! Write a JSON text as MessagePack.
+		/*!
+		 * It's used for raw_json_t values.
+		 */
+		bool
+		RawValue( const char * json, std::size_t length, rapidjson::Type )
+		{
+			rapidjson::MemoryStream ms{ json, length };
+			rapidjson::Reader reader;
+
+			return !reader.Parse( ms, *this ).IsError();
+		}
+
+	private:
+		//! An array or a map that is being written.
+		struct container_t
+		{
+			//! The position of the header in the output.
+			std::size_t m_header;
+			//! Count of items or members.
+			std::size_t m_count;
+		};
+
+		std::string & m_to;
+
+		std::vector< container_t > m_containers;
+
+		bool
+		value_written()
+		{
+			if( !m_containers.empty() )
+				++m_containers.back().m_count;
+
+			return true;
+		}
+
+		bool
+		start( unsigned char fix_marker )
+		{
+			m_containers.push_back( container_t{ m_to.size(), 0u } );
+			put_header( m_to, fix_marker );
+
+			return true;
+		}
+
+		bool
+		end( unsigned char fix_marker, unsigned char marker16 )
+		{
+			const auto container = m_containers.back();
+			m_containers.pop_back();
+
+			if( container.m_count < 16u )
+				m_to[ container.m_header ] = static_cast< char >(
+						fix_marker | container.m_count );
+			else
+			{
+				std::string header;
+				write_size( header, container.m_count,
+						fix_marker, 16u, 0, marker16 );
+				m_to.replace( container.m_header, 1u, header );
+			}
+
+			return value_written();
+		}
+};
+
+//! Write @a dto by @a action with restoring @a to in the case of an error.
+template< typename Action >
+void
+append( std::string & to, Action && action )
+{
+	const auto initial_size = to.size();
+	writer_t writer{ to };
+
+	try
+	{
+		action( writer );
+	}
+	catch( ... )
+	{
+		to.resize( initial_size );
+		throw;
+	}
+}
+
+//
+// decoder_t
+//
+
+//! Reader of MessagePack data that passes values to a SAX handler.
+/*!
+ * @a Handler has the same interface as handlers for rapidjson::Reader.
+ *
+ * Methods return false after an error is reported or if the handler
+ * returns false.
+ */
+template< typename Handler >
+class decoder_t
+{
+	public:
+		decoder_t(
+			const char * data,
+			std::size_t size,
+			Handler & handler ) noexcept
+			:	m_begin{ reinterpret_cast< const unsigned char * >( data ) }
+			,	m_current{ m_begin }
+			,	m_end{ m_begin + size }
+			,	m_handler{ handler }
+		{}
+
+		//! Read the only value from the data.
+		bool
+		read_document()
+		{
+			if( !read_value( 0u ) )
+				return false;
+
+			if( m_current != m_end )
+				return parse_error( "unexpected data after the root value" );
+
+			return true;
+		}
+
+		//! The count of bytes that are already read.
+		std::size_t
+		offset() const noexcept
+		{
+			return static_cast< std::size_t >( m_current - m_begin );
+		}
+
+	private:
+		const unsigned char * const m_begin;
+		const unsigned char * m_current;
+		const unsigned char * const m_end;
+
+		Handler & m_handler;
+
+		bool
+		parse_error( const char * what )
+		{
+			const auto at = offset();
+
+			error_info_t error{ error_code_t::parse_error,
+				std::string{ "MessagePack parse error: '" } + what +
+				"' (offset: " + std::to_string( at ) + ")" };
+			error.set_offset( at );
+
+			report_error( std::move(error) );
+			return false;
+		}
+
+		bool
+		has_bytes( std::size_t size )
+		{
+			if( static_cast< std::size_t >( m_end - m_current ) < size )
+				return parse_error( "unexpected end of data" );
+
+			return true;
+		}
+
+		template< typename Int >
+		bool
+		read_big_endian( Int & to )
+		{
+			if( !has_bytes( sizeof( Int ) ) )
+				return false;
+
+			std::uint64_t v{};
+			for( std::size_t i = 0u; i != sizeof( Int ); ++i )
+				v = ( v << 8 ) | *m_current++;
+
+			to = static_cast< Int >( v );
+			return true;
+		}
+
+		// The size follows the marker as uint8, uint16 or uint32.
+		bool
+		read_size(
+			unsigned char marker,
+			unsigned char marker8,
+			std::size_t & to )
+		{
+			bool ok = false;
+			switch( marker - marker8 )
+			{
+				case 0:
+				{
+					std::uint8_t v{}; ok = read_big_endian( v ); to = v;
+				}
+				break;
+
+				case 1:
+				{
+					std::uint16_t v{}; ok = read_big_endian( v ); to = v;
+				}
+				break;
+
+				default:
+				{
+					std::uint32_t v{}; ok = read_big_endian( v ); to = v;
+				}
+			}
+
+			return ok;
+		}
+
+		template< typename Int >
+		bool
+		read_int()
+		{
+			Int v{};
+			if( !read_big_endian( v ) )
+				return false;
+
+			return std::is_signed< Int >::value ?
+					m_handler.Int64( static_cast< std::int64_t >( v ) ) :
+					m_handler.Uint64( static_cast< std::uint64_t >( v ) );
+		}
+
+		template< typename Float, typename Bits >
+		bool
+		read_float()
+		{
+			Bits bits{};
+			if( !read_big_endian( bits ) )
+				return false;
+
+			Float v;
+			std::memcpy( &v, &bits, sizeof( v ) );
+
+			return m_handler.Double( v );
+		}
+
+		bool
+		read_string( std::size_t size, bool is_key )
+		{
+			if( !has_bytes( size ) )
+				return false;
+
+			const auto * str = reinterpret_cast< const char * >( m_current );
+			const auto length = static_cast< rapidjson::SizeType >( size );
+			m_current += size;
+
+			return is_key ?
+					m_handler.Key( str, length, true ) :
+					m_handler.String( str, length, true );
+		}
+
+		bool
+		read_array( std::size_t size, unsigned depth )
+		{
+			// Every item takes one byte at least, so the size is checked
+			// before items are read.
+			if( !has_bytes( size ) || !m_handler.StartArray() )
+				return false;
+
+			for( std::size_t i = 0u; i != size; ++i )
+				if( !read_value( depth + 1u ) )
+					return false;
+
+			return m_handler.EndArray(
+					static_cast< rapidjson::SizeType >( size ) );
+		}
+
+		bool
+		read_key()
+		{
+			if( !has_bytes( 1u ) )
+				return false;
+
+			const auto marker = *m_current++;
+
+			if( 0xa0u <= marker && marker < 0xc0u )
+				return read_string( marker & 0x1fu, true );
+
+			// bin 8/16/32 and str 8/16/32.
+			std::size_t size{};
+			if( 0xc4u <= marker && marker <= 0xc6u )
+				return read_size( marker, 0xc4, size ) &&
+						read_string( size, true );
+			if( 0xd9u <= marker && marker <= 0xdbu )
+				return read_size( marker, 0xd9, size ) &&
+						read_string( size, true );
+
+			return parse_error( "a key of a map must be a string" );
+		}
+
+		bool
+		read_map( std::size_t size, unsigned depth )
+		{
+			if( !has_bytes( size * 2u ) || !m_handler.StartObject() )
+				return false;
+
+			for( std::size_t i = 0u; i != size; ++i )
+				if( !read_key() || !read_value( depth + 1u ) )
+					return false;
+
+			return m_handler.EndObject(
+					static_cast< rapidjson::SizeType >( size ) );
+		}
+
+		bool
+		read_string_of_size( std::size_t size, unsigned )
+		{
+			return read_string( size, false );
+		}
+
+		bool
+		read_sized(
+			unsigned char marker,
+			unsigned char marker8,
+			bool ( decoder_t::*reader )( std::size_t, unsigned ),
+			unsigned depth )
+		{
+			std::size_t size{};
+			return read_size( marker, marker8, size ) &&
+					( this->*reader )( size, depth );
+		}
+
+		bool
+		read_value( unsigned depth )
+		{
+			if( max_depth < depth )
+				return parse_error( "too deep nesting" );
+
+			if( !has_bytes( 1u ) )
+				return false;
+
+			const auto marker = *m_current++;
+
+			if( marker < 0x80u )
+				return m_handler.Uint( marker );
+			if( marker < 0x90u )
+				return read_map( marker & 0x0fu, depth );
+			if( marker < 0xa0u )
+				return read_array( marker & 0x0fu, depth );
+			if( marker < 0xc0u )
+				return read_string( marker & 0x1fu, false );
+			if( marker >= 0xe0u )
+				return m_handler.Int( static_cast< std::int8_t >( marker ) );
+
+			switch( marker )
+			{
+				case 0xc0: return m_handler.Null();
+				case 0xc2: return m_handler.Bool( false );
+				case 0xc3: return m_handler.Bool( true );
+
+				// bin 8/16/32 are read as strings.
+				case 0xc4: case 0xc5: case 0xc6:
+					return read_sized( marker, 0xc4,
+							&decoder_t::read_string_of_size, depth );
+
+				case 0xca: return read_float< float, std::uint32_t >();
+				case 0xcb: return read_float< double, std::uint64_t >();
+
+				case 0xcc: return read_int< std::uint8_t >();
+				case 0xcd: return read_int< std::uint16_t >();
+				case 0xce: return read_int< std::uint32_t >();
+				case 0xcf: return read_int< std::uint64_t >();
+
+				case 0xd0: return read_int< std::int8_t >();
+				case 0xd1: return read_int< std::int16_t >();
+				case 0xd2: return read_int< std::int32_t >();
+				case 0xd3: return read_int< std::int64_t >();
+
+				case 0xd9: case 0xda: case 0xdb:
+					return read_sized( marker, 0xd9,
+							&decoder_t::read_string_of_size, depth );
+
+				case 0xdc: case 0xdd:
+					return read_sized( marker, 0xdb,
+							&decoder_t::read_array, depth );
+
+				case 0xde: case 0xdf:
+					return read_sized( marker, 0xdd,
+							&decoder_t::read_map, depth );
+			}
+
+			// 0xc1 and ext types.
+			--m_current;
+			return parse_error( "unsupported type" );
+		}
+};
+
+//! Read MessagePack data directly into @a o.
+/*!
+ * The data is passed to the same frames as JSON text in from_json_sax(),
+ * no rapidjson::Document is built.
+ */
+template< typename Type, typename Reader_Writer >
+void
+read(
+	const Reader_Writer & reader_writer,
+	const string_ref_t & data,
+	Type & o )
+{
+	sax_input::context_t ctx;
+	ctx.frames().push< sax_input::root_frame_t< Type, Reader_Writer > >(
+			o, reader_writer );
+
+	sax_input::handler_t handler{ ctx };
+	decoder_t< sax_input::handler_t > decoder{
+			data.s, data.length, handler };
+
+	if( !decoder.read_document() )
+		handler.rethrow_if_failed( decoder.offset() );
+}
+
+} /* namespace msgpack */
+
+} /* namespace details */
+
+/*!
+ * @brief Helper function for serialization of an object into MessagePack
+ * with appending the result to a string.
+ *
+ * A DTO is described by json_io() in the same way as for JSON: all
+ * binders, Reader_Writers, validators and manopt policies are used.
+ * JSON values are mapped to MessagePack types in the natural way. Integers
+ * are written in the shortest form, doubles are written as float32 if it
+ * holds the value exactly.
+ *
+ * The DTO is written directly into @a to via the SAX output (see
+ * to_writer()), there is no intermediate rapidjson::Document.
+ * If an exception is thrown then @a to is left unchanged.
+ *
+ * @since v.0.3.5
+ */
+template< typename Dto >
+void
+to_msgpack_append(
+	//! Target string.
+	std::string & to,
+	//! Object to be serialized.
+	const Dto & dto )
+{
+	details::msgpack::append( to, [&]( details::msgpack::writer_t & writer ) {
+			to_writer( writer, dto );
+		} );
+}
+
+/*!
+ * @brief Helper function for serialization of an object into MessagePack
+ * with appending the result to a string with a custom Reader_Writer.
+ *
+ * @since v.0.3.5
+ */
+template< typename Reader_Writer, typename Dto >
+void
+to_msgpack_append(
+	//! Custom Reader_Writer to be used.
+	const Reader_Writer & reader_writer,
+	//! Target string.
+	std::string & to,
+	//! Object to be serialized.
+	const Dto & dto )
+{
+	details::msgpack::append( to, [&]( details::msgpack::writer_t & writer ) {
+			details::sax_output::write_value( reader_writer, dto, writer );
+		} );
+}
+
+/*!
+ * @brief Helper function for serialization of an object into MessagePack.
+ *
+ * Usage example:
+ * @code
+ * const std::string packed = json_dto::to_msgpack( my_dto );
+ * ...
+ * auto unpacked = json_dto::from_msgpack< my_dto_t >( packed );
+ * @endcode
+ *
+ * @since v.0.3.5
+ */
+template< typename Dto >
+JSON_DTO_NODISCARD
+std::string
+to_msgpack(
+	//! Object to be serialized.
+	const Dto & dto )
+{
+	std::string result;
+	to_msgpack_append( result, dto );
+
+	return result;
+}
+
+/*!
+ * @brief Helper function for serialization of an object into MessagePack
+ * with a custom Reader_Writer.
+ *
+ * @since v.0.3.5
+ */
+template< typename Reader_Writer, typename Dto >
+JSON_DTO_NODISCARD
+std::string
+to_msgpack(
+	//! Custom Reader_Writer to be used.
+	const Reader_Writer & reader_writer,
+	//! Object to be serialized.
+	const Dto & dto )
+{
+	std::string result;
+	to_msgpack_append( reader_writer, result, dto );
+
+	return result;
+}
+
+//
+// NOTE: there are no overloads for const char* because MessagePack data
+// can contain zero bytes.
+//
+
+/*!
+ * @brief Helper function to read DTO from MessagePack data.
+ *
+ * Strings are read from bin types too. Ext types aren't supported,
+ * a key of a map must be a string.
+ *
+ * @note
+ * Type @a Type is required to be DefaultConstructible.
+ *
+ * @since v.0.3.5
+ */
+template< typename Type >
+Type
+from_msgpack(
+	//! MessagePack data.
+	const string_ref_t & data )
+{
+	Type result{};
+	details::msgpack::read( default_reader_writer_t{}, data, result );
+
+	return result;
+}
+
+/*!
+ * @brief Helper function to read DTO from MessagePack data.
+ *
+ * @note
+ * Type @a Type is required to be DefaultConstructible.
+ *
+ * @since v.0.3.5
+ */
+template< typename Type >
+Type
+from_msgpack(
+	//! MessagePack data.
+	const std::string & data )
+{
+	return from_msgpack< Type >( make_string_ref( data ) );
+}
+
+/*!
+ * @brief Helper function to read DTO from MessagePack data with
+ * a custom Reader_Writer.
+ *
+ * @note
+ * Type @a Type is required to be DefaultConstructible.
+ *
+ * @since v.0.3.5
+ */
+template< typename Type, typename Reader_Writer >
+Type
+from_msgpack(
+	//! Custom Reader_Writer to be used.
+	const Reader_Writer & reader_writer,
+	//! MessagePack data.
+	const string_ref_t & data )
+{
+	Type result{};
+	details::msgpack::read( reader_writer, data, result );
+
+	return result;
+}
+
+/*!
+ * @brief Helper function to read DTO from MessagePack data with
+ * a custom Reader_Writer.
+ *
+ * @note
+ * Type @a Type is required to be DefaultConstructible.
+ *
+ * @since v.0.3.5
+ */
+template< typename Type, typename Reader_Writer >
+Type
+from_msgpack(
+	//! Custom Reader_Writer to be used.
+	const Reader_Writer & reader_writer,
+	//! MessagePack data.
+	const std::string & data )
+{
+	return from_msgpack< Type >( reader_writer, make_string_ref( data ) );
+}
+
+/*!
+ * @brief Helper function to read MessagePack data into already
+ * constructed DTO.
+ *
+ * @note
+ * The state of @a o object is not defined if an error occurs.
+ *
+ * @since v.0.3.5
+ */
+template< typename Type >
+void
+from_msgpack(
+	//! MessagePack data.
+	const string_ref_t & data,
+	//! The receiver of the extracted value.
+	Type & o )
+{
+	details::msgpack::read( default_reader_writer_t{}, data, o );
+}
+
+/*!
+ * @brief Helper function to read MessagePack data into already
+ * constructed DTO.
+ *
+ * @note
+ * The state of @a o object is not defined if an error occurs.
+ *
+ * @since v.0.3.5
+ */
+template< typename Type >
+void
+from_msgpack(
+	//! MessagePack data.
+	const std::string & data,
+	//! The receiver of the extracted value.
+	Type & o )
+{
+	from_msgpack( make_string_ref( data ), o );
+}
+
+/*!
+ * @brief Helper function to read MessagePack data into already
+ * constructed DTO with a custom Reader_Writer.
+ *
+ * @note
+ * The state of @a o object is not defined if an error occurs.
+ *
+ * @since v.0.3.5
+ */
+template< typename Type, typename Reader_Writer >
+void
+from_msgpack(
+	//! Custom Reader_Writer to be used.
+	const Reader_Writer & reader_writer,
+	//! MessagePack data.
+	const string_ref_t & data,
+	//! The receiver of the extracted value.
+	Type & o )
+{
+	details::msgpack::read( reader_writer, data, o );
+}
+
+/*!
+ * @brief Helper function to read MessagePack data into already
+ * constructed DTO with a custom Reader_Writer.
+ *
+ * @note
+ * The state of @a o object is not defined if an error occurs.
+ *
+ * @since v.0.3.5
+ */
+template< typename Type, typename Reader_Writer >
+void
+from_msgpack(
+	//! Custom Reader_Writer to be used.
+	const Reader_Writer & reader_writer,
+	//! MessagePack data.
+	const std::string & data,
+	//! The receiver of the extracted value.
+	Type & o )
+{
+	from_msgpack( reader_writer, make_string_ref( data ), o );
+}
+
+} /* namespace json_dto */
@@ -16,13 +16,26 @@
 #include <rapidjson/stringbuffer.h>
 #include <rapidjson/ostreamwrapper.h>
 #include <rapidjson/istreamwrapper.h>
+#include <rapidjson/memorystream.h>
+#include <rapidjson/encodedstream.h>
+#include <rapidjson/reader.h>
 
+#include <algorithm>
 #include <array>
+#include <atomic>
+#include <cstddef>
 #include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <exception>
+#include <functional>
+#include <new>
 #include <vector>
 #include <memory>
 #include <limits>
 #include <type_traits>
+#include <tuple>
+#include <utility>
 #include <iostream>
 
 #if defined( __has_include )
@@ -53,6 +66,28 @@
 	#endif
 #endif
 
+#if defined( __has_include )
+	//
+	// Check for std::string_view.
+	//
+	// Since v.0.3.5.
+	//
+	#define JSON_DTO_CHECK_FOR_STD_STRING_VIEW
+	#if defined( _MSC_VER ) && !_HAS_CXX17
+		#undef JSON_DTO_CHECK_FOR_STD_STRING_VIEW
+	#endif
+
+	#if defined( JSON_DTO_CHECK_FOR_STD_STRING_VIEW )
+		#if __has_include(<string_view>)
+			#include <string_view>
+		#endif
+
+		#if defined( __cpp_lib_string_view )
+			#define JSON_DTO_SUPPORTS_STD_STRING_VIEW
+		#endif
+	#endif
+#endif
+
 #if defined(__has_cpp_attribute)
 	#if __has_cpp_attribute(nodiscard)
 		#define JSON_DTO_NODISCARD [[nodiscard]]
@@ -70,6 +105,30 @@
 	#define JSON_DTO_STD_LAUNDER(x) x
 #endif
 
+// Instrumentation of fields.
+// JSON_DTO_INSTRUMENTATION turns on the standard collector of statistics,
+// JSON_DTO_INSTRUMENTATION_POLICY can specify a custom policy.
+// All translation units of a program must use the same policy.
+//
+// Since v.0.3.5.
+#if defined( JSON_DTO_INSTRUMENTATION )
+	#include <chrono>
+	#include <map>
+	#include <mutex>
+	#include <string>
+	#include <typeindex>
+	#include <typeinfo>
+
+	#if !defined( JSON_DTO_INSTRUMENTATION_POLICY )
+		#define JSON_DTO_INSTRUMENTATION_POLICY \
+			::json_dto::instrumentation::collector_t
+	#endif
+#endif
+
+#if !defined( JSON_DTO_INSTRUMENTATION_POLICY )
+	#define JSON_DTO_INSTRUMENTATION_POLICY ::json_dto::no_instrumentation_t
+#endif
+
 namespace json_dto
 {
 
@@ -222,6 +281,99 @@ struct has_before_begin<
 			>
 		> : public std::true_type {};
 
+//
+// has_mutable_items
+//
+// Since v.0.3.5.
+// Items of a container can be read in place only if the container
+// gives non-const references to them. It isn't true for set-like
+// containers and std::vector<bool>.
+template< typename, typename = void_t<> >
+struct has_mutable_items : public std::false_type {};
+
+template< typename T >
+struct has_mutable_items<
+		T,
+		void_t<
+			std::enable_if_t<
+					std::is_same<
+							typename T::value_type &,
+							decltype(*std::declval<typename T::iterator &>()) >::value >
+			>
+		> : public std::true_type {};
+
+//
+// has_reserve
+//
+// Since v.0.3.5.
+// reserve() will be called for sequence containers before reading.
+template< typename, typename = void_t<> >
+struct has_reserve : public std::false_type {};
+
+template< typename T >
+struct has_reserve<
+		T,
+		void_t<
+			decltype(
+					std::declval<T &>().reserve(
+							std::declval<typename T::size_type>() )
+			) >
+		> : public std::true_type {};
+
+//
+// has_size
+//
+// Since v.0.3.5.
+// size() is used for reserving space in JSON arrays before writing.
+// There is no size() in std::forward_list.
+template< typename, typename = void_t<> >
+struct has_size : public std::false_type {};
+
+template< typename T >
+struct has_size<
+		T,
+		void_t<decltype(std::declval<const T &>().size())> > : public std::true_type {};
+
+//
+// is_hash_container
+//
+// Since v.0.3.5.
+// reserve() will be called for hash containers before reading.
+template< typename, typename = void_t<> >
+struct is_hash_container : public std::false_type {};
+
+template< typename T >
+struct is_hash_container<
+		T,
+		void_t<
+			decltype(
+					std::declval<T &>().reserve(
+							std::declval<typename T::size_type>() ) ),
+			decltype(std::declval<const T &>().bucket_count()),
+			decltype(std::declval<const T &>().max_load_factor())
+			>
+		> : public std::true_type {};
+
+//
+// is_ordered_associative_container
+//
+// Since v.0.3.5.
+// New items are added into ordered containers via emplace_hint().
+template< typename, typename = void_t<> >
+struct is_ordered_associative_container : public std::false_type {};
+
+template< typename T >
+struct is_ordered_associative_container<
+		T,
+		void_t<
+			typename T::key_compare,
+			decltype(
+					std::declval<T &>().emplace_hint(
+							std::declval<typename T::const_iterator>(),
+							std::declval<typename T::value_type>() )
+			) >
+		> : public std::true_type {};
+
 //
 // is_stl_like_sequence_container
 //
@@ -281,6 +433,16 @@ struct is_stl_set_like_associative_container
 				;
 	};
 
+//
+// is_std_array
+//
+// Since v.0.3.5.
+template< typename T >
+struct is_std_array : public std::false_type {};
+
+template< typename T, std::size_t N >
+struct is_std_array< std::array< T, N > > : public std::true_type {};
+
 //
 // is_stl_like_container
 //
@@ -289,7 +451,8 @@ struct is_stl_like_container
 	{
 		static constexpr bool value =
 				is_stl_like_sequence_container<T>::value ||
-				is_stl_like_associative_container<T>::value;
+				is_stl_like_associative_container<T>::value ||
+				is_std_array<T>::value;
 	};
 
 //
@@ -376,6 +539,30 @@ struct head_of<T>
 template< typename... Args >
 using head_of_t = typename head_of<Args...>::type;
 
+// Detector of static read_from_member method in an implementation
+// of binder's read operation.
+//
+// User-defined specializations of binder_read_from_implementation_t
+// may have no read_from_member method.
+//
+// Since v.0.3.5
+template<
+	typename Read_From_Impl,
+	typename Data_Holder,
+	typename = void_t<> >
+struct has_static_read_from_member : public std::false_type {};
+
+template< typename Read_From_Impl, typename Data_Holder >
+struct has_static_read_from_member<
+		Read_From_Impl,
+		Data_Holder,
+		void_t<
+			decltype(Read_From_Impl::read_from_member(
+					std::declval<const Data_Holder &>(),
+					std::declval<const rapidjson::Value *>()))
+		>
+	> : public std::true_type {};
+
 } /* namespace meta */
 
 namespace sequence_containers
@@ -409,6 +596,14 @@ public :
 	{
 		m_cnt.emplace_back( std::forward<V>(value) );
 	}
+
+	// Since v.0.3.5.
+	typename C::value_type &
+	emplace_default()
+	{
+		m_cnt.emplace_back();
+		return m_cnt.back();
+	}
 };
 
 template< typename C >
@@ -427,6 +622,14 @@ public :
 	{
 		m_it = m_cnt.emplace_after( m_it, std::forward<V>(value) );
 	}
+
+	// Since v.0.3.5.
+	typename C::value_type &
+	emplace_default()
+	{
+		m_it = m_cnt.emplace_after( m_it );
+		return *m_it;
+	}
 };
 
 template< typename C >
@@ -434,8 +637,168 @@ using container_filler_t = container_filler_impl_t<
 		C,
 		meta::has_before_begin<C>::value && meta::has_emplace_after<C>::value >;
 
+//
+// Reserving of space before reading and writing.
+//
+// Since v.0.3.5.
+//
+
+template< typename C >
+void
+reserve( C & cnt, std::size_t size, std::true_type /*has_reserve*/ )
+{
+	cnt.reserve( size );
+}
+
+template< typename C >
+void
+reserve( C &, std::size_t, std::false_type /*has_reserve*/ )
+{}
+
+//! Reserve space for items if the container supports it.
+template< typename C >
+void
+reserve( C & cnt, std::size_t size )
+{
+	reserve( cnt, size, meta::has_reserve< C >{} );
+}
+
+template< typename C >
+void
+reserve_array(
+	rapidjson::Value & object,
+	const C & cnt,
+	rapidjson::MemoryPoolAllocator<> & allocator,
+	std::true_type /*has_size*/ )
+{
+	object.Reserve( static_cast< rapidjson::SizeType >( cnt.size() ), allocator );
+}
+
+template< typename C >
+void
+reserve_array(
+	rapidjson::Value &,
+	const C &,
+	rapidjson::MemoryPoolAllocator<> &,
+	std::false_type /*has_size*/ )
+{}
+
+//! Reserve space in a JSON array for all items of the container.
+template< typename C >
+void
+reserve_array(
+	rapidjson::Value & object,
+	const C & cnt,
+	rapidjson::MemoryPoolAllocator<> & allocator )
+{
+	reserve_array( object, cnt, allocator, meta::has_size< C >{} );
+}
+
 } /* namespace sequence_containers */
 
+namespace associative_containers
+{
+
+//
+// Helpers for adding new items into associative containers.
+//
+// Since v.0.3.5.
+//
+
+// NOTE: reserve() can shrink the bucket array of a reused container,
+// so it's called only if there aren't enough buckets.
+template< typename C >
+void
+reserve( C & cnt, std::size_t size, std::true_type /*is_hash_container*/ )
+{
+	if( static_cast< float >( size ) >
+			static_cast< float >( cnt.bucket_count() ) * cnt.max_load_factor() )
+		cnt.reserve( size );
+}
+
+template< typename C >
+void
+reserve( C &, std::size_t, std::false_type /*is_hash_container*/ )
+{}
+
+//! Reserve space for items of hash containers.
+template< typename C >
+void
+reserve( C & cnt, std::size_t size )
+{
+	reserve( cnt, size, meta::is_hash_container< C >{} );
+}
+
+//! A place for a mapped value.
+template< typename C >
+struct slot_t
+{
+	typename C::iterator m_it;
+	//! false if there already was an item with the same key.
+	bool m_inserted;
+};
+
+// For containers with unique keys.
+template< typename C, typename It >
+slot_t< C >
+make_slot( std::pair< It, bool > r )
+{
+	return { r.first, r.second };
+}
+
+// For multimaps.
+template< typename C, typename It >
+slot_t< C >
+make_slot( It it )
+{
+	return { it, true };
+}
+
+// New items are added to the end of ordered containers with a hint.
+// It makes the insertion very cheap if keys are sorted (JSON produced
+// from an ordered container has sorted keys).
+//
+// NOTE: emplace_hint() doesn't tell whether an item was inserted,
+// so the size of the container is checked.
+template< typename C, typename... Args >
+slot_t< C >
+emplace( C & cnt, std::true_type /*is_ordered*/, Args &&... args )
+{
+	const auto size = cnt.size();
+	const auto it = cnt.emplace_hint( cnt.end(), std::forward< Args >( args )... );
+
+	return { it, size != cnt.size() };
+}
+
+template< typename C, typename... Args >
+slot_t< C >
+emplace( C & cnt, std::false_type /*is_ordered*/, Args &&... args )
+{
+	return make_slot< C >( cnt.emplace( std::forward< Args >( args )... ) );
+}
+
+//! Emplace an item into a set-like container.
+template< typename C, typename V >
+void
+emplace_item( C & cnt, V && value )
+{
+	emplace( cnt, meta::is_ordered_associative_container< C >{},
+			std::forward< V >( value ) );
+}
+
+//! Emplace an item with the key and a default-constructed value.
+template< typename C, typename Key >
+slot_t< C >
+emplace_key( C & cnt, Key && key )
+{
+	return emplace( cnt, meta::is_ordered_associative_container< C >{},
+			std::piecewise_construct,
+			std::forward_as_tuple( std::forward< Key >( key ) ),
+			std::forward_as_tuple() );
+}
+
+} /* namespace associative_containers */
+
 } /* namespace details */
 
 namespace cpp17
@@ -453,68 +816,615 @@ namespace cpp17
 #endif
 } /* namespace cpp17 */
 
-//
-// ex_t
-//
+using string_ref_t = rapidjson::Value::StringRefType;
 
-//! Errors reading json data.
-class ex_t
-	:	public std::runtime_error
+//! Helper function to make a string_ref instance.
+/*!
+ * @since v.0.2.9
+ */
+inline string_ref_t
+make_string_ref( const char * src, std::size_t length ) noexcept
 {
-		typedef std::runtime_error base_type_t;
+	return { src, static_cast<rapidjson::SizeType>(length) };
+}
 
-	public:
-		ex_t( const std::string & error_desc )
-			:	base_type_t{ error_desc }
-		{}
-};
+//! Helper function to make a string_ref instance from std::string object.
+/*!
+ * @since v.0.2.9
+ */
+inline string_ref_t
+make_string_ref( const std::string & src ) noexcept
+{
+	return make_string_ref( src.data(), src.size() );
+}
 
+//! Helper function to make a string_ref instance from raw pointer.
+/*!
+ * @since v.0.2.9
+ */
+inline string_ref_t
+make_string_ref( const char * src ) noexcept
+{
+	return make_string_ref( src, std::strlen(src) );
+}
 
 //
-// json_input_t
+// field_name_t
 //
 
-//! Input object for building DTO out of JSON.
-class json_input_t
+//! A name of a field passed to a binder.
+/*!
+ * A name made from an array of const chars (usually a string literal)
+ * is considered static, as rapidjson::StringRef considers it. Such a name
+ * is referenced by the path of an error without a copy. Names made
+ * from a modifiable buffer or from string_ref_t (for example, built in
+ * json_io() at run-time) are copied into the path.
+ *
+ * @since v.0.3.5
+ */
+class field_name_t : public string_ref_t
 {
-	public:
-		json_input_t( const rapidjson::Value & object )
-			:	m_object{ object }
-		{}
+public:
+	template< rapidjson::SizeType N >
+	field_name_t( const char (&name)[ N ] ) noexcept
+		:	string_ref_t{ name }
+		,	m_is_static{ true }
+	{}
 
-		template< typename Binder >
-		json_input_t &
-		operator & ( const Binder & b )
-		{
-			b.read_from( m_object );
-			return *this;
-		}
+	template< rapidjson::SizeType N >
+	field_name_t( char (&name)[ N ] ) noexcept
+		:	string_ref_t{ name }
+	{}
 
-	private:
-		const rapidjson::Value & m_object;
+	field_name_t( string_ref_t name ) noexcept
+		:	string_ref_t{ name }
+	{}
+
+	//! Does the name live until the end of the program?
+	bool
+	is_static() const noexcept { return m_is_static; }
+
+private:
+	bool m_is_static{ false };
 };
 
 //
-// json_output_t
+// error_code_t
 //
 
-//! Input object for building JSON out of DTO.
-class json_output_t
+//! Kinds of errors of reading and writing.
+/*!
+ * @since v.0.3.5
+ */
+enum class error_code_t
 {
-	public:
-		json_output_t(
-			rapidjson::Value & object,
-			rapidjson::MemoryPoolAllocator<> & allocator )
-			:	m_object{ object }
-			,	m_allocator{ allocator }
-		{
-			m_object.SetObject();
-		}
+	//! There is no error.
+	ok,
+	//! JSON is not valid.
+	parse_error,
+	//! A JSON value has an unexpected type.
+	type_mismatch,
+	//! A value doesn't fit into the target type.
+	out_of_range,
+	//! A mandatory field doesn't exist.
+	missing_field,
+	//! A null value for a non-nullable field.
+	null_value,
+	//! An unexpected count of items.
+	invalid_size,
+	//! A value is rejected by a validator.
+	validation_failed,
+	//! An error of writing of JSON.
+	write_failed,
+	//! Any other error (for example, an exception from user code).
+	other
+};
 
-		template< typename Binder >
-		json_output_t &
-		operator & ( const Binder & b )
-		{
+//
+// error_path_item_t
+//
+
+//! An element of the path to a value that can't be read or written.
+/*!
+ * It's a name of a field, a key of a map-like container or an index
+ * of an item of an array.
+ *
+ * Static names of fields (see field_name_t) are referenced. Other names
+ * of fields and keys are copied, because they can be built in json_io()
+ * or taken from the JSON text and an error outlives them.
+ *
+ * @since v.0.3.5
+ */
+class error_path_item_t
+{
+public:
+	enum class kind_t
+	{
+		//! A field of DTO.
+		field,
+		//! A key of a map-like container.
+		key,
+		//! An index of an item of an array.
+		index
+	};
+
+	//! Make an item for a field.
+	/*!
+	 * The name is copied only if it isn't static.
+	 */
+	static error_path_item_t
+	field( const field_name_t & name )
+	{
+		if( !name.is_static() )
+			return copied( kind_t::field, name );
+
+		error_path_item_t item{ kind_t::field };
+		item.m_name = name.s;
+		item.m_length = name.length;
+
+		return item;
+	}
+
+	//! Make an item for a field or a key. The name is copied.
+	static error_path_item_t
+	copied( kind_t kind, string_ref_t name )
+	{
+		error_path_item_t item{ kind };
+		item.m_copy.assign( name.s, name.length );
+
+		return item;
+	}
+
+	//! Make an item for an item of an array.
+	static error_path_item_t
+	index( std::size_t index ) noexcept
+	{
+		error_path_item_t item{ kind_t::index };
+		item.m_index = index;
+
+		return item;
+	}
+
+	kind_t
+	kind() const noexcept { return m_kind; }
+
+	//! The name of a field or a key (empty for an index).
+	string_ref_t
+	name() const noexcept
+	{
+		return m_name ?
+				string_ref_t{ m_name, m_length } :
+				make_string_ref( m_copy );
+	}
+
+	//! The index of an item of an array.
+	std::size_t
+	index() const noexcept { return m_index; }
+
+private:
+	explicit error_path_item_t( kind_t kind ) noexcept : m_kind{ kind } {}
+
+	kind_t m_kind;
+	//! A static name of a field.
+	const char * m_name{ nullptr };
+	rapidjson::SizeType m_length{ 0u };
+	//! A copy of a non-static name.
+	std::string m_copy;
+	std::size_t m_index{ 0u };
+};
+
+//
+// error_info_t
+//
+
+/*!
+ * @brief A description of an error of reading or writing.
+ *
+ * It's returned by try_from_json() and try_to_json() and is held by ex_t.
+ * An empty object (with error_code_t::ok) means that there is no error.
+ *
+ * The path to the failed value is stored as a stack of names of fields
+ * and indices of items. Text representations of the path are created
+ * only by message() and json_pointer().
+ *
+ * @since v.0.3.5
+ */
+class error_info_t
+{
+public:
+	error_info_t() = default;
+
+	error_info_t( error_code_t code, std::string description )
+		:	m_code{ code }
+		,	m_description{ std::move(description) }
+	{}
+
+	//! Is there an error?
+	explicit operator bool() const noexcept
+	{
+		return error_code_t::ok != m_code;
+	}
+
+	//! The kind of the error.
+	error_code_t
+	code() const noexcept { return m_code; }
+
+	//! The description of the error without the path to the value.
+	const std::string &
+	description() const noexcept { return m_description; }
+
+	//! The offset in the JSON text (0 if it's unknown).
+	/*!
+	 * It's known for parse errors and for errors of SAX-based reading.
+	 */
+	std::size_t
+	offset() const noexcept { return m_offset; }
+
+	void
+	set_offset( std::size_t offset ) noexcept { m_offset = offset; }
+
+	//! Has the error occurred during writing?
+	bool
+	on_writing() const noexcept { return m_on_writing; }
+
+	//! The number of items in the path to the failed value.
+	std::size_t
+	path_size() const noexcept { return m_path.size(); }
+
+	//! The path from the outermost value to the failed one.
+	std::vector< error_path_item_t >
+	path() const
+	{
+		return { m_path.rbegin(), m_path.rend() };
+	}
+
+	//! The path as RFC 6901 JSON Pointer (for example, "/items/2/name").
+	std::string
+	json_pointer() const
+	{
+		std::string result;
+		for( auto it = m_path.rbegin(); it != m_path.rend(); ++it )
+		{
+			result += '/';
+			if( error_path_item_t::kind_t::index == it->kind() )
+				result += std::to_string( it->index() );
+			else
+			{
+				const auto name = it->name();
+				for( const char * c = name.s; c != name.s + name.length; ++c )
+				{
+					if( '~' == *c )
+						result += "~0";
+					else if( '/' == *c )
+						result += "~1";
+					else
+						result += *c;
+				}
+			}
+		}
+
+		return result;
+	}
+
+	//! The full message, the same as the message of ex_t.
+	/*!
+	 * Only names of fields are included into the message.
+	 */
+	std::string
+	message() const
+	{
+		std::string result;
+		for( auto it = m_path.rbegin(); it != m_path.rend(); ++it )
+		{
+			if( error_path_item_t::kind_t::field != it->kind() )
+				continue;
+
+			const auto name = it->name();
+			result += m_on_writing ?
+					"error writing field \"" : "error reading field \"";
+			result.append( name.s, name.length );
+			result += "\": ";
+		}
+		result += m_description;
+
+		return result;
+	}
+
+	//! Add an element to the path.
+	/*!
+	 * Elements are added from the failed value to the outermost one.
+	 */
+	void
+	add_to_path( error_path_item_t item )
+	{
+		if( m_path.empty() )
+			m_path.reserve( 8u );
+		m_path.push_back( std::move(item) );
+	}
+
+	//! Add a name of the field that contains the failed value.
+	void
+	add_field( const field_name_t & name, bool on_writing )
+	{
+		add_to_path( error_path_item_t::field( name ) );
+		m_on_writing = on_writing;
+	}
+
+	//! Add a key of an item of a map-like container.
+	void
+	add_key( string_ref_t key )
+	{
+		add_to_path( error_path_item_t::copied(
+				error_path_item_t::kind_t::key, key ) );
+	}
+
+	//! Add an index of an item of an array.
+	void
+	add_index( std::size_t index )
+	{
+		add_to_path( error_path_item_t::index( index ) );
+	}
+
+private:
+	error_code_t m_code{ error_code_t::ok };
+	std::string m_description;
+	std::size_t m_offset{ 0u };
+	//! Items from the failed value to the outermost one.
+	std::vector< error_path_item_t > m_path;
+	bool m_on_writing{ false };
+};
+
+//
+// ex_t
+//
+
+//! Errors reading json data.
+/*!
+ * Since v.0.3.5 the path to the failed value is stored in error_info_t
+ * and the full message is created by what() on the first call.
+ *
+ * The path grows while the exception goes up through binders, so
+ * what() creates a new message if the path has been changed since
+ * the previous call. Messages are published atomically and are
+ * kept until the exception is destroyed, so what() can be called
+ * from several threads at the same time.
+ */
+class ex_t
+	:	public std::runtime_error
+{
+		typedef std::runtime_error base_type_t;
+
+	public:
+		ex_t( const std::string & error_desc )
+			:	base_type_t{ error_desc }
+			,	m_info{ error_code_t::other, error_desc }
+		{}
+
+		// Since v.0.3.5.
+		ex_t( error_code_t code, const std::string & error_desc )
+			:	base_type_t{ error_desc }
+			,	m_info{ code, error_desc }
+		{}
+
+		// Since v.0.3.5.
+		explicit ex_t( error_info_t info )
+			:	base_type_t{ info.description() }
+			,	m_info{ std::move(info) }
+		{}
+
+		ex_t( const ex_t & other )
+			:	base_type_t{ other }
+			,	m_info{ other.m_info }
+		{}
+
+		ex_t &
+		operator=( const ex_t & other )
+		{
+			if( this != &other )
+			{
+				base_type_t::operator=( other );
+				m_info = other.m_info;
+				release_messages( m_message.exchange( nullptr ) );
+			}
+
+			return *this;
+		}
+
+		~ex_t() override
+		{
+			release_messages( m_message.load() );
+		}
+
+		//! The kind of the error.
+		/*!
+		 * @since v.0.3.5
+		 */
+		error_code_t
+		code() const noexcept { return m_info.code(); }
+
+		//! The description of the error.
+		/*!
+		 * @since v.0.3.5
+		 */
+		const error_info_t &
+		info() const noexcept { return m_info; }
+
+		error_info_t &
+		info() noexcept { return m_info; }
+
+		const char *
+		what() const noexcept override
+		{
+			if( !m_info.path_size() )
+				return base_type_t::what();
+
+			try
+			{
+				return actual_message().c_str();
+			}
+			catch( ... )
+			{
+				return base_type_t::what();
+			}
+		}
+
+	private:
+		//! A message for a path of a particular size.
+		struct message_t
+		{
+			std::size_t m_path_size;
+			std::string m_text;
+			//! The message for the previous state of the path.
+			const message_t * m_previous;
+		};
+
+		error_info_t m_info;
+
+		//! The last created message.
+		mutable std::atomic< const message_t * > m_message{ nullptr };
+
+		static void
+		release_messages( const message_t * message ) noexcept
+		{
+			while( message )
+			{
+				const auto * previous = message->m_previous;
+				delete message;
+				message = previous;
+			}
+		}
+
+		const std::string &
+		actual_message() const
+		{
+			// The path only grows, so its size tells whether
+			// a message is up to date.
+			const auto path_size = m_info.path_size();
+
+			const message_t * last = m_message.load( std::memory_order_acquire );
+			if( last && path_size == last->m_path_size )
+				return last->m_text;
+
+			std::unique_ptr< message_t > created{
+					new message_t{ path_size, m_info.message(), last } };
+			while( !m_message.compare_exchange_weak(
+					last, created.get(),
+					std::memory_order_acq_rel,
+					std::memory_order_acquire ) )
+			{
+				// The message is created by another thread.
+				if( last && path_size == last->m_path_size )
+					return last->m_text;
+
+				created->m_previous = last;
+			}
+
+			return created.release()->m_text;
+		}
+};
+
+namespace details
+{
+
+namespace member_index
+{
+
+class lookup_t;
+
+template< typename Binder >
+void
+read_member(
+	const Binder & b,
+	const rapidjson::Value & object,
+	lookup_t * lookup );
+
+template< typename Dto >
+void
+read_dto( const rapidjson::Value & object, Dto & v );
+
+} /* namespace member_index */
+
+namespace delta
+{
+
+template< typename Binder >
+void
+read_member( const Binder & b, const rapidjson::Value & object );
+
+} /* namespace delta */
+
+} /* namespace details */
+
+//
+// json_input_t
+//
+
+//! Input object for building DTO out of JSON.
+class json_input_t
+{
+	public:
+		json_input_t( const rapidjson::Value & object )
+			:	m_object{ object }
+		{}
+
+		//! Constructor for single-pass reading of object's members.
+		/*!
+		 * @since v.0.3.5
+		 */
+		json_input_t(
+			const rapidjson::Value & object,
+			details::member_index::lookup_t & lookup )
+			:	m_object{ object }
+			,	m_lookup{ &lookup }
+		{}
+
+		template< typename Binder >
+		json_input_t &
+		operator & ( const Binder & b )
+		{
+			details::member_index::read_member( b, m_object, m_lookup );
+			return *this;
+		}
+
+		//! Get the value that is being read.
+		/*!
+		 * @since v.0.3.5
+		 */
+		const rapidjson::Value &
+		object() const noexcept { return m_object; }
+
+	private:
+		const rapidjson::Value & m_object;
+
+		//! Values of members found in a single pass over the object.
+		/*!
+		 * Can be nullptr. Every binder looks for its member
+		 * via FindMember in that case.
+		 */
+		details::member_index::lookup_t * m_lookup{ nullptr };
+};
+
+//
+// json_output_t
+//
+
+//! Input object for building JSON out of DTO.
+class json_output_t
+{
+	public:
+		json_output_t(
+			rapidjson::Value & object,
+			rapidjson::MemoryPoolAllocator<> & allocator )
+			:	m_object{ object }
+			,	m_allocator{ allocator }
+		{
+			m_object.SetObject();
+		}
+
+		template< typename Binder >
+		json_output_t &
+		operator & ( const Binder & b )
+		{
 			b.write_to( m_object, m_allocator );
 			return *this;
 		}
@@ -591,4820 +1501,15554 @@ mutable_map_key_t<T>
 mutable_map_key( T & v ) noexcept { return { v }; };
 
 //
-// default_reader_writer_t
+// string_view_t
 //
-// NOTE: implementation is going below.
 /*!
- * @brief The default implementation of Reader_Writer.
+ * @brief A non-owning reference to a string.
  *
- * This implementation simply calls read_json_value and write_json_value
- * functions.
+ * A field of this type receives a pointer to the string inside
+ * the parsed document (or inside the buffer for in-situ parsing)
+ * instead of a copy of the string. So reading of such a field doesn't
+ * allocate memory.
  *
- * @since v.0.2.10
+ * @attention
+ * The value is valid only while the source of the string is alive.
+ * It means that DTOs with such fields should be read from a document
+ * that is kept by the caller, by from_json_insitu from a buffer that is
+ * kept by the caller, or by make_parsed(). Functions that destroy
+ * the source before the return reject such DTOs at compile time.
+ *
+ * Unlike string_ref_t it's default-constructible and assignable, so it
+ * can be used as a type of a field.
+ *
+ * @since v.0.3.5
  */
-struct default_reader_writer_t
+class string_view_t
 {
-	template< typename Field_Type >
-	void
-	read( Field_Type & v, const rapidjson::Value & from ) const;
+public:
+	constexpr string_view_t() noexcept = default;
 
-	template< typename Field_Type >
-	void
-	write(
-		const Field_Type & v,
-		rapidjson::Value & to,
-		rapidjson::MemoryPoolAllocator<> & allocator ) const;
-};
+	constexpr string_view_t( const char * data, std::size_t size ) noexcept
+		:	m_data{ data }
+		,	m_size{ size }
+	{}
 
-//
-// reader functions.
-//
+	// NOTE: it's explicit to avoid ambiguity between overloads
+	// for std::string and string_view_t.
+	explicit string_view_t( const char * str ) noexcept
+		:	string_view_t{ str, std::strlen( str ) }
+	{}
 
-#define RW_JSON_VALUES( type, checker, getter, setter ) \
-inline void \
-read_json_value( type & v, const rapidjson::Value & object ) \
-{ \
-	if( object. checker () ) \
-		v = object. getter (); \
-	else \
-		throw ex_t{ "value is not " #type }; \
-} \
-inline void \
-write_json_value( type v, rapidjson::Value & object, rapidjson::MemoryPoolAllocator<> & ) \
-{\
-	object. setter ( v ); \
-}
+	string_view_t( const std::string & str ) noexcept
+		:	string_view_t{ str.data(), str.size() }
+	{}
 
-//
-// BOOL
-//
+#if defined( JSON_DTO_SUPPORTS_STD_STRING_VIEW )
+	// NOTE: it's explicit to avoid ambiguity between comparison
+	// operators for std::string_view and string_view_t.
+	constexpr explicit string_view_t( std::string_view str ) noexcept
+		:	string_view_t{ str.data(), str.size() }
+	{}
 
-RW_JSON_VALUES( bool, IsBool, GetBool, SetBool )
+	constexpr operator std::string_view() const noexcept
+	{
+		return { m_data, m_size };
+	}
+#endif
 
-//
-// NUMBER
-//
+	constexpr const char *
+	data() const noexcept { return m_data; }
 
-RW_JSON_VALUES( std::uint32_t, IsUint, GetUint, SetUint )
-RW_JSON_VALUES( std::int32_t, IsInt, GetInt, SetInt )
+	constexpr std::size_t
+	size() const noexcept { return m_size; }
 
-RW_JSON_VALUES( std::uint64_t, IsUint64, GetUint64, SetUint64 )
-RW_JSON_VALUES( std::int64_t, IsInt64, GetInt64, SetInt64 )
+	constexpr bool
+	empty() const noexcept { return 0u == m_size; }
 
-RW_JSON_VALUES( float, IsNumber, GetFloat, SetFloat )
-RW_JSON_VALUES( double, IsNumber, GetDouble, SetDouble )
+	constexpr const char *
+	begin() const noexcept { return m_data; }
 
-//
-// uint16
-//
+	constexpr const char *
+	end() const noexcept { return m_data + m_size; }
 
-inline void
-read_json_value(
-	std::uint16_t & v,
-	const rapidjson::Value & object )
-{
-	std::uint32_t value;
-	read_json_value( value, object );
+	//! Make a copy of the string.
+	std::string
+	to_string() const { return std::string( m_data, m_size ); }
 
-	if( value <= std::uint32_t(std::numeric_limits< std::uint16_t >::max()) )
-		v = std::uint16_t( value );
-	else
-		throw ex_t{ "value is out of uint16: " + std::to_string( value ) };
-}
+	//! Comparison like std::string::compare().
+	int
+	compare( string_view_t other ) const noexcept
+	{
+		const auto common = m_size < other.m_size ? m_size : other.m_size;
+		const int r = common ? std::memcmp( m_data, other.m_data, common ) : 0;
+		if( r )
+			return r;
 
-inline void
-write_json_value(
-	std::uint16_t v,
-	rapidjson::Value & object,
-	rapidjson::MemoryPoolAllocator<> & allocator )
+		return m_size == other.m_size ? 0 : ( m_size < other.m_size ? -1 : 1 );
+	}
+
+private:
+	const char * m_data{ nullptr };
+	std::size_t m_size{ 0u };
+};
+
+inline bool
+operator==( string_view_t a, string_view_t b ) noexcept
 {
-	const std::uint32_t value = v;
-	write_json_value( value, object, allocator );
+	return a.size() == b.size() && 0 == a.compare( b );
 }
 
-//
-// int16
-//
-
-inline void
-read_json_value( std::int16_t & v, const rapidjson::Value & object )
+inline bool
+operator!=( string_view_t a, string_view_t b ) noexcept
 {
-	std::int32_t value;
-	read_json_value( value, object );
+	return !( a == b );
+}
 
-	if( value <= std::int32_t(std::numeric_limits< std::int16_t >::max()) &&
-		value >= std::int32_t(std::numeric_limits< std::int16_t >::min()) )
-		v = std::int16_t( value );
-	else
-		throw ex_t{ "value is out of int16: " + std::to_string( value ) };
+inline bool
+operator==( string_view_t a, const char * b ) noexcept
+{
+	return a == string_view_t{ b };
 }
 
-inline void
-write_json_value(
-	std::int16_t v,
-	rapidjson::Value & object,
-	rapidjson::MemoryPoolAllocator<> & allocator )
+inline bool
+operator==( const char * a, string_view_t b ) noexcept
 {
-	const std::int32_t value = v;
-	write_json_value( value, object, allocator );
+	return string_view_t{ a } == b;
 }
 
-//
-// uint8
-//
+inline bool
+operator!=( string_view_t a, const char * b ) noexcept
+{
+	return !( a == b );
+}
 
-inline void
-read_json_value(
-	std::uint8_t & v,
-	const rapidjson::Value & object )
+inline bool
+operator!=( const char * a, string_view_t b ) noexcept
 {
-	std::uint32_t value;
-	read_json_value( value, object );
+	return !( a == b );
+}
 
-	if( value <= std::uint32_t(std::numeric_limits< std::uint8_t >::max()) )
-		v = std::uint8_t( value );
-	else
-		throw ex_t{ "value is out of uint8: " + std::to_string( value ) };
+inline bool
+operator<( string_view_t a, string_view_t b ) noexcept
+{
+	return a.compare( b ) < 0;
 }
 
-inline void
-write_json_value(
-	std::uint8_t v,
-	rapidjson::Value & object,
-	rapidjson::MemoryPoolAllocator<> & allocator )
+inline std::ostream &
+operator<<( std::ostream & to, string_view_t v )
 {
-	const std::uint32_t value = v;
-	write_json_value( value, object, allocator );
+	return to.write( v.data(), static_cast< std::streamsize >( v.size() ) );
 }
 
+namespace details
+{
+
 //
-// int8
+// value_copy_t
 //
-
-inline void
-read_json_value( std::int8_t & v, const rapidjson::Value & object )
+/*!
+ * @brief A deep copy of rapidjson::Value with its own allocator.
+ *
+ * Strings are always copied, so the copy doesn't refer to the source
+ * even if the source was parsed in-situ.
+ *
+ * @since v.0.3.5
+ */
+class value_copy_t
 {
-	std::int32_t value;
-	read_json_value( value, object );
+public:
+	explicit value_copy_t( const rapidjson::Value & source )
+		// Most of copies are small, the default chunk is 64KiB.
+		:	m_allocator{ 1024u }
+	{
+		copy( source, m_value );
+	}
 
-	if( value <= std::int32_t(std::numeric_limits< std::int8_t >::max()) &&
-		value >= std::int32_t(std::numeric_limits< std::int8_t >::min()) )
-		v = std::int8_t( value );
-	else
-		throw ex_t{ "value is out of int8: " + std::to_string( value ) };
-}
+	value_copy_t( const value_copy_t & ) = delete;
+	value_copy_t &
+	operator=( const value_copy_t & ) = delete;
 
-inline void
-write_json_value(
-	std::int8_t v,
-	rapidjson::Value & object,
-	rapidjson::MemoryPoolAllocator<> & allocator )
-{
-	const std::int32_t value = v;
-	write_json_value( value, object, allocator );
-}
+	const rapidjson::Value &
+	value() const noexcept { return m_value; }
+
+private:
+	rapidjson::MemoryPoolAllocator<> m_allocator;
+	rapidjson::Value m_value;
+
+	void
+	copy( const rapidjson::Value & from, rapidjson::Value & to )
+	{
+		switch( from.GetType() )
+		{
+			case rapidjson::kObjectType:
+				to.SetObject();
+				for( auto it = from.MemberBegin(); it != from.MemberEnd(); ++it )
+				{
+					rapidjson::Value name;
+					rapidjson::Value value;
+					copy( it->name, name );
+					copy( it->value, value );
+					to.AddMember( name, value, m_allocator );
+				}
+			break;
+
+			case rapidjson::kArrayType:
+				to.SetArray();
+				to.Reserve( from.Size(), m_allocator );
+				for( auto it = from.Begin(); it != from.End(); ++it )
+				{
+					rapidjson::Value value;
+					copy( *it, value );
+					to.PushBack( value, m_allocator );
+				}
+			break;
+
+			case rapidjson::kStringType:
+				to.SetString( from.GetString(), from.GetStringLength(), m_allocator );
+			break;
+
+			default:
+				to.CopyFrom( from, m_allocator );
+			break;
+		}
+	}
+};
+
+} /* namespace details */
 
 //
-// STRING
+// raw_json_t
 //
-
-inline void
-read_json_value( std::string & s, const rapidjson::Value & object )
+/*!
+ * @brief A JSON value that is kept as text without parsing.
+ *
+ * A field of this type is used for forwarding of subtrees that aren't
+ * interpreted by the application. from_json_sax() copies the exact
+ * slice of the source for objects and arrays, without building
+ * rapidjson::Value for them. SAX-based writers (to_json_sax(),
+ * to_stream_sax()) emit the text verbatim via RawValue().
+ *
+ * DOM-based readers, from_stream_sax() and SAX-based reading of scalars
+ * keep a copy of the parsed rapidjson::Value instead of the text. Such
+ * a copy is written by DOM-based writers without parsing and by SAX-based
+ * writers without serialization into a temporary text. str() returns
+ * the compact form of it.
+ *
+ * DOM-based writers parse the text into rapidjson::Value.
+ *
+ * An empty raw_json_t is written as null.
+ *
+ * Usage example:
+ * @code
+ * struct envelope_t
+ * {
+ * 	std::string m_route;
+ * 	json_dto::raw_json_t m_payload;
+ *
+ * 	template< typename Json_Io >
+ * 	void json_io( Json_Io & io )
+ * 	{
+ * 		io & json_dto::mandatory( "route", m_route )
+ * 			& json_dto::mandatory( "payload", m_payload );
+ * 	}
+ * };
+ *
+ * auto envelope = json_dto::from_json_sax< envelope_t >( incoming );
+ * outgoing = json_dto::to_json_sax( envelope );
+ * @endcode
+ *
+ * @attention
+ * The text isn't validated by the writers. It has to be a single valid
+ * JSON value.
+ *
+ * @since v.0.3.5
+ */
+class raw_json_t
 {
-	if( object.IsString() )
-		s = object.GetString();
-	else
-		throw ex_t{ "value is not std::string" };
-}
+public:
+	raw_json_t() = default;
 
-inline void
-write_json_value(
-	const std::string & s,
-	rapidjson::Value & object,
-	rapidjson::MemoryPoolAllocator<> & allocator )
-{
-	constexpr std::string::size_type max_str_len = std::numeric_limits< rapidjson::SizeType >::max();
+	explicit raw_json_t( std::string json )
+		:	m_json{ std::move(json) }
+	{}
 
-	if( max_str_len < s.size() )
+	//! Make a copy of @a value.
+	explicit raw_json_t( const rapidjson::Value & value )
 	{
-		throw ex_t{ "string length is too large: " + std::to_string( s.size() ) +
-					" (max is " + std::to_string( max_str_len ) + ")" };
+		assign( value );
 	}
 
-	object.SetString( s.data(), static_cast< rapidjson::SizeType >( s.size() ), allocator );
+	//! The text of the value.
+	/*!
+	 * A copy of rapidjson::Value is serialized on every call.
+	 */
+	std::string
+	str() const
+	{
+		if( !m_value )
+			return m_json;
+
+		rapidjson::StringBuffer buffer;
+		rapidjson::Writer< rapidjson::StringBuffer > writer{ buffer };
+		m_value->value().Accept( writer );
+
+		return std::string{ buffer.GetString(), buffer.GetSize() };
+	}
+
+	//! The text of the value if it's kept as text.
+	/*!
+	 * It's empty if a copy of rapidjson::Value is kept.
+	 */
+	const std::string &
+	text() const noexcept { return m_json; }
+
+	//! The copy of rapidjson::Value if it's kept.
+	/*!
+	 * It's nullptr if the value is kept as text.
+	 */
+	const rapidjson::Value *
+	value() const noexcept { return m_value ? &m_value->value() : nullptr; }
+
+	bool
+	empty() const noexcept { return m_json.empty() && !m_value; }
+
+	void
+	assign( const char * data, std::size_t size )
+	{
+		m_json.assign( data, size );
+		m_value.reset();
+	}
+
+	//! Keep a copy of @a value.
+	void
+	assign( const rapidjson::Value & value )
+	{
+		m_value = std::make_shared< const details::value_copy_t >( value );
+		m_json.clear();
+	}
+
+	void
+	clear() noexcept
+	{
+		m_json.clear();
+		m_value.reset();
+	}
+
+	//! Compare with @a value without building of C++ objects.
+	/*!
+	 * The text is parsed for the comparison if the value is kept as text.
+	 */
+	bool
+	equals( const rapidjson::Value & value ) const
+	{
+		if( m_value )
+			return m_value->value() == value;
+		if( m_json.empty() )
+			return value.IsNull();
+
+		rapidjson::Document document;
+		document.Parse( m_json.data(), m_json.size() );
+		return !document.HasParseError() && document == value;
+	}
+
+	//! Type of the value for RapidJSON's writers.
+	/*!
+	 * It's detected by the first char of the text.
+	 */
+	rapidjson::Type
+	type() const noexcept
+	{
+		if( m_value )
+			return m_value->value().GetType();
+
+		const char first = m_json.empty() ? 'n' : m_json.front();
+		switch( first )
+		{
+			case '{': return rapidjson::kObjectType;
+			case '[': return rapidjson::kArrayType;
+			case '"': return rapidjson::kStringType;
+			case 't': return rapidjson::kTrueType;
+			case 'f': return rapidjson::kFalseType;
+			case 'n': return rapidjson::kNullType;
+			default: return rapidjson::kNumberType;
+		}
+	}
+
+private:
+	std::string m_json;
+
+	//! A copy of the value from a DOM-based reader.
+	/*!
+	 * It's never modified, so it's shared by copies of raw_json_t.
+	 */
+	std::shared_ptr< const details::value_copy_t > m_value;
+};
+
+/*!
+ * Texts are compared as is. A copy of rapidjson::Value is compared
+ * with a text by parsing of the text.
+ */
+inline bool
+operator==( const raw_json_t & a, const raw_json_t & b )
+{
+	if( const auto * value = b.value() )
+		return a.equals( *value );
+	if( const auto * value = a.value() )
+		return b.equals( *value );
+
+	return a.text() == b.text();
 }
 
-// Since v.0.2.10.
-inline void
-write_json_value(
-	const rapidjson::Value::StringRefType & s,
-	rapidjson::Value & object,
-	rapidjson::MemoryPoolAllocator<> & allocator )
+inline bool
+operator!=( const raw_json_t & a, const raw_json_t & b )
 {
-	// NOTE: there is no check for max_str_len as for std::string version
-	// because s.length has type rapidjson::SizeType.
-	object.SetString( s.s, s.length, allocator );
+	return !( a == b );
 }
 
 //
-// const- and mutable map keys
+// reuse_mode_t
 //
 
-// Since v.0.2.11.
-template< typename T >
-void
-read_json_value(
-	mutable_map_key_t<T> key,
-	const rapidjson::Value & object )
+namespace details
 {
-	read_json_value( key.v, object );
+
+//! The flag of reuse mode for the current thread.
+/*!
+ * @since v.0.3.5
+ */
+inline bool &
+reuse_mode_flag() noexcept
+{
+	static thread_local bool flag{ false };
+	return flag;
 }
 
-// Since v.0.2.11.
-template< typename T >
-void
-write_json_value(
-	const_map_key_t<T> key,
-	rapidjson::Value & object,
-	rapidjson::MemoryPoolAllocator<> & allocator )
+} /* namespace details */
+
+/*!
+ * @brief Reuse mode for reading into already constructed objects.
+ *
+ * By default readers of containers clear a container and construct
+ * new items, and readers of nullable_t/std::optional construct a new
+ * value. While an instance of reuse_mode_t exists, the readers
+ * called on the current thread overwrite existing objects in place
+ * instead:
+ *
+ * - existing items of std::vector and other sequence containers are
+ *   overwritten, containers only grow or shrink at the tail;
+ * - existing values of map-like containers are overwritten if their keys
+ *   are present in JSON. Other entries are removed;
+ * - existing values of nullable_t and std::optional are overwritten.
+ *
+ * So memory of nested containers and strings is reused and reading of
+ * a long-lived object doesn't allocate in a steady state.
+ *
+ * Usage example:
+ * @code
+ * worker_state_t state;
+ * for( const auto & message : incoming_messages )
+ * {
+ * 	json_dto::reuse_mode_t reuse;
+ * 	json_dto::from_json( message, state );
+ * 	...
+ * }
+ * @endcode
+ *
+ * @attention
+ * Fields of items are overwritten only if they are present in JSON
+ * (or have default values). A field that is read by optional_no_default()
+ * and is missing in JSON keeps the value of the previous item.
+ *
+ * @note
+ * The mode affects DOM-based reading only (from_json, from_stream,
+ * from_json_insitu and reading via parse_context_t). Items of set-like
+ * containers are immutable, so these containers are always rebuilt.
+ *
+ * @since v.0.3.5
+ */
+class reuse_mode_t
 {
-	write_json_value( key.v, object, allocator );
-}
+public:
+	reuse_mode_t() noexcept
+		:	m_previous{ details::reuse_mode_flag() }
+	{
+		details::reuse_mode_flag() = true;
+	}
+
+	reuse_mode_t( const reuse_mode_t & ) = delete;
+	reuse_mode_t &
+	operator=( const reuse_mode_t & ) = delete;
+
+	~reuse_mode_t() noexcept
+	{
+		details::reuse_mode_flag() = m_previous;
+	}
+
+	//! Is reuse mode turned on for the current thread?
+	static bool
+	active() noexcept { return details::reuse_mode_flag(); }
+
+private:
+	const bool m_previous;
+};
 
 //
-// JSON
+// merge_patch_mode_t
 //
 
-inline void
-read_json_value( rapidjson::Document & d, const rapidjson::Value & object )
+namespace details
 {
-	d.CopyFrom( object, d.GetAllocator() );
+
+//! The flag of merge patch mode for the current thread.
+/*!
+ * @since v.0.3.5
+ */
+inline bool &
+merge_patch_mode_flag() noexcept
+{
+	static thread_local bool flag{ false };
+	return flag;
 }
 
-inline void
-write_json_value(
-	const rapidjson::Document & d,
-	rapidjson::Value & object,
-	rapidjson::MemoryPoolAllocator<> & allocator )
+} /* namespace details */
+
+/*!
+ * @brief Mode for applying JSON Merge Patch (RFC 7386) to existing objects.
+ *
+ * While an instance of merge_patch_mode_t exists, reading of DTOs on
+ * the current thread changes only fields that are present in JSON:
+ *
+ * - a missing member leaves the field untouched (even for mandatory
+ *   fields);
+ * - null removes the field: nullable_t and std::optional are reset,
+ *   other fields are handled like missing members in the usual reading
+ *   (an optional field receives its default value, a mandatory field
+ *   leads to an error);
+ * - an object patches a nested DTO, an existing value of nullable_t or
+ *   std::optional, or a map-like container (null removes an entry of
+ *   the container) in place;
+ * - other values (including arrays) replace the field. They are read
+ *   in the usual way.
+ *
+ * So an update costs O(size of patch) instead of a full round trip.
+ *
+ * Usage example:
+ * @code
+ * settings_t settings = load_settings();
+ * {
+ * 	json_dto::merge_patch_mode_t merge_patch;
+ * 	json_dto::from_json( R"({"log":{"level":"debug"},"proxy":null})",
+ * 			settings );
+ * }
+ * @endcode
+ *
+ * @note
+ * The mode affects DOM-based reading only (from_json, from_stream,
+ * from_json_insitu and reading via parse_context_t). Multimaps are
+ * replaced. Patched fields are validated after the update.
+ *
+ * @since v.0.3.5
+ */
+class merge_patch_mode_t
 {
-	object.CopyFrom( d, allocator );
+public:
+	merge_patch_mode_t() noexcept
+		:	m_previous{ details::merge_patch_mode_flag() }
+	{
+		details::merge_patch_mode_flag() = true;
+	}
+
+	merge_patch_mode_t( const merge_patch_mode_t & ) = delete;
+	merge_patch_mode_t &
+	operator=( const merge_patch_mode_t & ) = delete;
+
+	~merge_patch_mode_t() noexcept
+	{
+		details::merge_patch_mode_flag() = m_previous;
+	}
+
+	//! Is merge patch mode turned on for the current thread?
+	static bool
+	active() noexcept { return details::merge_patch_mode_flag(); }
+
+private:
+	const bool m_previous;
+};
+
+namespace details
+{
+
+//! The receiver of an error for the current thread.
+/*!
+ * It's not null only inside try_from_json() and try_to_json(). It's
+ * hidden while user's code is reading values (see owned_read_t).
+ *
+ * @since v.0.3.5
+ */
+inline error_info_t *&
+error_sink() noexcept
+{
+	static thread_local error_info_t * sink{ nullptr };
+	return sink;
 }
 
-#if defined( JSON_DTO_SUPPORTS_STD_OPTIONAL )
-//
-// std::optional
-//
-template< typename T, typename Reader_Writer = default_reader_writer_t >
-inline void
-read_json_value(
-	cpp17::optional<T> & v,
-	const rapidjson::Value & object,
-	Reader_Writer reader_writer = Reader_Writer{} );
+//! Has an error already been registered by try_from_json()/try_to_json()?
+/*!
+ * @since v.0.3.5
+ */
+inline bool
+error_registered() noexcept
+{
+	const auto * sink = error_sink();
+	return sink && *sink;
+}
 
-template< typename T, typename Reader_Writer = default_reader_writer_t >
-inline void
-write_json_value(
-	const cpp17::optional<T> & v,
-	rapidjson::Value & object,
-	rapidjson::MemoryPoolAllocator<> & allocator,
-	Reader_Writer reader_writer = Reader_Writer{} );
-#endif
+//! Get the description of an error from an exception.
+/*!
+ * @since v.0.3.5
+ */
+inline error_info_t
+error_info_of( const std::exception & ex )
+{
+	if( const auto * e = dynamic_cast< const ex_t * >( &ex ) )
+		return e->info();
 
-//
-// ARRAY
-//
+	return error_info_t{ error_code_t::other, ex.what() };
+}
 
-template< typename T, typename A, typename Reader_Writer = default_reader_writer_t >
-void
-read_json_value(
-	std::vector< T, A > & vec,
-	const rapidjson::Value & object,
-	const Reader_Writer & reader_writer = Reader_Writer{} );
+} /* namespace details */
 
-template< typename T, typename A, typename Reader_Writer = default_reader_writer_t >
-void
-write_json_value(
-	const std::vector< T, A > & vec,
-	rapidjson::Value & object,
-	rapidjson::MemoryPoolAllocator<> & allocator,
-	const Reader_Writer & reader_writer = Reader_Writer{} );
+/*!
+ * @brief Report an error of reading or writing.
+ *
+ * Usually it throws ex_t. But inside try_from_json() and try_to_json()
+ * the first error is stored and the function returns if it's called
+ * from reading functions of json_dto that are called by json_dto itself
+ * (json_dto checks for an error right after such a call). Reading
+ * functions called from user's code (for example, from a custom
+ * Reader_Writer or from a user-defined read_json_value) throw ex_t as
+ * usual. So a caller has to return after the call:
+ * @code
+ * void read( my_type & v, const rapidjson::Value & from ) const
+ * {
+ * 	if( !from.IsString() )
+ * 	{
+ * 		json_dto::report_error(
+ * 				json_dto::error_code_t::type_mismatch, "value is not a string" );
+ * 		return;
+ * 	}
+ * 	...
+ * }
+ * @endcode
+ *
+ * This function is used by json_dto itself and can be used by
+ * custom Reader_Writers.
+ *
+ * @since v.0.3.5
+ */
+inline void
+report_error( error_info_t error )
+{
+	auto * sink = details::error_sink();
+	if( !sink )
+		throw ex_t{ std::move(error) };
 
-//
-// STL-like non-associative containers.
-//
-template< typename C, typename Reader_Writer = default_reader_writer_t >
-std::enable_if_t<
-		details::meta::is_stl_like_sequence_container<C>::value,
-		void >
-read_json_value(
-	C & cnt,
-	const rapidjson::Value & object,
-	const Reader_Writer & reader_writer = Reader_Writer{} );
+	// Only the first error is stored.
+	if( !*sink )
+		*sink = std::move(error);
+}
 
-template< typename C, typename Reader_Writer = default_reader_writer_t >
-std::enable_if_t<
-		details::meta::is_stl_like_sequence_container<C>::value,
-		void >
-write_json_value(
-	const C & cnt,
-	rapidjson::Value & object,
-	rapidjson::MemoryPoolAllocator<> & allocator,
-	const Reader_Writer & reader_writer = Reader_Writer{} );
+/*!
+ * @brief Report an error with a code and a description.
+ *
+ * @since v.0.3.5
+ */
+inline void
+report_error( error_code_t code, std::string description )
+{
+	report_error( error_info_t{ code, std::move(description) } );
+}
 
-//
-// STL-set-like associative containers.
-//
-template< typename C, typename Reader_Writer = default_reader_writer_t >
-std::enable_if_t<
-		details::meta::is_stl_set_like_associative_container<C>::value,
-		void >
-read_json_value(
-	C & cnt,
-	const rapidjson::Value & object,
-	const Reader_Writer & reader_writer = Reader_Writer{} );
+/*!
+ * @brief Report an error with a static description.
+ *
+ * The string for the description isn't created if an error has
+ * already been stored inside try_from_json()/try_to_json().
+ *
+ * @since v.0.3.5
+ */
+inline void
+report_error( error_code_t code, const char * description )
+{
+	if( !details::error_registered() )
+		report_error( code, std::string{ description } );
+}
 
-template< typename C, typename Reader_Writer = default_reader_writer_t >
-std::enable_if_t<
-		details::meta::is_stl_set_like_associative_container<C>::value,
-		void >
-write_json_value(
-	const C & cnt,
-	rapidjson::Value & object,
-	rapidjson::MemoryPoolAllocator<> & allocator,
-	const Reader_Writer & reader_writer = Reader_Writer{} );
+namespace details
+{
 
 //
-// STL-map-like associative containers.
+// Reading of values owned by json_dto.
 //
-template< typename C, typename Reader_Writer = default_reader_writer_t >
-std::enable_if_t<
-		details::meta::is_stl_map_like_associative_container<C>::value,
-		void >
-read_json_value(
-	C & cnt,
-	const rapidjson::Value & object,
-	const Reader_Writer & reader_writer = default_reader_writer_t{} );
-
-template< typename C, typename Reader_Writer = default_reader_writer_t >
-std::enable_if_t<
-		details::meta::is_stl_map_like_associative_container<C>::value,
-		void >
-write_json_value(
-	const C & cnt,
-	rapidjson::Value & object,
-	rapidjson::MemoryPoolAllocator<> & allocator,
-	const Reader_Writer & reader_writer = Reader_Writer{} );
-
+// Inside try_from_json() errors are stored instead of being thrown
+// only by reading functions that are called by json_dto itself for
+// a particular value. json_dto marks the value before the call
+// (owned_read_t) and the reading function checks the mark at the
+// entry (reading_scope_t). Any other call (for example, from a custom
+// Reader_Writer) is done with the sink hidden, so errors are thrown
+// there as before.
 //
-// nullable_t
+// Since v.0.3.5.
 //
 
-//! A wrapper for nullable fields.
-template< typename Field_Type >
-struct nullable_t
+//! Unique identifier of a type.
+template< typename T >
+const void *
+type_tag() noexcept
 {
-	nullable_t() noexcept
-		:	m_has_value{ false }
-	{}
+	static char tag;
+	return &tag;
+}
 
-	nullable_t( std::nullptr_t ) noexcept
-		:	m_has_value{ false }
-	{}
+//! The value that is going to be read by json_dto itself.
+struct owned_value_t
+{
+	const void * m_value;
+	const void * m_type;
+	//! The sink that has to be used while the value is being read.
+	error_info_t * m_sink;
+};
 
-	explicit nullable_t( Field_Type value )
-		noexcept( noexcept( Field_Type{std::move(value)} ) )
-		:	m_has_value{ true }
-	{
-		new( m_image_space ) Field_Type{ std::move( value ) };
-	}
+inline owned_value_t &
+owned_value() noexcept
+{
+	static thread_local owned_value_t value{ nullptr, nullptr, nullptr };
+	return value;
+}
 
-	nullable_t( const nullable_t & other )
-		noexcept( noexcept( Field_Type{other.field_ref()} ) )
-		:	m_has_value{ other.m_has_value }
+/*!
+ * @brief Marker of a value that json_dto is going to read.
+ *
+ * The sink is hidden until a reading function of json_dto for that
+ * value is entered. If @a owned is false then the value is read by
+ * user's code and the sink stays hidden.
+ */
+class owned_read_t
+{
+public:
+	template< typename T >
+	owned_read_t( T & v, bool owned ) noexcept
+		:	m_sink{ error_sink() }
 	{
-		if( has_value() )
-			new( m_image_space ) Field_Type{ other.field_ref() };
+		if( m_sink )
+		{
+			m_previous = owned_value();
+			owned_value() = owned ?
+					owned_value_t{ &v, type_tag< T >(), m_sink } :
+					owned_value_t{ nullptr, nullptr, nullptr };
+			error_sink() = nullptr;
+		}
 	}
 
-	nullable_t( nullable_t && other )
-		noexcept( noexcept( Field_Type{std::move(other.field_ref())} ) )
-		:	m_has_value{ other.m_has_value }
-	{
-		if( has_value() )
-			new( m_image_space ) Field_Type{ std::move( other.field_ref() ) };
-	}
+	owned_read_t( const owned_read_t & ) = delete;
+	owned_read_t &
+	operator=( const owned_read_t & ) = delete;
 
-	// Constructor to be used for initialization of the value.
-	//
-	// Usage example:
-	//
-	// 	const std::string base{ "0123456789xyz" };
-	// 	size_t pos = 5;
-	// 	size_t len = 4;
-	// 	json_dto::nullable_t< std::string > str{ base, pos, len };
-	//
-	template<
-		typename... Args,
-		// NOTE: to avoid calling of this constructor when Args is 'nullable_t &'.
-		typename T = std::enable_if_t<
-			!( 1u == sizeof...(Args) &&
-				std::is_same<
-					std::decay_t< details::meta::head_of_t<Args...> >,
-					nullable_t >::value )
-		>
-	>
-	explicit nullable_t( Args &&... args )
-		noexcept( noexcept( Field_Type{std::forward< Args >( args )...} ) )
-		:	m_has_value{ true }
+	~owned_read_t() noexcept
 	{
-		new( m_image_space ) Field_Type{ std::forward< Args >( args )... };
+		if( m_sink )
+		{
+			error_sink() = m_sink;
+			owned_value() = m_previous;
+		}
 	}
 
-	~nullable_t()
+private:
+	error_info_t * const m_sink;
+	owned_value_t m_previous{ nullptr, nullptr, nullptr };
+};
+
+/*!
+ * @brief The entry of a reading function of json_dto.
+ *
+ * The sink is visible inside the function only if json_dto has
+ * marked the value by owned_read_t.
+ */
+class reading_scope_t
+{
+public:
+	template< typename T >
+	explicit reading_scope_t( const T & v ) noexcept
+		:	m_previous{ error_sink() }
 	{
-		reset();
+		auto & owned = owned_value();
+		if( owned.m_sink )
+		{
+			const bool matched = &v == owned.m_value &&
+					type_tag< T >() == owned.m_type;
+			error_sink() = matched ? owned.m_sink : nullptr;
+			owned = owned_value_t{ nullptr, nullptr, nullptr };
+			m_changed = true;
+		}
+		else if( m_previous )
+		{
+			error_sink() = nullptr;
+			m_changed = true;
+		}
 	}
 
-	bool
-	has_value() const noexcept
+	reading_scope_t( const reading_scope_t & ) = delete;
+	reading_scope_t &
+	operator=( const reading_scope_t & ) = delete;
+
+	~reading_scope_t() noexcept
 	{
-		return m_has_value;
+		if( m_changed )
+			error_sink() = m_previous;
 	}
 
-	operator bool () const noexcept
+private:
+	error_info_t * const m_previous;
+	bool m_changed{ false };
+};
+
+} /* namespace details */
+
+namespace details
+{
+
+//! Is there an error stored in @a sink?
+/*!
+ * @since v.0.3.5
+ */
+inline bool
+has_failed( const error_info_t * sink ) noexcept
+{
+	return sink && *sink;
+}
+
+/*!
+ * @brief Add an element to the path of the error that is being handled.
+ *
+ * It has to be called from a catch block. ex_t is rethrown after
+ * @a add_item is applied to it, any other exception is converted into ex_t.
+ * Inside try_from_json()/try_to_json() the exception is stored in @a sink
+ * instead.
+ *
+ * @since v.0.3.5
+ */
+template< typename Add_Item >
+void
+handle_current_exception( error_info_t * sink, Add_Item && add_item )
+{
+	try
 	{
-		return has_value();
+		throw;
 	}
-
-	void
-	swap( nullable_t & other )
-		noexcept( noexcept( Field_Type{ std::move(other.field_ref()) } ) )
+	catch( ex_t & ex )
 	{
-		if( m_has_value && other.m_has_value )
-		{
-			std::swap( field_ref(), other.field_ref() );
-		}
-		else if( !m_has_value && other.m_has_value )
+		if( !sink )
 		{
-			new( m_image_space ) Field_Type{ std::move( other.field_ref() ) };
-			m_has_value = true;
-			other.reset();
+			add_item( ex.info() );
+			throw;
 		}
-		else if( m_has_value && !other.m_has_value )
+
+		// An exception from user's code.
+		if( !*sink )
+			*sink = ex.info();
+	}
+	catch( const std::exception & ex )
+	{
+		if( !sink )
 		{
-			other.swap( *this );
+			ex_t error{ error_code_t::other, ex.what() };
+			add_item( error.info() );
+			throw error;
 		}
-		// Both objects has no value: do nothing.
+
+		if( !*sink )
+			*sink = error_info_of( ex );
 	}
 
-	nullable_t &
-	operator = ( const nullable_t & other )
-	{
-		nullable_t temp{ other };
-		swap( temp );
+	add_item( *sink );
+}
 
-		return *this;
-	}
+/*!
+ * @brief Run @a action and add an element to the path of an error.
+ *
+ * Inside try_from_json()/try_to_json() @a add_item is applied to the
+ * stored error. @a action isn't called if an error is already stored.
+ *
+ * There are no string operations until a message is requested.
+ *
+ * @since v.0.3.5
+ */
+template< typename Action, typename Add_Item >
+void
+with_error_path( Action && action, Add_Item && add_item )
+{
+	auto * sink = error_sink();
+	if( has_failed( sink ) )
+		return;
 
-	nullable_t &
-	operator = ( nullable_t && other )
-		noexcept(
-			noexcept( nullable_t{ std::move(other) } ) &&
-			noexcept( this->swap( other ) ) )
+	try
 	{
-		nullable_t temp{ std::move( other ) };
-		swap( temp );
-
-		return *this;
+		action();
 	}
-
-	nullable_t &
-	operator = ( const Field_Type & value )
+	catch( ... )
 	{
-		nullable_t temp{ value };
-		swap( temp );
-
-		return *this;
+		handle_current_exception( sink, add_item );
+		return;
 	}
 
-	nullable_t &
-	operator = ( Field_Type && value )
-		noexcept(
-			noexcept( nullable_t{ std::move(value) } ) &&
-			noexcept( this->swap( *this ) ) )
-	{
-		nullable_t temp{ std::move( value ) };
-		swap( temp );
+	if( has_failed( sink ) )
+		add_item( *sink );
+}
 
-		return *this;
-	}
+//! Call @a action for indices of items from 0 to @a size.
+/*!
+ * The index of the failed item is added to the path of an error.
+ * Reading is stopped at the first error.
+ *
+ * @note
+ * @a action is received by value and the index is a local variable,
+ * so they stay in registers in the loop.
+ *
+ * @since v.0.3.5
+ */
+template< typename Action >
+void
+for_each_index( rapidjson::SizeType size, Action action )
+{
+	auto * sink = error_sink();
+	if( has_failed( sink ) )
+		return;
 
-	nullable_t &
-	operator = ( std::nullptr_t ) noexcept
+	rapidjson::SizeType i = 0u;
+	try
 	{
-		reset();
-		return *this;
+		// Errors are reported by exceptions if there is no sink.
+		if( !sink )
+			for( ; i != size; ++i )
+				action( i );
+		else
+			for( ; i != size; ++i )
+			{
+				action( i );
+				if( *sink )
+				{
+					sink->add_index( i );
+					return;
+				}
+			}
 	}
-
-	const Field_Type*
-	operator -> () const noexcept
+	catch( ... )
 	{
-		return field_ptr();
+		handle_current_exception( sink,
+				[i]( error_info_t & error ) { error.add_index( i ); } );
 	}
+}
 
-	Field_Type*
-	operator -> () noexcept
+//! Call @a action for all members of @a object.
+/*!
+ * The key of the failed member is added to the path of an error.
+ * Reading is stopped at the first error.
+ *
+ * @since v.0.3.5
+ */
+template< typename Action >
+void
+for_each_member( const rapidjson::Value & object, Action action )
+{
+	auto * sink = error_sink();
+	if( has_failed( sink ) )
+		return;
+
+	const auto add_key = []( const rapidjson::Value & name ) {
+		return [&name]( error_info_t & error ) {
+				error.add_key( string_ref_t{
+						name.GetString(), name.GetStringLength() } );
+			};
+	};
+
+	auto it = object.MemberBegin();
+	const auto end = object.MemberEnd();
+	try
 	{
-		return field_ptr();
+		if( !sink )
+			for( ; it != end; ++it )
+				action( *it );
+		else
+			for( ; it != end; ++it )
+			{
+				action( *it );
+				if( *sink )
+				{
+					add_key( it->name )( *sink );
+					return;
+				}
+			}
+	}
+	catch( ... )
+	{
+		handle_current_exception( sink, add_key( it->name ) );
 	}
+}
 
-	const Field_Type &
-	operator * () const noexcept
+} /* namespace details */
+
+//
+// Instrumentation of fields.
+//
+
+namespace instrumentation
+{
+
+//! The current offset in the JSON text that is being written.
+/*!
+ * @since v.0.3.5
+ */
+struct text_position_t
+{
+	//! The stream the text is written to.
+	const void * m_stream;
+	//! Function that returns the size of the text in @a m_stream.
+	std::size_t (*m_size)( const void * );
+
+	std::size_t
+	offset() const { return m_size( m_stream ); }
+};
+
+//! Description of a field that is being read or written.
+/*!
+ * @since v.0.3.5
+ */
+struct field_context_t
+{
+	//! Name of the field.
+	string_ref_t m_field_name;
+	//! Is the field being written?
+	bool m_on_writing;
+	//! JSON object the field is read from.
+	/*!
+	 * It's nullptr if the field isn't read from a DOM object.
+	 */
+	const rapidjson::Value * m_source;
+	//! JSON object the field is written to.
+	/*!
+	 * It's nullptr if the field isn't written to a DOM object.
+	 */
+	const rapidjson::Value * m_target;
+	//! The offset in the JSON text the field is written to.
+	/*!
+	 * It's nullptr if the field isn't written directly to a text
+	 * (for example, to_json() writes fields into a DOM object that
+	 * is serialized later).
+	 */
+	const text_position_t * m_position;
+	//! Size of the JSON text the field has been read from.
+	/*!
+	 * It's known for fields read by from_json_sax() only (it's 0
+	 * otherwise). The parser has already passed the value when the field
+	 * is read, so the size is taken from offsets in the input text before
+	 * the call. It includes the name of the field and separators.
+	 */
+	std::size_t m_source_size;
+};
+
+} /* namespace instrumentation */
+
+//! Instrumentation policy that does nothing.
+/*!
+ * It's used by default. A custom policy is specified by
+ * JSON_DTO_INSTRUMENTATION_POLICY macro and has to be defined before
+ * inclusion of json_dto/pub.hpp. It has to have the same static methods:
+ * on_dto() is called around reading/writing of a DTO, on_field() is called
+ * around reading/writing of every field with instrumentation::field_context_t.
+ * Both must call @a action.
+ *
+ * @note
+ * DTOs read by from_json_sax() are read by events of the parser,
+ * so on_dto() is called around every step of reading of such DTO
+ * and on_field() is called when the value of a field has been parsed
+ * completely (it doesn't include the time of parsing).
+ *
+ * @since v.0.3.5
+ */
+struct no_instrumentation_t
+{
+	template< typename Dto, typename Action >
+	static void
+	on_dto( Action && action )
 	{
-		return field_ref();
+		action();
 	}
 
-	Field_Type&
-	operator * () noexcept
+	template< typename Field_Context, typename Action >
+	static void
+	on_field( const Field_Context &, Action && action )
 	{
-		return field_ref();
+		action();
 	}
+};
 
-	bool
-	operator == ( const nullable_t & other ) const
+#if defined( JSON_DTO_INSTRUMENTATION )
+
+namespace instrumentation
+{
+
+//! Aggregated statistics of a field.
+/*!
+ * @since v.0.3.5
+ */
+struct field_stats_t
+{
+	//! Count of reads or writes.
+	std::uint64_t m_calls{ 0u };
+	//! Total time. It includes the time of nested fields.
+	std::uint64_t m_nanoseconds{ 0u };
+	//! Total size of JSON text produced or consumed.
+	/*!
+	 * It's known for fields written by to_json_sax() and read by
+	 * from_json_sax() only. It's the difference between offsets in
+	 * the text, so it includes the name of the field and separators.
+	 */
+	std::uint64_t m_bytes{ 0u };
+	//! Total count of allocations.
+	/*!
+	 * It's counted only if registry_t::set_allocation_counter() is called.
+	 */
+	std::uint64_t m_allocations{ 0u };
+
+	field_stats_t &
+	operator+=( const field_stats_t & o ) noexcept
 	{
-		return
-			has_value() &&
-			other.has_value() &&
-			field_ref() == other.field_ref();
+		m_calls += o.m_calls;
+		m_nanoseconds += o.m_nanoseconds;
+		m_bytes += o.m_bytes;
+		m_allocations += o.m_allocations;
+		return *this;
 	}
+};
+
+//! Statistics of a field of some DTO type.
+/*!
+ * @since v.0.3.5
+ */
+struct field_record_t
+{
+	//! Name of DTO type as returned by std::type_info::name().
+	std::string m_dto_type;
+	std::string m_field_name;
+	bool m_on_writing;
+	field_stats_t m_stats;
+};
 
+namespace details
+{
+
+//! Statistics collected by one thread.
+/*!
+ * Fields are found by a hash of the DTO type and the content of
+ * the name, so names of fields aren't copied for every record.
+ * The mutex is locked by other threads only inside registry_t::snapshot()
+ * and registry_t::reset().
+ *
+ * @since v.0.3.5
+ */
+class shard_t
+{
+public:
 	void
-	emplace()
+	add(
+		const std::type_info & dto_type,
+		string_ref_t field_name,
+		bool on_writing,
+		const field_stats_t & stats )
 	{
-		*this = Field_Type{};
+		const auto hash = hash_of( dto_type, field_name, on_writing );
+
+		std::lock_guard< std::mutex > lock{ m_lock };
+
+		if( 2u * ( m_size + 1u ) > m_entries.size() )
+			grow();
+
+		auto & entry = m_entries[ find( hash, dto_type, field_name, on_writing ) ];
+		if( !entry.m_dto_type )
+		{
+			entry.m_hash = hash;
+			entry.m_dto_type = &dto_type;
+			entry.m_field_name.assign( field_name.s, field_name.length );
+			entry.m_on_writing = on_writing;
+			++m_size;
+		}
+
+		entry.m_stats += stats;
 	}
 
+	//! Call @a f( dto_type, field_name, on_writing, stats ) for every field.
+	template< typename F >
 	void
-	emplace( Field_Type value )
+	for_each( F && f ) const
 	{
-		*this = std::move( value );
+		std::lock_guard< std::mutex > lock{ m_lock };
+		for( const auto & e : m_entries )
+			if( e.m_dto_type )
+				f( *e.m_dto_type, e.m_field_name, e.m_on_writing, e.m_stats );
 	}
 
 	void
-	reset() noexcept
+	clear()
 	{
-		if( has_value() )
-		{
-			m_has_value = false;
-			field_ref().~Field_Type();
-		}
+		std::lock_guard< std::mutex > lock{ m_lock };
+		m_entries.clear();
+		m_size = 0u;
 	}
 
-	private:
-		alignas( alignof( Field_Type ) ) char m_image_space[ sizeof( Field_Type ) ];
-		bool m_has_value{ false };
+private:
+	struct entry_t
+	{
+		std::size_t m_hash{ 0u };
+		//! nullptr for an empty entry.
+		const std::type_info * m_dto_type{ nullptr };
+		std::string m_field_name;
+		bool m_on_writing{ false };
+		field_stats_t m_stats;
+	};
 
-		Field_Type *
-		field_ptr() noexcept
-		{
-			return JSON_DTO_STD_LAUNDER( reinterpret_cast< Field_Type * >( m_image_space ) );
-		}
+	mutable std::mutex m_lock;
+	//! Hash table with open addressing. Its size is a power of 2.
+	std::vector< entry_t > m_entries;
+	std::size_t m_size{ 0u };
 
-		const Field_Type *
-		field_ptr() const noexcept
-		{
-			return JSON_DTO_STD_LAUNDER( reinterpret_cast< const Field_Type * >( m_image_space ) );
-		}
+	static std::size_t
+	hash_of(
+		const std::type_info & dto_type,
+		string_ref_t field_name,
+		bool on_writing ) noexcept
+	{
+		// FNV-1a over the name.
+		auto h = static_cast< std::size_t >( 2166136261u ) ^
+				dto_type.hash_code() ^ ( on_writing ? 1u : 0u );
+		for( std::size_t i = 0u; i != field_name.length; ++i )
+			h = ( h ^ static_cast< unsigned char >( field_name.s[ i ] ) ) *
+					static_cast< std::size_t >( 16777619u );
+		return h;
+	}
 
-		Field_Type &
-		field_ref() noexcept
+	//! Index of the entry for a field or of an empty entry for it.
+	std::size_t
+	find(
+		std::size_t hash,
+		const std::type_info & dto_type,
+		string_ref_t field_name,
+		bool on_writing ) const noexcept
+	{
+		const auto mask = m_entries.size() - 1u;
+		for( auto i = hash & mask;; i = ( i + 1u ) & mask )
 		{
-			return *field_ptr();
+			const auto & e = m_entries[ i ];
+			if( !e.m_dto_type ||
+					( e.m_hash == hash &&
+						e.m_on_writing == on_writing &&
+						*e.m_dto_type == dto_type &&
+						e.m_field_name.size() == field_name.length &&
+						0 == std::memcmp(
+							e.m_field_name.data(), field_name.s, field_name.length ) ) )
+				return i;
 		}
+	}
 
-		const Field_Type &
-		field_ref() const noexcept
-		{
-			return *field_ptr();
-		}
+	void
+	grow()
+	{
+		std::vector< entry_t > old( m_entries.empty() ? 16u : m_entries.size() * 2u );
+		old.swap( m_entries );
+
+		const auto mask = m_entries.size() - 1u;
+		for( auto & e : old )
+			if( e.m_dto_type )
+			{
+				auto i = e.m_hash & mask;
+				while( m_entries[ i ].m_dto_type )
+					i = ( i + 1u ) & mask;
+				m_entries[ i ] = std::move( e );
+			}
+	}
 };
 
-//
-// json_io
-//
+} /* namespace details */
 
-//! Standard io for DTO objects.
+//! Storage of statistics for all DTO types and fields.
 /*!
-	It is possible to implement specifications for a concrete DTO type.
-	For example it allows to write non intrusive json_io adapters.
-*/
-template< typename Io, typename Dto >
-void
-json_io( Io & io, Dto & dto )
-{
-	dto.json_io( io );
-}
-
-//
-// Nested DTO helpers.
-//
-
-template< typename Dto >
-std::enable_if_t<
-		!details::meta::is_stl_like_container<Dto>::value,
-		void >
-read_json_value(
-	Dto & v,
-	const rapidjson::Value & object )
-{
-	json_input_t input( object );
-	json_io( input, v );
-}
-
-template< typename Dto >
-std::enable_if_t<
-		!details::meta::is_stl_like_container<Dto>::value,
-		void >
-write_json_value(
-	const Dto & v,
-	rapidjson::Value & object,
-	rapidjson::MemoryPoolAllocator<> & allocator )
+ * It's thread-safe. Every thread accumulates statistics in its own
+ * shard, the shards are merged by snapshot().
+ *
+ * @since v.0.3.5
+ */
+class registry_t
 {
-	json_output_t ouput( object, allocator );
-	json_io( ouput, const_cast< Dto & >( v ) );
-}
+public:
+	//! Function that returns the total count of allocations.
+	using allocation_counter_t = std::uint64_t (*)();
 
-//
-// RW specializations for nullable_t< T >
-//
+	//! Set a function for counting of allocations.
+	/*!
+	 * json_dto doesn't count allocations by itself. A program can
+	 * count them in replacements of operator new or malloc and provide
+	 * the counter here.
+	 */
+	void
+	set_allocation_counter( allocation_counter_t counter ) noexcept
+	{
+		m_allocation_counter.store( counter, std::memory_order_relaxed );
+	}
 
-template<
-	typename Field_Type,
-	typename Reader_Writer = default_reader_writer_t >
-void
-read_json_value(
-	nullable_t< Field_Type > & f,
-	const rapidjson::Value & object,
-	Reader_Writer reader_writer = Reader_Writer{} )
-{
-	if( !object.IsNull() )
+	std::uint64_t
+	allocations() const
 	{
-		Field_Type value;
-		reader_writer.read( value, object );
-		f = std::move( value );
+		const auto counter = m_allocation_counter.load(
+				std::memory_order_relaxed );
+		return counter ? counter() : 0u;
 	}
-	else
-		f.reset();
-}
 
-template<
-	typename Field_Type,
-	typename Reader_Writer = default_reader_writer_t >
-void
-write_json_value(
-	const nullable_t< Field_Type > & f,
-	rapidjson::Value & object,
-	rapidjson::MemoryPoolAllocator<> & allocator,
-	Reader_Writer reader_writer = Reader_Writer{} )
-{
-	if( f )
+	void
+	add(
+		const std::type_info & dto_type,
+		string_ref_t field_name,
+		bool on_writing,
+		const field_stats_t & stats )
 	{
-		reader_writer.write( *f, object, allocator );
+		local_shard().add( dto_type, field_name, on_writing, stats );
 	}
-	else
+
+	//! Get statistics of all fields.
+	/*!
+	 * The most expensive fields go first.
+	 */
+	std::vector< field_record_t >
+	snapshot() const
 	{
-		object.SetNull();
+		fields_t fields;
+		{
+			std::lock_guard< std::mutex > lock{ m_lock };
+			fields = m_retired;
+			for( const auto & shard : m_shards )
+				shard->for_each( [&fields](
+						const std::type_info & dto_type,
+						const std::string & field_name,
+						bool on_writing,
+						const field_stats_t & stats ) {
+					merge( fields, dto_type, field_name, on_writing, stats );
+				} );
+		}
+
+		std::vector< field_record_t > result;
+		result.reserve( fields.size() );
+		for( const auto & f : fields )
+			result.push_back( field_record_t{
+					f.first.m_dto_type.name(),
+					f.first.m_field_name,
+					f.first.m_on_writing,
+					f.second } );
+
+		std::stable_sort( result.begin(), result.end(),
+				[]( const field_record_t & a, const field_record_t & b ) {
+					return a.m_stats.m_nanoseconds > b.m_stats.m_nanoseconds;
+				} );
+
+		return result;
 	}
-}
 
-#if defined( JSON_DTO_SUPPORTS_STD_OPTIONAL )
-//
-// std::optional
-//
-template< typename T, typename Reader_Writer >
-inline void
-read_json_value(
-	cpp17::optional<T> & v,
-	const rapidjson::Value & object,
-	Reader_Writer reader_writer )
-{
-	T value_from_stream;
-	reader_writer.read( value_from_stream, object );
-	v = std::move(value_from_stream);
-}
+	//! Remove all statistics.
+	void
+	reset()
+	{
+		std::lock_guard< std::mutex > lock{ m_lock };
+		m_retired.clear();
+		for( const auto & shard : m_shards )
+			shard->clear();
+	}
 
-template< typename T, typename Reader_Writer >
-inline void
-write_json_value(
-	const cpp17::optional<T> & v,
-	rapidjson::Value & object,
-	rapidjson::MemoryPoolAllocator<> & allocator,
-	Reader_Writer reader_writer )
-{
-	if( v )
-		reader_writer.write( *v, object, allocator );
-}
-#endif
+private:
+	struct key_t
+	{
+		std::type_index m_dto_type;
+		std::string m_field_name;
+		bool m_on_writing;
+	};
 
-//
-// ARRAY
-//
+	// It allows to find a field without a copy of its name.
+	struct key_view_t
+	{
+		std::type_index m_dto_type;
+		const std::string & m_field_name;
+		bool m_on_writing;
+	};
 
-template< typename T, typename A, typename Reader_Writer >
-void
-read_json_value(
-	std::vector< T, A > & vec,
-	const rapidjson::Value & object,
-	const Reader_Writer & reader_writer )
-{
-	if( object.IsArray() )
+	struct key_less_t
 	{
-		vec.clear();
-		vec.reserve( object.Size() );
-		for( rapidjson::SizeType i = 0; i < object.Size(); ++i )
+		using is_transparent = void;
+
+		template< typename A, typename B >
+		bool
+		operator()( const A & a, const B & b ) const noexcept
 		{
-			T v;
-			reader_writer.read( v, object[ i ] );
-			vec.push_back( std::move(v) );
+			if( a.m_dto_type != b.m_dto_type )
+				return a.m_dto_type < b.m_dto_type;
+			if( a.m_on_writing != b.m_on_writing )
+				return a.m_on_writing < b.m_on_writing;
+
+			return a.m_field_name < b.m_field_name;
 		}
-	}
-	else
-		throw ex_t{ "value is not an array" };
-}
+	};
 
-namespace details
-{
+	using fields_t = std::map< key_t, field_stats_t, key_less_t >;
 
-template< typename T >
-struct std_vector_item_read_access_type
-{
-	using type = const T&;
-};
+	using shard_ptr_t = std::shared_ptr< details::shard_t >;
 
-// since v.0.2.3
-// std::vector<bool> must be processed different way.
-template<>
-struct std_vector_item_read_access_type<bool>
-{
-	using type = const bool;
-};
+	mutable std::mutex m_lock;
+	//! Shards of all threads that used the registry.
+	std::vector< shard_ptr_t > m_shards;
+	//! Statistics from shards of finished threads.
+	fields_t m_retired;
+	std::atomic< allocation_counter_t > m_allocation_counter{ nullptr };
 
-} /* namespace details */
+	//! Unique id of the registry for thread-local lists of shards.
+	/*!
+	 * An address isn't used because another registry can be created
+	 * at the address of a destroyed one.
+	 */
+	const std::uint64_t m_id{ next_id() };
 
-template< typename T, typename A, typename Reader_Writer >
-void
-write_json_value(
-	const std::vector< T, A > & vec,
-	rapidjson::Value & object,
-	rapidjson::MemoryPoolAllocator<> & allocator,
-	const Reader_Writer & reader_writer )
-{
-	object.SetArray();
-	for( typename details::std_vector_item_read_access_type<T>::type v : vec )
+	static std::uint64_t
+	next_id() noexcept
 	{
-		rapidjson::Value o;
-		reader_writer.write( v, o, allocator );
-		object.PushBack( o, allocator );
+		static std::atomic< std::uint64_t > last{ 0u };
+		return ++last;
 	}
-}
 
-//
-// STL-like non-associative containers.
-//
-template< typename C, typename Reader_Writer >
-std::enable_if_t<
-		details::meta::is_stl_like_sequence_container<C>::value,
-		void >
-read_json_value(
-	C & cnt,
-	const rapidjson::Value & object,
-	const Reader_Writer & reader_writer )
-{
-	if( object.IsArray() )
+	static void
+	merge(
+		fields_t & fields,
+		const std::type_info & dto_type,
+		const std::string & field_name,
+		bool on_writing,
+		const field_stats_t & stats )
 	{
-		cnt.clear();
-		details::sequence_containers::container_filler_t<C> filler{ cnt };
+		const key_view_t key{ std::type_index{ dto_type }, field_name, on_writing };
+
+		auto it = fields.find( key );
+		if( fields.end() == it )
+			it = fields.emplace(
+					key_t{ key.m_dto_type, field_name, on_writing },
+					field_stats_t{} ).first;
+
+		it->second += stats;
+	}
 
-		for( rapidjson::SizeType i = 0; i < object.Size(); ++i )
+	details::shard_t &
+	local_shard()
+	{
+		struct local_t
 		{
-			typename C::value_type v;
-			reader_writer.read( v, object[ i ] );
-			filler.emplace_back( std::move(v) );
+			std::uint64_t m_registry;
+			shard_ptr_t m_shard;
+		};
+
+		static thread_local std::vector< local_t > shards;
+
+		for( const auto & s : shards )
+			if( m_id == s.m_registry )
+				return *s.m_shard;
+
+		auto shard = std::make_shared< details::shard_t >();
+		{
+			std::lock_guard< std::mutex > lock{ m_lock };
+			retire_unused_shards();
+			m_shards.push_back( shard );
 		}
+		shards.push_back( local_t{ m_id, shard } );
+
+		return *shard;
 	}
-	else
-		throw ex_t{ "value is not an array" };
-}
 
-template< typename C, typename Reader_Writer >
-std::enable_if_t<
-		details::meta::is_stl_like_sequence_container<C>::value,
-		void >
-write_json_value(
-	const C & cnt,
-	rapidjson::Value & object,
-	rapidjson::MemoryPoolAllocator<> & allocator,
-	const Reader_Writer & reader_writer )
-{
-	object.SetArray();
-	for( const auto & v : cnt )
+	// Shards of finished threads are referenced by the registry only.
+	// Their statistics are moved to m_retired.
+	// NOTE: m_lock must be locked.
+	void
+	retire_unused_shards()
 	{
-		rapidjson::Value o;
-		reader_writer.write( v, o, allocator );
-		object.PushBack( o, allocator );
+		const auto unused = std::remove_if( m_shards.begin(), m_shards.end(),
+				[this]( const shard_ptr_t & shard ) {
+					if( 1 != shard.use_count() )
+						return false;
+
+					shard->for_each( [this](
+							const std::type_info & dto_type,
+							const std::string & field_name,
+							bool on_writing,
+							const field_stats_t & stats ) {
+						merge( m_retired, dto_type, field_name, on_writing, stats );
+					} );
+					return true;
+				} );
+		m_shards.erase( unused, m_shards.end() );
 	}
+};
+
+//! The registry used by collector_t.
+/*!
+ * @since v.0.3.5
+ */
+inline registry_t &
+registry()
+{
+	static registry_t instance;
+	return instance;
 }
 
-//
-// STL-set-like associative containers.
-//
-template< typename C, typename Reader_Writer >
-std::enable_if_t<
-		details::meta::is_stl_set_like_associative_container<C>::value,
-		void >
-read_json_value(
-	C & cnt,
-	const rapidjson::Value & object,
-	const Reader_Writer & reader_writer )
+namespace details
 {
-	if( !object.IsArray() )
-		throw ex_t{ "value can't be deserialized into std::set-like container!" };
-
-	cnt.clear();
-	for( rapidjson::SizeType i = 0; i < object.Size(); ++i )
-	{
-		typename C::value_type v;
-		reader_writer.read( v, object[ i ] );
-		cnt.emplace( std::move(v) );
-	}
-}
 
-/*
- * NOTE. There is no a special handling for multiset cases.
- * All values from the container are deserialized.
- *
- * It it possible to check for duplicates of keys in the containers.
- * But this check has performance penalty. So at v.0.2.8 there is no
- * such check.
- */
-template< typename C, typename Reader_Writer >
-std::enable_if_t<
-		details::meta::is_stl_set_like_associative_container<C>::value,
-		void >
-write_json_value(
-	const C & cnt,
-	rapidjson::Value & object,
-	rapidjson::MemoryPoolAllocator<> & allocator,
-	const Reader_Writer & reader_writer )
+inline const std::type_info *&
+current_dto() noexcept
 {
-	const auto write_item =
-			[&object, &allocator, &reader_writer]( const auto & v ) {
-				rapidjson::Value o;
-				reader_writer.write( v, o, allocator );
-				object.PushBack( o, allocator );
-			};
-
-	object.SetArray();
-	for( const auto & v : cnt )
-		write_item( v );
+	static thread_local const std::type_info * dto = nullptr;
+	return dto;
 }
 
-//
-// STL-map-like associative containers.
-//
-template< typename C, typename Reader_Writer >
-std::enable_if_t<
-		details::meta::is_stl_map_like_associative_container<C>::value,
-		void >
-read_json_value(
-	C & cnt,
-	const rapidjson::Value & object,
-	const Reader_Writer & reader_writer )
-{
-	if( !object.IsObject() )
-		throw ex_t{ "value can't be deserialized into std::map-like container!" };
-
-	cnt.clear();
-	for( auto it = object.MemberBegin(); it != object.MemberEnd(); ++it )
-	{
-		typename C::key_type key;
-		typename C::mapped_type value;
-
-		// It is necessary to have mutable_key_ref as a lvalue to pass
-		// a non-const reference to it to read() method of the reader_writer.
-		auto mutable_key_ref = mutable_map_key(key);
-		reader_writer.read( mutable_key_ref, it->name );
-		reader_writer.read( value, it->value );
-
-		cnt.emplace( typename C::value_type{ std::move(key), std::move(value) } );
-	}
-}
+} /* namespace details */
 
-/*
- * NOTE. There is no a special handling for multimap cases.
- * All values from the container are deserialized.
+//! Instrumentation policy that collects statistics into registry().
+/*!
+ * It's used if JSON_DTO_INSTRUMENTATION is defined. Statistics are
+ * recorded for successful reads and writes only.
  *
- * It it possible to check for duplicates of keys in the containers.
- * But this check has performance penalty. So at v.0.2.8 there is no
- * such check.
+ * @since v.0.3.5
  */
-template< typename C, typename Reader_Writer >
-std::enable_if_t<
-		details::meta::is_stl_map_like_associative_container<C>::value,
-		void >
-write_json_value(
-	const C & cnt,
-	rapidjson::Value & object,
-	rapidjson::MemoryPoolAllocator<> & allocator,
-	const Reader_Writer & reader_writer )
+struct collector_t
 {
-	const auto write_item =
-			[&object, &allocator, &reader_writer]( const auto & kv ) {
-				rapidjson::Value key;
-				rapidjson::Value value;
-
-				// It is necessary to have const_key_ref as a lvalue to pass a
-				// const reference to it to write() method of the reader_writer.
-				auto const_key_ref = const_map_key(kv.first);
-				reader_writer.write( const_key_ref, key, allocator );
-				reader_writer.write( kv.second, value, allocator );
-
-				object.AddMember( key, value, allocator );
-			};
+	template< typename Dto, typename Action >
+	static void
+	on_dto( Action && action )
+	{
+		struct scope_t
+		{
+			const std::type_info * m_parent;
 
-	object.SetObject();
-	for( const auto & kv : cnt )
-		write_item( kv );
-}
+			explicit scope_t( const std::type_info & dto ) noexcept
+				:	m_parent{ details::current_dto() }
+			{
+				details::current_dto() = &dto;
+			}
 
-//
-// Support for to_json/from_json for STL-like containers.
-// Since v.0.2.8
-//
-namespace details {
+			~scope_t() { details::current_dto() = m_parent; }
+		};
 
-template< typename C >
-struct stl_like_container_reader_t {
-	C & m_dest;
+		scope_t scope{ typeid( Dto ) };
+		action();
+	}
 
-	void
-	read_from( const rapidjson::Value & from ) const
+	template< typename Action >
+	static void
+	on_field( const field_context_t & field, Action && action )
 	{
-		read_json_value( m_dest, from );
+		auto & stats_registry = registry();
+
+		const auto * dto = details::current_dto();
+		const auto offset_before = field.m_position ?
+				field.m_position->offset() : 0u;
+		const auto allocations_before = stats_registry.allocations();
+		const auto started_at = std::chrono::steady_clock::now();
+
+		action();
+
+		const auto finished_at = std::chrono::steady_clock::now();
+
+		// An error is stored by try_from_json() or try_to_json().
+		if( ::json_dto::details::error_registered() )
+			return;
+
+		field_stats_t stats;
+		stats.m_calls = 1u;
+		stats.m_nanoseconds = static_cast< std::uint64_t >(
+				std::chrono::duration_cast< std::chrono::nanoseconds >(
+						finished_at - started_at ).count() );
+		stats.m_allocations = stats_registry.allocations() - allocations_before;
+		stats.m_bytes = field.m_position ?
+				field.m_position->offset() - offset_before :
+				field.m_source_size;
+
+		stats_registry.add(
+				dto ? *dto : typeid( void ),
+				field.m_field_name,
+				field.m_on_writing,
+				stats );
 	}
 };
 
-template< typename C >
-struct stl_like_container_writer_t {
-	const C & m_src;
+} /* namespace instrumentation */
 
-	void
-	write_to(
-		rapidjson::Value & to,
-		rapidjson::MemoryPoolAllocator<> & allocator ) const
-	{
-		write_json_value( m_src, to, allocator );
-	}
-};
+#endif
 
-} /* namespace details */
+//! The instrumentation policy used for all fields.
+/*!
+ * @since v.0.3.5
+ */
+using instrumentation_policy_t = JSON_DTO_INSTRUMENTATION_POLICY;
 
-template< typename C >
-std::enable_if_t<
-		details::meta::is_stl_like_container<C>::value,
-		void >
-json_io( json_input_t & from, C & what )
+namespace details
 {
-	from & details::stl_like_container_reader_t<C>{ what };
-}
 
-// NOTE: argument 'what' is not const.
-// It is required by implementation of operator<<() below.
-template< typename C >
-std::enable_if_t<
-		details::meta::is_stl_like_container<C>::value,
-		void >
-json_io( json_output_t & from, C & what )
+//! Run @a action for reading or writing of @a Dto.
+/*!
+ * @since v.0.3.5
+ */
+template< typename Dto, typename Action >
+void
+with_dto_instrumentation( Action && action )
 {
-	from & details::stl_like_container_writer_t<C>{ what };
+	instrumentation_policy_t::on_dto< Dto >( std::forward< Action >( action ) );
 }
 
+} /* namespace details */
+
 //
-// Funcs for handling nullable property.
+// default_reader_writer_t
 //
-
+// NOTE: implementation is going below.
 /*!
- * @brief Default handler of null value for non-nullable attribute.
+ * @brief The default implementation of Reader_Writer.
  *
- * Throws an exception because non-nullable attribute can't receive null value.
+ * This implementation simply calls read_json_value and write_json_value
+ * functions.
  *
- * Is has name `default_on_null` since v.0.3.0.
+ * @since v.0.2.10
  */
-template< typename Field_Type >
-void
-default_on_null( Field_Type & )
+struct default_reader_writer_t
+{
+	template< typename Field_Type >
+	void
+	read( Field_Type & v, const rapidjson::Value & from ) const;
+
+	template< typename Field_Type >
+	void
+	write(
+		const Field_Type & v,
+		rapidjson::Value & to,
+		rapidjson::MemoryPoolAllocator<> & allocator ) const;
+};
+
+namespace details
 {
-	throw ex_t{ "non nullable field is null" };
-}
 
+//! Is @a Reader_Writer a part of json_dto?
 /*!
- * @brief Default handler of null value for nullable attribute.
+ * Values read by such Reader_Writers are read by json_dto itself.
  *
- * Calls `reset` for @a f.
+ * @since v.0.3.5
+ */
+template< typename Reader_Writer >
+struct is_owned_reader_writer : public std::false_type {};
+
+template<>
+struct is_owned_reader_writer< default_reader_writer_t >
+	: public std::true_type {};
+
+//! Read @a v by @a reader_writer with a check for an error after the call.
+/*!
+ * Inside try_from_json() errors of json_dto's reading functions are
+ * stored without exceptions, the caller has to check for an error
+ * right after the call.
  *
- * It has name `default_on_null` since v.0.3.0.
+ * @since v.0.3.5
  */
-template< typename Field_Type >
+template< typename Reader_Writer, typename Field_Type >
 void
-default_on_null( nullable_t< Field_Type > & f )
+read_owned(
+	const Reader_Writer & reader_writer,
+	Field_Type & v,
+	const rapidjson::Value & from )
 {
-	f.reset();
+	const owned_read_t owned{
+			v, is_owned_reader_writer< Reader_Writer >::value };
+	reader_writer.read( v, from );
 }
 
-template< typename Field_Type, typename Field_Default_Value_Type >
+//! Read @a v by default_reader_writer_t.
+template< typename Field_Type >
 void
-set_default_value( Field_Type & f, Field_Default_Value_Type && default_value )
+read_owned( Field_Type & v, const rapidjson::Value & from )
 {
-	f = std::move( default_value );
+	read_owned( default_reader_writer_t{}, v, from );
 }
 
-template< typename Field_Type, typename Field_Default_Value_Type >
-void
-set_default_value(
-	nullable_t< Field_Type > & f,
-	Field_Default_Value_Type && default_value )
-{
-	f.emplace( std::move( default_value ) );
+} /* namespace details */
+
+//
+// reader functions.
+//
+
+#define RW_JSON_VALUES( type, checker, getter, setter ) \
+inline void \
+read_json_value( type & v, const rapidjson::Value & object ) \
+{ \
+	const details::reading_scope_t scope{ v }; \
+	if( object. checker () ) \
+		v = object. getter (); \
+	else \
+	{ \
+		report_error( error_code_t::type_mismatch, "value is not " #type ); \
+		v = type{}; \
+	} \
+} \
+inline void \
+write_json_value( type v, rapidjson::Value & object, rapidjson::MemoryPoolAllocator<> & ) \
+{\
+	object. setter ( v ); \
 }
 
 //
-// mandtatory_attr_t
+// BOOL
 //
 
-//! Field set/notset attribute ckecker for mandatory case.
-/*!
- * This class is intended to be used as Manopt_Policy trait
- * for field binders.
- */
-struct mandatory_attr_t
-{
-	template< typename Field_Type >
-	void
-	on_field_not_defined( Field_Type & ) const
-	{
-		throw ex_t{ "mandatory field doesn't exist" };
-	}
+RW_JSON_VALUES( bool, IsBool, GetBool, SetBool )
 
-	/*!
-	 * @note
-	 * Since v.0.3.0.
-	 */
-	template< typename Field_Type >
-	void
-	on_null( Field_Type & f ) const
-	{
-		// NOTE: directly use 'default_on_null' from json_dto namespace
-		// to avoid surprises with ADL.
-		json_dto::default_on_null( f );
-	}
+//
+// NUMBER
+//
 
-	template< typename Field_Type >
-	constexpr bool
-	is_default_value( Field_Type & ) const noexcept
-	{
-		return false;
-	}
-};
-
-//! Field set/notset attribute ckecker for mandatory field.
-/*!
- * It field value is 'null' in JSON then field will receive
- * default value.
- *
- * This class is intended to be used as Manopt_Policy trait
- * for field binders.
- *
- * @note
- * Type \a Field_Type has to be DefaultConstructible.
- *
- * @since v.0.3.0
- */
-struct mandatory_attr_with_null_as_default_t
-{
-	template< typename Field_Type >
-	void
-	on_field_not_defined( Field_Type & ) const
-	{
-		throw json_dto::ex_t{ "mandatory field doesn't exist" };
-	}
+RW_JSON_VALUES( std::uint32_t, IsUint, GetUint, SetUint )
+RW_JSON_VALUES( std::int32_t, IsInt, GetInt, SetInt )
 
-	template< typename Field_Type >
-	void
-	on_null( Field_Type & f ) const
-	{
-		static_assert( std::is_default_constructible<Field_Type>::value,
-				"type Field_Type has to be DefaultConstructible" );
+RW_JSON_VALUES( std::uint64_t, IsUint64, GetUint64, SetUint64 )
+RW_JSON_VALUES( std::int64_t, IsInt64, GetInt64, SetInt64 )
 
-		f = Field_Type{};
-	}
+RW_JSON_VALUES( float, IsNumber, GetFloat, SetFloat )
+RW_JSON_VALUES( double, IsNumber, GetDouble, SetDouble )
 
-	template< typename Field_Type >
-	constexpr bool
-	is_default_value( Field_Type & ) const noexcept
-	{
-		return false;
-	}
-};
 //
-// optional_attr_t
+// uint16
 //
 
-//! Field set/notset attribute ckecker for optional case with default value.
-template< typename Field_Default_Value_Type >
-struct optional_attr_t
+inline void
+read_json_value(
+	std::uint16_t & v,
+	const rapidjson::Value & object )
 {
-	optional_attr_t( Field_Default_Value_Type default_value )
-		:	m_default_value{ std::move( default_value ) }
-	{}
-
-	template< typename Field_Type >
-	void
-	on_field_not_defined( Field_Type & f ) const
-	{
-		set_default_value( f, std::move( m_default_value ) );
-	}
-
-	/*!
-	 * @note
-	 * Since v.0.3.0.
-	 */
-	template< typename Field_Type >
-	void
-	on_null( Field_Type & f ) const
-	{
-		// NOTE: directly use 'default_on_null' from json_dto namespace
-		// to avoid surprises with ADL.
-		json_dto::default_on_null( f );
-	}
+	const details::reading_scope_t scope{ v };
 
-	template< typename Field_Type >
-	bool
-	is_default_value( nullable_t< Field_Type > & f ) const
-	{
-		return f && *f == m_default_value;
-	}
+	std::uint32_t value{};
+	details::read_owned( value, object );
 
-	template< typename Field_Type >
-	bool
-	is_default_value( Field_Type & f ) const
+	if( value <= std::uint32_t(std::numeric_limits< std::uint16_t >::max()) )
+		v = std::uint16_t( value );
+	else
 	{
-		return f == m_default_value;
+		report_error( error_code_t::out_of_range,
+				"value is out of uint16: " + std::to_string( value ) );
+		v = std::uint16_t{};
 	}
+}
 
-	Field_Default_Value_Type m_default_value;
-};
+inline void
+write_json_value(
+	std::uint16_t v,
+	rapidjson::Value & object,
+	rapidjson::MemoryPoolAllocator<> & allocator )
+{
+	const std::uint32_t value = v;
+	write_json_value( value, object, allocator );
+}
 
 //
-// optional_attr_null_t
+// int16
 //
 
-//! Field set/notset attribute checker for optional case with default value.
-struct optional_attr_null_t
+inline void
+read_json_value( std::int16_t & v, const rapidjson::Value & object )
 {
-	template< typename Field_Type >
-	void
-	on_field_not_defined( nullable_t< Field_Type > & f ) const noexcept
-	{
-		f.reset();
-	}
+	const details::reading_scope_t scope{ v };
 
-	/*!
-	 * @note
-	 * Since v.0.3.0.
-	 */
-	template< typename Field_Type >
-	void
-	on_null( Field_Type & f ) const
-	{
-		// NOTE: directly use 'default_on_null' from json_dto namespace
-		// to avoid surprises with ADL.
-		json_dto::default_on_null( f );
-	}
+	std::int32_t value{};
+	details::read_owned( value, object );
 
-	template< typename Field_Type >
-	bool
-	is_default_value( nullable_t< Field_Type > & f ) const noexcept
+	if( value <= std::int32_t(std::numeric_limits< std::int16_t >::max()) &&
+		value >= std::int32_t(std::numeric_limits< std::int16_t >::min()) )
+		v = std::int16_t( value );
+	else
 	{
-		return !f.has_value();
+		report_error( error_code_t::out_of_range,
+				"value is out of int16: " + std::to_string( value ) );
+		v = std::int16_t{};
 	}
-};
+}
+
+inline void
+write_json_value(
+	std::int16_t v,
+	rapidjson::Value & object,
+	rapidjson::MemoryPoolAllocator<> & allocator )
+{
+	const std::int32_t value = v;
+	write_json_value( value, object, allocator );
+}
 
 //
-// optional_nodefault_attr_t
+// uint8
 //
 
-//! Field set/notset attribute ckecker for optional case without default value.
-struct optional_nodefault_attr_t
+inline void
+read_json_value(
+	std::uint8_t & v,
+	const rapidjson::Value & object )
 {
-	template< typename Field_Type >
-	constexpr void
-	on_field_not_defined( Field_Type & ) const noexcept
-	{}
+	const details::reading_scope_t scope{ v };
 
-	/*!
-	 * @note
-	 * Since v.0.3.0.
-	 */
-	template< typename Field_Type >
-	void
-	on_null( Field_Type & f ) const
-	{
-		// NOTE: directly use 'default_on_null' from json_dto namespace
-		// to avoid surprises with ADL.
-		json_dto::default_on_null( f );
-	}
+	std::uint32_t value{};
+	details::read_owned( value, object );
 
-	template< typename Field_Type >
-	constexpr bool
-	is_default_value( Field_Type & ) const noexcept
+	if( value <= std::uint32_t(std::numeric_limits< std::uint8_t >::max()) )
+		v = std::uint8_t( value );
+	else
 	{
-		return false;
+		report_error( error_code_t::out_of_range,
+				"value is out of uint8: " + std::to_string( value ) );
+		v = std::uint8_t{};
 	}
-};
-
-using string_ref_t = rapidjson::Value::StringRefType;
+}
 
-//! Helper function to make a string_ref instance.
-/*!
- * @since v.0.2.9
- */
-inline string_ref_t
-make_string_ref( const char * src, std::size_t length ) noexcept
+inline void
+write_json_value(
+	std::uint8_t v,
+	rapidjson::Value & object,
+	rapidjson::MemoryPoolAllocator<> & allocator )
 {
-	return { src, static_cast<rapidjson::SizeType>(length) };
+	const std::uint32_t value = v;
+	write_json_value( value, object, allocator );
 }
 
-//! Helper function to make a string_ref instance from std::string object.
-/*!
- * @since v.0.2.9
- */
-inline string_ref_t
-make_string_ref( const std::string & src ) noexcept
+//
+// int8
+//
+
+inline void
+read_json_value( std::int8_t & v, const rapidjson::Value & object )
 {
-	return make_string_ref( src.data(), src.size() );
+	const details::reading_scope_t scope{ v };
+
+	std::int32_t value{};
+	details::read_owned( value, object );
+
+	if( value <= std::int32_t(std::numeric_limits< std::int8_t >::max()) &&
+		value >= std::int32_t(std::numeric_limits< std::int8_t >::min()) )
+		v = std::int8_t( value );
+	else
+	{
+		report_error( error_code_t::out_of_range,
+				"value is out of int8: " + std::to_string( value ) );
+		v = std::int8_t{};
+	}
 }
 
-//! Helper function to make a string_ref instance from raw pointer.
-/*!
- * @since v.0.2.9
- */
-inline string_ref_t
-make_string_ref( const char * src ) noexcept
+inline void
+write_json_value(
+	std::int8_t v,
+	rapidjson::Value & object,
+	rapidjson::MemoryPoolAllocator<> & allocator )
 {
-	return make_string_ref( src, std::strlen(src) );
+	const std::int32_t value = v;
+	write_json_value( value, object, allocator );
 }
 
 //
-// empty_validator_t
+// STRING
 //
 
-struct empty_validator_t
+inline void
+read_json_value( std::string & s, const rapidjson::Value & object )
 {
-	template< typename Field_Type >
-	constexpr void
-	operator () ( const Field_Type & ) const noexcept
-	{}
-};
-
-//
-// the implementation of default_reader_writer_t
-//
+	const details::reading_scope_t scope{ s };
 
-template< typename Field_Type >
-void
-default_reader_writer_t::read(
-	Field_Type & v, const rapidjson::Value & from ) const
-{
-	read_json_value( v, from );
+	// NOTE: assign() reuses the capacity of the string.
+	if( object.IsString() )
+		s.assign( object.GetString(), object.GetStringLength() );
+	else
+		report_error( error_code_t::type_mismatch, "value is not std::string" );
 }
 
-template< typename Field_Type >
-void
-default_reader_writer_t::write(
-	const Field_Type & v,
-	rapidjson::Value & to,
-	rapidjson::MemoryPoolAllocator<> & allocator ) const
+inline void
+write_json_value(
+	const std::string & s,
+	rapidjson::Value & object,
+	rapidjson::MemoryPoolAllocator<> & allocator )
 {
-	write_json_value( v, to, allocator );
+	constexpr std::string::size_type max_str_len = std::numeric_limits< rapidjson::SizeType >::max();
+
+	if( max_str_len < s.size() )
+	{
+		report_error( error_code_t::out_of_range,
+				"string length is too large: " + std::to_string( s.size() ) +
+				" (max is " + std::to_string( max_str_len ) + ")" );
+		return;
+	}
+
+	object.SetString( s.data(), static_cast< rapidjson::SizeType >( s.size() ), allocator );
 }
 
-/*!
- * @brief A special proxy reader_writer that delegates actual
- * formatting actions to the nested reader_writer.
- *
- * When a custom reader_writer is specified for a field it's applied
- * to the field itself. For example:
- * @code
- * struct my_int_reader_writer {
- * 	void read(int & v, ...) const {...}
- * 	void write(const int & v, ...) const {...}
- * };
- *
- * struct my_data {
- * 	int field_;
- * 	...
- * 	template<typename Io> void json_io(Io & io) {
- * 		io & json_dto::mandatory(my_int_reader_writer{}, "field", field_)
- * 			...
- * 			;
- * 	}
- * };
- * @endcode
- * In that case a reference to integer field `field_` will be passed to
- * `my_int_reader_writer`. And this is intended behavior.
- *
- * But there could be cases when (de)serialized field is a container.
- * For example, in that case we'll get a compiler error:
- * @code
- * struct my_complex_data {
- * 	std::vector<int> field_;
- * 	...
- * 	template<typename Io> void json_io(Io & io) {
- * 		io & json_dto::mandatory(my_int_reader_writer{}, "field", field_)
- * 			...
- * 			;
- * 	}
- * };
- * @endcode
- * It is because a reference to `vector<int>` will be passed to
- * `my_int_reader_writer`, but `my_int_reader_writer` expects references
- * to integers.
- *
- * It seems that this problem can be solved by extending `my_int_reader_writer`:
- * @code
- * struct my_int_reader_writer {
- * 	void read(int & v, ...) const {...}
- * 	void read(std::vector<int> & v, ...) const {...}
- *
- * 	void write(const int & v, ...) const {...}
- * 	void write(const std::vector<int> & v, ...) const {...}
- * };
- * @endcode
- * But this solution doesn't scale well because there are a plenty of
- * container types. And it's not good to create an overload for every
- * of them.
- *
- * So the template `apply_to_content_t` gives another solution:
- * @code
- * struct my_complex_data {
- * 	std::vector<int> field_;
- * 	...
- * 	template<typename Io> void json_io(Io & io) {
- * 		io & json_dto::mandatory(
- * 				json_dto::apply_to_content_t<my_int_reader_writer>{},
- * 				"field", field_)
- * 			...
- * 			;
- * 	}
- * };
- * @endcode
- *
- * An instance of `apply_to_content_t` holds an instance of an actual
- * reader_writer type and applies it to every item of container.
- *
- * @note
- * The template `apply_to_content_t` should also be used with
- * `nullable_t` and `std::optional` if an actual reader_writer has
- * to be applied to the content of `nullable_t`/`std::optional`:
- * @code
- * struct my_data {
- * 	std::optional<int> weight_;
- * 	json_dto::nullable_t<int> priority_;
- * 	...
- * 	template<typename Io> void json_io(Io & io) {
- * 		io & json_dto::optional(
- * 				json_dto::apply_to_content_t<my_int_reader_writer>{},
- * 				"weight", weight_, std::nullopt)
- * 			& json_dto::mandatory(
- * 				json_dto::apply_to_content_t<my_int_reader_writer>{},
- * 				"priority", priority_)
- * 		...
- * 		;
- * 	}
- * }
- * @endcode
- *
- * @note
- * Sometimes `apply_to_content_t` should be nested:
- * @code
- * struct my_complex_data {
- * 	json_dto::nullable_t< std::vector<int> > params_;
- * 	...
- * 	template<typename Io> void json_io(Io & io) {
- * 		io & json_dto::mandatory(
- * 				// The first occurence of apply_to_content_t is for nullable_t.
- * 				json_dto::apply_to_content_t<
- * 					// The second occurence of apply_to_content_t is for std::vector.
- * 					json_dto::apply_to_content_t<
- * 						// This is for the content of std::vector.
- * 						my_int_reader_writer
- * 					>
- * 				>{},
- * 				"params", params_)
- * 			...
- * 			;
- * 	}
- * };
- * @endcode
- *
- * @since v.0.2.11
- */
-template< typename Item_Reader_Writer >
-struct apply_to_content_t
+// Since v.0.2.10.
+inline void
+write_json_value(
+	const rapidjson::Value::StringRefType & s,
+	rapidjson::Value & object,
+	rapidjson::MemoryPoolAllocator<> & allocator )
 {
-	Item_Reader_Writer m_reader_writer;
+	// NOTE: there is no check for max_str_len as for std::string version
+	// because s.length has type rapidjson::SizeType.
+	object.SetString( s.s, s.length, allocator );
+}
 
-	apply_to_content_t() = default;
+// Since v.0.3.5.
+inline void
+read_json_value( string_view_t & s, const rapidjson::Value & object )
+{
+	const details::reading_scope_t scope{ s };
 
-	apply_to_content_t( const Item_Reader_Writer & initial )
-		:	m_reader_writer{ initial }
-	{}
+	if( object.IsString() )
+		s = string_view_t{ object.GetString(), object.GetStringLength() };
+	else
+		report_error( error_code_t::type_mismatch, "value is not a string" );
+}
 
-	apply_to_content_t( Item_Reader_Writer && initial )
-		:	m_reader_writer{ std::move(initial) }
-	{}
+// Since v.0.3.5.
+inline void
+write_json_value(
+	const string_view_t & s,
+	rapidjson::Value & object,
+	rapidjson::MemoryPoolAllocator<> & allocator )
+{
+	constexpr std::size_t max_str_len = std::numeric_limits< rapidjson::SizeType >::max();
 
-	template< typename Field_Type >
-	void
-	read(
-		Field_Type & v, const rapidjson::Value & from ) const
+	if( max_str_len < s.size() )
 	{
-		read_json_value( v, from, m_reader_writer );
+		report_error( error_code_t::out_of_range,
+				"string length is too large: " + std::to_string( s.size() ) +
+				" (max is " + std::to_string( max_str_len ) + ")" );
+		return;
 	}
 
-	template< typename Field_Type >
-	void
-	write(
-		Field_Type & v,
-		rapidjson::Value & to,
-		rapidjson::MemoryPoolAllocator<> & allocator ) const
-	{
-		write_json_value( v, to, allocator, m_reader_writer );
-	}
-};
+	object.SetString( s.data(), static_cast< rapidjson::SizeType >( s.size() ), allocator );
+}
+
+#if defined( JSON_DTO_SUPPORTS_STD_STRING_VIEW )
+// Since v.0.3.5.
+inline void
+read_json_value( std::string_view & s, const rapidjson::Value & object )
+{
+	const details::reading_scope_t scope{ s };
+
+	string_view_t v;
+	details::read_owned( v, object );
+	s = v;
+}
+
+// Since v.0.3.5.
+inline void
+write_json_value(
+	const std::string_view & s,
+	rapidjson::Value & object,
+	rapidjson::MemoryPoolAllocator<> & allocator )
+{
+	write_json_value( string_view_t{ s }, object, allocator );
+}
+#endif
 
 //
-// start of inside_array related stuff
+// const- and mutable map keys
 //
 
-namespace inside_array
+// Since v.0.2.11.
+template< typename T >
+void
+read_json_value(
+	mutable_map_key_t<T> key,
+	const rapidjson::Value & object )
 {
+	read_json_value( key.v, object );
+}
 
-namespace details
+// Since v.0.2.11.
+template< typename T >
+void
+write_json_value(
+	const_map_key_t<T> key,
+	rapidjson::Value & object,
+	rapidjson::MemoryPoolAllocator<> & allocator )
 {
+	write_json_value( key.v, object, allocator );
+}
 
-/*!
- * @brief Base class for all implementations of array member (de)serializers.
- *
- * It's necessary to have a possibility to build a vector of pointers to actual
- * instances of (de)serializers. All those (de)serializers may have different
- * types and we want a simple way to work with them without digging into
- * complex template magic.
- *
- * @since v.0.3.3
- */
-class member_processor_base_t
+//
+// JSON
+//
+
+inline void
+read_json_value( rapidjson::Document & d, const rapidjson::Value & object )
 {
-public:
-	/*!
-	 * Implementation should process an item with index @a index from array @a from.
-	 *
-	 * @note
-	 * It's guaranteed that @a from is an array.
-	 */
-	virtual void
-	read(
-		rapidjson::SizeType index,
-		const rapidjson::Value & from ) const = 0;
+	d.CopyFrom( object, d.GetAllocator() );
+}
 
-	/*!
-	 * Implementation should assign a default value to the item.
-	 *
-	 * This method is called when actual array in JSON has less items than
-	 * described by a user. All missing items have to receive default values.
-	 */
-	virtual void
-	on_field_not_defined() const = 0;
+inline void
+write_json_value(
+	const rapidjson::Document & d,
+	rapidjson::Value & object,
+	rapidjson::MemoryPoolAllocator<> & allocator )
+{
+	object.CopyFrom( d, allocator );
+}
 
-	/*!
-	 * Implementation should add the next value to arrat @a to.
-	 *
-	 * The implementation must use `to.PushBack` for adding a value.
-	 *
-	 * @note
-	 * It's guaranteed that @a from is an array.
-	 */
-	virtual void
-	write(
-		rapidjson::Value & to,
-		rapidjson::MemoryPoolAllocator<> & allocator ) const = 0;
-};
+// Since v.0.3.5.
+inline void
+read_json_value( raw_json_t & v, const rapidjson::Value & object )
+{
+	v.assign( object );
+}
 
-/*!
- * @brief A metafunction that specified that all members are mandatory.
- *
- * This metafunction will be used by json_dto::inside_array::reader_writer by
- * default.
- */
-struct all_members_required_t
+// Since v.0.3.5.
+inline void
+write_json_value(
+	const raw_json_t & v,
+	rapidjson::Value & object,
+	rapidjson::MemoryPoolAllocator<> & allocator )
 {
-	/*!
-	 * @brief Metafunction that detects if the specified number of fields is valid.
-	 *
-	 * This metafunction always returns true.
-	 *
-	 * @since v.0.3.3
-	 */
-	template< rapidjson::SizeType Members_Count >
-	struct is_valid_members_count
+	if( v.empty() )
 	{
-		static constexpr bool value = true;
-	};
+		object.SetNull();
+		return;
+	}
 
-	/*!
-	 * @brief Helper method that detect number of array members to be read.
-	 *
-	 * @return the value of @a expected_members.
-	 *
-	 * @throw ex_t if @a expected_members is not equal to @a actual_members.
-	 *
-	 * @since v.0.3.3
-	 */
-	JSON_DTO_NODISCARD
-	static rapidjson::SizeType
-	handle_actual_members_count(
-		rapidjson::SizeType expected_members,
-		rapidjson::SizeType actual_members )
+	if( const auto * value = v.value() )
 	{
-		if( expected_members != actual_members )
-			throw ex_t{ "inside_array: actual members count ("
-					+ std::to_string(actual_members)
-					+ ") missmatches expected members count ("
-					+ std::to_string(expected_members) + ")"
-				};
+		object.CopyFrom( *value, allocator );
+		return;
+	}
 
-		return expected_members;
+	// Values are created by the allocator of the caller.
+	rapidjson::Document document{ &allocator };
+	document.Parse( v.text().data(), v.text().size() );
+	if( document.HasParseError() )
+	{
+		report_error( error_code_t::write_failed,
+				std::string{ "raw JSON can't be parsed: '" } +
+				rapidjson::GetParseError_En( document.GetParseError() ) +
+				"' (offset: " + std::to_string( document.GetErrorOffset() ) + ")" );
+		object.SetNull();
+		return;
 	}
-};
 
-/*!
- * @brief Implementation of a reader-writer or a case when a bunch of fields
- * has to be placed into an array.
- *
- * @note
- * This implementation always serializes exactly @a Members_Count fields.
- * Number of fields to be deserialized depends on @a At_Least_Limiter.
- *
- * @tparam Members_Count number of fields for (de)serialization.
- * @tparam At_Least_Limiter a metafunction for work with number of fields.
- * It's expected to be json_dto::inside_array::details::all_members_required_t,
- * json_dto::inside_array::at_least or similar.
- *
- * @since v.0.3.3
- */
-template<
-	rapidjson::SizeType Members_Count,
-	typename At_Least_Limiter >
-class reader_writer_t
-{
-	static_assert( 0u != Members_Count, "Members_Count can't be 0" );
-	static_assert(
-			At_Least_Limiter::template is_valid_members_count<Members_Count>::value,
-			"At_Least_Limiter has to allow at least Members_Count items in an array" );
+	object.Swap( document );
+}
 
-	//! Just a useful type alias.
-	using member_processor_ptr_t = const member_processor_base_t*;
+#if defined( JSON_DTO_SUPPORTS_STD_OPTIONAL )
+//
+// std::optional
+//
+template< typename T, typename Reader_Writer = default_reader_writer_t >
+inline void
+read_json_value(
+	cpp17::optional<T> & v,
+	const rapidjson::Value & object,
+	Reader_Writer reader_writer = Reader_Writer{} );
 
-	//! Holder for pointers to actual members processor.
-	/*!
-	 * It's expected that all the pointers remain valid the whole lifetime
-	 * of reader_writer_t object.
-	 */
-	std::array< member_processor_ptr_t, Members_Count > m_member_processors;
+template< typename T, typename Reader_Writer = default_reader_writer_t >
+inline void
+write_json_value(
+	const cpp17::optional<T> & v,
+	rapidjson::Value & object,
+	rapidjson::MemoryPoolAllocator<> & allocator,
+	Reader_Writer reader_writer = Reader_Writer{} );
+#endif
 
-	//! Helper method for filling %m_member_processors.
-	template<
-		std::size_t Index,
-		typename Member_Processor >
-	static void
-	set_member_processor_pointer(
-		reader_writer_t & self,
-		Member_Processor && current_processor )
-	{
-		self.m_member_processors[ Index ] = std::addressof(current_processor);
-	}
+//
+// ARRAY
+//
 
-	//! Helper method for filling %m_member_processors.
-	template<
-		std::size_t Index,
-		typename Member_Processor,
-		typename... Tail >
-	static void
-	set_member_processor_pointer(
-		reader_writer_t & self,
-		Member_Processor && current_processor,
-		Tail && ...tail )
-	{
-		self.m_member_processors[ Index ] = std::addressof(current_processor);
-		set_member_processor_pointer<Index + 1u>( self, std::forward<Tail>(tail)... );
-	}
+template< typename T, typename A, typename Reader_Writer = default_reader_writer_t >
+void
+read_json_value(
+	std::vector< T, A > & vec,
+	const rapidjson::Value & object,
+	const Reader_Writer & reader_writer = Reader_Writer{} );
 
-public:
-	reader_writer_t(
-		const reader_writer_t & ) = default;
-	reader_writer_t(
-		reader_writer_t && ) = default;
+template< typename T, typename A, typename Reader_Writer = default_reader_writer_t >
+void
+write_json_value(
+	const std::vector< T, A > & vec,
+	rapidjson::Value & object,
+	rapidjson::MemoryPoolAllocator<> & allocator,
+	const Reader_Writer & reader_writer = Reader_Writer{} );
 
-	reader_writer_t &
-	operator=( const reader_writer_t & ) = default;
-	reader_writer_t &
-	operator=( reader_writer_t && ) = default;
+// Since v.0.3.5.
+template< typename T, std::size_t N, typename Reader_Writer = default_reader_writer_t >
+void
+read_json_value(
+	std::array< T, N > & arr,
+	const rapidjson::Value & object,
+	const Reader_Writer & reader_writer = Reader_Writer{} );
 
-	//! Initializing constructor.
-	template< typename... Member_Processors >
-	reader_writer_t( Member_Processors && ...processors )
-	{
-		static_assert( Members_Count == sizeof...(processors),
-				"Members_Count should be equal to sizeof...(processors)" );
+// Since v.0.3.5.
+template< typename T, std::size_t N, typename Reader_Writer = default_reader_writer_t >
+void
+write_json_value(
+	const std::array< T, N > & arr,
+	rapidjson::Value & object,
+	rapidjson::MemoryPoolAllocator<> & allocator,
+	const Reader_Writer & reader_writer = Reader_Writer{} );
 
-		set_member_processor_pointer< 0u >(
-				*this,
-				std::forward<Member_Processors>(processors)... );
-	}
+//
+// STL-like non-associative containers.
+//
+template< typename C, typename Reader_Writer = default_reader_writer_t >
+std::enable_if_t<
+		details::meta::is_stl_like_sequence_container<C>::value,
+		void >
+read_json_value(
+	C & cnt,
+	const rapidjson::Value & object,
+	const Reader_Writer & reader_writer = Reader_Writer{} );
 
-	//! Reads members from JSON value.
-	/*!
-	 * It may read less than @a Members_Count members if some are missing
-	 * during deserialization and @a At_Least_Limiter allows that.
-	 *
-	 * @note
-	 * It's expected that @a from is an array. An ex_t is thrown otherwise.
-	 */
-	template< typename Field_Type >
-	void
-	read( Field_Type & /*ignored*/, const rapidjson::Value & from ) const
-	{
-		if( from.IsArray() )
-		{
-			const auto members_to_read =
-					At_Least_Limiter::handle_actual_members_count( Members_Count, from.Size() );
+template< typename C, typename Reader_Writer = default_reader_writer_t >
+std::enable_if_t<
+		details::meta::is_stl_like_sequence_container<C>::value,
+		void >
+write_json_value(
+	const C & cnt,
+	rapidjson::Value & object,
+	rapidjson::MemoryPoolAllocator<> & allocator,
+	const Reader_Writer & reader_writer = Reader_Writer{} );
 
-			rapidjson::SizeType i = 0u;
-			for( ; i != members_to_read; ++i )
-				m_member_processors[ i ]->read( i, from );
+//
+// STL-set-like associative containers.
+//
+template< typename C, typename Reader_Writer = default_reader_writer_t >
+std::enable_if_t<
+		details::meta::is_stl_set_like_associative_container<C>::value,
+		void >
+read_json_value(
+	C & cnt,
+	const rapidjson::Value & object,
+	const Reader_Writer & reader_writer = Reader_Writer{} );
 
-			for( ; i != Members_Count; ++i )
-				m_member_processors[ i ]->on_field_not_defined();
-		}
-		else
-			throw ex_t{ "reader_writer_t: value is not an array" };
-	}
+template< typename C, typename Reader_Writer = default_reader_writer_t >
+std::enable_if_t<
+		details::meta::is_stl_set_like_associative_container<C>::value,
+		void >
+write_json_value(
+	const C & cnt,
+	rapidjson::Value & object,
+	rapidjson::MemoryPoolAllocator<> & allocator,
+	const Reader_Writer & reader_writer = Reader_Writer{} );
 
-	//! Writes members into JSON value.
-	/*!
-	 * Changes type of @a to to an array and then adds all members to it.
+//
+// STL-map-like associative containers.
+//
+template< typename C, typename Reader_Writer = default_reader_writer_t >
+std::enable_if_t<
+		details::meta::is_stl_map_like_associative_container<C>::value,
+		void >
+read_json_value(
+	C & cnt,
+	const rapidjson::Value & object,
+	const Reader_Writer & reader_writer = default_reader_writer_t{} );
+
+template< typename C, typename Reader_Writer = default_reader_writer_t >
+std::enable_if_t<
+		details::meta::is_stl_map_like_associative_container<C>::value,
+		void >
+write_json_value(
+	const C & cnt,
+	rapidjson::Value & object,
+	rapidjson::MemoryPoolAllocator<> & allocator,
+	const Reader_Writer & reader_writer = Reader_Writer{} );
+
+//
+// nullable_t
+//
+
+//! A wrapper for nullable fields.
+template< typename Field_Type >
+struct nullable_t
+{
+	nullable_t() noexcept
+		:	m_has_value{ false }
+	{}
+
+	nullable_t( std::nullptr_t ) noexcept
+		:	m_has_value{ false }
+	{}
+
+	explicit nullable_t( Field_Type value )
+		noexcept( noexcept( Field_Type{std::move(value)} ) )
+		:	m_has_value{ true }
+	{
+		new( m_image_space ) Field_Type{ std::move( value ) };
+	}
+
+	nullable_t( const nullable_t & other )
+		noexcept( noexcept( Field_Type{other.field_ref()} ) )
+		:	m_has_value{ other.m_has_value }
+	{
+		if( has_value() )
+			new( m_image_space ) Field_Type{ other.field_ref() };
+	}
+
+	nullable_t( nullable_t && other )
+		noexcept( noexcept( Field_Type{std::move(other.field_ref())} ) )
+		:	m_has_value{ other.m_has_value }
+	{
+		if( has_value() )
+			new( m_image_space ) Field_Type{ std::move( other.field_ref() ) };
+	}
+
+	// Constructor to be used for initialization of the value.
+	//
+	// Usage example:
+	//
+	// 	const std::string base{ "0123456789xyz" };
+	// 	size_t pos = 5;
+	// 	size_t len = 4;
+	// 	json_dto::nullable_t< std::string > str{ base, pos, len };
+	//
+	template<
+		typename... Args,
+		// NOTE: to avoid calling of this constructor when Args is 'nullable_t &'.
+		typename T = std::enable_if_t<
+			!( 1u == sizeof...(Args) &&
+				std::is_same<
+					std::decay_t< details::meta::head_of_t<Args...> >,
+					nullable_t >::value )
+		>
+	>
+	explicit nullable_t( Args &&... args )
+		noexcept( noexcept( Field_Type{std::forward< Args >( args )...} ) )
+		:	m_has_value{ true }
+	{
+		new( m_image_space ) Field_Type{ std::forward< Args >( args )... };
+	}
+
+	~nullable_t()
+	{
+		reset();
+	}
+
+	bool
+	has_value() const noexcept
+	{
+		return m_has_value;
+	}
+
+	operator bool () const noexcept
+	{
+		return has_value();
+	}
+
+	void
+	swap( nullable_t & other )
+		noexcept( noexcept( Field_Type{ std::move(other.field_ref()) } ) )
+	{
+		if( m_has_value && other.m_has_value )
+		{
+			std::swap( field_ref(), other.field_ref() );
+		}
+		else if( !m_has_value && other.m_has_value )
+		{
+			new( m_image_space ) Field_Type{ std::move( other.field_ref() ) };
+			m_has_value = true;
+			other.reset();
+		}
+		else if( m_has_value && !other.m_has_value )
+		{
+			other.swap( *this );
+		}
+		// Both objects has no value: do nothing.
+	}
+
+	nullable_t &
+	operator = ( const nullable_t & other )
+	{
+		nullable_t temp{ other };
+		swap( temp );
+
+		return *this;
+	}
+
+	nullable_t &
+	operator = ( nullable_t && other )
+		noexcept(
+			noexcept( nullable_t{ std::move(other) } ) &&
+			noexcept( this->swap( other ) ) )
+	{
+		nullable_t temp{ std::move( other ) };
+		swap( temp );
+
+		return *this;
+	}
+
+	nullable_t &
+	operator = ( const Field_Type & value )
+	{
+		nullable_t temp{ value };
+		swap( temp );
+
+		return *this;
+	}
+
+	nullable_t &
+	operator = ( Field_Type && value )
+		noexcept(
+			noexcept( nullable_t{ std::move(value) } ) &&
+			noexcept( this->swap( *this ) ) )
+	{
+		nullable_t temp{ std::move( value ) };
+		swap( temp );
+
+		return *this;
+	}
+
+	nullable_t &
+	operator = ( std::nullptr_t ) noexcept
+	{
+		reset();
+		return *this;
+	}
+
+	const Field_Type*
+	operator -> () const noexcept
+	{
+		return field_ptr();
+	}
+
+	Field_Type*
+	operator -> () noexcept
+	{
+		return field_ptr();
+	}
+
+	const Field_Type &
+	operator * () const noexcept
+	{
+		return field_ref();
+	}
+
+	Field_Type&
+	operator * () noexcept
+	{
+		return field_ref();
+	}
+
+	bool
+	operator == ( const nullable_t & other ) const
+	{
+		return
+			has_value() &&
+			other.has_value() &&
+			field_ref() == other.field_ref();
+	}
+
+	//! Construct a new value in place.
+	/*!
+	 * @note Since v.0.3.5 the value isn't moved from a temporary and
+	 * a reference to it is returned.
 	 */
-	template< typename Field_Type >
+	Field_Type &
+	emplace()
+	{
+		reset();
+		new( m_image_space ) Field_Type{};
+		m_has_value = true;
+
+		return field_ref();
+	}
+
 	void
-	write(
-		const Field_Type & /*ignored*/,
-		rapidjson::Value & to,
-		rapidjson::MemoryPoolAllocator<> & allocator ) const
+	emplace( Field_Type value )
 	{
-		to.SetArray();
-		to.Reserve( Members_Count, allocator );
-		for( rapidjson::SizeType i = 0u; i != Members_Count; ++i )
-			m_member_processors[ i ]->write( to, allocator );
+		*this = std::move( value );
 	}
-};
 
+	void
+	reset() noexcept
+	{
+		if( has_value() )
+		{
+			m_has_value = false;
+			field_ref().~Field_Type();
+		}
+	}
+
+	private:
+		alignas( alignof( Field_Type ) ) char m_image_space[ sizeof( Field_Type ) ];
+		bool m_has_value{ false };
+
+		Field_Type *
+		field_ptr() noexcept
+		{
+			return JSON_DTO_STD_LAUNDER( reinterpret_cast< Field_Type * >( m_image_space ) );
+		}
+
+		const Field_Type *
+		field_ptr() const noexcept
+		{
+			return JSON_DTO_STD_LAUNDER( reinterpret_cast< const Field_Type * >( m_image_space ) );
+		}
+
+		Field_Type &
+		field_ref() noexcept
+		{
+			return *field_ptr();
+		}
+
+		const Field_Type &
+		field_ref() const noexcept
+		{
+			return *field_ptr();
+		}
+};
+
+//
+// lazy_t
+//
+
+struct empty_validator_t;
+
+/*!
+ * @brief A value that is decoded at the first access.
+ *
+ * Readers store the value in raw_json_t: the text for from_json_sax()
+ * or a copy of rapidjson::Value for DOM-based readers (see raw_json_t
+ * for details). It's decoded at the first call to get(), the result
+ * is cached.
+ *
+ * Validators of the field are called when the value is decoded.
+ * Errors of decoding and validation are thrown from get(). The type of
+ * the validator has to be specified by @a Validator, because the validator
+ * is kept until the decoding.
+ *
+ * Writers emit the text if the value wasn't modified by get_mutable()
+ * or by an assignment. So a value that is only forwarded isn't encoded.
+ *
+ * Usage example:
+ * @code
+ * struct event_t
+ * {
+ * 	std::string m_kind;
+ * 	json_dto::lazy_t<
+ * 			std::vector< double >,
+ * 			json_dto::min_max_validator_t< double > > m_prices;
+ *
+ * 	template< typename Json_Io >
+ * 	void json_io( Json_Io & io )
+ * 	{
+ * 		io & json_dto::mandatory( "kind", m_kind )
+ * 			& json_dto::mandatory( "prices", m_prices,
+ * 					json_dto::min_max_constraint( 0.0, 1e6 ) );
+ * 	}
+ * };
+ *
+ * auto event = json_dto::from_json_sax< event_t >( json );
+ * if( "audit" == event.m_kind )
+ * 	for( const auto price : event.m_prices.get() )
+ * 		...
+ * @endcode
+ *
+ * @attention
+ * get() modifies the cache, so an instance can't be accessed from
+ * several threads without synchronization.
+ *
+ * @note
+ * A comparison of lazy_t doesn't decode the value. A value that isn't
+ * decoded is compared via raw_json_t, the other value is encoded into
+ * rapidjson::Value for that if it's necessary. The comparison is performed
+ * on writing of optional fields with default values.
+ *
+ * @since v.0.3.5
+ */
+template< typename T, typename Validator = empty_validator_t >
+class lazy_t
+{
+public:
+	using value_type = T;
+	using validator_type = Validator;
+
+	//! Holds the decoded T{}.
+	lazy_t()
+	{
+		m_value.emplace();
+	}
+
+	lazy_t( T value )
+	{
+		m_value.emplace( std::move(value) );
+	}
+
+	lazy_t &
+	operator=( T value )
+	{
+		m_value.emplace( std::move(value) );
+		m_raw.clear();
+		m_validator.reset();
+		return *this;
+	}
+
+	//! Get the value. It's decoded at the first call.
+	const T &
+	get() const
+	{
+		if( !m_value )
+			decode();
+		return *m_value;
+	}
+
+	//! Get the value for modification.
+	/*!
+	 * The text is dropped, so the value is encoded by writers.
+	 */
+	T &
+	get_mutable()
+	{
+		get();
+		m_raw.clear();
+		return *m_value;
+	}
+
+	const T &
+	operator*() const { return get(); }
+
+	const T *
+	operator->() const { return &get(); }
+
+	//! Has the value been decoded (or assigned)?
+	bool
+	is_decoded() const noexcept { return static_cast< bool >( m_value ); }
+
+	//! The text of the value from the last reading.
+	/*!
+	 * It's empty if the value is modified.
+	 */
+	const raw_json_t &
+	raw() const noexcept { return m_raw; }
+
+	//! Prepare for reading of the new text.
+	/*!
+	 * It's intended for readers. The value is dropped, the text has to be
+	 * stored into the returned object.
+	 */
+	raw_json_t &
+	raw_for_reading() noexcept
+	{
+		m_value.reset();
+		m_validator.reset();
+		return m_raw;
+	}
+
+	//! Set a validator to be called when the value is decoded.
+	template< typename Field_Validator >
+	void
+	defer_validation( const Field_Validator & validator ) const
+	{
+		static_assert(
+				std::is_convertible< const Field_Validator &, Validator >::value,
+				"the type of the validator of lazy_t field has to be "
+				"specified as the second template parameter of lazy_t" );
+
+		m_validator.emplace( validator );
+	}
+
+	//! Compare the value that isn't decoded with @a value.
+	/*!
+	 * @a value is encoded into rapidjson::Value for the comparison.
+	 */
+	bool
+	raw_equals( const T & value ) const
+	{
+		rapidjson::Document document;
+		default_reader_writer_t{}.write( value, document, document.GetAllocator() );
+		return m_raw.equals( document );
+	}
+
+private:
+	//! Decode the value. It's defined after from_json_sax().
+	void
+	decode() const;
+
+	raw_json_t m_raw;
+	mutable nullable_t< T > m_value;
+	mutable nullable_t< Validator > m_validator;
+};
+
+template< typename T, typename Validator >
+bool
+operator==(
+	const lazy_t< T, Validator > & a,
+	const lazy_t< T, Validator > & b )
+{
+	if( a.is_decoded() && b.is_decoded() )
+		return a.get() == b.get();
+	if( !a.raw().empty() && !b.raw().empty() )
+		return a.raw() == b.raw();
+
+	// One of the values is decoded only.
+	return a.is_decoded() ? b.raw_equals( a.get() ) : a.raw_equals( b.get() );
+}
+
+template< typename T, typename Validator >
+bool
+operator==( const lazy_t< T, Validator > & a, const T & b )
+{
+	return a.is_decoded() ? a.get() == b : a.raw_equals( b );
+}
+
+template< typename T, typename Validator >
+bool
+operator!=(
+	const lazy_t< T, Validator > & a,
+	const lazy_t< T, Validator > & b )
+{
+	return !( a == b );
+}
+
+template< typename T, typename Validator >
+bool
+operator!=( const lazy_t< T, Validator > & a, const T & b )
+{
+	return !( a == b );
+}
+
+// Since v.0.3.5.
+template< typename T, typename Validator >
+void
+read_json_value(
+	lazy_t< T, Validator > & v,
+	const rapidjson::Value & object )
+{
+	read_json_value( v.raw_for_reading(), object );
+}
+
+// Since v.0.3.5.
+template< typename T, typename Validator >
+void
+write_json_value(
+	const lazy_t< T, Validator > & v,
+	rapidjson::Value & object,
+	rapidjson::MemoryPoolAllocator<> & allocator )
+{
+	if( !v.raw().empty() )
+		write_json_value( v.raw(), object, allocator );
+	else
+		default_reader_writer_t{}.write( v.get(), object, allocator );
+}
+
+//
+// json_io
+//
+
+//! Standard io for DTO objects.
+/*!
+	It is possible to implement specifications for a concrete DTO type.
+	For example it allows to write non intrusive json_io adapters.
+*/
+template< typename Io, typename Dto >
+void
+json_io( Io & io, Dto & dto )
+{
+	dto.json_io( io );
+}
+
+//
+// Nested DTO helpers.
+//
+
+template< typename Dto >
+std::enable_if_t<
+		!details::meta::is_stl_like_container<Dto>::value,
+		void >
+read_json_value(
+	Dto & v,
+	const rapidjson::Value & object )
+{
+	details::member_index::read_dto( object, v );
+}
+
+template< typename Dto >
+std::enable_if_t<
+		!details::meta::is_stl_like_container<Dto>::value,
+		void >
+write_json_value(
+	const Dto & v,
+	rapidjson::Value & object,
+	rapidjson::MemoryPoolAllocator<> & allocator )
+{
+	json_output_t ouput( object, allocator );
+	details::with_dto_instrumentation< Dto >( [&] {
+			json_io( ouput, const_cast< Dto & >( v ) );
+		} );
+}
+
+//
+// RW specializations for nullable_t< T >
+//
+
+template<
+	typename Field_Type,
+	typename Reader_Writer = default_reader_writer_t >
+void
+read_json_value(
+	nullable_t< Field_Type > & f,
+	const rapidjson::Value & object,
+	Reader_Writer reader_writer = Reader_Writer{} )
+{
+	const details::reading_scope_t scope{ f };
+
+	if( !object.IsNull() )
+	{
+		if( !f || !reuse_mode_t::active() )
+			f.emplace();
+		details::read_owned( reader_writer, *f, object );
+	}
+	else
+		f.reset();
+}
+
+template<
+	typename Field_Type,
+	typename Reader_Writer = default_reader_writer_t >
+void
+write_json_value(
+	const nullable_t< Field_Type > & f,
+	rapidjson::Value & object,
+	rapidjson::MemoryPoolAllocator<> & allocator,
+	Reader_Writer reader_writer = Reader_Writer{} )
+{
+	if( f )
+	{
+		reader_writer.write( *f, object, allocator );
+	}
+	else
+	{
+		object.SetNull();
+	}
+}
+
+#if defined( JSON_DTO_SUPPORTS_STD_OPTIONAL )
+//
+// std::optional
+//
+template< typename T, typename Reader_Writer >
+inline void
+read_json_value(
+	cpp17::optional<T> & v,
+	const rapidjson::Value & object,
+	Reader_Writer reader_writer )
+{
+	const details::reading_scope_t scope{ v };
+
+	if( !v || !reuse_mode_t::active() )
+		v.emplace();
+	details::read_owned( reader_writer, *v, object );
+}
+
+template< typename T, typename Reader_Writer >
+inline void
+write_json_value(
+	const cpp17::optional<T> & v,
+	rapidjson::Value & object,
+	rapidjson::MemoryPoolAllocator<> & allocator,
+	Reader_Writer reader_writer )
+{
+	if( v )
+		reader_writer.write( *v, object, allocator );
+}
+#endif
+
+namespace details
+{
+
+namespace reuse
+{
+
+//
+// Helpers for reading in reuse mode.
+//
+// Since v.0.3.5.
+//
+
+template< typename T, typename A, typename Reader_Writer >
+void
+overwrite_items(
+	std::vector< T, A > & vec,
+	const rapidjson::Value & object,
+	const Reader_Writer & reader_writer )
+{
+	// All new items are created at once, it's cheaper than
+	// emplace_back() for every item.
+	vec.resize( object.Size() );
+	for_each_index( object.Size(), [&]( rapidjson::SizeType i ) {
+			read_owned( reader_writer, vec[ i ], object[ i ] );
+		} );
+}
+
+// std::vector<bool> has no references to items.
+template< typename A, typename Reader_Writer >
+void
+overwrite_items(
+	std::vector< bool, A > & vec,
+	const rapidjson::Value & object,
+	const Reader_Writer & reader_writer )
+{
+	vec.resize( object.Size() );
+	for_each_index( object.Size(), [&]( rapidjson::SizeType i ) {
+			bool v{};
+			read_owned( reader_writer, v, object[ i ] );
+			vec[ i ] = v;
+		} );
+}
+
+template< typename C, typename Reader_Writer >
+void
+overwrite_items_impl(
+	C & cnt,
+	const rapidjson::Value & object,
+	const Reader_Writer & reader_writer,
+	std::false_type /*is_forward_list*/ )
+{
+	rapidjson::SizeType i = 0;
+	with_error_path(
+			[&] {
+				const auto * sink = error_sink();
+				auto it = cnt.begin();
+				for( ; it != cnt.end() && i < object.Size(); ++it, ++i )
+				{
+					read_owned( reader_writer, *it, object[ i ] );
+					if( has_failed( sink ) )
+						return;
+				}
+
+				cnt.erase( it, cnt.end() );
+				sequence_containers::reserve( cnt, object.Size() );
+
+				for( ; i < object.Size(); ++i )
+				{
+					cnt.emplace_back();
+					read_owned( reader_writer, cnt.back(), object[ i ] );
+					if( has_failed( sink ) )
+						return;
+				}
+			},
+			[&]( error_info_t & error ) { error.add_index( i ); } );
+}
+
+template< typename C, typename Reader_Writer >
+void
+overwrite_items_impl(
+	C & cnt,
+	const rapidjson::Value & object,
+	const Reader_Writer & reader_writer,
+	std::true_type /*is_forward_list*/ )
+{
+	rapidjson::SizeType i = 0;
+	with_error_path(
+			[&] {
+				const auto * sink = error_sink();
+				auto prev = cnt.before_begin();
+				for( auto it = cnt.begin();
+						it != cnt.end() && i < object.Size();
+						++it, ++i )
+				{
+					read_owned( reader_writer, *it, object[ i ] );
+					if( has_failed( sink ) )
+						return;
+					prev = it;
+				}
+
+				cnt.erase_after( prev, cnt.end() );
+
+				for( ; i < object.Size(); ++i )
+				{
+					prev = cnt.emplace_after( prev );
+					read_owned( reader_writer, *prev, object[ i ] );
+					if( has_failed( sink ) )
+						return;
+				}
+			},
+			[&]( error_info_t & error ) { error.add_index( i ); } );
+}
+
+template< typename C, typename Reader_Writer >
+void
+overwrite_items(
+	C & cnt,
+	const rapidjson::Value & object,
+	const Reader_Writer & reader_writer )
+{
+	overwrite_items_impl( cnt, object, reader_writer,
+			std::integral_constant< bool,
+					meta::has_before_begin<C>::value &&
+					meta::has_emplace_after<C>::value >{} );
+}
+
+//
+// has_unique_keys
+//
+template< typename C, typename = meta::void_t<> >
+struct has_unique_keys : public std::false_type {};
+
+template< typename C >
+struct has_unique_keys<
+		C,
+		meta::void_t<
+			decltype( std::declval< C & >().insert(
+					std::declval< typename C::value_type >() ).second ) > >
+	:	public std::true_type
+{};
+
+/*!
+ * @brief Set of entries of a container that are touched by a pass
+ * over members of JSON object.
+ *
+ * Entries are identified by their addresses. Small objects don't
+ * require a dynamic allocation.
+ */
+class touched_entries_t
+{
+	static constexpr std::size_t inline_capacity = 64u;
+
+	std::array< const void *, inline_capacity > m_inline;
+	std::unique_ptr< const void *[] > m_dynamic;
+	const void ** m_slots;
+	std::size_t m_mask;
+	std::size_t m_size{ 0u };
+
+public:
+	//! Create a set for at most @a count entries.
+	explicit touched_entries_t( std::size_t count )
+	{
+		std::size_t capacity = 8u;
+		while( capacity < count * 2u )
+			capacity *= 2u;
+
+		if( capacity <= inline_capacity )
+			m_slots = m_inline.data();
+		else
+		{
+			m_dynamic.reset( new const void *[ capacity ] );
+			m_slots = m_dynamic.get();
+		}
+
+		m_mask = capacity - 1u;
+		std::fill( m_slots, m_slots + capacity, nullptr );
+	}
+
+	//! Add an entry to the set.
+	/*!
+	 * @retval false if the entry is already in the set.
+	 */
+	bool
+	insert( const void * entry ) noexcept
+	{
+		// Low bits of addresses are mostly zeros, so they are mixed.
+		const auto address = static_cast< std::uint64_t >(
+				reinterpret_cast< std::uintptr_t >( entry ) );
+		auto i = static_cast< std::size_t >(
+				( address * 0x9E3779B97F4A7C15ull ) >> 32 ) & m_mask;
+		for( ; nullptr != m_slots[ i ]; i = ( i + 1u ) & m_mask )
+			if( entry == m_slots[ i ] )
+				return false;
+
+		m_slots[ i ] = entry;
+		++m_size;
+
+		return true;
+	}
+
+	//! Count of entries in the set.
+	std::size_t
+	size() const noexcept { return m_size; }
+};
+
+//! Find an entry for a JSON member by reading its key into @a key.
+template< typename C, typename Reader_Writer >
+typename C::iterator
+find_entry(
+	C & cnt,
+	typename C::iterator,
+	const Reader_Writer & reader_writer,
+	const rapidjson::Value & name,
+	typename C::key_type & key )
+{
+	// It is necessary to have mutable_key_ref as a lvalue to pass
+	// a non-const reference to it to read() method of the reader_writer.
+	auto mutable_key_ref = mutable_map_key(key);
+	reader_writer.read( mutable_key_ref, name );
+
+	return cnt.find( key );
+}
+
+//! Find an entry for a JSON member with a std::string key.
+/*!
+ * Keys of type std::string with default_reader_writer_t are compared
+ * with the name directly. The entry that follows the previous found
+ * entry is checked first, so a container with the same keys in the same
+ * order is updated without creation of temporary keys.
+ */
+template< typename C >
+std::enable_if_t<
+		std::is_same< typename C::key_type, std::string >::value,
+		typename C::iterator >
+find_entry(
+	C & cnt,
+	typename C::iterator hint,
+	const default_reader_writer_t &,
+	const rapidjson::Value & name,
+	typename C::key_type & key )
+{
+	if( hint != cnt.end() &&
+			hint->first.size() == name.GetStringLength() &&
+			0 == std::memcmp(
+					hint->first.data(), name.GetString(), hint->first.size() ) )
+		return hint;
+
+	key.assign( name.GetString(), name.GetStringLength() );
+
+	return cnt.find( key );
+}
+
+template< typename C, typename Reader_Writer >
+bool
+overwrite_mapped_values_impl(
+	C & cnt,
+	const rapidjson::Value & object,
+	const Reader_Writer & reader_writer,
+	std::true_type /*has_unique_keys*/ )
+{
+	if( cnt.empty() )
+		return false;
+
+	// Entries that are updated or inserted.
+	touched_entries_t touched{ object.MemberCount() };
+
+	typename C::key_type key{};
+	auto hint = cnt.begin();
+	for_each_member( object, [&]( const rapidjson::Value::Member & member ) {
+			auto existing = find_entry(
+					cnt, hint, reader_writer, member.name, key );
+			if( existing != cnt.end() )
+			{
+				// Only the first occurrence of a key is used, as in
+				// the usual reading of map-like containers.
+				if( touched.insert( &*existing ) )
+					read_owned( reader_writer, existing->second, member.value );
+				hint = std::next( existing );
+			}
+			else
+			{
+				auto inserted = associative_containers::emplace_key( cnt, key ).m_it;
+				touched.insert( &*inserted );
+				read_owned( reader_writer, inserted->second, member.value );
+			}
+		} );
+
+	// If there are entries that are not in JSON then the container
+	// has to be rebuilt.
+	return touched.size() == cnt.size();
+}
+
+template< typename C, typename Reader_Writer >
+bool
+overwrite_mapped_values_impl(
+	C &,
+	const rapidjson::Value &,
+	const Reader_Writer &,
+	std::false_type /*has_unique_keys*/ )
+{
+	return false;
+}
+
+//! Overwrite values of a map-like container.
+/*!
+ * @retval false if the container has to be read in the usual way.
+ */
+template< typename C, typename Reader_Writer >
+bool
+overwrite_mapped_values(
+	C & cnt,
+	const rapidjson::Value & object,
+	const Reader_Writer & reader_writer )
+{
+	return overwrite_mapped_values_impl( cnt, object, reader_writer,
+			has_unique_keys< C >{} );
+}
+
+} /* namespace reuse */
+
+} /* namespace details */
+
+namespace details
+{
+
+namespace sequence_containers
+{
+
+//
+// Reading of items into an empty sequence container.
+//
+// Since v.0.3.5.
+//
+
+// Items are constructed in the container and read in place.
+template< typename C, typename Reader_Writer >
+void
+read_items(
+	C & cnt,
+	const rapidjson::Value & object,
+	const Reader_Writer & reader_writer,
+	std::true_type /*has_mutable_items*/ )
+{
+	container_filler_t< C > filler{ cnt };
+	for_each_index( object.Size(), [&]( rapidjson::SizeType i ) {
+			read_owned( reader_writer, filler.emplace_default(), object[ i ] );
+		} );
+}
+
+// Items are read into a temporary and then moved into the container.
+template< typename C, typename Reader_Writer >
+void
+read_items(
+	C & cnt,
+	const rapidjson::Value & object,
+	const Reader_Writer & reader_writer,
+	std::false_type /*has_mutable_items*/ )
+{
+	container_filler_t< C > filler{ cnt };
+	for_each_index( object.Size(), [&]( rapidjson::SizeType i ) {
+			typename C::value_type v{};
+			read_owned( reader_writer, v, object[ i ] );
+			filler.emplace_back( std::move(v) );
+		} );
+}
+
+} /* namespace sequence_containers */
+
+namespace numeric_arrays
+{
+
+//
+// Fast path for arrays of numbers.
+//
+// Since v.0.3.5.
+//
+
+//! Detector of numeric types that have the fast path.
+template< typename T >
+struct is_number
+{
+	static constexpr bool value =
+			std::is_same< T, std::int8_t >::value ||
+			std::is_same< T, std::uint8_t >::value ||
+			std::is_same< T, std::int16_t >::value ||
+			std::is_same< T, std::uint16_t >::value ||
+			std::is_same< T, std::int32_t >::value ||
+			std::is_same< T, std::uint32_t >::value ||
+			std::is_same< T, std::int64_t >::value ||
+			std::is_same< T, std::uint64_t >::value ||
+			std::is_same< T, float >::value ||
+			std::is_same< T, double >::value;
+};
+
+//! Is the fast path used for items of type @a T?
+/*!
+ * The fast path isn't used for custom Reader_Writers.
+ */
+template< typename T, typename Reader_Writer >
+using use_fast_path_t = std::integral_constant< bool,
+		is_number< T >::value &&
+		std::is_same< Reader_Writer, default_reader_writer_t >::value >;
+
+//! Type-specific access to a number in rapidjson::Value.
+/*!
+ * is() has the same checks as read_json_value() for the type,
+ * so a value that passes is() is read without an error.
+ */
+template< typename T >
+struct number_access_t;
+
+#define JSON_DTO_NUMBER_ACCESS( type, checker, getter, setter ) \
+template<> \
+struct number_access_t< type > \
+{ \
+	static bool \
+	is( const rapidjson::Value & v ) noexcept { return v. checker (); } \
+	static type \
+	get( const rapidjson::Value & v ) noexcept { return v. getter (); } \
+	static void \
+	set( rapidjson::Value & v, type n ) noexcept { v. setter ( n ); } \
+};
+
+JSON_DTO_NUMBER_ACCESS( std::uint32_t, IsUint, GetUint, SetUint )
+JSON_DTO_NUMBER_ACCESS( std::int32_t, IsInt, GetInt, SetInt )
+JSON_DTO_NUMBER_ACCESS( std::uint64_t, IsUint64, GetUint64, SetUint64 )
+JSON_DTO_NUMBER_ACCESS( std::int64_t, IsInt64, GetInt64, SetInt64 )
+JSON_DTO_NUMBER_ACCESS( float, IsNumber, GetFloat, SetFloat )
+JSON_DTO_NUMBER_ACCESS( double, IsNumber, GetDouble, SetDouble )
+
+#undef JSON_DTO_NUMBER_ACCESS
+
+//! Access to 8- and 16-bit integers via a 32-bit one.
+template< typename T, typename Wide >
+struct narrow_number_access_t
+{
+	static bool
+	is( const rapidjson::Value & v ) noexcept
+	{
+		if( !number_access_t< Wide >::is( v ) )
+			return false;
+
+		const Wide n = number_access_t< Wide >::get( v );
+		return Wide( T( n ) ) == n;
+	}
+
+	static T
+	get( const rapidjson::Value & v ) noexcept
+	{
+		return T( number_access_t< Wide >::get( v ) );
+	}
+
+	static void
+	set( rapidjson::Value & v, T n ) noexcept
+	{
+		number_access_t< Wide >::set( v, n );
+	}
+};
+
+template<>
+struct number_access_t< std::uint16_t >
+	: public narrow_number_access_t< std::uint16_t, std::uint32_t > {};
+
+template<>
+struct number_access_t< std::int16_t >
+	: public narrow_number_access_t< std::int16_t, std::int32_t > {};
+
+template<>
+struct number_access_t< std::uint8_t >
+	: public narrow_number_access_t< std::uint8_t, std::uint32_t > {};
+
+template<>
+struct number_access_t< std::int8_t >
+	: public narrow_number_access_t< std::int8_t, std::int32_t > {};
+
+//! Detector of std::vector and std::array of numbers.
+template< typename T >
+struct is_number_array : public std::false_type {};
+
+template< typename T, typename A >
+struct is_number_array< std::vector< T, A > >
+	: public std::integral_constant< bool, is_number< T >::value > {};
+
+template< typename T, std::size_t N >
+struct is_number_array< std::array< T, N > >
+	: public std::integral_constant< bool, is_number< T >::value > {};
+
+//! Read all items of a JSON array into a contiguous storage.
+/*!
+ * The caller checks that @a object is an array of the right size.
+ *
+ * If an item isn't a number of type @a T then the whole array is read
+ * again by the usual way. It reports the error with the index of the
+ * failed item.
+ */
+template< typename T >
+void
+read_numbers( T * to, const rapidjson::Value & object )
+{
+	using access_t = number_access_t< T >;
+
+	if( has_failed( error_sink() ) )
+		return;
+
+	const auto * const items = object.Begin();
+	const auto * const end = object.End();
+
+	const auto * it = items;
+	for( T * out = to; it != end && access_t::is( *it ); ++it, ++out )
+		*out = access_t::get( *it );
+
+	if( it != end )
+		for_each_index( object.Size(), [to, items]( rapidjson::SizeType i ) {
+				json_dto::read_json_value( to[ i ], items[ i ] );
+			} );
+}
+
+//! Write numbers from a contiguous storage into a JSON array.
+template< typename T >
+void
+write_numbers(
+	const T * from,
+	std::size_t count,
+	rapidjson::Value & object,
+	rapidjson::MemoryPoolAllocator<> & allocator )
+{
+	using access_t = number_access_t< T >;
+
+	object.SetArray();
+	object.Reserve( static_cast< rapidjson::SizeType >( count ), allocator );
+
+	for( const T * end = from + count; from != end; ++from )
+	{
+		rapidjson::Value o;
+		access_t::set( o, *from );
+		object.PushBack( o, allocator );
+	}
+}
+
+} /* namespace numeric_arrays */
+
+template< typename T, typename A, typename Reader_Writer >
+void
+read_vector_items(
+	std::vector< T, A > & vec,
+	const rapidjson::Value & object,
+	const Reader_Writer &,
+	std::true_type /*use_fast_path*/ )
+{
+	// NOTE: there is no difference between the usual reading and
+	// reuse mode for numbers.
+	vec.resize( object.Size() );
+	numeric_arrays::read_numbers( vec.data(), object );
+}
+
+template< typename T, typename A, typename Reader_Writer >
+void
+read_vector_items(
+	std::vector< T, A > & vec,
+	const rapidjson::Value & object,
+	const Reader_Writer & reader_writer,
+	std::false_type /*use_fast_path*/ )
+{
+	// Old items are overwritten only in reuse mode.
+	if( !reuse_mode_t::active() )
+		vec.clear();
+
+	reuse::overwrite_items( vec, object, reader_writer );
+}
+
+} /* namespace details */
+
+//
+// ARRAY
+//
+
+template< typename T, typename A, typename Reader_Writer >
+void
+read_json_value(
+	std::vector< T, A > & vec,
+	const rapidjson::Value & object,
+	const Reader_Writer & reader_writer )
+{
+	const details::reading_scope_t scope{ vec };
+
+	if( object.IsArray() )
+		details::read_vector_items( vec, object, reader_writer,
+				details::numeric_arrays::use_fast_path_t< T, Reader_Writer >{} );
+	else
+		report_error( error_code_t::type_mismatch, "value is not an array" );
+}
+
+namespace details
+{
+
+template< typename T >
+struct std_vector_item_read_access_type
+{
+	using type = const T&;
+};
+
+// since v.0.2.3
+// std::vector<bool> must be processed different way.
+template<>
+struct std_vector_item_read_access_type<bool>
+{
+	using type = const bool;
+};
+
+template< typename T, typename A, typename Reader_Writer >
+void
+write_vector_items(
+	const std::vector< T, A > & vec,
+	rapidjson::Value & object,
+	rapidjson::MemoryPoolAllocator<> & allocator,
+	const Reader_Writer &,
+	std::true_type /*use_fast_path*/ )
+{
+	numeric_arrays::write_numbers( vec.data(), vec.size(), object, allocator );
+}
+
+template< typename T, typename A, typename Reader_Writer >
+void
+write_vector_items(
+	const std::vector< T, A > & vec,
+	rapidjson::Value & object,
+	rapidjson::MemoryPoolAllocator<> & allocator,
+	const Reader_Writer & reader_writer,
+	std::false_type /*use_fast_path*/ )
+{
+	object.SetArray();
+	object.Reserve( static_cast< rapidjson::SizeType >( vec.size() ), allocator );
+	for( typename std_vector_item_read_access_type<T>::type v : vec )
+	{
+		rapidjson::Value o;
+		reader_writer.write( v, o, allocator );
+		object.PushBack( o, allocator );
+	}
+}
+
+} /* namespace details */
+
+template< typename T, typename A, typename Reader_Writer >
+void
+write_json_value(
+	const std::vector< T, A > & vec,
+	rapidjson::Value & object,
+	rapidjson::MemoryPoolAllocator<> & allocator,
+	const Reader_Writer & reader_writer )
+{
+	details::write_vector_items( vec, object, allocator, reader_writer,
+			details::numeric_arrays::use_fast_path_t< T, Reader_Writer >{} );
+}
+
+//
+// std::array
+//
+
+namespace details
+{
+
+template< typename T, std::size_t N, typename Reader_Writer >
+void
+read_array_items(
+	std::array< T, N > & arr,
+	const rapidjson::Value & object,
+	const Reader_Writer &,
+	std::true_type /*use_fast_path*/ )
+{
+	numeric_arrays::read_numbers( arr.data(), object );
+}
+
+template< typename T, std::size_t N, typename Reader_Writer >
+void
+read_array_items(
+	std::array< T, N > & arr,
+	const rapidjson::Value & object,
+	const Reader_Writer & reader_writer,
+	std::false_type /*use_fast_path*/ )
+{
+	for_each_index( object.Size(), [&]( rapidjson::SizeType i ) {
+			read_owned( reader_writer, arr[ i ], object[ i ] );
+		} );
+}
+
+template< typename T, std::size_t N, typename Reader_Writer >
+void
+write_array_items(
+	const std::array< T, N > & arr,
+	rapidjson::Value & object,
+	rapidjson::MemoryPoolAllocator<> & allocator,
+	const Reader_Writer &,
+	std::true_type /*use_fast_path*/ )
+{
+	numeric_arrays::write_numbers( arr.data(), N, object, allocator );
+}
+
+template< typename T, std::size_t N, typename Reader_Writer >
+void
+write_array_items(
+	const std::array< T, N > & arr,
+	rapidjson::Value & object,
+	rapidjson::MemoryPoolAllocator<> & allocator,
+	const Reader_Writer & reader_writer,
+	std::false_type /*use_fast_path*/ )
+{
+	object.SetArray();
+	object.Reserve( static_cast< rapidjson::SizeType >( N ), allocator );
+	for( const auto & v : arr )
+	{
+		rapidjson::Value o;
+		reader_writer.write( v, o, allocator );
+		object.PushBack( o, allocator );
+	}
+}
+
+} /* namespace details */
+
+template< typename T, std::size_t N, typename Reader_Writer >
+void
+read_json_value(
+	std::array< T, N > & arr,
+	const rapidjson::Value & object,
+	const Reader_Writer & reader_writer )
+{
+	const details::reading_scope_t scope{ arr };
+
+	if( !object.IsArray() )
+		return report_error( error_code_t::type_mismatch, "value is not an array" );
+
+	if( N != object.Size() )
+		return report_error( error_code_t::invalid_size,
+				"invalid size of array: " + std::to_string( object.Size() ) +
+				" (expected " + std::to_string( N ) + ")" );
+
+	details::read_array_items( arr, object, reader_writer,
+			details::numeric_arrays::use_fast_path_t< T, Reader_Writer >{} );
+}
+
+template< typename T, std::size_t N, typename Reader_Writer >
+void
+write_json_value(
+	const std::array< T, N > & arr,
+	rapidjson::Value & object,
+	rapidjson::MemoryPoolAllocator<> & allocator,
+	const Reader_Writer & reader_writer )
+{
+	details::write_array_items( arr, object, allocator, reader_writer,
+			details::numeric_arrays::use_fast_path_t< T, Reader_Writer >{} );
+}
+
+//
+// STL-like non-associative containers.
+//
+template< typename C, typename Reader_Writer >
+std::enable_if_t<
+		details::meta::is_stl_like_sequence_container<C>::value,
+		void >
+read_json_value(
+	C & cnt,
+	const rapidjson::Value & object,
+	const Reader_Writer & reader_writer )
+{
+	const details::reading_scope_t scope{ cnt };
+
+	if( object.IsArray() )
+	{
+		if( reuse_mode_t::active() )
+		{
+			details::reuse::overwrite_items( cnt, object, reader_writer );
+			return;
+		}
+
+		cnt.clear();
+		details::sequence_containers::reserve( cnt, object.Size() );
+		details::sequence_containers::read_items( cnt, object, reader_writer,
+				details::meta::has_mutable_items< C >{} );
+	}
+	else
+		report_error( error_code_t::type_mismatch, "value is not an array" );
+}
+
+template< typename C, typename Reader_Writer >
+std::enable_if_t<
+		details::meta::is_stl_like_sequence_container<C>::value,
+		void >
+write_json_value(
+	const C & cnt,
+	rapidjson::Value & object,
+	rapidjson::MemoryPoolAllocator<> & allocator,
+	const Reader_Writer & reader_writer )
+{
+	object.SetArray();
+	details::sequence_containers::reserve_array( object, cnt, allocator );
+	for( const auto & v : cnt )
+	{
+		rapidjson::Value o;
+		reader_writer.write( v, o, allocator );
+		object.PushBack( o, allocator );
+	}
+}
+
+//
+// STL-set-like associative containers.
+//
+template< typename C, typename Reader_Writer >
+std::enable_if_t<
+		details::meta::is_stl_set_like_associative_container<C>::value,
+		void >
+read_json_value(
+	C & cnt,
+	const rapidjson::Value & object,
+	const Reader_Writer & reader_writer )
+{
+	const details::reading_scope_t scope{ cnt };
+
+	if( !object.IsArray() )
+		return report_error( error_code_t::type_mismatch,
+				"value can't be deserialized into std::set-like container!" );
+
+	cnt.clear();
+	details::associative_containers::reserve( cnt, object.Size() );
+	details::for_each_index( object.Size(), [&]( rapidjson::SizeType i ) {
+			typename C::value_type v{};
+			details::read_owned( reader_writer, v, object[ i ] );
+			details::associative_containers::emplace_item( cnt, std::move(v) );
+		} );
+}
+
+/*
+ * NOTE. There is no a special handling for multiset cases.
+ * All values from the container are deserialized.
+ *
+ * It it possible to check for duplicates of keys in the containers.
+ * But this check has performance penalty. So at v.0.2.8 there is no
+ * such check.
+ */
+template< typename C, typename Reader_Writer >
+std::enable_if_t<
+		details::meta::is_stl_set_like_associative_container<C>::value,
+		void >
+write_json_value(
+	const C & cnt,
+	rapidjson::Value & object,
+	rapidjson::MemoryPoolAllocator<> & allocator,
+	const Reader_Writer & reader_writer )
+{
+	const auto write_item =
+			[&object, &allocator, &reader_writer]( const auto & v ) {
+				rapidjson::Value o;
+				reader_writer.write( v, o, allocator );
+				object.PushBack( o, allocator );
+			};
+
+	object.SetArray();
+	details::sequence_containers::reserve_array( object, cnt, allocator );
+	for( const auto & v : cnt )
+		write_item( v );
+}
+
+//
+// STL-map-like associative containers.
+//
+template< typename C, typename Reader_Writer >
+std::enable_if_t<
+		details::meta::is_stl_map_like_associative_container<C>::value,
+		void >
+read_json_value(
+	C & cnt,
+	const rapidjson::Value & object,
+	const Reader_Writer & reader_writer )
+{
+	const details::reading_scope_t scope{ cnt };
+
+	if( !object.IsObject() )
+		return report_error( error_code_t::type_mismatch,
+				"value can't be deserialized into std::map-like container!" );
+
+	if( reuse_mode_t::active() &&
+			details::reuse::overwrite_mapped_values( cnt, object, reader_writer ) )
+		return;
+
+	cnt.clear();
+	details::associative_containers::reserve( cnt, object.MemberCount() );
+	details::for_each_member( object,
+		[&]( const rapidjson::Value::Member & member ) {
+			typename C::key_type key{};
+
+			// It is necessary to have mutable_key_ref as a lvalue to pass
+			// a non-const reference to it to read() method of the
+			// reader_writer.
+			auto mutable_key_ref = mutable_map_key(key);
+			reader_writer.read( mutable_key_ref, member.name );
+
+			// The value is read in place. The value for a duplicate key
+			// is read into a temporary and ignored.
+			const auto slot = details::associative_containers::emplace_key(
+					cnt, std::move(key) );
+			if( slot.m_inserted )
+				details::read_owned( reader_writer, slot.m_it->second, member.value );
+			else
+			{
+				typename C::mapped_type value{};
+				details::read_owned( reader_writer, value, member.value );
+			}
+		} );
+}
+
+/*
+ * NOTE. There is no a special handling for multimap cases.
+ * All values from the container are deserialized.
+ *
+ * It it possible to check for duplicates of keys in the containers.
+ * But this check has performance penalty. So at v.0.2.8 there is no
+ * such check.
+ */
+template< typename C, typename Reader_Writer >
+std::enable_if_t<
+		details::meta::is_stl_map_like_associative_container<C>::value,
+		void >
+write_json_value(
+	const C & cnt,
+	rapidjson::Value & object,
+	rapidjson::MemoryPoolAllocator<> & allocator,
+	const Reader_Writer & reader_writer )
+{
+	const auto write_item =
+			[&object, &allocator, &reader_writer]( const auto & kv ) {
+				rapidjson::Value key;
+				rapidjson::Value value;
+
+				// It is necessary to have const_key_ref as a lvalue to pass a
+				// const reference to it to write() method of the reader_writer.
+				auto const_key_ref = const_map_key(kv.first);
+				reader_writer.write( const_key_ref, key, allocator );
+				reader_writer.write( kv.second, value, allocator );
+
+				object.AddMember( key, value, allocator );
+			};
+
+	object.SetObject();
+	for( const auto & kv : cnt )
+		write_item( kv );
+}
+
+//
+// Support for to_json/from_json for STL-like containers.
+// Since v.0.2.8
+//
+namespace details {
+
+template< typename C >
+struct stl_like_container_reader_t {
+	C & m_dest;
+
+	void
+	read_from( const rapidjson::Value & from ) const
+	{
+		read_json_value( m_dest, from );
+	}
+};
+
+template< typename C >
+struct stl_like_container_writer_t {
+	const C & m_src;
+
+	void
+	write_to(
+		rapidjson::Value & to,
+		rapidjson::MemoryPoolAllocator<> & allocator ) const
+	{
+		write_json_value( m_src, to, allocator );
+	}
+};
+
+} /* namespace details */
+
+template< typename C >
+std::enable_if_t<
+		details::meta::is_stl_like_container<C>::value,
+		void >
+json_io( json_input_t & from, C & what )
+{
+	from & details::stl_like_container_reader_t<C>{ what };
+}
+
+// NOTE: argument 'what' is not const.
+// It is required by implementation of operator<<() below.
+template< typename C >
+std::enable_if_t<
+		details::meta::is_stl_like_container<C>::value,
+		void >
+json_io( json_output_t & from, C & what )
+{
+	from & details::stl_like_container_writer_t<C>{ what };
+}
+
+//
+// Funcs for handling nullable property.
+//
+
+/*!
+ * @brief Default handler of null value for non-nullable attribute.
+ *
+ * Throws an exception because non-nullable attribute can't receive null value.
+ *
+ * Is has name `default_on_null` since v.0.3.0.
+ */
+template< typename Field_Type >
+void
+default_on_null( Field_Type & )
+{
+	report_error( error_code_t::null_value, "non nullable field is null" );
+}
+
+/*!
+ * @brief Default handler of null value for nullable attribute.
+ *
+ * Calls `reset` for @a f.
+ *
+ * It has name `default_on_null` since v.0.3.0.
+ */
+template< typename Field_Type >
+void
+default_on_null( nullable_t< Field_Type > & f )
+{
+	f.reset();
+}
+
+template< typename Field_Type, typename Field_Default_Value_Type >
+void
+set_default_value( Field_Type & f, Field_Default_Value_Type && default_value )
+{
+	f = std::move( default_value );
+}
+
+template< typename Field_Type, typename Field_Default_Value_Type >
+void
+set_default_value(
+	nullable_t< Field_Type > & f,
+	Field_Default_Value_Type && default_value )
+{
+	f.emplace( std::move( default_value ) );
+}
+
+//
+// mandtatory_attr_t
+//
+
+//! Field set/notset attribute ckecker for mandatory case.
+/*!
+ * This class is intended to be used as Manopt_Policy trait
+ * for field binders.
+ */
+struct mandatory_attr_t
+{
+	template< typename Field_Type >
+	void
+	on_field_not_defined( Field_Type & ) const
+	{
+		report_error(
+				error_code_t::missing_field, "mandatory field doesn't exist" );
+	}
+
+	/*!
+	 * @note
+	 * Since v.0.3.0.
+	 */
+	template< typename Field_Type >
+	void
+	on_null( Field_Type & f ) const
+	{
+		// NOTE: directly use 'default_on_null' from json_dto namespace
+		// to avoid surprises with ADL.
+		json_dto::default_on_null( f );
+	}
+
+	template< typename Field_Type >
+	constexpr bool
+	is_default_value( Field_Type & ) const noexcept
+	{
+		return false;
+	}
+};
+
+//! Field set/notset attribute ckecker for mandatory field.
+/*!
+ * It field value is 'null' in JSON then field will receive
+ * default value.
+ *
+ * This class is intended to be used as Manopt_Policy trait
+ * for field binders.
+ *
+ * @note
+ * Type \a Field_Type has to be DefaultConstructible.
+ *
+ * @since v.0.3.0
+ */
+struct mandatory_attr_with_null_as_default_t
+{
+	template< typename Field_Type >
+	void
+	on_field_not_defined( Field_Type & ) const
+	{
+		report_error( error_code_t::missing_field, "mandatory field doesn't exist" );
+	}
+
+	template< typename Field_Type >
+	void
+	on_null( Field_Type & f ) const
+	{
+		static_assert( std::is_default_constructible<Field_Type>::value,
+				"type Field_Type has to be DefaultConstructible" );
+
+		f = Field_Type{};
+	}
+
+	template< typename Field_Type >
+	constexpr bool
+	is_default_value( Field_Type & ) const noexcept
+	{
+		return false;
+	}
+};
+//
+// optional_attr_t
+//
+
+//! Field set/notset attribute ckecker for optional case with default value.
+template< typename Field_Default_Value_Type >
+struct optional_attr_t
+{
+	optional_attr_t( Field_Default_Value_Type default_value )
+		:	m_default_value{ std::move( default_value ) }
+	{}
+
+	template< typename Field_Type >
+	void
+	on_field_not_defined( Field_Type & f ) const
+	{
+		set_default_value( f, std::move( m_default_value ) );
+	}
+
+	/*!
+	 * @note
+	 * Since v.0.3.0.
+	 */
+	template< typename Field_Type >
+	void
+	on_null( Field_Type & f ) const
+	{
+		// NOTE: directly use 'default_on_null' from json_dto namespace
+		// to avoid surprises with ADL.
+		json_dto::default_on_null( f );
+	}
+
+	template< typename Field_Type >
+	bool
+	is_default_value( nullable_t< Field_Type > & f ) const
+	{
+		return f && *f == m_default_value;
+	}
+
+	template< typename Field_Type >
+	bool
+	is_default_value( Field_Type & f ) const
+	{
+		return f == m_default_value;
+	}
+
+	Field_Default_Value_Type m_default_value;
+};
+
+//
+// optional_attr_null_t
+//
+
+//! Field set/notset attribute checker for optional case with default value.
+struct optional_attr_null_t
+{
+	template< typename Field_Type >
+	void
+	on_field_not_defined( nullable_t< Field_Type > & f ) const noexcept
+	{
+		f.reset();
+	}
+
+	/*!
+	 * @note
+	 * Since v.0.3.0.
+	 */
+	template< typename Field_Type >
+	void
+	on_null( Field_Type & f ) const
+	{
+		// NOTE: directly use 'default_on_null' from json_dto namespace
+		// to avoid surprises with ADL.
+		json_dto::default_on_null( f );
+	}
+
+	template< typename Field_Type >
+	bool
+	is_default_value( nullable_t< Field_Type > & f ) const noexcept
+	{
+		return !f.has_value();
+	}
+};
+
+//
+// optional_nodefault_attr_t
+//
+
+//! Field set/notset attribute ckecker for optional case without default value.
+struct optional_nodefault_attr_t
+{
+	template< typename Field_Type >
+	constexpr void
+	on_field_not_defined( Field_Type & ) const noexcept
+	{}
+
+	/*!
+	 * @note
+	 * Since v.0.3.0.
+	 */
+	template< typename Field_Type >
+	void
+	on_null( Field_Type & f ) const
+	{
+		// NOTE: directly use 'default_on_null' from json_dto namespace
+		// to avoid surprises with ADL.
+		json_dto::default_on_null( f );
+	}
+
+	template< typename Field_Type >
+	constexpr bool
+	is_default_value( Field_Type & ) const noexcept
+	{
+		return false;
+	}
+};
+
+//
+// empty_validator_t
+//
+
+struct empty_validator_t
+{
+	template< typename Field_Type >
+	constexpr void
+	operator () ( const Field_Type & ) const noexcept
+	{}
+};
+
+namespace details
+{
+
+/*!
+ * @brief Validator for lazy_t fields.
+ *
+ * A decoded value is checked immediately, otherwise the check is
+ * deferred until the decoding.
+ *
+ * @since v.0.3.5
+ */
+template< typename Validator >
+struct lazy_validator_t
+{
+	Validator m_validator;
+
+	template< typename T, typename Lazy_Validator >
+	void
+	operator()( const lazy_t< T, Lazy_Validator > & v ) const
+	{
+		if( v.is_decoded() )
+			m_validator( v.get() );
+		else
+			v.defer_validation( m_validator );
+	}
+};
+
+/*!
+ * @brief Type of validator to be stored for a field.
+ *
+ * Validators of lazy_t fields are applied to the decoded values.
+ *
+ * @since v.0.3.5
+ */
+template< typename Field_Type, typename Validator >
+struct field_validator
+{
+	using type = Validator;
+
+	static Validator &&
+	make( Validator && validator ) noexcept { return std::move(validator); }
+};
+
+template< typename T, typename Lazy_Validator, typename Validator >
+struct field_validator< lazy_t< T, Lazy_Validator >, Validator >
+{
+	using type = lazy_validator_t< Validator >;
+
+	static type
+	make( Validator && validator ) { return type{ std::move(validator) }; }
+};
+
+template< typename T, typename Lazy_Validator >
+struct field_validator< lazy_t< T, Lazy_Validator >, empty_validator_t >
+{
+	using type = empty_validator_t;
+
+	static empty_validator_t
+	make( empty_validator_t ) noexcept { return {}; }
+};
+
+} /* namespace details */
+
+//
+// the implementation of default_reader_writer_t
+//
+
+template< typename Field_Type >
+void
+default_reader_writer_t::read(
+	Field_Type & v, const rapidjson::Value & from ) const
+{
+	read_json_value( v, from );
+}
+
+template< typename Field_Type >
+void
+default_reader_writer_t::write(
+	const Field_Type & v,
+	rapidjson::Value & to,
+	rapidjson::MemoryPoolAllocator<> & allocator ) const
+{
+	write_json_value( v, to, allocator );
+}
+
+/*!
+ * @brief A special proxy reader_writer that delegates actual
+ * formatting actions to the nested reader_writer.
+ *
+ * When a custom reader_writer is specified for a field it's applied
+ * to the field itself. For example:
+ * @code
+ * struct my_int_reader_writer {
+ * 	void read(int & v, ...) const {...}
+ * 	void write(const int & v, ...) const {...}
+ * };
+ *
+ * struct my_data {
+ * 	int field_;
+ * 	...
+ * 	template<typename Io> void json_io(Io & io) {
+ * 		io & json_dto::mandatory(my_int_reader_writer{}, "field", field_)
+ * 			...
+ * 			;
+ * 	}
+ * };
+ * @endcode
+ * In that case a reference to integer field `field_` will be passed to
+ * `my_int_reader_writer`. And this is intended behavior.
+ *
+ * But there could be cases when (de)serialized field is a container.
+ * For example, in that case we'll get a compiler error:
+ * @code
+ * struct my_complex_data {
+ * 	std::vector<int> field_;
+ * 	...
+ * 	template<typename Io> void json_io(Io & io) {
+ * 		io & json_dto::mandatory(my_int_reader_writer{}, "field", field_)
+ * 			...
+ * 			;
+ * 	}
+ * };
+ * @endcode
+ * It is because a reference to `vector<int>` will be passed to
+ * `my_int_reader_writer`, but `my_int_reader_writer` expects references
+ * to integers.
+ *
+ * It seems that this problem can be solved by extending `my_int_reader_writer`:
+ * @code
+ * struct my_int_reader_writer {
+ * 	void read(int & v, ...) const {...}
+ * 	void read(std::vector<int> & v, ...) const {...}
+ *
+ * 	void write(const int & v, ...) const {...}
+ * 	void write(const std::vector<int> & v, ...) const {...}
+ * };
+ * @endcode
+ * But this solution doesn't scale well because there are a plenty of
+ * container types. And it's not good to create an overload for every
+ * of them.
+ *
+ * So the template `apply_to_content_t` gives another solution:
+ * @code
+ * struct my_complex_data {
+ * 	std::vector<int> field_;
+ * 	...
+ * 	template<typename Io> void json_io(Io & io) {
+ * 		io & json_dto::mandatory(
+ * 				json_dto::apply_to_content_t<my_int_reader_writer>{},
+ * 				"field", field_)
+ * 			...
+ * 			;
+ * 	}
+ * };
+ * @endcode
+ *
+ * An instance of `apply_to_content_t` holds an instance of an actual
+ * reader_writer type and applies it to every item of container.
+ *
+ * @note
+ * The template `apply_to_content_t` should also be used with
+ * `nullable_t` and `std::optional` if an actual reader_writer has
+ * to be applied to the content of `nullable_t`/`std::optional`:
+ * @code
+ * struct my_data {
+ * 	std::optional<int> weight_;
+ * 	json_dto::nullable_t<int> priority_;
+ * 	...
+ * 	template<typename Io> void json_io(Io & io) {
+ * 		io & json_dto::optional(
+ * 				json_dto::apply_to_content_t<my_int_reader_writer>{},
+ * 				"weight", weight_, std::nullopt)
+ * 			& json_dto::mandatory(
+ * 				json_dto::apply_to_content_t<my_int_reader_writer>{},
+ * 				"priority", priority_)
+ * 		...
+ * 		;
+ * 	}
+ * }
+ * @endcode
+ *
+ * @note
+ * Sometimes `apply_to_content_t` should be nested:
+ * @code
+ * struct my_complex_data {
+ * 	json_dto::nullable_t< std::vector<int> > params_;
+ * 	...
+ * 	template<typename Io> void json_io(Io & io) {
+ * 		io & json_dto::mandatory(
+ * 				// The first occurence of apply_to_content_t is for nullable_t.
+ * 				json_dto::apply_to_content_t<
+ * 					// The second occurence of apply_to_content_t is for std::vector.
+ * 					json_dto::apply_to_content_t<
+ * 						// This is for the content of std::vector.
+ * 						my_int_reader_writer
+ * 					>
+ * 				>{},
+ * 				"params", params_)
+ * 			...
+ * 			;
+ * 	}
+ * };
+ * @endcode
+ *
+ * @since v.0.2.11
+ */
+template< typename Item_Reader_Writer >
+struct apply_to_content_t
+{
+	Item_Reader_Writer m_reader_writer;
+
+	apply_to_content_t() = default;
+
+	apply_to_content_t( const Item_Reader_Writer & initial )
+		:	m_reader_writer{ initial }
+	{}
+
+	apply_to_content_t( Item_Reader_Writer && initial )
+		:	m_reader_writer{ std::move(initial) }
+	{}
+
+	template< typename Field_Type >
+	void
+	read(
+		Field_Type & v, const rapidjson::Value & from ) const
+	{
+		read_json_value( v, from, m_reader_writer );
+	}
+
+	template< typename Field_Type >
+	void
+	write(
+		Field_Type & v,
+		rapidjson::Value & to,
+		rapidjson::MemoryPoolAllocator<> & allocator ) const
+	{
+		write_json_value( v, to, allocator, m_reader_writer );
+	}
+};
+
+namespace details
+{
+
+// Since v.0.3.5.
+// Containers are read by json_dto, items are read by Item_Reader_Writer.
+template< typename Item_Reader_Writer >
+struct is_owned_reader_writer< apply_to_content_t< Item_Reader_Writer > >
+	: public std::true_type {};
+
+} /* namespace details */
+
+//
+// start of SAX-output related stuff
+//
+
+template< typename Writer >
+class json_sax_output_t;
+
+namespace details
+{
+
+namespace sax_output
+{
+
+/*!
+ * @brief Helper for checking the result of a call to a Writer's method.
+ *
+ * Reports an error via report_error() if @a result is false.
+ *
+ * @since v.0.3.5
+ */
+inline void
+ensure_writer_accepted( bool result )
+{
+	if( !result )
+		report_error( error_code_t::write_failed, "SAX writer returns false" );
+}
+
+/*!
+ * @brief Size of a buffer on the stack for a temporary rapidjson::Value.
+ *
+ * Some values can't be written directly into a SAX writer (for example,
+ * values that are handled by user-defined write_json_value or by
+ * custom Reader_Writers). Such values are written into a temporary
+ * rapidjson::Value that uses a pool allocator with a buffer on the stack.
+ * Dynamic memory is used only if that buffer isn't big enough.
+ *
+ * @since v.0.3.5
+ */
+constexpr std::size_t fallback_buffer_size = 512u;
+
+/*!
+ * @brief A pool allocator for temporary values with a buffer on the stack.
+ *
+ * @since v.0.3.5
+ */
+class fallback_allocator_t
+{
+	alignas(std::max_align_t) char m_buffer[ fallback_buffer_size ];
+	rapidjson::MemoryPoolAllocator<> m_allocator{ m_buffer, sizeof(m_buffer) };
+
+public:
+	fallback_allocator_t() = default;
+	fallback_allocator_t( const fallback_allocator_t & ) = delete;
+	fallback_allocator_t &
+	operator=( const fallback_allocator_t & ) = delete;
+
+	rapidjson::MemoryPoolAllocator<> &
+	get() noexcept { return m_allocator; }
+};
+
+/*!
+ * @brief Write a value via a temporary rapidjson::Value.
+ *
+ * This is the way for all values that can't be handled by json_dto
+ * directly (values with custom Reader_Writers, types with user-defined
+ * write_json_value and so on). The output is the same as in the case
+ * of DOM-based serialization.
+ *
+ * @since v.0.3.5
+ */
+template< typename Reader_Writer, typename Field_Type, typename Writer >
+void
+write_via_dom(
+	const Reader_Writer & reader_writer,
+	Field_Type & v,
+	Writer & writer )
+{
+	fallback_allocator_t allocator;
+	rapidjson::Value value;
+
+	reader_writer.write( v, value, allocator.get() );
+
+	ensure_writer_accepted( value.Accept( writer ) );
+}
+
+/*!
+ * @brief Write a content of an object into SAX writer member by member.
+ *
+ * It's expected that StartObject/EndObject are called by the caller.
+ *
+ * @since v.0.3.5
+ */
+template< typename Writer >
+void
+write_object_members(
+	const rapidjson::Value & object,
+	Writer & writer )
+{
+	for( auto it = object.MemberBegin(); it != object.MemberEnd(); ++it )
+	{
+		ensure_writer_accepted( writer.Key(
+				it->name.GetString(),
+				it->name.GetStringLength() ) );
+		ensure_writer_accepted( it->value.Accept( writer ) );
+	}
+}
+
+//
+// sized_writer_t
+//
+/*!
+ * @brief Writer into rapidjson::StringBuffer that provides the current
+ * offset in the output.
+ *
+ * It's used by to_json_sax(). The offset allows instrumentation
+ * to know the size of JSON text produced for every field.
+ *
+ * @since v.0.3.5
+ */
+template< typename Base_Writer >
+class sized_writer_t : public Base_Writer
+{
+public:
+	explicit sized_writer_t( rapidjson::StringBuffer & buffer )
+		:	Base_Writer{ buffer }
+		,	m_position{ &buffer, &buffer_size }
+	{}
+
+	const instrumentation::text_position_t &
+	text_position() const noexcept { return m_position; }
+
+private:
+	const instrumentation::text_position_t m_position;
+
+	static std::size_t
+	buffer_size( const void * buffer )
+	{
+		return static_cast< const rapidjson::StringBuffer * >( buffer )
+				->GetSize();
+	}
+};
+
+//
+// text_position_of
+//
+/*!
+ * @brief Get the offset in the output of @a writer.
+ *
+ * It's nullptr if @a writer doesn't provide it.
+ *
+ * @since v.0.3.5
+ */
+template< typename Writer >
+const instrumentation::text_position_t *
+text_position_of( const Writer & ) noexcept
+{
+	return nullptr;
+}
+
+template< typename Base_Writer >
+const instrumentation::text_position_t *
+text_position_of( const sized_writer_t< Base_Writer > & writer ) noexcept
+{
+	return &writer.text_position();
+}
+
+//
+// has_write_to_sax
+//
+/*!
+ * @brief Detector of write_to_sax method in a binder.
+ *
+ * Custom binders (or custom specializations of
+ * binder_write_to_implementation_t) may have no write_to_sax method.
+ * They are handled via temporary rapidjson::Value.
+ *
+ * @since v.0.3.5
+ */
+template< typename Binder, typename Writer, typename = meta::void_t<> >
+struct has_write_to_sax : public std::false_type {};
+
+template< typename Binder, typename Writer >
+struct has_write_to_sax<
+		Binder,
+		Writer,
+		meta::void_t<
+			decltype(std::declval<const Binder &>().write_to_sax(
+					std::declval<Writer &>()))
+		>
+	> : public std::true_type {};
+
+//
+// has_static_write_to_sax
+//
+/*!
+ * @brief Detector of static write_to_sax method in an implementation
+ * of binder's write operation.
+ *
+ * User-defined specializations of binder_write_to_implementation_t
+ * may have no write_to_sax method.
+ *
+ * @since v.0.3.5
+ */
+template<
+	typename Write_To_Impl,
+	typename Data_Holder,
+	typename Writer,
+	typename = meta::void_t<> >
+struct has_static_write_to_sax : public std::false_type {};
+
+template< typename Write_To_Impl, typename Data_Holder, typename Writer >
+struct has_static_write_to_sax<
+		Write_To_Impl,
+		Data_Holder,
+		Writer,
+		meta::void_t<
+			decltype(Write_To_Impl::write_to_sax(
+					std::declval<const Data_Holder &>(),
+					std::declval<Writer &>()))
+		>
+	> : public std::true_type {};
+
+/*!
+ * @brief Pass a binder to SAX writer.
+ *
+ * Binder's write_to_sax is used if it is present.
+ * Otherwise binder's write_to is called for a temporary object and
+ * then the content of that object is passed to the writer.
+ *
+ * @since v.0.3.5
+ */
+template< typename Binder, typename Writer >
+std::enable_if_t< has_write_to_sax< Binder, Writer >::value, void >
+write_binder( const Binder & binder, Writer & writer )
+{
+	binder.write_to_sax( writer );
+}
+
+template< typename Binder, typename Writer >
+std::enable_if_t< !has_write_to_sax< Binder, Writer >::value, void >
+write_binder( const Binder & binder, Writer & writer )
+{
+	fallback_allocator_t allocator;
+	rapidjson::Value object{ rapidjson::kObjectType };
+
+	binder.write_to( object, allocator.get() );
+
+	write_object_members( object, writer );
+}
+
+//
+// Detection of json_io for a type.
+//
+namespace json_io_detection
+{
+
+/*!
+ * @brief A type of probe Io object.
+ *
+ * It's a template with json_output_t as a parameter in order to make
+ * json_dto namespace an associated namespace for ADL (because
+ * non-intrusive json_io are often defined in json_dto namespace).
+ */
+template< typename T >
+struct probe_io_t {};
+
+struct probe_result_t {};
+
+/*!
+ * @brief Probe function.
+ *
+ * If there is a user-defined non-intrusive template
+ * `template<typename Io> void json_io(Io &, Dto &)` then a call to json_io
+ * with probe_io_t will be ambiguous. Otherwise this probe will be selected.
+ */
+template< typename Dto >
+probe_result_t
+json_io( probe_io_t< json_output_t > &, Dto & );
+
+template< typename Dto, typename = meta::void_t<> >
+struct has_free_json_io : public std::true_type {};
+
+template< typename Dto >
+struct has_free_json_io<
+		Dto,
+		meta::void_t<
+			std::enable_if_t<
+				std::is_same<
+					probe_result_t,
+					decltype(json_io(
+							std::declval< probe_io_t< json_output_t > & >(),
+							std::declval< Dto & >() ))
+				>::value
+			>
+		>
+	> : public std::false_type {};
+
+} /* namespace json_io_detection */
+
+template< typename Dto, typename Io, typename = meta::void_t<> >
+struct has_member_json_io : public std::false_type {};
+
+template< typename Dto, typename Io >
+struct has_member_json_io<
+		Dto,
+		Io,
+		meta::void_t<
+			decltype(std::declval< Dto & >().json_io( std::declval< Io & >() ))
+		>
+	> : public std::true_type {};
+
+/*!
+ * @brief Detector of a json_io that can be used with the specified Io
+ * (json_sax_output_t or json_sax_input_t).
+ *
+ * @note
+ * Class types only are checked. It's because json_io can't be
+ * defined for a fundamental type.
+ *
+ * @since v.0.3.5
+ */
+template< typename Dto, typename Io >
+struct has_json_io
+{
+	static constexpr bool value =
+			std::is_class< Dto >::value &&
+			( has_member_json_io< Dto, Io >::value ||
+			  json_io_detection::has_free_json_io< Dto >::value );
+};
+
+//
+// Detection of user-defined write_json_value for a type.
+//
+// Since v.0.3.5.
+//
+namespace write_json_value_detection
+{
+
+using ::json_dto::write_json_value;
+
+struct probe_result_t {};
+
+/*!
+ * @brief Probe function.
+ *
+ * It's as specialized as the generic write_json_value for DTO, so
+ * a call to write_json_value is ambiguous if there is no more specific
+ * overload for a type. If there is a user-defined overload for the type
+ * it's selected instead of both templates.
+ */
+template< typename Dto >
+probe_result_t
+write_json_value(
+	const Dto &,
+	rapidjson::Value &,
+	rapidjson::MemoryPoolAllocator<> & );
+
+template< typename Dto, typename = meta::void_t<> >
+struct has_user_write_json_value : public std::false_type {};
+
+template< typename Dto >
+struct has_user_write_json_value<
+		Dto,
+		meta::void_t<
+			std::enable_if_t<
+				!std::is_same<
+					probe_result_t,
+					decltype(write_json_value(
+							std::declval< const Dto & >(),
+							std::declval< rapidjson::Value & >(),
+							std::declval< rapidjson::MemoryPoolAllocator<> & >() ))
+				>::value
+			>
+		>
+	> : public std::true_type {};
+
+} /* namespace write_json_value_detection */
+
+//
+// Detection of a way of SAX-serialization for a value.
+//
+
+//! Kinds of values that can be written into SAX writer directly.
+enum class value_kind_t
+{
+	//! Value has to be written via temporary rapidjson::Value.
+	via_dom,
+	scalar,
+	string,
+	string_ref,
+	string_view,
+	document,
+	raw_json,
+	lazy,
+	nullable,
+	optional,
+	//! std::vector or std::array of numbers.
+	numbers,
+	sequence,
+	map,
+	dto
+};
+
+template< typename T >
+struct is_string_view : public std::false_type {};
+
+template<>
+struct is_string_view< string_view_t > : public std::true_type {};
+
+#if defined( JSON_DTO_SUPPORTS_STD_STRING_VIEW )
+template<>
+struct is_string_view< std::string_view > : public std::true_type {};
+#endif
+
+template< typename T >
+struct is_sax_scalar
+{
+	static constexpr bool value =
+			std::is_same< T, bool >::value ||
+			std::is_same< T, std::int8_t >::value ||
+			std::is_same< T, std::uint8_t >::value ||
+			std::is_same< T, std::int16_t >::value ||
+			std::is_same< T, std::uint16_t >::value ||
+			std::is_same< T, std::int32_t >::value ||
+			std::is_same< T, std::uint32_t >::value ||
+			std::is_same< T, std::int64_t >::value ||
+			std::is_same< T, std::uint64_t >::value ||
+			std::is_same< T, float >::value ||
+			std::is_same< T, double >::value;
+};
+
+template< typename T >
+struct is_lazy : public std::false_type {};
+
+template< typename T, typename Validator >
+struct is_lazy< lazy_t< T, Validator > > : public std::true_type {};
+
+template< typename T >
+struct is_nullable : public std::false_type {};
+
+template< typename T >
+struct is_nullable< nullable_t< T > > : public std::true_type {};
+
+template< typename T >
+struct is_optional : public std::false_type {};
+
+#if defined( JSON_DTO_SUPPORTS_STD_OPTIONAL )
+template< typename T >
+struct is_optional< cpp17::optional< T > > : public std::true_type {};
+#endif
+
+/*!
+ * @brief Metafunction for Reader_Writers that are applied to the content
+ * of nullable_t, std::optional and containers.
+ *
+ * For default_reader_writer_t it's default_reader_writer_t itself.
+ * For apply_to_content_t it's the nested Reader_Writer.
+ * Other Reader_Writers are not known for json_dto and values
+ * with them are handled via temporary rapidjson::Value.
+ */
+template< typename Reader_Writer >
+struct content_reader_writer
+{
+	static constexpr bool is_known = false;
+};
+
+template<>
+struct content_reader_writer< default_reader_writer_t >
+{
+	static constexpr bool is_known = true;
+
+	static const default_reader_writer_t &
+	get( const default_reader_writer_t & rw ) noexcept { return rw; }
+};
+
+template< typename Item_Reader_Writer >
+struct content_reader_writer< apply_to_content_t< Item_Reader_Writer > >
+{
+	static constexpr bool is_known = true;
+
+	static const Item_Reader_Writer &
+	get( const apply_to_content_t< Item_Reader_Writer > & rw ) noexcept
+	{
+		return rw.m_reader_writer;
+	}
+};
+
+template< typename Reader_Writer, typename T, typename Io >
+constexpr value_kind_t
+detect_value_kind() noexcept
+{
+	constexpr bool is_default_rw =
+			std::is_same< Reader_Writer, default_reader_writer_t >::value;
+	constexpr bool is_content_rw =
+			content_reader_writer< Reader_Writer >::is_known;
+
+	return
+		( is_default_rw && is_sax_scalar< T >::value ) ?
+			value_kind_t::scalar :
+		( is_default_rw && std::is_same< T, std::string >::value ) ?
+			value_kind_t::string :
+		( is_default_rw && std::is_same< T, string_ref_t >::value ) ?
+			value_kind_t::string_ref :
+		( is_default_rw && is_string_view< T >::value ) ?
+			value_kind_t::string_view :
+		( is_default_rw && std::is_same< T, rapidjson::Document >::value ) ?
+			value_kind_t::document :
+		( is_default_rw && std::is_same< T, raw_json_t >::value ) ?
+			value_kind_t::raw_json :
+		( is_default_rw && is_lazy< T >::value ) ?
+			value_kind_t::lazy :
+		( is_content_rw && is_nullable< T >::value ) ?
+			value_kind_t::nullable :
+		( is_content_rw && is_optional< T >::value ) ?
+			value_kind_t::optional :
+		( is_default_rw && numeric_arrays::is_number_array< T >::value ) ?
+			value_kind_t::numbers :
+		( is_content_rw && (
+				meta::is_stl_like_sequence_container< T >::value ||
+				meta::is_stl_set_like_associative_container< T >::value ) ) ?
+			value_kind_t::sequence :
+		( is_content_rw &&
+				meta::is_stl_map_like_associative_container< T >::value ) ?
+			value_kind_t::map :
+		( is_default_rw && has_json_io< T, Io >::value ) ?
+			value_kind_t::dto :
+			value_kind_t::via_dom;
+}
+
+/*!
+ * @brief Detector of a kind of value for writing.
+ *
+ * A user-defined write_json_value has precedence over json_io, as it
+ * has for to_json. Such DTOs are written via temporary rapidjson::Value.
+ *
+ * @since v.0.3.5
+ */
+template< typename Reader_Writer, typename T, typename Io >
+constexpr value_kind_t
+detect_output_value_kind() noexcept
+{
+	return
+		( value_kind_t::dto == detect_value_kind< Reader_Writer, T, Io >() &&
+				write_json_value_detection::has_user_write_json_value< T >::value ) ?
+			value_kind_t::via_dom :
+			detect_value_kind< Reader_Writer, T, Io >();
+}
+
+template< value_kind_t Kind >
+using value_kind_tag_t = std::integral_constant< value_kind_t, Kind >;
+
+/*!
+ * @brief The main function for writing a value into SAX writer.
+ *
+ * Values are written directly if it's possible (if default_reader_writer_t
+ * or apply_to_content_t are used for them). Other values are written
+ * via temporary rapidjson::Value.
+ *
+ * @since v.0.3.5
+ */
+template< typename Reader_Writer, typename Field_Type, typename Writer >
+void
+write_value(
+	const Reader_Writer & reader_writer,
+	Field_Type & v,
+	Writer & writer );
+
+//
+// Writers for scalar values.
+//
+// NOTE: the actual writer's methods are selected the same way
+// as rapidjson::Value::Accept does.
+//
+template< typename Writer >
+void
+write_scalar( bool v, Writer & writer )
+{
+	ensure_writer_accepted( writer.Bool( v ) );
+}
+
+template< typename Writer >
+void
+write_scalar( std::int64_t v, Writer & writer )
+{
+	if( v >= std::numeric_limits< std::int32_t >::min() &&
+			v <= std::numeric_limits< std::int32_t >::max() )
+		ensure_writer_accepted( writer.Int( static_cast< int >( v ) ) );
+	else if( v > 0 && v <= std::numeric_limits< std::uint32_t >::max() )
+		ensure_writer_accepted( writer.Uint( static_cast< unsigned >( v ) ) );
+	else
+		ensure_writer_accepted( writer.Int64( v ) );
+}
+
+template< typename Writer >
+void
+write_scalar( std::uint64_t v, Writer & writer )
+{
+	if( v <= static_cast< std::uint64_t >(
+			std::numeric_limits< std::int64_t >::max() ) )
+		write_scalar( static_cast< std::int64_t >( v ), writer );
+	else
+		ensure_writer_accepted( writer.Uint64( v ) );
+}
+
+template< typename Writer >
+void
+write_scalar( std::int32_t v, Writer & writer )
+{
+	ensure_writer_accepted( writer.Int( v ) );
+}
+
+template< typename Writer >
+void
+write_scalar( std::uint32_t v, Writer & writer )
+{
+	write_scalar( static_cast< std::int64_t >( v ), writer );
+}
+
+template< typename Writer >
+void
+write_scalar( std::int16_t v, Writer & writer )
+{
+	ensure_writer_accepted( writer.Int( v ) );
+}
+
+template< typename Writer >
+void
+write_scalar( std::uint16_t v, Writer & writer )
+{
+	ensure_writer_accepted( writer.Int( v ) );
+}
+
+template< typename Writer >
+void
+write_scalar( std::int8_t v, Writer & writer )
+{
+	ensure_writer_accepted( writer.Int( v ) );
+}
+
+template< typename Writer >
+void
+write_scalar( std::uint8_t v, Writer & writer )
+{
+	ensure_writer_accepted( writer.Int( v ) );
+}
+
+template< typename Writer >
+void
+write_scalar( double v, Writer & writer )
+{
+	ensure_writer_accepted( writer.Double( v ) );
+}
+
+template< typename Writer >
+void
+write_scalar( float v, Writer & writer )
+{
+	ensure_writer_accepted( writer.Double( static_cast< double >( v ) ) );
+}
+
+template< typename Reader_Writer, typename Field_Type, typename Writer >
+void
+write_value_impl(
+	value_kind_tag_t< value_kind_t::via_dom >,
+	const Reader_Writer & reader_writer,
+	Field_Type & v,
+	Writer & writer )
+{
+	write_via_dom( reader_writer, v, writer );
+}
+
+template< typename Reader_Writer, typename Field_Type, typename Writer >
+void
+write_value_impl(
+	value_kind_tag_t< value_kind_t::scalar >,
+	const Reader_Writer &,
+	Field_Type & v,
+	Writer & writer )
+{
+	write_scalar( static_cast< std::remove_cv_t< Field_Type > >( v ), writer );
+}
+
+template< typename Reader_Writer, typename Field_Type, typename Writer >
+void
+write_value_impl(
+	value_kind_tag_t< value_kind_t::string >,
+	const Reader_Writer &,
+	Field_Type & v,
+	Writer & writer )
+{
+	const std::string & s = v;
+	constexpr std::string::size_type max_str_len = std::numeric_limits< rapidjson::SizeType >::max();
+
+	if( max_str_len < s.size() )
+	{
+		report_error( error_code_t::out_of_range,
+				"string length is too large: " + std::to_string( s.size() ) +
+				" (max is " + std::to_string( max_str_len ) + ")" );
+		// A placeholder keeps the structure of JSON valid for the writer.
+		ensure_writer_accepted( writer.Null() );
+		return;
+	}
+
+	ensure_writer_accepted( writer.String(
+			s.data(), static_cast< rapidjson::SizeType >( s.size() ), true ) );
+}
+
+template< typename Reader_Writer, typename Field_Type, typename Writer >
+void
+write_value_impl(
+	value_kind_tag_t< value_kind_t::string_ref >,
+	const Reader_Writer &,
+	Field_Type & v,
+	Writer & writer )
+{
+	ensure_writer_accepted( writer.String( v.s, v.length, true ) );
+}
+
+template< typename Reader_Writer, typename Field_Type, typename Writer >
+void
+write_value_impl(
+	value_kind_tag_t< value_kind_t::string_view >,
+	const Reader_Writer &,
+	Field_Type & v,
+	Writer & writer )
+{
+	constexpr std::size_t max_str_len = std::numeric_limits< rapidjson::SizeType >::max();
+
+	if( max_str_len < v.size() )
+	{
+		report_error( error_code_t::out_of_range,
+				"string length is too large: " + std::to_string( v.size() ) +
+				" (max is " + std::to_string( max_str_len ) + ")" );
+		// A placeholder keeps the structure of JSON valid for the writer.
+		ensure_writer_accepted( writer.Null() );
+		return;
+	}
+
+	ensure_writer_accepted( writer.String(
+			v.data(), static_cast< rapidjson::SizeType >( v.size() ), true ) );
+}
+
+template< typename Reader_Writer, typename Field_Type, typename Writer >
+void
+write_value_impl(
+	value_kind_tag_t< value_kind_t::document >,
+	const Reader_Writer &,
+	Field_Type & v,
+	Writer & writer )
+{
+	ensure_writer_accepted( v.Accept( writer ) );
+}
+
+template< typename Reader_Writer, typename Field_Type, typename Writer >
+void
+write_value_impl(
+	value_kind_tag_t< value_kind_t::raw_json >,
+	const Reader_Writer &,
+	Field_Type & v,
+	Writer & writer )
+{
+	if( const auto * value = v.value() )
+		ensure_writer_accepted( value->Accept( writer ) );
+	else if( v.empty() )
+		ensure_writer_accepted( writer.Null() );
+	else
+		ensure_writer_accepted(
+				writer.RawValue( v.text().data(), v.text().size(), v.type() ) );
+}
+
+template< typename Reader_Writer, typename Field_Type, typename Writer >
+void
+write_value_impl(
+	value_kind_tag_t< value_kind_t::lazy >,
+	const Reader_Writer & reader_writer,
+	Field_Type & v,
+	Writer & writer )
+{
+	// The text is written as is if the value isn't modified.
+	if( !v.raw().empty() )
+		write_value( reader_writer, v.raw(), writer );
+	else
+		write_value( reader_writer, v.get(), writer );
+}
+
+template< typename Reader_Writer, typename Field_Type, typename Writer >
+void
+write_value_impl(
+	value_kind_tag_t< value_kind_t::nullable >,
+	const Reader_Writer & reader_writer,
+	Field_Type & v,
+	Writer & writer )
+{
+	const auto & value = v;
+	if( value )
+		write_value(
+				content_reader_writer< Reader_Writer >::get( reader_writer ),
+				*value,
+				writer );
+	else
+		ensure_writer_accepted( writer.Null() );
+}
+
+template< typename Reader_Writer, typename Field_Type, typename Writer >
+void
+write_value_impl(
+	value_kind_tag_t< value_kind_t::optional >,
+	const Reader_Writer & reader_writer,
+	Field_Type & v,
+	Writer & writer )
+{
+	// NOTE: an empty std::optional leaves rapidjson::Value untouched
+	// in write_json_value, so null is written in DOM mode.
+	const auto & value = v;
+	if( value )
+		write_value(
+				content_reader_writer< Reader_Writer >::get( reader_writer ),
+				*value,
+				writer );
+	else
+		ensure_writer_accepted( writer.Null() );
+}
+
+template< typename Reader_Writer, typename Field_Type, typename Writer >
+void
+write_value_impl(
+	value_kind_tag_t< value_kind_t::sequence >,
+	const Reader_Writer & reader_writer,
+	Field_Type & cnt,
+	Writer & writer )
+{
+	const auto & item_reader_writer =
+			content_reader_writer< Reader_Writer >::get( reader_writer );
+
+	ensure_writer_accepted( writer.StartArray() );
+
+	// NOTE: items are accessed via const reference to the container
+	// because of std::vector<bool>.
+	const auto & items_source = cnt;
+
+	rapidjson::SizeType items = 0u;
+	for( const auto & v : items_source )
+	{
+		write_value( item_reader_writer, v, writer );
+		++items;
+	}
+
+	ensure_writer_accepted( writer.EndArray( items ) );
+}
+
+template< typename Reader_Writer, typename Field_Type, typename Writer >
+void
+write_value_impl(
+	value_kind_tag_t< value_kind_t::numbers >,
+	const Reader_Writer &,
+	Field_Type & cnt,
+	Writer & writer )
+{
+	using item_t = typename std::remove_cv_t< Field_Type >::value_type;
+
+	ensure_writer_accepted( writer.StartArray() );
+
+	// NOTE: write_scalar() is resolved for the item type at compile time,
+	// so the loop has no dispatch per item.
+	for( const item_t v : cnt )
+		write_scalar( v, writer );
+
+	ensure_writer_accepted( writer.EndArray(
+			static_cast< rapidjson::SizeType >( cnt.size() ) ) );
+}
+
+/*!
+ * @brief Writer of keys of map-like containers.
+ *
+ * Keys of type std::string with default_reader_writer_t are written
+ * directly. All other keys are written via temporary rapidjson::Value
+ * because a user can have own formatting for const_map_key_t.
+ */
+template< typename Writer >
+void
+write_map_key(
+	const default_reader_writer_t &,
+	const std::string & key,
+	Writer & writer )
+{
+	constexpr std::string::size_type max_str_len = std::numeric_limits< rapidjson::SizeType >::max();
+
+	if( max_str_len < key.size() )
+	{
+		report_error( error_code_t::out_of_range,
+				"string length is too large: " + std::to_string( key.size() ) +
+				" (max is " + std::to_string( max_str_len ) + ")" );
+		// A placeholder keeps the structure of JSON valid for the writer.
+		ensure_writer_accepted( writer.Key( "", 0u, true ) );
+		return;
+	}
+
+	ensure_writer_accepted( writer.Key(
+			key.data(), static_cast< rapidjson::SizeType >( key.size() ), true ) );
+}
+
+template< typename Reader_Writer, typename Key, typename Writer >
+void
+write_map_key(
+	const Reader_Writer & reader_writer,
+	const Key & key,
+	Writer & writer )
+{
+	fallback_allocator_t allocator;
+	rapidjson::Value key_value;
+
+	// It is necessary to have const_key_ref as a lvalue to pass a
+	// const reference to it to write() method of the reader_writer.
+	auto const_key_ref = const_map_key( key );
+	reader_writer.write( const_key_ref, key_value, allocator.get() );
+
+	if( !key_value.IsString() )
+	{
+		report_error( error_code_t::write_failed,
+				"key of map-like container is not serialized as string" );
+		// A placeholder keeps the structure of JSON valid for the writer.
+		ensure_writer_accepted( writer.Key( "", 0u, true ) );
+		return;
+	}
+
+	ensure_writer_accepted( writer.Key(
+			key_value.GetString(), key_value.GetStringLength(), true ) );
+}
+
+template< typename Reader_Writer, typename Field_Type, typename Writer >
+void
+write_value_impl(
+	value_kind_tag_t< value_kind_t::map >,
+	const Reader_Writer & reader_writer,
+	Field_Type & cnt,
+	Writer & writer )
+{
+	const auto & item_reader_writer =
+			content_reader_writer< Reader_Writer >::get( reader_writer );
+
+	ensure_writer_accepted( writer.StartObject() );
+
+	const auto & members_source = cnt;
+
+	rapidjson::SizeType members = 0u;
+	for( const auto & kv : members_source )
+	{
+		write_map_key( item_reader_writer, kv.first, writer );
+		write_value( item_reader_writer, kv.second, writer );
+		++members;
+	}
+
+	ensure_writer_accepted( writer.EndObject( members ) );
+}
+
+template< typename Reader_Writer, typename Field_Type, typename Writer >
+void
+write_value_impl(
+	value_kind_tag_t< value_kind_t::dto >,
+	const Reader_Writer &,
+	Field_Type & v,
+	Writer & writer )
+{
+	ensure_writer_accepted( writer.StartObject() );
+
+	json_sax_output_t< Writer > output{ writer };
+	with_dto_instrumentation< std::remove_cv_t< Field_Type > >( [&] {
+			json_io( output, const_cast< std::remove_cv_t< Field_Type > & >( v ) );
+		} );
+
+	ensure_writer_accepted( writer.EndObject() );
+}
+
+template< typename Reader_Writer, typename Field_Type, typename Writer >
+void
+write_value(
+	const Reader_Writer & reader_writer,
+	Field_Type & v,
+	Writer & writer )
+{
+	using tag_t = value_kind_tag_t<
+			detect_output_value_kind<
+					Reader_Writer,
+					std::remove_cv_t< Field_Type >,
+					json_sax_output_t< Writer > >() >;
+
+	write_value_impl( tag_t{}, reader_writer, v, writer );
+}
+
+/*!
+ * @brief Writing of a top-level value.
+ *
+ * json_io is used for a top-level DTO even if there is a user-defined
+ * write_json_value for it, as it's done by to_json.
+ *
+ * @since v.0.3.5
+ */
+template< typename Dto, typename Writer >
+void
+write_top_level_value( const Dto & dto, Writer & writer )
+{
+	using tag_t = value_kind_tag_t<
+			detect_value_kind<
+					default_reader_writer_t,
+					Dto,
+					json_sax_output_t< Writer > >() >;
+
+	write_value_impl( tag_t{}, default_reader_writer_t{}, dto, writer );
+}
+
+} /* namespace sax_output */
+
+} /* namespace details */
+
+//
+// json_sax_output_t
+//
+
+/*!
+ * @brief Output object for writing DTO directly into a SAX writer.
+ *
+ * Unlike json_output_t there is no intermediate rapidjson::Value:
+ * binders pass their fields directly to @a Writer. It's expected that
+ * @a Writer is rapidjson::Writer, rapidjson::PrettyWriter or a type
+ * with the same interface.
+ *
+ * @note
+ * json_sax_output_t doesn't call StartObject/EndObject, it's
+ * the responsibility of the caller.
+ *
+ * @since v.0.3.5
+ */
+template< typename Writer >
+class json_sax_output_t
+{
+	public:
+		explicit json_sax_output_t( Writer & writer )
+			:	m_writer{ writer }
+		{}
+
+		template< typename Binder >
+		json_sax_output_t &
+		operator & ( const Binder & b )
+		{
+			details::sax_output::write_binder( b, m_writer );
+			return *this;
+		}
+
+	private:
+		Writer & m_writer;
+};
+
+//
+// start of SAX-input related stuff
+//
+
+//
+// projection_t
+//
+
+/*!
+ * @brief A list of fields to be read from the top-level JSON object.
+ *
+ * Only binders for these fields are used by from_json_sax(). Other
+ * members of JSON object are skipped by the parser without building
+ * any values, binders for other fields are ignored (even if the fields
+ * are mandatory and missing).
+ *
+ * Usage example:
+ * @code
+ * const json_dto::projection_t projection{ "id", "time", "price" };
+ * event_t event;
+ * json_dto::from_json_sax( json, event, projection );
+ * @endcode
+ *
+ * @note
+ * The projection is applied to members of the top-level object only.
+ * Nested DTOs of selected fields are read completely.
+ *
+ * @since v.0.3.5
+ */
+class projection_t
+{
+	public:
+		projection_t( std::initializer_list< std::string > names )
+			:	m_names{ names }
+		{}
+
+		explicit projection_t( std::vector< std::string > names )
+			:	m_names{ std::move(names) }
+		{}
+
+		//! Is the field with @a name selected?
+		JSON_DTO_NODISCARD
+		bool
+		contains( const string_ref_t & name ) const noexcept
+		{
+			for( const auto & n : m_names )
+				if( n.size() == name.length &&
+						0 == std::memcmp( n.data(), name.s, name.length ) )
+					return true;
+
+			return false;
+		}
+
+	private:
+		std::vector< std::string > m_names;
+};
+
+namespace details
+{
+
+namespace member_index
+{
+
+//
+// Single-pass reading of object's members.
+//
+// Every binder_t looks for its member via FindMember by default. So reading
+// of an object with N declared fields and M members costs O(N*M).
+// To avoid that names of fields from json_io() are stored in an index
+// once per DTO type. Then all members of an object are distributed between
+// fields in a single pass and binders receive their values directly.
+//
+// The same index is used by SAX parsing for selection of binders
+// for members of an object.
+//
+
+//! Hash function for names of members (FNV-1a).
+inline std::size_t
+hash_name( const char * name, std::size_t length ) noexcept
+{
+	std::uint32_t hash = 2166136261u;
+	for( std::size_t i = 0u; i != length; ++i )
+	{
+		hash ^= static_cast< unsigned char >( name[ i ] );
+		hash *= 16777619u;
+	}
+
+	return hash;
+}
+
+/*!
+ * @brief Index of fields declared in json_io() of a DTO type.
+ *
+ * Fields with the same name share a slot. A value for every slot is
+ * found in a single pass over members of an object.
+ *
+ * @since v.0.3.5
+ */
+class index_t
+{
+public:
+	static constexpr std::size_t npos = ~std::size_t{ 0u };
+
+	//! Create an index for names of fields in the order of declaration.
+	explicit index_t( const std::vector< std::string > & names )
+	{
+		std::size_t capacity = 8u;
+		while( capacity < names.size() * 2u )
+			capacity *= 2u;
+
+		m_mask = capacity - 1u;
+		m_table.assign( capacity, std::size_t{ npos } );
+
+		m_slot_of.reserve( names.size() );
+		for( const auto & name : names )
+		{
+			auto slot = find( name.data(), name.size() );
+			if( npos == slot )
+			{
+				slot = m_names.size();
+				m_names.push_back( name );
+				insert( slot );
+			}
+
+			m_slot_of.push_back( slot );
+		}
+
+		// Initially members are expected in the order of declaration.
+		m_next.reset( new std::atomic< std::size_t >[ m_names.size() + 1u ] );
+		for( std::size_t i = 0u; i != m_names.size(); ++i )
+			m_next[ i ].store( i + 1u, std::memory_order_relaxed );
+		m_next[ m_names.size() ].store( 0u, std::memory_order_relaxed );
+	}
+
+	//! Count of unique names.
+	std::size_t
+	slots() const noexcept { return m_names.size(); }
+
+	//! Count of binders in json_io().
+	std::size_t
+	binders() const noexcept { return m_slot_of.size(); }
+
+	//! Get the slot for a binder.
+	/*!
+	 * @return npos if json_io() declared another field at
+	 * that position when the index was created.
+	 */
+	std::size_t
+	slot_for_binder(
+		std::size_t position,
+		const string_ref_t & name ) const noexcept
+	{
+		if( position < m_slot_of.size() )
+		{
+			const auto slot = m_slot_of[ position ];
+			const auto & expected = m_names[ slot ];
+			if( expected.size() == name.length &&
+					0 == std::memcmp( expected.data(), name.s, name.length ) )
+				return slot;
+		}
+
+		return npos;
+	}
+
+	//! Get the slot for a binder without checking of its name.
+	/*!
+	 * @attention
+	 * @a position must be less than binders().
+	 */
+	std::size_t
+	slot_of_binder( std::size_t position ) const noexcept
+	{
+		return m_slot_of[ position ];
+	}
+
+	//! Get the slot for a name of member.
+	/*!
+	 * @return npos if there is no field with that name.
+	 */
+	std::size_t
+	slot_of_name( const string_ref_t & name ) const noexcept
+	{
+		return find( name.s, name.length );
+	}
+
+	//! Find values for all slots in @a object.
+	/*!
+	 * Only the first occurrence of a member is used
+	 * (like rapidjson::Value::FindMember does).
+	 *
+	 * The name of every member is compared with the name of the slot
+	 * that is expected at this position first. The hash table is used
+	 * only on a miss. The order of members seen on a miss is remembered,
+	 * so objects that always come with the same order of members
+	 * are handled without lookups even if that order differs from
+	 * the order of declaration.
+	 *
+	 * @attention
+	 * @a values must have slots() items and all of them must be nullptr.
+	 */
+	void
+	fill(
+		const rapidjson::Value & object,
+		const rapidjson::Value ** values ) const noexcept
+	{
+		const auto count = slots();
+		auto prev = count;
+		auto expected = m_next[ prev ].load( std::memory_order_relaxed );
+
+		for( auto it = object.MemberBegin(); it != object.MemberEnd(); ++it )
+		{
+			const auto * name = it->name.GetString();
+			const std::size_t length = it->name.GetStringLength();
+
+			auto slot = expected;
+			if( slot >= count || !name_equals( slot, name, length ) )
+			{
+				slot = find( name, length );
+				if( npos == slot )
+					// Unknown members don't affect the expected order.
+					continue;
+
+				m_next[ prev ].store( slot, std::memory_order_relaxed );
+			}
+
+			if( nullptr == values[ slot ] )
+				values[ slot ] = &it->value;
+
+			prev = slot;
+			expected = m_next[ slot ].load( std::memory_order_relaxed );
+		}
+	}
+
+private:
+	//! Unique names of fields.
+	std::vector< std::string > m_names;
+	//! Slot for every binder from json_io().
+	std::vector< std::size_t > m_slot_of;
+	//! Hash table with slots (open addressing).
+	std::vector< std::size_t > m_table;
+	std::size_t m_mask;
+	//! Slot expected after a slot (the last item is for the first member).
+	/*!
+	 * It is updated by fill() without synchronization: a stale value
+	 * only costs an additional lookup.
+	 */
+	std::unique_ptr< std::atomic< std::size_t >[] > m_next;
+
+	bool
+	name_equals(
+		std::size_t slot,
+		const char * name,
+		std::size_t length ) const noexcept
+	{
+		const auto & candidate = m_names[ slot ];
+		return candidate.size() == length &&
+				0 == std::memcmp( candidate.data(), name, length );
+	}
+
+	std::size_t
+	find( const char * name, std::size_t length ) const noexcept
+	{
+		for( auto i = hash_name( name, length ) & m_mask;; i = ( i + 1u ) & m_mask )
+		{
+			const auto slot = m_table[ i ];
+			if( npos == slot || name_equals( slot, name, length ) )
+				return slot;
+		}
+	}
+
+	void
+	insert( std::size_t slot ) noexcept
+	{
+		const auto & name = m_names[ slot ];
+		auto i = hash_name( name.data(), name.size() ) & m_mask;
+		while( npos != m_table[ i ] )
+			i = ( i + 1u ) & m_mask;
+
+		m_table[ i ] = slot;
+	}
+};
+
+/*!
+ * @brief Storage for the index of a DTO type.
+ *
+ * The index is created after the first successful reading of an object
+ * of that type. Names of fields are recorded during that reading.
+ * Nothing is created after a reading that failed, either by an exception
+ * or by an error stored by try_from_json(), or if some binders
+ * of json_io() can't be read via the index.
+ *
+ * @since v.0.3.5
+ */
+template< typename Dto >
+class index_holder_t
+{
+	std::atomic< const index_t * > m_index{ nullptr };
+
+	index_holder_t() = default;
+
+public:
+	~index_holder_t() { delete m_index.load(); }
+
+	static index_holder_t &
+	instance()
+	{
+		static index_holder_t holder;
+		return holder;
+	}
+
+	const index_t *
+	get() const noexcept { return m_index.load( std::memory_order_acquire ); }
+
+	void
+	publish( std::unique_ptr< index_t > index ) noexcept
+	{
+		const index_t * expected = nullptr;
+		// NOTE: the index could be published by another thread.
+		if( m_index.compare_exchange_strong(
+				expected, index.get(), std::memory_order_acq_rel ) )
+			index.release();
+	}
+};
+
+} /* namespace member_index */
+
+namespace sax_input
+{
+
+class member_dispatcher_t;
+
+} /* namespace sax_input */
+
+} /* namespace details */
+
+//
+// json_sax_input_t
+//
+
+/*!
+ * @brief Input object for reading DTO from events of a SAX parser.
+ *
+ * There is no rapidjson::Value for the whole object, so binders are
+ * passed to a dispatcher that selects a binder for the current member
+ * of JSON object.
+ *
+ * @attention
+ * json_io() for a DTO is called several times during the parsing of
+ * a single JSON object: when a value for a member is found and when
+ * the end of the object is reached. Because of that json_io() should
+ * declare the same binders in the same order every time.
+ *
+ * @since v.0.3.5
+ */
+class json_sax_input_t
+{
+	public:
+		explicit json_sax_input_t(
+			details::sax_input::member_dispatcher_t & dispatcher )
+			:	m_dispatcher{ dispatcher }
+		{}
+
+		template< typename Binder >
+		json_sax_input_t &
+		operator & ( const Binder & b )
+		{
+			b.read_from_dispatcher( m_dispatcher );
+			return *this;
+		}
+
+	private:
+		details::sax_input::member_dispatcher_t & m_dispatcher;
+};
+
+namespace details
+{
+
+namespace sax_input
+{
+
+//! Kind of a compound value.
+enum class compound_kind_t
+{
+	object,
+	array
+};
+
+/*!
+ * @brief Detector of values that don't hold pointers to the source
+ * rapidjson::Value after reading.
+ *
+ * Strings from SAX parser are valid only during a call to the handler.
+ * A temporary rapidjson::Value that refers to such string can be
+ * passed directly only to readers that copy the content of the string.
+ * All other readers receive a copy of the string.
+ *
+ * @since v.0.3.5
+ */
+template< typename T >
+struct is_string_copied_by_default_reader
+{
+	static constexpr bool value =
+			sax_output::is_sax_scalar< T >::value ||
+			std::is_same< T, std::string >::value ||
+			std::is_same< T, raw_json_t >::value;
+};
+
+template< typename T, typename Validator >
+struct is_string_copied_by_default_reader< lazy_t< T, Validator > >
+	:	public std::true_type
+{};
+
+template< typename T >
+struct is_string_copied_by_default_reader< nullable_t< T > >
+	:	public is_string_copied_by_default_reader< T >
+{};
+
+template< typename T >
+struct is_string_copied_by_default_reader< mutable_map_key_t< T > >
+	:	public is_string_copied_by_default_reader< T >
+{};
+
+#if defined( JSON_DTO_SUPPORTS_STD_OPTIONAL )
+template< typename T >
+struct is_string_copied_by_default_reader< cpp17::optional< T > >
+	:	public is_string_copied_by_default_reader< T >
+{};
+#endif
+
+/*!
+ * @brief Detector of values that keep pointers to strings of the source.
+ *
+ * Such values can't be read by SAX parser because its strings aren't
+ * kept after the parsing.
+ *
+ * @since v.0.3.5
+ */
+template< typename T >
+struct is_string_view_for_default_reader
+	:	public sax_output::is_string_view< T >
+{};
+
+template< typename T >
+struct is_string_view_for_default_reader< nullable_t< T > >
+	:	public is_string_view_for_default_reader< T >
+{};
+
+template< typename T >
+struct is_string_view_for_default_reader< mutable_map_key_t< T > >
+	:	public is_string_view_for_default_reader< T >
+{};
+
+#if defined( JSON_DTO_SUPPORTS_STD_OPTIONAL )
+template< typename T >
+struct is_string_view_for_default_reader< cpp17::optional< T > >
+	:	public is_string_view_for_default_reader< T >
+{};
+#endif
+
+template< typename Reader_Writer, typename T >
+struct is_string_copied_by_reader : public std::false_type {};
+
+template< typename T >
+struct is_string_copied_by_reader< default_reader_writer_t, T >
+	:	public is_string_copied_by_default_reader< T >
+{};
+
+/*!
+ * @brief A scalar value (or null) received from SAX parser.
+ *
+ * @since v.0.3.5
+ */
+class scalar_value_t
+{
+	//! The value from the parser.
+	/*!
+	 * @attention
+	 * A string in this value is valid only during the current
+	 * call to the handler.
+	 */
+	const rapidjson::Value & m_value;
+
+	rapidjson::MemoryPoolAllocator<> & m_allocator;
+
+	//! A copy of the string (if it was requested).
+	rapidjson::Value m_copy;
+
+	const rapidjson::Value &
+	for_reading_impl( std::true_type ) noexcept { return m_value; }
+
+	const rapidjson::Value &
+	for_reading_impl( std::false_type ) { return copy(); }
+
+public:
+	scalar_value_t(
+		const rapidjson::Value & value,
+		rapidjson::MemoryPoolAllocator<> & allocator )
+		:	m_value{ value }
+		,	m_allocator{ allocator }
+	{}
+
+	scalar_value_t( const scalar_value_t & ) = delete;
+	scalar_value_t &
+	operator=( const scalar_value_t & ) = delete;
+
+	//! Get the original value.
+	const rapidjson::Value &
+	value() const noexcept { return m_value; }
+
+	//! Get a value that doesn't depend on parser's buffers.
+	const rapidjson::Value &
+	copy()
+	{
+		if( !m_value.IsString() )
+			return m_value;
+
+		if( !m_copy.IsString() )
+			m_copy.SetString(
+					m_value.GetString(),
+					m_value.GetStringLength(),
+					m_allocator );
+
+		return m_copy;
+	}
+
+	//! Get a value to be passed to the specified Reader_Writer.
+	template< typename Reader_Writer, typename T >
+	const rapidjson::Value &
+	for_reading()
+	{
+		static_assert( !(
+				std::is_same< Reader_Writer, default_reader_writer_t >::value &&
+				is_string_view_for_default_reader< std::remove_cv_t< T > >::value ),
+				"string views can't be read by SAX parser because its strings "
+				"aren't kept after the parsing" );
+
+		return for_reading_impl(
+				std::integral_constant< bool,
+						is_string_copied_by_reader<
+								Reader_Writer, std::remove_cv_t< T > >::value >{} );
+	}
+};
+
+class context_t;
+
+/*!
+ * @brief Base class for handlers of JSON values.
+ *
+ * A frame is created for every compound value (an object or an array)
+ * and receives all events from SAX parser until the end of that value.
+ * A frame can create a child frame for a nested value.
+ *
+ * Default implementations ignore the event. It's suitable for events
+ * that can't be received by a particular type of frame.
+ *
+ * @since v.0.3.5
+ */
+class frame_t
+{
+	friend class frame_stack_t;
+
+	frame_t * m_parent{ nullptr };
+
+	// The position in frame_stack_t before the creation of the frame.
+	std::size_t m_block{ 0u };
+	std::size_t m_offset{ 0u };
+
+public:
+	frame_t() = default;
+	frame_t( const frame_t & ) = delete;
+	frame_t &
+	operator=( const frame_t & ) = delete;
+
+	virtual ~frame_t() = default;
+
+	frame_t *
+	parent() const noexcept { return m_parent; }
+
+	//! A scalar value (or null) is found.
+	virtual void
+	on_value( context_t &, scalar_value_t & ) {}
+
+	//! A name of object's member is found.
+	virtual void
+	on_key( context_t &, const string_ref_t & ) {}
+
+	//! The beginning of a nested object or array is found.
+	virtual void
+	on_start( context_t &, compound_kind_t ) {}
+
+	//! The end of an object or array is found.
+	/*!
+	 * @return true if the frame is completed.
+	 */
+	virtual bool
+	on_end( context_t &, compound_kind_t, rapidjson::SizeType )
+	{
+		return false;
+	}
+
+	//! The child frame is completed.
+	/*!
+	 * @return true if the frame is completed too.
+	 */
+	virtual bool
+	on_child_completed( context_t & ) { return false; }
+
+	//! Add the current member or item to the path of an error.
+	virtual void
+	decorate_error( const context_t &, error_info_t & ) const {}
+};
+
+/*!
+ * @brief Storage for frames.
+ *
+ * Frames are created and destroyed in LIFO order, so they are placed into
+ * blocks of memory one after another. The first block is a part of
+ * frame_stack_t itself, additional blocks are allocated only for deeply
+ * nested values and are reused until frame_stack_t is destroyed.
+ *
+ * @since v.0.3.5
+ */
+class frame_stack_t
+{
+	static constexpr std::size_t first_block_size = 1024u;
+	static constexpr std::size_t additional_block_size = 4096u;
+
+	struct block_t
+	{
+		std::unique_ptr< char[] > m_data;
+		std::size_t m_capacity;
+	};
+
+	alignas(std::max_align_t) char m_first_block[ first_block_size ];
+	std::vector< block_t > m_additional_blocks;
+
+	// Index of the current block (0 is for m_first_block).
+	std::size_t m_block{ 0u };
+	// Offset of free space in the current block.
+	std::size_t m_offset{ 0u };
+
+	frame_t * m_top{ nullptr };
+
+	char *
+	block_data( std::size_t block ) noexcept
+	{
+		return 0u == block ?
+				m_first_block : m_additional_blocks[ block - 1u ].m_data.get();
+	}
+
+	std::size_t
+	block_capacity( std::size_t block ) const noexcept
+	{
+		return 0u == block ?
+				first_block_size : m_additional_blocks[ block - 1u ].m_capacity;
+	}
+
+	static block_t
+	make_block( std::size_t required_size )
+	{
+		const auto capacity = required_size > additional_block_size ?
+				required_size : additional_block_size;
+
+		return block_t{ std::unique_ptr< char[] >{ new char[ capacity ] }, capacity };
+	}
+
+	void *
+	allocate( std::size_t size, std::size_t alignment )
+	{
+		for(;;)
+		{
+			const auto offset = ( m_offset + alignment - 1u ) & ~( alignment - 1u );
+			if( offset + size <= block_capacity( m_block ) )
+			{
+				m_offset = offset + size;
+				return block_data( m_block ) + offset;
+			}
+
+			// All blocks after the current one are empty,
+			// so the next block can be replaced by a bigger one.
+			if( m_block == m_additional_blocks.size() )
+				m_additional_blocks.push_back( make_block( size ) );
+			else if( m_additional_blocks[ m_block ].m_capacity < size )
+				m_additional_blocks[ m_block ] = make_block( size );
+
+			++m_block;
+			m_offset = 0u;
+		}
+	}
+
+public:
+	frame_stack_t() = default;
+	frame_stack_t( const frame_stack_t & ) = delete;
+	frame_stack_t &
+	operator=( const frame_stack_t & ) = delete;
+
+	~frame_stack_t()
+	{
+		while( m_top )
+			pop();
+	}
+
+	frame_t *
+	top() const noexcept { return m_top; }
+
+	template< typename Frame, typename... Args >
+	Frame &
+	push( Args &&... args )
+	{
+		static_assert( alignof(Frame) <= alignof(std::max_align_t),
+				"over-aligned frames are not supported" );
+
+		const auto block = m_block;
+		const auto offset = m_offset;
+
+		void * place = allocate( sizeof(Frame), alignof(Frame) );
+
+		Frame * frame = nullptr;
+		try
+		{
+			frame = new(place) Frame( std::forward< Args >( args )... );
+		}
+		catch( ... )
+		{
+			m_block = block;
+			m_offset = offset;
+			throw;
+		}
+
+		frame->m_parent = m_top;
+		frame->m_block = block;
+		frame->m_offset = offset;
+		m_top = frame;
+
+		return *frame;
+	}
+
+	void
+	pop() noexcept
+	{
+		frame_t * frame = m_top;
+
+		m_top = frame->m_parent;
+		m_block = frame->m_block;
+		m_offset = frame->m_offset;
+
+		frame->~frame_t();
+	}
+};
+
+inline bool
+names_equal( const string_ref_t & a, const string_ref_t & b ) noexcept
+{
+	return a.length == b.length &&
+			( a.s == b.s || 0 == std::memcmp( a.s, b.s, a.length ) );
+}
+
+/*!
+ * @brief The state of SAX-based input.
+ *
+ * Holds the stack of frames, names of members of objects that are being
+ * parsed and values that are collected for Reader_Writers that require
+ * rapidjson::Value.
+ *
+ * @since v.0.3.5
+ */
+class context_t
+{
+	//! Allocator for copies of strings and for collected values.
+	rapidjson::MemoryPoolAllocator<> m_allocator;
+
+	//! Values that are being collected.
+	std::vector< rapidjson::Value > m_collected;
+
+	//! Current keys of objects that are being parsed.
+	std::vector< char > m_keys;
+
+	//! Flags for fields that already have been read.
+	/*!
+	 * A field is identified by the position of its binder in json_io().
+	 */
+	std::vector< std::uint64_t > m_seen;
+
+	//! Fields of the top-level object to be read.
+	const projection_t * m_projection{ nullptr };
+
+	//! The text that is being parsed (if it's in memory).
+	const char * m_source{ nullptr };
+	//! The input stream for the text.
+	const void * m_stream{ nullptr };
+	//! Getter of the current position of the parser in the stream.
+	std::size_t (*m_position)( const void * ){ nullptr };
+
+	// NOTE: frames have to be destroyed first.
+	frame_stack_t m_frames;
+
+public:
+	context_t() = default;
+	context_t( const context_t & ) = delete;
+	context_t &
+	operator=( const context_t & ) = delete;
+
+	rapidjson::MemoryPoolAllocator<> &
+	allocator() noexcept { return m_allocator; }
+
+	frame_stack_t &
+	frames() noexcept { return m_frames; }
+
+	//
+	// Projection.
+	//
+	void
+	set_projection( const projection_t * projection ) noexcept
+	{
+		m_projection = projection;
+	}
+
+	//! Projection for a DTO frame that is being created.
+	/*!
+	 * It's nullptr for all objects except the top-level one.
+	 */
+	const projection_t *
+	projection_for_new_frame() const noexcept
+	{
+		return m_frames.top() && !m_frames.top()->parent() ?
+				m_projection : nullptr;
+	}
+
+	//
+	// The source text.
+	//
+
+	//! Set the stream that is read by the parser.
+	template< typename Input_Stream >
+	void
+	set_stream( const Input_Stream & stream ) noexcept
+	{
+		m_stream = &stream;
+		m_position = []( const void * s ) -> std::size_t {
+				return static_cast< const Input_Stream * >( s )->Tell();
+			};
+	}
+
+	//! Set the text that is read by the stream.
+	void
+	set_source( const char * source ) noexcept { m_source = source; }
+
+	bool
+	has_source() const noexcept { return nullptr != m_source; }
+
+	const char *
+	source() const noexcept { return m_source; }
+
+	//! The position of the parser in the stream.
+	/*!
+	 * It's the position right after the last processed char.
+	 * It's 0 if the stream isn't set.
+	 */
+	std::size_t
+	position() const { return m_position ? m_position( m_stream ) : 0u; }
+
+	//
+	// Keys.
+	//
+	std::size_t
+	keys_size() const noexcept { return m_keys.size(); }
+
+	//! Replace a key stored at @a offset by a new one.
+	void
+	store_key( std::size_t offset, const string_ref_t & key )
+	{
+		m_keys.resize( offset + key.length );
+		if( key.length )
+			std::memcpy( m_keys.data() + offset, key.s, key.length );
+	}
+
+	string_ref_t
+	key( std::size_t offset, rapidjson::SizeType length ) const noexcept
+	{
+		return string_ref_t{
+				m_keys.empty() ? "" : m_keys.data() + offset, length };
+	}
+
+	void
+	release_keys( std::size_t offset ) { m_keys.resize( offset ); }
+
+	//
+	// Fields that have been read.
+	//
+	std::size_t
+	seen_size() const noexcept { return m_seen.size(); }
+
+	void
+	mark_seen( std::size_t offset, std::size_t index )
+	{
+		const auto word = offset + index / 64u;
+		if( m_seen.size() <= word )
+			m_seen.resize( word + 1u, 0u );
+		m_seen[ word ] |= std::uint64_t{ 1u } << ( index % 64u );
+	}
+
+	bool
+	is_seen( std::size_t offset, std::size_t index ) const noexcept
+	{
+		const auto word = offset + index / 64u;
+		return word < m_seen.size() &&
+				0u != ( m_seen[ word ] & ( std::uint64_t{ 1u } << ( index % 64u ) ) );
+	}
+
+	void
+	release_seen( std::size_t offset ) { m_seen.resize( offset ); }
+
+	//
+	// Collecting of values.
+	//
+	void
+	collect_key( const string_ref_t & key )
+	{
+		m_collected.emplace_back( key.s, key.length, m_allocator );
+	}
+
+	void
+	collect_value( const rapidjson::Value & value )
+	{
+		if( value.IsString() )
+			m_collected.emplace_back(
+					value.GetString(), value.GetStringLength(), m_allocator );
+		else
+			m_collected.emplace_back( value, m_allocator );
+	}
+
+	//! Make an object or array from the last collected values.
+	void
+	collect_end( compound_kind_t kind, rapidjson::SizeType count )
+	{
+		std::size_t first;
+
+		if( compound_kind_t::object == kind )
+		{
+			first = m_collected.size() - 2u * count;
+
+			rapidjson::Value object{ rapidjson::kObjectType };
+			for( auto i = first; i < m_collected.size(); i += 2u )
+				object.AddMember( m_collected[ i ], m_collected[ i + 1u ], m_allocator );
+
+			m_collected.erase( m_collected.begin() + first, m_collected.end() );
+			m_collected.push_back( std::move( object ) );
+		}
+		else
+		{
+			first = m_collected.size() - count;
+
+			rapidjson::Value array{ rapidjson::kArrayType };
+			array.Reserve( count, m_allocator );
+			for( auto i = first; i < m_collected.size(); ++i )
+				array.PushBack( m_collected[ i ], m_allocator );
+
+			m_collected.erase( m_collected.begin() + first, m_collected.end() );
+			m_collected.push_back( std::move( array ) );
+		}
+	}
+
+	const rapidjson::Value &
+	collected_value() const noexcept { return m_collected.back(); }
+
+	void
+	pop_collected_value() { m_collected.pop_back(); }
+};
+
+/*!
+ * @brief Create a frame for reading a compound value into @a target.
+ *
+ * @return false if there is no frame for that type of value (or
+ * for that type of Reader_Writer). The value has to be collected
+ * into rapidjson::Value in that case.
+ *
+ * @since v.0.3.5
+ */
+template< typename Reader_Writer, typename T >
+bool
+start_native_frame(
+	context_t & ctx,
+	const Reader_Writer & reader_writer,
+	T & target,
+	compound_kind_t kind );
+
+/*!
+ * @brief Create a frame for reading a compound value into @a target.
+ *
+ * If there is no native frame for @a target then the value is
+ * collected into rapidjson::Value and then passed to @a reader_writer.
+ *
+ * @since v.0.3.5
+ */
+template< typename Reader_Writer, typename T >
+void
+start_value(
+	context_t & ctx,
+	const Reader_Writer & reader_writer,
+	T & target,
+	compound_kind_t kind );
+
+/*!
+ * @brief Selector of a binder for a member of JSON object.
+ *
+ * An instance of member_dispatcher_t is passed to all binders from
+ * json_io() via json_sax_input_t. A binder for the current member
+ * performs the action specified by dispatcher's mode.
+ *
+ * If binders of a DTO match the index of the DTO type then the slot
+ * for the current member is found by the frame once per key. Binders
+ * for other slots are skipped without comparison of names.
+ *
+ * @since v.0.3.5
+ */
+class member_dispatcher_t
+{
+public:
+	enum class mode_t
+	{
+		//! A scalar value for the member is found.
+		value,
+		//! A compound value for the member is found.
+		start,
+		//! A compound value was read by a native frame.
+		finish_native,
+		//! A compound value was collected into rapidjson::Value.
+		finish_collected,
+		//! The end of object is found. All missed fields have to be handled.
+		finalize,
+		//! Binders are compared with the index of the DTO type.
+		check
+	};
+
+	enum class result_t
+	{
+		not_found,
+		found,
+		//! The member was already read (JSON object has duplicate keys).
+		duplicate,
+		//! A native frame was created for a compound value.
+		native,
+		//! A compound value has to be collected.
+		collect
+	};
+
+	member_dispatcher_t(
+		context_t & ctx,
+		mode_t mode,
+		std::size_t seen_offset,
+		string_ref_t key,
+		const projection_t * projection,
+		const member_index::index_t * index,
+		std::size_t slot,
+		std::size_t member_size,
+		scalar_value_t * value = nullptr,
+		compound_kind_t kind = compound_kind_t::object )
+		:	m_ctx{ ctx }
+		,	m_mode{ mode }
+		,	m_seen_offset{ seen_offset }
+		,	m_key{ key }
+		,	m_projection{ projection }
+		,	m_member_index{ index }
+		,	m_slot{ slot }
+		,	m_member_size{ member_size }
+		,	m_value{ value }
+		,	m_kind{ kind }
+	{}
+
+	//! Constructor for the check mode.
+	/*!
+	 * Names of binders are stored into @a names if @a index is null.
+	 */
+	member_dispatcher_t(
+		context_t & ctx,
+		const member_index::index_t * index,
+		std::vector< std::string > * names )
+		:	m_ctx{ ctx }
+		,	m_mode{ mode_t::check }
+		,	m_seen_offset{ 0u }
+		,	m_key{ "" }
+		,	m_projection{ nullptr }
+		,	m_member_index{ index }
+		,	m_slot{ member_index::index_t::npos }
+		,	m_member_size{ 0u }
+		,	m_value{ nullptr }
+		,	m_kind{ compound_kind_t::object }
+		,	m_names{ names }
+	{}
+
+	result_t
+	result() const noexcept { return m_result; }
+
+	//! Do binders match the index of the DTO type?
+	/*!
+	 * It's for the check mode only.
+	 */
+	bool
+	index_matched() const noexcept
+	{
+		return !m_index_mismatch && m_member_index &&
+				m_index == m_member_index->binders();
+	}
+
+	template< typename Read_From_Impl, typename Data_Holder >
+	void
+	read_field( const Data_Holder & holder )
+	{
+		const auto index = m_index++;
+
+		if( mode_t::check == m_mode )
+			return check_binder( index, holder.field_name() );
+
+		// Binders for other members are skipped if the index is used.
+		if( m_member_index && mode_t::finalize != m_mode &&
+				m_member_index->slot_of_binder( index ) != m_slot )
+			return;
+
+		// Fields that aren't selected are ignored completely.
+		if( m_projection && !m_projection->contains( holder.field_name() ) )
+			return;
+
+		if( mode_t::finalize == m_mode )
+		{
+			if( !m_ctx.is_seen( m_seen_offset, index ) )
+				instrument( holder, [&] {
+						read_member< Read_From_Impl >( holder, nullptr );
+					} );
+			return;
+		}
+
+		// Every binder with the same name receives a scalar value,
+		// but only the first one receives a compound value.
+		if( result_t::not_found != m_result &&
+				( mode_t::value != m_mode || result_t::duplicate == m_result ) )
+			return;
+
+		if( !m_member_index && !names_equal( holder.field_name(), m_key ) )
+			return;
+
+		// Only the first occurrence of a member is used
+		// (like rapidjson::Value::FindMember does).
+		if( result_t::not_found == m_result &&
+				( mode_t::value == m_mode || mode_t::start == m_mode ) &&
+				m_ctx.is_seen( m_seen_offset, index ) )
+		{
+			m_result = result_t::duplicate;
+			return;
+		}
+
+		m_result = result_t::found;
+
+		switch( m_mode )
+		{
+			case mode_t::value:
+				m_ctx.mark_seen( m_seen_offset, index );
+				instrument( holder, [&] {
+						read_member< Read_From_Impl >(
+								holder,
+								&value_for_reading< Read_From_Impl >( holder ) );
+					} );
+			break;
+
+			case mode_t::start:
+				m_ctx.mark_seen( m_seen_offset, index );
+				m_result = start_member< Read_From_Impl >( holder ) ?
+						result_t::native : result_t::collect;
+			break;
+
+			case mode_t::finish_native:
+				instrument( holder, [&] {
+						holder.validator()(
+								holder.field_for_deserialization() ); // validate value.
+					} );
+			break;
+
+			case mode_t::finish_collected:
+				instrument( holder, [&] {
+						read_member< Read_From_Impl >(
+								holder, &m_ctx.collected_value() );
+					} );
+			break;
+
+			case mode_t::finalize:
+			case mode_t::check:
+			break;
+		}
+	}
+
+private:
+	context_t & m_ctx;
+	const mode_t m_mode;
+	const std::size_t m_seen_offset;
+	const string_ref_t m_key;
+	const projection_t * const m_projection;
+	//! The index of the DTO type (if binders match it).
+	const member_index::index_t * const m_member_index;
+	//! The slot of the current member in the index.
+	const std::size_t m_slot;
+	//! Size of the text of the current member (for instrumentation).
+	const std::size_t m_member_size;
+	scalar_value_t * m_value;
+	const compound_kind_t m_kind;
+
+	//! Storage for names of binders in the check mode.
+	std::vector< std::string > * m_names{ nullptr };
+	bool m_index_mismatch{ false };
+
+	//! Position of the current binder in json_io().
+	std::size_t m_index{ 0u };
+
+	result_t m_result{ result_t::not_found };
+
+	template< typename Data_Holder, typename Action >
+	void
+	instrument( const Data_Holder & holder, Action && action ) const
+	{
+		instrumentation_policy_t::on_field(
+				instrumentation::field_context_t{
+					holder.field_name(),
+					false,
+					nullptr,
+					nullptr,
+					nullptr,
+					mode_t::finalize == m_mode ? 0u : m_member_size },
+				std::forward< Action >( action ) );
+	}
+
+	void
+	check_binder( std::size_t position, const string_ref_t & name )
+	{
+		if( m_names )
+			m_names->emplace_back( name.s, name.length );
+		else if( !m_member_index || member_index::index_t::npos ==
+				m_member_index->slot_for_binder( position, name ) )
+			m_index_mismatch = true;
+	}
+
+	template< typename Data_Holder >
+	using field_type_t = std::remove_reference_t<
+			decltype(std::declval< const Data_Holder & >()
+					.field_for_deserialization()) >;
+
+	template< typename Read_From_Impl, typename Data_Holder >
+	const rapidjson::Value &
+	value_for_reading( const Data_Holder & holder )
+	{
+		return value_for_reading_impl(
+				holder,
+				meta::has_static_read_from_member< Read_From_Impl, Data_Holder >{} );
+	}
+
+	template< typename Data_Holder >
+	const rapidjson::Value &
+	value_for_reading_impl( const Data_Holder &, std::true_type )
+	{
+		return m_value->template for_reading<
+				std::decay_t< decltype(std::declval< const Data_Holder & >()
+						.reader_writer()) >,
+				field_type_t< Data_Holder > >();
+	}
+
+	template< typename Data_Holder >
+	const rapidjson::Value &
+	value_for_reading_impl( const Data_Holder &, std::false_type )
+	{
+		return m_value->copy();
+	}
+
+	template< typename Read_From_Impl, typename Data_Holder >
+	void
+	read_member( const Data_Holder & holder, const rapidjson::Value * value )
+	{
+		read_member_impl< Read_From_Impl >(
+				holder,
+				value,
+				meta::has_static_read_from_member< Read_From_Impl, Data_Holder >{} );
+	}
+
+	template< typename Read_From_Impl, typename Data_Holder >
+	void
+	read_member_impl(
+		const Data_Holder & holder,
+		const rapidjson::Value * value,
+		std::true_type )
+	{
+		Read_From_Impl::read_from_member( holder, value );
+	}
+
+	// A specialization of binder_read_from_implementation_t without
+	// read_from_member is used. The member is placed into a temporary
+	// object to be passed to read_from.
+	template< typename Read_From_Impl, typename Data_Holder >
+	void
+	read_member_impl(
+		const Data_Holder & holder,
+		const rapidjson::Value * value,
+		std::false_type )
+	{
+		rapidjson::Value object{ rapidjson::kObjectType };
+
+		if( value )
+		{
+			rapidjson::Value name{ holder.field_name() };
+			rapidjson::Value copy;
+			copy.CopyFrom( *value, m_ctx.allocator() );
+
+			object.AddMember( name, copy, m_ctx.allocator() );
+		}
+
+		Read_From_Impl::read_from( holder, object );
+	}
+
+	template< typename Read_From_Impl, typename Data_Holder >
+	bool
+	start_member( const Data_Holder & holder )
+	{
+		return start_member_impl(
+				holder,
+				std::integral_constant< bool,
+					meta::has_static_read_from_member<
+							Read_From_Impl, Data_Holder >::value &&
+					!std::is_const< field_type_t< Data_Holder > >::value >{} );
+	}
+
+	template< typename Data_Holder >
+	bool
+	start_member_impl( const Data_Holder & holder, std::true_type )
+	{
+		return start_native_frame(
+				m_ctx,
+				holder.reader_writer(),
+				holder.field_for_deserialization(),
+				m_kind );
+	}
+
+	template< typename Data_Holder >
+	bool
+	start_member_impl( const Data_Holder &, std::false_type )
+	{
+		return false;
+	}
+};
+
+//
+// Frames.
+//
+
+//! Frame for a value that isn't bound to any field.
+class skip_frame_t final : public frame_t
+{
+	std::size_t m_depth{ 1u };
+
+public:
+	void
+	on_start( context_t &, compound_kind_t ) override { ++m_depth; }
+
+	bool
+	on_end( context_t &, compound_kind_t, rapidjson::SizeType ) override
+	{
+		return 0u == --m_depth;
+	}
+};
+
+//! Frame for copying the source text of a compound value into raw_json_t.
+class raw_json_frame_t final : public frame_t
+{
+	raw_json_t & m_target;
+
+	//! The position of the opening bracket.
+	std::size_t m_begin;
+
+	std::size_t m_depth{ 1u };
+
+public:
+	raw_json_frame_t( const context_t & ctx, raw_json_t & target )
+		:	m_target{ target }
+		,	m_begin{ ctx.position() - 1u }
+	{}
+
+	void
+	on_start( context_t &, compound_kind_t ) override { ++m_depth; }
+
+	bool
+	on_end( context_t & ctx, compound_kind_t, rapidjson::SizeType ) override
+	{
+		if( 0u != --m_depth )
+			return false;
+
+		m_target.assign( ctx.source() + m_begin, ctx.position() - m_begin );
+		return true;
+	}
+};
+
+//! Frame for collecting a compound value into rapidjson::Value.
+/*!
+ * The collected value is left in the context for the parent frame.
+ */
+class collect_frame_t : public frame_t
+{
+	std::size_t m_depth{ 1u };
+
+protected:
+	//! The whole value is collected.
+	virtual void
+	on_collected( context_t & ) {}
+
+public:
+	void
+	on_value( context_t & ctx, scalar_value_t & value ) override
+	{
+		ctx.collect_value( value.value() );
+	}
+
+	void
+	on_key( context_t & ctx, const string_ref_t & key ) override
+	{
+		ctx.collect_key( key );
+	}
+
+	void
+	on_start( context_t &, compound_kind_t ) override { ++m_depth; }
+
+	bool
+	on_end(
+		context_t & ctx,
+		compound_kind_t kind,
+		rapidjson::SizeType count ) override
+	{
+		ctx.collect_end( kind, count );
+
+		if( 0u == --m_depth )
+		{
+			on_collected( ctx );
+			return true;
+		}
+
+		return false;
+	}
+};
+
+//! Frame for collecting a value and passing it to a Reader_Writer.
+template< typename T, typename Reader_Writer >
+class read_collected_frame_t final : public collect_frame_t
+{
+	T & m_target;
+	Reader_Writer m_reader_writer;
+
+protected:
+	void
+	on_collected( context_t & ctx ) override
+	{
+		m_reader_writer.read( m_target, ctx.collected_value() );
+		ctx.pop_collected_value();
+	}
+
+public:
+	read_collected_frame_t( T & target, const Reader_Writer & reader_writer )
+		:	m_target{ target }
+		,	m_reader_writer{ reader_writer }
+	{}
+};
+
+//! Helper for adding items into STL-like containers.
+/*!
+ * An item is obtained by new_item(), then it's read and then commit()
+ * is called.
+ *
+ * Items of sequence containers are constructed in the container and read
+ * in place. Items of set-like containers (and std::vector<bool>) are read
+ * into a temporary object and then moved into the container.
+ */
+template< typename C, bool In_Place = meta::has_mutable_items< C >::value >
+class item_inserter_t
+{
+	sequence_containers::container_filler_t< C > m_filler;
+
+public:
+	item_inserter_t( C & cnt ) : m_filler{ cnt } {}
+
+	typename C::value_type &
+	new_item() { return m_filler.emplace_default(); }
+
+	void
+	commit() noexcept {}
+};
+
+template< typename C >
+class item_inserter_t< C, false >
+{
+	using value_type = typename C::value_type;
+
+	C & m_cnt;
+	value_type m_item{};
+
+	template< typename V >
+	void
+	insert( V && value, std::false_type /*is_set*/ )
+	{
+		sequence_containers::container_filler_t< C >{ m_cnt }.emplace_back(
+				std::forward< V >( value ) );
+	}
+
+	template< typename V >
+	void
+	insert( V && value, std::true_type /*is_set*/ )
+	{
+		associative_containers::emplace_item( m_cnt, std::forward< V >( value ) );
+	}
+
+public:
+	item_inserter_t( C & cnt ) : m_cnt{ cnt } {}
+
+	value_type &
+	new_item()
+	{
+		m_item = value_type{};
+		return m_item;
+	}
+
+	void
+	commit()
+	{
+		insert( std::move( m_item ),
+				std::integral_constant< bool,
+						meta::is_stl_set_like_associative_container< C >::value >{} );
+	}
+};
+
+//! Frame for STL-like sequence and set-like containers.
+template< typename C, typename Item_Reader_Writer >
+class sequence_frame_t final : public frame_t
+{
+	using value_type = typename C::value_type;
+
+	Item_Reader_Writer m_reader_writer;
+	item_inserter_t< C > m_inserter;
+
+	//! The index of the current item.
+	std::size_t m_index{ 0u };
+
+	static C &
+	cleared( C & cnt )
+	{
+		cnt.clear();
+		return cnt;
+	}
+
+	void
+	commit()
+	{
+		m_inserter.commit();
+		++m_index;
+	}
+
+public:
+	sequence_frame_t( C & cnt, const Item_Reader_Writer & reader_writer )
+		:	m_reader_writer{ reader_writer }
+		,	m_inserter{ cleared( cnt ) }
+	{}
+
+	void
+	on_value( context_t &, scalar_value_t & value ) override
+	{
+		m_reader_writer.read(
+				m_inserter.new_item(),
+				value.template for_reading< Item_Reader_Writer, value_type >() );
+		commit();
+	}
+
+	void
+	on_start( context_t & ctx, compound_kind_t kind ) override
+	{
+		start_value( ctx, m_reader_writer, m_inserter.new_item(), kind );
+	}
+
+	bool
+	on_end( context_t &, compound_kind_t, rapidjson::SizeType ) override
+	{
+		return true;
+	}
+
+	bool
+	on_child_completed( context_t & ) override
+	{
+		commit();
+		return false;
+	}
+
+	void
+	decorate_error( const context_t &, error_info_t & error ) const override
+	{
+		error.add_index( m_index );
+	}
+};
+
+//! Storage for items read by numbers_frame_t.
+template< typename C >
+class number_items_t;
+
+template< typename T, typename A >
+class number_items_t< std::vector< T, A > >
+{
+	std::vector< T, A > & m_cnt;
+
+public:
+	explicit number_items_t( std::vector< T, A > & cnt ) : m_cnt{ cnt }
+	{
+		m_cnt.clear();
+	}
+
+	void
+	push( std::size_t, T v ) { m_cnt.push_back( v ); }
+
+	T &
+	item( std::size_t )
+	{
+		m_cnt.emplace_back();
+		return m_cnt.back();
+	}
+
+	void
+	check_size( std::size_t ) const noexcept {}
+};
+
+template< typename T, std::size_t N >
+class number_items_t< std::array< T, N > >
+{
+	std::array< T, N > & m_cnt;
+
+	//! Receiver for extra items, the error is reported at the end.
+	T m_extra{};
+
+public:
+	explicit number_items_t( std::array< T, N > & cnt ) : m_cnt{ cnt } {}
+
+	void
+	push( std::size_t index, T v ) { item( index ) = v; }
+
+	T &
+	item( std::size_t index ) noexcept
+	{
+		return index < N ? m_cnt[ index ] : m_extra;
+	}
+
+	void
+	check_size( std::size_t size ) const
+	{
+		if( N != size )
+			report_error( error_code_t::invalid_size,
+					"invalid size of array: " + std::to_string( size ) +
+					" (expected " + std::to_string( N ) + ")" );
+	}
+};
+
+//! Frame for std::vector and std::array of numbers.
+/*!
+ * Numbers of the right type are stored by a type-specific check
+ * and getter. Other values are read by default_reader_writer_t
+ * that reports the error.
+ *
+ * @since v.0.3.5
+ */
+template< typename C >
+class numbers_frame_t final : public frame_t
+{
+	using value_type = typename C::value_type;
+	using access_t = numeric_arrays::number_access_t< value_type >;
+
+	number_items_t< C > m_items;
+
+	//! The index of the current item.
+	std::size_t m_index{ 0u };
+
+	//! Is the end of the array reached?
+	bool m_completed{ false };
+
+public:
+	explicit numbers_frame_t( C & cnt ) : m_items{ cnt } {}
+
+	void
+	on_value( context_t &, scalar_value_t & value ) override
+	{
+		const rapidjson::Value & v = value.template for_reading<
+				default_reader_writer_t, value_type >();
+
+		if( access_t::is( v ) )
+			m_items.push( m_index, access_t::get( v ) );
+		else
+			default_reader_writer_t{}.read( m_items.item( m_index ), v );
+
+		++m_index;
+	}
+
+	void
+	on_start( context_t & ctx, compound_kind_t kind ) override
+	{
+		start_value( ctx, default_reader_writer_t{}, m_items.item( m_index ),
+				kind );
+	}
+
+	bool
+	on_end( context_t &, compound_kind_t, rapidjson::SizeType count ) override
+	{
+		m_completed = true;
+		m_items.check_size( count );
+		return true;
+	}
+
+	bool
+	on_child_completed( context_t & ) override
+	{
+		++m_index;
+		return false;
+	}
+
+	void
+	decorate_error( const context_t &, error_info_t & error ) const override
+	{
+		if( !m_completed )
+			error.add_index( m_index );
+	}
+};
+
+//! Frame for STL-like map-like containers.
+template< typename C, typename Item_Reader_Writer >
+class map_frame_t final : public frame_t
+{
+	using key_type = typename C::key_type;
+	using mapped_type = typename C::mapped_type;
+
+	C & m_cnt;
+	Item_Reader_Writer m_reader_writer;
+
+	// The current key in the context (for errors only).
+	const std::size_t m_key_offset;
+	rapidjson::SizeType m_key_length{ 0u };
+
+	key_type m_key{};
+	//! A temporary object for values of duplicate keys.
+	mapped_type m_duplicate{};
+
+	//! Emplace an item for the current key.
+	/*!
+	 * @return a reference to the value of the new item or to
+	 * the temporary if there already is an item with the same key.
+	 */
+	mapped_type &
+	new_value()
+	{
+		const auto slot = associative_containers::emplace_key(
+				m_cnt, std::move( m_key ) );
+		if( slot.m_inserted )
+			return slot.m_it->second;
+
+		m_duplicate = mapped_type{};
+		return m_duplicate;
+	}
+
+public:
+	map_frame_t(
+		context_t & ctx,
+		C & cnt,
+		const Item_Reader_Writer & reader_writer )
+		:	m_cnt{ cnt }
+		,	m_reader_writer{ reader_writer }
+		,	m_key_offset{ ctx.keys_size() }
+	{
+		m_cnt.clear();
+	}
+
+	void
+	on_key( context_t & ctx, const string_ref_t & key ) override
+	{
+		ctx.store_key( m_key_offset, key );
+		m_key_length = key.length;
+
+		const rapidjson::Value key_value{ key.s, key.length };
+		scalar_value_t scalar{ key_value, ctx.allocator() };
+
+		m_key = key_type{};
+
+		// It is necessary to have mutable_key_ref as a lvalue to pass
+		// a non-const reference to it to read() method of the reader_writer.
+		auto mutable_key_ref = mutable_map_key( m_key );
+		m_reader_writer.read(
+				mutable_key_ref,
+				scalar.template for_reading<
+						Item_Reader_Writer, mutable_map_key_t< key_type > >() );
+	}
+
+	void
+	on_value( context_t &, scalar_value_t & value ) override
+	{
+		m_reader_writer.read(
+				new_value(),
+				value.template for_reading< Item_Reader_Writer, mapped_type >() );
+	}
+
+	void
+	on_start( context_t & ctx, compound_kind_t kind ) override
+	{
+		start_value( ctx, m_reader_writer, new_value(), kind );
+	}
+
+	bool
+	on_end( context_t & ctx, compound_kind_t, rapidjson::SizeType ) override
+	{
+		ctx.release_keys( m_key_offset );
+		return true;
+	}
+
+	bool
+	on_child_completed( context_t & ) override
+	{
+		return false;
+	}
+
+	void
+	decorate_error( const context_t & ctx, error_info_t & error ) const override
+	{
+		error.add_key( ctx.key( m_key_offset, m_key_length ) );
+	}
+};
+
+//! Frame for a DTO with json_io.
+template< typename Dto >
+class dto_frame_t final : public frame_t
+{
+	enum class member_state_t
+	{
+		none,
+		native,
+		collected
+	};
+
+	Dto & m_dto;
+
+	// The current key in the context.
+	const std::size_t m_key_offset;
+	rapidjson::SizeType m_key_length{ 0u };
+
+	// Flags of fields that have been read in the context.
+	const std::size_t m_seen_offset;
+
+	// The state of the current compound member.
+	member_state_t m_member_state{ member_state_t::none };
+
+	// Selected fields (for the top-level object only).
+	const projection_t * const m_projection;
+
+	// The index of Dto type if binders from json_io() match it.
+	const member_index::index_t * m_member_index{ nullptr };
+
+	// The slot of the current key in the index.
+	std::size_t m_slot{ member_index::index_t::npos };
+
+	// The position in the text right after the previous member
+	// (or the opening brace). It's used for instrumentation.
+	std::size_t m_member_begin;
+
+	string_ref_t
+	current_key( const context_t & ctx ) const noexcept
+	{
+		return ctx.key( m_key_offset, m_key_length );
+	}
+
+	bool
+	check_binders(
+		context_t & ctx,
+		const member_index::index_t * index,
+		std::vector< std::string > * names )
+	{
+		member_dispatcher_t dispatcher{ ctx, index, names };
+		json_sax_input_t input{ dispatcher };
+
+		json_io( input, m_dto );
+
+		return dispatcher.index_matched();
+	}
+
+	// The index is created by the first object of Dto type.
+	// Then binders of every object are compared with the index,
+	// because json_io() could declare different fields for
+	// different objects.
+	void
+	use_index( context_t & ctx )
+	{
+		auto & holder = member_index::index_holder_t< Dto >::instance();
+
+		if( !holder.get() )
+		{
+			std::vector< std::string > names;
+			check_binders( ctx, nullptr, &names );
+			holder.publish( std::make_unique< member_index::index_t >( names ) );
+		}
+
+		if( check_binders( ctx, holder.get(), nullptr ) )
+			m_member_index = holder.get();
+	}
+
+	member_dispatcher_t::result_t
+	replay(
+		context_t & ctx,
+		member_dispatcher_t::mode_t mode,
+		scalar_value_t * value = nullptr,
+		compound_kind_t kind = compound_kind_t::object )
+	{
+		member_dispatcher_t dispatcher{
+				ctx, mode, m_seen_offset, current_key( ctx ), m_projection,
+				m_member_index, m_slot, ctx.position() - m_member_begin,
+				value, kind };
+		json_sax_input_t input{ dispatcher };
+
+		with_dto_instrumentation< Dto >( [&] { json_io( input, m_dto ); } );
+
+		return dispatcher.result();
+	}
+
+public:
+	dto_frame_t( context_t & ctx, Dto & dto )
+		:	m_dto{ dto }
+		,	m_key_offset{ ctx.keys_size() }
+		,	m_seen_offset{ ctx.seen_size() }
+		,	m_projection{ ctx.projection_for_new_frame() }
+		,	m_member_begin{ ctx.position() }
+	{
+		use_index( ctx );
+	}
+
+	// Members that aren't selected or aren't known for the index
+	// are skipped without calls to json_io.
+	bool
+	is_skipped( const context_t & ctx ) const noexcept
+	{
+		return ( m_projection && !m_projection->contains( current_key( ctx ) ) ) ||
+				( m_member_index && member_index::index_t::npos == m_slot );
+	}
+
+	void
+	on_key( context_t & ctx, const string_ref_t & key ) override
+	{
+		ctx.store_key( m_key_offset, key );
+		m_key_length = key.length;
+
+		if( m_member_index )
+			m_slot = m_member_index->slot_of_name( key );
+	}
+
+	void
+	on_value( context_t & ctx, scalar_value_t & value ) override
+	{
+		if( !is_skipped( ctx ) )
+			replay( ctx, member_dispatcher_t::mode_t::value, &value );
+
+		m_member_begin = ctx.position();
+	}
+
+	void
+	on_start( context_t & ctx, compound_kind_t kind ) override
+	{
+		m_member_state = member_state_t::none;
+
+		if( is_skipped( ctx ) )
+		{
+			ctx.frames().push< skip_frame_t >();
+			return;
+		}
+
+		switch( replay(
+				ctx, member_dispatcher_t::mode_t::start, nullptr, kind ) )
+		{
+			case member_dispatcher_t::result_t::native:
+				m_member_state = member_state_t::native;
+			break;
+
+			case member_dispatcher_t::result_t::collect:
+				m_member_state = member_state_t::collected;
+				ctx.frames().push< collect_frame_t >();
+			break;
+
+			default:
+			break;
+		}
+
+		if( member_state_t::none == m_member_state )
+			ctx.frames().push< skip_frame_t >();
+	}
+
+	bool
+	on_child_completed( context_t & ctx ) override
+	{
+		const auto state = m_member_state;
+		m_member_state = member_state_t::none;
+
+		if( member_state_t::native == state )
+			replay( ctx, member_dispatcher_t::mode_t::finish_native );
+		else if( member_state_t::collected == state )
+		{
+			replay( ctx, member_dispatcher_t::mode_t::finish_collected );
+			ctx.pop_collected_value();
+		}
+
+		m_member_begin = ctx.position();
+
+		return false;
+	}
+
+	bool
+	on_end( context_t & ctx, compound_kind_t, rapidjson::SizeType ) override
+	{
+		replay( ctx, member_dispatcher_t::mode_t::finalize );
+
+		ctx.release_seen( m_seen_offset );
+		ctx.release_keys( m_key_offset );
+
+		return true;
+	}
+
+	void
+	decorate_error(
+		const context_t & ctx,
+		error_info_t & error ) const override
+	{
+		// Errors of scalar members are handled by binders.
+		if( member_state_t::none != m_member_state )
+			error.add_to_path( error_path_item_t::copied(
+					error_path_item_t::kind_t::field, current_key( ctx ) ) );
+	}
+};
+
+//! Frame for the top-level value.
+template< typename T, typename Reader_Writer = default_reader_writer_t >
+class root_frame_t final : public frame_t
+{
+	T & m_target;
+	Reader_Writer m_reader_writer;
+
+public:
+	root_frame_t(
+		T & target,
+		const Reader_Writer & reader_writer = Reader_Writer{} )
+		:	m_target{ target }
+		,	m_reader_writer{ reader_writer }
+	{}
+
+	void
+	on_value( context_t &, scalar_value_t & value ) override
+	{
+		m_reader_writer.read(
+				m_target,
+				value.template for_reading< Reader_Writer, T >() );
+	}
+
+	void
+	on_start( context_t & ctx, compound_kind_t kind ) override
+	{
+		start_value( ctx, m_reader_writer, m_target, kind );
+	}
+};
+
+//
+// Selection of frames for values.
+//
+
+// The default case: there is no native frame.
+template< typename Tag, typename Reader_Writer, typename T >
+bool
+start_native_frame_impl(
+	Tag,
+	context_t &,
+	const Reader_Writer &,
+	T &,
+	compound_kind_t )
+{
+	return false;
+}
+
+template< typename Reader_Writer, typename T >
+bool
+start_native_frame_impl(
+	sax_output::value_kind_tag_t< sax_output::value_kind_t::dto >,
+	context_t & ctx,
+	const Reader_Writer &,
+	T & target,
+	compound_kind_t kind )
+{
+	if( compound_kind_t::object != kind )
+		return false;
+
+	ctx.frames().push< dto_frame_t< T > >( ctx, target );
+	return true;
+}
+
+// The text of a compound value is copied from the source if it's
+// available. Otherwise the value is collected and serialized.
+template< typename Reader_Writer, typename T >
+bool
+start_native_frame_impl(
+	sax_output::value_kind_tag_t< sax_output::value_kind_t::raw_json >,
+	context_t & ctx,
+	const Reader_Writer &,
+	T & target,
+	compound_kind_t )
+{
+	if( !ctx.has_source() )
+		return false;
+
+	ctx.frames().push< raw_json_frame_t >( ctx, target );
+	return true;
+}
+
+// The text of lazy_t is read the same way as raw_json_t.
+template< typename Reader_Writer, typename T >
+bool
+start_native_frame_impl(
+	sax_output::value_kind_tag_t< sax_output::value_kind_t::lazy >,
+	context_t & ctx,
+	const Reader_Writer & reader_writer,
+	T & target,
+	compound_kind_t kind )
+{
+	if( !ctx.has_source() )
+		return false;
+
+	return start_native_frame_impl(
+			sax_output::value_kind_tag_t< sax_output::value_kind_t::raw_json >{},
+			ctx,
+			reader_writer,
+			target.raw_for_reading(),
+			kind );
+}
+
+template< typename Reader_Writer, typename T >
+bool
+start_native_frame_impl(
+	sax_output::value_kind_tag_t< sax_output::value_kind_t::sequence >,
+	context_t & ctx,
+	const Reader_Writer & reader_writer,
+	T & target,
+	compound_kind_t kind )
+{
+	using content_rw_t = sax_output::content_reader_writer< Reader_Writer >;
+	using item_reader_writer_t = std::decay_t<
+			decltype(content_rw_t::get( reader_writer )) >;
+
+	if( compound_kind_t::array != kind )
+		return false;
+
+	ctx.frames().push< sequence_frame_t< T, item_reader_writer_t > >(
+			target, content_rw_t::get( reader_writer ) );
+	return true;
+}
+
+template< typename Reader_Writer, typename T >
+bool
+start_native_frame_impl(
+	sax_output::value_kind_tag_t< sax_output::value_kind_t::numbers >,
+	context_t & ctx,
+	const Reader_Writer &,
+	T & target,
+	compound_kind_t kind )
+{
+	if( compound_kind_t::array != kind )
+		return false;
+
+	ctx.frames().push< numbers_frame_t< T > >( target );
+	return true;
+}
+
+template< typename Reader_Writer, typename T >
+bool
+start_native_frame_impl(
+	sax_output::value_kind_tag_t< sax_output::value_kind_t::map >,
+	context_t & ctx,
+	const Reader_Writer & reader_writer,
+	T & target,
+	compound_kind_t kind )
+{
+	using content_rw_t = sax_output::content_reader_writer< Reader_Writer >;
+	using item_reader_writer_t = std::decay_t<
+			decltype(content_rw_t::get( reader_writer )) >;
+
+	if( compound_kind_t::object != kind )
+		return false;
+
+	ctx.frames().push< map_frame_t< T, item_reader_writer_t > >(
+			ctx, target, content_rw_t::get( reader_writer ) );
+	return true;
+}
+
+// A non-null value of nullable_t or std::optional is constructed
+// in place and is read by a frame for the content.
+template< typename Reader_Writer, typename T >
+bool
+start_content_frame(
+	context_t & ctx,
+	const Reader_Writer & reader_writer,
+	T & target,
+	compound_kind_t kind )
+{
+	target.emplace();
+
+	start_value(
+			ctx,
+			sax_output::content_reader_writer< Reader_Writer >::get( reader_writer ),
+			*target,
+			kind );
+
+	return true;
+}
+
+template< typename Reader_Writer, typename T >
+bool
+start_native_frame_impl(
+	sax_output::value_kind_tag_t< sax_output::value_kind_t::nullable >,
+	context_t & ctx,
+	const Reader_Writer & reader_writer,
+	T & target,
+	compound_kind_t kind )
+{
+	return start_content_frame( ctx, reader_writer, target, kind );
+}
+
+template< typename Reader_Writer, typename T >
+bool
+start_native_frame_impl(
+	sax_output::value_kind_tag_t< sax_output::value_kind_t::optional >,
+	context_t & ctx,
+	const Reader_Writer & reader_writer,
+	T & target,
+	compound_kind_t kind )
+{
+	return start_content_frame( ctx, reader_writer, target, kind );
+}
+
+template< typename Reader_Writer, typename T >
+bool
+start_native_frame(
+	context_t & ctx,
+	const Reader_Writer & reader_writer,
+	T & target,
+	compound_kind_t kind )
+{
+	using tag_t = sax_output::value_kind_tag_t<
+			sax_output::detect_value_kind<
+					Reader_Writer,
+					T,
+					json_sax_input_t >() >;
+
+	return start_native_frame_impl( tag_t{}, ctx, reader_writer, target, kind );
+}
+
+template< typename Reader_Writer, typename T >
+void
+start_value(
+	context_t & ctx,
+	const Reader_Writer & reader_writer,
+	T & target,
+	compound_kind_t kind )
+{
+	if( !start_native_frame( ctx, reader_writer, target, kind ) )
+		ctx.frames().push< read_collected_frame_t< T, Reader_Writer > >(
+				target, reader_writer );
+}
+
+/*!
+ * @brief Handler for rapidjson::Reader.
+ *
+ * Passes events to the top frame. An exception from a frame stops
+ * the parsing and is rethrown by rethrow_if_failed().
+ *
+ * @since v.0.3.5
+ */
+class handler_t
+{
+	context_t & m_ctx;
+
+	//! The frame that handles the current event.
+	frame_t * m_active{ nullptr };
+
+	std::exception_ptr m_exception;
+
+	template< typename Action >
+	bool
+	handle( Action && action ) noexcept
+	{
+		try
+		{
+			action();
+			return true;
+		}
+		catch( const std::exception & ex )
+		{
+			// Members and items that contain the failed value are added
+			// the same way as binder_t::read_from does.
+			auto error = error_info_of( ex );
+			const auto path_size = error.path_size();
+			for( auto * frame = m_active; frame; frame = frame->parent() )
+				frame->decorate_error( m_ctx, error );
+
+			m_exception = path_size != error.path_size() ?
+					std::make_exception_ptr( ex_t{ std::move(error) } ) :
+					std::current_exception();
+		}
+		catch( ... )
+		{
+			m_exception = std::current_exception();
+		}
+
+		return false;
+	}
+
+	frame_t &
+	activate_top() noexcept
+	{
+		m_active = m_ctx.frames().top();
+		return *m_active;
+	}
+
+	bool
+	on_value( const rapidjson::Value & value )
+	{
+		return handle( [&] {
+				scalar_value_t scalar{ value, m_ctx.allocator() };
+				activate_top().on_value( m_ctx, scalar );
+			} );
+	}
+
+	bool
+	on_start( compound_kind_t kind )
+	{
+		return handle( [&] { activate_top().on_start( m_ctx, kind ); } );
+	}
+
+	bool
+	on_end( compound_kind_t kind, rapidjson::SizeType count )
+	{
+		return handle( [&] {
+				bool completed = activate_top().on_end( m_ctx, kind, count );
+				while( completed )
+				{
+					// NOTE: root_frame_t is never completed.
+					m_ctx.frames().pop();
+					completed = activate_top().on_child_completed( m_ctx );
+				}
+			} );
+	}
+
+public:
+	explicit handler_t( context_t & ctx ) : m_ctx{ ctx } {}
+
+	bool Null() { return on_value( rapidjson::Value{} ); }
+	bool Bool( bool v ) { return on_value( rapidjson::Value{ v } ); }
+	bool Int( int v ) { return on_value( rapidjson::Value{ v } ); }
+	bool Uint( unsigned v ) { return on_value( rapidjson::Value{ v } ); }
+	bool Int64( std::int64_t v ) { return on_value( rapidjson::Value{ v } ); }
+	bool Uint64( std::uint64_t v ) { return on_value( rapidjson::Value{ v } ); }
+	bool Double( double v ) { return on_value( rapidjson::Value{ v } ); }
+
+	bool
+	RawNumber( const char * str, rapidjson::SizeType length, bool copy )
+	{
+		return String( str, length, copy );
+	}
+
+	bool
+	String( const char * str, rapidjson::SizeType length, bool )
+	{
+		return on_value( rapidjson::Value{ str, length } );
+	}
+
+	bool StartObject() { return on_start( compound_kind_t::object ); }
+
+	bool
+	Key( const char * str, rapidjson::SizeType length, bool )
+	{
+		return handle( [&] {
+				activate_top().on_key( m_ctx, string_ref_t{ str, length } );
+			} );
+	}
+
+	bool
+	EndObject( rapidjson::SizeType count )
+	{
+		return on_end( compound_kind_t::object, count );
+	}
+
+	bool StartArray() { return on_start( compound_kind_t::array ); }
+
+	bool
+	EndArray( rapidjson::SizeType count )
+	{
+		return on_end( compound_kind_t::array, count );
+	}
+
+	//! Rethrow an exception that stopped the parsing.
+	/*!
+	 * @a offset is the position where the parsing was stopped.
+	 */
+	void
+	rethrow_if_failed( std::size_t offset ) const
+	{
+		if( !m_exception )
+			return;
+
+		try
+		{
+			std::rethrow_exception( m_exception );
+		}
+		catch( ex_t & ex )
+		{
+			if( !ex.info().offset() )
+				ex.info().set_offset( offset );
+			throw;
+		}
+	}
+};
+
+} /* namespace sax_input */
+
+} /* namespace details */
+
+namespace details
+{
+
+namespace member_index
+{
+
+/*!
+ * @brief Storage for values of slots of an index.
+ *
+ * Small DTOs don't require a dynamic allocation.
+ *
+ * @since v.0.3.5
+ */
+class values_t
+{
+	static constexpr std::size_t inline_capacity = 32u;
+
+	std::array< const rapidjson::Value *, inline_capacity > m_inline;
+	std::unique_ptr< const rapidjson::Value *[] > m_dynamic;
+	const rapidjson::Value ** m_values;
+
+public:
+	explicit values_t( std::size_t size )
+	{
+		if( size <= inline_capacity )
+			m_values = m_inline.data();
+		else
+		{
+			m_dynamic.reset( new const rapidjson::Value *[ size ] );
+			m_values = m_dynamic.get();
+		}
+
+		std::fill( m_values, m_values + size, nullptr );
+	}
+
+	const rapidjson::Value **
+	data() noexcept { return m_values; }
+};
+
+/*!
+ * @brief Dispatcher that passes found values to binders.
+ *
+ * If there is no index yet then names of fields are recorded and
+ * binders use FindMember.
+ *
+ * @since v.0.3.5
+ */
+class lookup_t
+{
+public:
+	//! Constructor for reading via an index.
+	lookup_t(
+		const rapidjson::Value & object,
+		const index_t & index,
+		const rapidjson::Value * const * values ) noexcept
+		:	m_object{ object }
+		,	m_index{ &index }
+		,	m_values{ values }
+	{}
+
+	//! Constructor for recording of names of fields.
+	lookup_t(
+		const rapidjson::Value & object,
+		std::vector< std::string > & names ) noexcept
+		:	m_object{ object }
+		,	m_names{ &names }
+	{}
+
+	template< typename Read_From_Impl, typename Data_Holder >
+	void
+	read_field( const Data_Holder & holder )
+	{
+		const auto position = m_position++;
+
+		if( m_names )
+			m_names->emplace_back(
+					holder.field_name().s, holder.field_name().length );
+
+		read_field_impl< Read_From_Impl >(
+				holder,
+				position,
+				meta::has_static_read_from_member< Read_From_Impl, Data_Holder >{} );
+	}
+
+	//! Get the object that is being read.
+	const rapidjson::Value &
+	object() const noexcept { return m_object; }
+
+	//! Count a binder from json_io().
+	/*!
+	 * Binders without read_from_dispatcher() are counted too,
+	 * but their names aren't recorded.
+	 */
+	void
+	binder_seen() noexcept { ++m_binders; }
+
+	//! Have names been recorded for all binders from json_io()?
+	bool
+	all_names_recorded() const noexcept
+	{
+		return m_names && m_names->size() == m_binders;
+	}
+
+private:
+	const rapidjson::Value & m_object;
+
+	const index_t * m_index{ nullptr };
+	const rapidjson::Value * const * m_values{ nullptr };
+
+	std::vector< std::string > * m_names{ nullptr };
+
+	//! Position of the current binder in json_io().
+	std::size_t m_position{ 0u };
+
+	//! Count of binders from json_io().
+	std::size_t m_binders{ 0u };
+
+	template< typename Read_From_Impl, typename Data_Holder >
+	void
+	read_field_impl(
+		const Data_Holder & holder,
+		std::size_t position,
+		std::true_type )
+	{
+		if( m_index )
+		{
+			const auto slot = m_index->slot_for_binder(
+					position, holder.field_name() );
+			if( index_t::npos != slot )
+			{
+				Read_From_Impl::read_from_member( holder, m_values[ slot ] );
+				return;
+			}
+		}
+
+		Read_From_Impl::read_from( holder, m_object );
+	}
+
+	template< typename Read_From_Impl, typename Data_Holder >
+	void
+	read_field_impl(
+		const Data_Holder & holder,
+		std::size_t,
+		std::false_type )
+	{
+		Read_From_Impl::read_from( holder, m_object );
+	}
+};
+
+template< typename Binder, typename = meta::void_t<> >
+struct has_read_from_dispatcher : public std::false_type {};
+
+template< typename Binder >
+struct has_read_from_dispatcher<
+		Binder,
+		meta::void_t<
+			decltype(std::declval< const Binder & >().read_from_dispatcher(
+					std::declval< lookup_t & >()))
+		>
+	> : public std::true_type {};
+
+template< typename Binder >
+void
+read_member_impl(
+	const Binder & b,
+	const rapidjson::Value & object,
+	lookup_t * lookup,
+	std::true_type )
+{
+	if( lookup )
+		b.read_from_dispatcher( *lookup );
+	else
+		b.read_from( object );
+}
+
+template< typename Binder >
+void
+read_member_impl(
+	const Binder & b,
+	const rapidjson::Value & object,
+	lookup_t *,
+	std::false_type )
+{
+	b.read_from( object );
+}
+
+template< typename Binder >
+void
+read_member(
+	const Binder & b,
+	const rapidjson::Value & object,
+	lookup_t * lookup )
+{
+	// Since v.0.3.5.
+	if( merge_patch_mode_t::active() )
+		return delta::read_member( b, object );
+
+	if( lookup )
+		lookup->binder_seen();
+
+	read_member_impl( b, object, lookup, has_read_from_dispatcher< Binder >{} );
+}
+
+template< typename Dto >
+void
+read_dto_directly( const rapidjson::Value & object, Dto & v )
+{
+	json_input_t input{ object };
+	json_io( input, v );
+}
+
+template< typename Dto >
+void
+read_dto_via_index( const rapidjson::Value & object, Dto & v )
+{
+	// FindMember is cheaper for very small objects.
+	constexpr std::size_t min_lookups_for_index = 16u;
+
+	auto & holder = index_holder_t< Dto >::instance();
+
+	if( const auto * index = holder.get() )
+	{
+		if( index->binders() * object.MemberCount() <= min_lookups_for_index )
+		{
+			read_dto_directly( object, v );
+			return;
+		}
+
+		values_t values{ index->slots() };
+		index->fill( object, values.data() );
+
+		lookup_t lookup{ object, *index, values.data() };
+		json_input_t input{ object, lookup };
+		json_io( input, v );
+	}
+	else
+	{
+		std::vector< std::string > names;
+
+		lookup_t lookup{ object, names };
+		json_input_t input{ object, lookup };
+		json_io( input, v );
+
+		// Names of fields can be missed if an error was stored
+		// by try_from_json() or some binders can't use the index.
+		if( !error_registered() && lookup.all_names_recorded() )
+			holder.publish( std::make_unique< index_t >( names ) );
+	}
+}
+
+template< typename Dto >
+void
+read_dto_impl( const rapidjson::Value & object, Dto & v, std::true_type )
+{
+	// Binders report errors for values that aren't objects.
+	// Merge patch mode doesn't use the index of members.
+	if( object.IsObject() && !merge_patch_mode_t::active() )
+		read_dto_via_index( object, v );
+	else
+		read_dto_directly( object, v );
+}
+
+template< typename Dto >
+void
+read_dto_impl( const rapidjson::Value & object, Dto & v, std::false_type )
+{
+	read_dto_directly( object, v );
+}
+
+/*!
+ * @brief Read a DTO from @a object via json_io().
+ *
+ * Members of an object are read in a single pass if it's possible.
+ *
+ * @since v.0.3.5
+ */
+template< typename Dto >
+void
+read_dto( const rapidjson::Value & object, Dto & v )
+{
+	const reading_scope_t scope{ v };
+
+	with_dto_instrumentation< Dto >( [&] {
+			read_dto_impl(
+					object,
+					v,
+					std::integral_constant< bool,
+							!meta::is_stl_like_container< Dto >::value >{} );
+		} );
+}
+
+} /* namespace member_index */
+
+namespace string_view_check
+{
+
+//
+// Compile-time check for string views in values that are read from
+// a document owned by json_dto.
+//
+// Such a document is destroyed before the return from from_json, so
+// string views would point to the freed memory. Fields of DTOs are
+// checked via instantiation of json_io() for probe_io_t. That json_io()
+// is never called.
+//
+// Since v.0.3.5.
+//
+
+template< typename T >
+void
+check_value();
+
+/*!
+ * @brief A type of probe Io object.
+ *
+ * It's a template with json_input_t as a parameter in order to make
+ * json_dto namespace an associated namespace for ADL.
+ */
+template< typename T >
+class probe_io_t
+{
+public:
+	template< typename Binder >
+	probe_io_t &
+	operator & ( const Binder & b )
+	{
+		check_binder( b, member_index::has_read_from_dispatcher< Binder >{} );
+		return *this;
+	}
+
+	template< typename Read_From_Impl, typename Data_Holder >
+	void
+	read_field( const Data_Holder & holder )
+	{
+		check_field( holder, has_reader_writer< Data_Holder >{} );
+	}
+
+private:
+	template< typename Data_Holder, typename = meta::void_t<> >
+	struct has_reader_writer : public std::false_type {};
+
+	template< typename Data_Holder >
+	struct has_reader_writer<
+			Data_Holder,
+			meta::void_t<
+				decltype(std::declval< const Data_Holder & >().reader_writer())
+			>
+		> : public std::true_type {};
+
+	template< typename Binder >
+	void
+	check_binder( const Binder & b, std::true_type )
+	{
+		b.read_from_dispatcher( *this );
+	}
+
+	// Binders of unknown types aren't checked.
+	template< typename Binder >
+	void
+	check_binder( const Binder &, std::false_type ) {}
+
+	// Only fields with default_reader_writer_t are checked.
+	template< typename Data_Holder >
+	void
+	check_field( const Data_Holder & holder, std::true_type )
+	{
+		check_field_value< std::remove_cv_t< std::remove_reference_t<
+					decltype(holder.field_for_deserialization()) > > >(
+				holder.reader_writer() );
+	}
+
+	template< typename Data_Holder >
+	void
+	check_field( const Data_Holder &, std::false_type ) {}
+
+	template< typename Field_Type >
+	void
+	check_field_value( const default_reader_writer_t & )
+	{
+		check_value< Field_Type >();
+	}
+
+	template< typename Field_Type, typename Reader_Writer >
+	void
+	check_field_value( const Reader_Writer & ) {}
+};
+
+template< typename Dto >
+void
+probe_json_io( Dto & dto )
+{
+	probe_io_t< json_input_t > io;
+	json_io( io, dto );
+}
+
+enum class value_kind_t
+{
+	other,
+	nullable,
+	sequence,
+	map,
+	dto
+};
+
+template< value_kind_t Kind >
+using value_kind_tag_t = std::integral_constant< value_kind_t, Kind >;
+
+template< typename T >
+constexpr value_kind_t
+detect_value_kind() noexcept
+{
+	return
+		( sax_output::is_nullable< T >::value ||
+				sax_output::is_optional< T >::value ) ?
+			value_kind_t::nullable :
+		meta::is_stl_map_like_associative_container< T >::value ?
+			value_kind_t::map :
+		meta::is_stl_like_container< T >::value ?
+			value_kind_t::sequence :
+		sax_output::has_json_io< T, probe_io_t< json_input_t > >::value ?
+			value_kind_t::dto :
+			value_kind_t::other;
+}
+
+template< typename T >
+void
+check_content( value_kind_tag_t< value_kind_t::other > ) {}
+
+template< typename T >
+void
+check_content( value_kind_tag_t< value_kind_t::nullable > )
+{
+	check_value< std::remove_cv_t< std::remove_reference_t<
+			decltype(*std::declval< T & >()) > > >();
+}
+
+template< typename T >
+void
+check_content( value_kind_tag_t< value_kind_t::sequence > )
+{
+	check_value< typename T::value_type >();
+}
+
+template< typename T >
+void
+check_content( value_kind_tag_t< value_kind_t::map > )
+{
+	check_value< typename T::key_type >();
+	check_value< typename T::mapped_type >();
+}
+
+template< typename T >
+void
+check_content( value_kind_tag_t< value_kind_t::dto > )
+{
+	(void)&probe_json_io< T >;
+}
+
+template< typename T >
+void
+check_value()
+{
+	static_assert(
+			!sax_input::is_string_view_for_default_reader< T >::value,
+			"string views can't be read from a document that is destroyed "
+			"before the return from from_json, use a document kept by "
+			"the caller, from_json_insitu with a buffer or make_parsed" );
+
+	check_content< T >( value_kind_tag_t< detect_value_kind< T >() >{} );
+}
+
+} /* namespace string_view_check */
+
+} /* namespace details */
+
+//
+// start of inside_array related stuff
+//
+
+namespace inside_array
+{
+
+namespace details
+{
+
+/*!
+ * @brief Base class for all implementations of array member (de)serializers.
+ *
+ * It's necessary to have a possibility to build a vector of pointers to actual
+ * instances of (de)serializers. All those (de)serializers may have different
+ * types and we want a simple way to work with them without digging into
+ * complex template magic.
+ *
+ * @since v.0.3.3
+ */
+class member_processor_base_t
+{
+public:
+	/*!
+	 * Implementation should process an item with index @a index from array @a from.
+	 *
+	 * @note
+	 * It's guaranteed that @a from is an array.
+	 */
+	virtual void
+	read(
+		rapidjson::SizeType index,
+		const rapidjson::Value & from ) const = 0;
+
+	/*!
+	 * Implementation should assign a default value to the item.
+	 *
+	 * This method is called when actual array in JSON has less items than
+	 * described by a user. All missing items have to receive default values.
+	 */
+	virtual void
+	on_field_not_defined() const = 0;
+
+	/*!
+	 * Implementation should add the next value to arrat @a to.
+	 *
+	 * The implementation must use `to.PushBack` for adding a value.
+	 *
+	 * @note
+	 * It's guaranteed that @a from is an array.
+	 */
+	virtual void
+	write(
+		rapidjson::Value & to,
+		rapidjson::MemoryPoolAllocator<> & allocator ) const = 0;
+};
+
+/*!
+ * @brief A metafunction that specified that all members are mandatory.
+ *
+ * This metafunction will be used by json_dto::inside_array::reader_writer by
+ * default.
+ */
+struct all_members_required_t
+{
+	/*!
+	 * @brief Metafunction that detects if the specified number of fields is valid.
+	 *
+	 * This metafunction always returns true.
+	 *
+	 * @since v.0.3.3
+	 */
+	template< rapidjson::SizeType Members_Count >
+	struct is_valid_members_count
+	{
+		static constexpr bool value = true;
+	};
+
+	/*!
+	 * @brief Helper method that detect number of array members to be read.
+	 *
+	 * @return the value of @a expected_members (or 0 if the error
+	 * is stored by try_from_json()).
+	 *
+	 * @throw ex_t if @a expected_members is not equal to @a actual_members.
+	 *
+	 * @since v.0.3.3
+	 */
+	JSON_DTO_NODISCARD
+	static rapidjson::SizeType
+	handle_actual_members_count(
+		rapidjson::SizeType expected_members,
+		rapidjson::SizeType actual_members )
+	{
+		if( expected_members != actual_members )
+		{
+			report_error( error_code_t::invalid_size,
+					"inside_array: actual members count ("
+					+ std::to_string(actual_members)
+					+ ") missmatches expected members count ("
+					+ std::to_string(expected_members) + ")" );
+			return 0u;
+		}
+
+		return expected_members;
+	}
+};
+
+/*!
+ * @brief Implementation of a reader-writer or a case when a bunch of fields
+ * has to be placed into an array.
+ *
+ * @note
+ * This implementation always serializes exactly @a Members_Count fields.
+ * Number of fields to be deserialized depends on @a At_Least_Limiter.
+ *
+ * @tparam Members_Count number of fields for (de)serialization.
+ * @tparam At_Least_Limiter a metafunction for work with number of fields.
+ * It's expected to be json_dto::inside_array::details::all_members_required_t,
+ * json_dto::inside_array::at_least or similar.
+ *
+ * @since v.0.3.3
+ */
+template<
+	rapidjson::SizeType Members_Count,
+	typename At_Least_Limiter >
+class reader_writer_t
+{
+	static_assert( 0u != Members_Count, "Members_Count can't be 0" );
+	static_assert(
+			At_Least_Limiter::template is_valid_members_count<Members_Count>::value,
+			"At_Least_Limiter has to allow at least Members_Count items in an array" );
+
+	//! Just a useful type alias.
+	using member_processor_ptr_t = const member_processor_base_t*;
+
+	//! Holder for pointers to actual members processor.
+	/*!
+	 * It's expected that all the pointers remain valid the whole lifetime
+	 * of reader_writer_t object.
+	 */
+	std::array< member_processor_ptr_t, Members_Count > m_member_processors;
+
+	//! Helper method for filling %m_member_processors.
+	template<
+		std::size_t Index,
+		typename Member_Processor >
+	static void
+	set_member_processor_pointer(
+		reader_writer_t & self,
+		Member_Processor && current_processor )
+	{
+		self.m_member_processors[ Index ] = std::addressof(current_processor);
+	}
+
+	//! Helper method for filling %m_member_processors.
+	template<
+		std::size_t Index,
+		typename Member_Processor,
+		typename... Tail >
+	static void
+	set_member_processor_pointer(
+		reader_writer_t & self,
+		Member_Processor && current_processor,
+		Tail && ...tail )
+	{
+		self.m_member_processors[ Index ] = std::addressof(current_processor);
+		set_member_processor_pointer<Index + 1u>( self, std::forward<Tail>(tail)... );
+	}
+
+public:
+	reader_writer_t(
+		const reader_writer_t & ) = default;
+	reader_writer_t(
+		reader_writer_t && ) = default;
+
+	reader_writer_t &
+	operator=( const reader_writer_t & ) = default;
+	reader_writer_t &
+	operator=( reader_writer_t && ) = default;
+
+	//! Initializing constructor.
+	template< typename... Member_Processors >
+	reader_writer_t( Member_Processors && ...processors )
+	{
+		static_assert( Members_Count == sizeof...(processors),
+				"Members_Count should be equal to sizeof...(processors)" );
+
+		set_member_processor_pointer< 0u >(
+				*this,
+				std::forward<Member_Processors>(processors)... );
+	}
+
+	//! Reads members from JSON value.
+	/*!
+	 * It may read less than @a Members_Count members if some are missing
+	 * during deserialization and @a At_Least_Limiter allows that.
+	 *
+	 * @note
+	 * It's expected that @a from is an array. An ex_t is thrown otherwise.
+	 */
+	template< typename Field_Type >
+	void
+	read( Field_Type & /*ignored*/, const rapidjson::Value & from ) const
+	{
+		if( from.IsArray() )
+		{
+			const auto members_to_read =
+					At_Least_Limiter::handle_actual_members_count( Members_Count, from.Size() );
+			if( json_dto::details::error_registered() )
+				return;
+
+			// Members that are missing in JSON have to be handled too.
+			json_dto::details::for_each_index(
+				static_cast< rapidjson::SizeType >( Members_Count ),
+				[&]( rapidjson::SizeType i ) {
+					if( i < members_to_read )
+						m_member_processors[ i ]->read( i, from );
+					else
+						m_member_processors[ i ]->on_field_not_defined();
+				} );
+		}
+		else
+			report_error( error_code_t::type_mismatch,
+					"reader_writer_t: value is not an array" );
+	}
+
+	//! Writes members into JSON value.
+	/*!
+	 * Changes type of @a to to an array and then adds all members to it.
+	 */
+	template< typename Field_Type >
+	void
+	write(
+		const Field_Type & /*ignored*/,
+		rapidjson::Value & to,
+		rapidjson::MemoryPoolAllocator<> & allocator ) const
+	{
+		to.SetArray();
+		to.Reserve( Members_Count, allocator );
+		for( rapidjson::SizeType i = 0u; i != Members_Count; ++i )
+			m_member_processors[ i ]->write( to, allocator );
+	}
+};
+
+/*!
+ * @brief Implementation of a reader-writer for a case when a bunch of fields
+ * has to be placed into an array without virtual calls.
+ *
+ * Unlike reader_writer_t it holds copies of member processors in a tuple
+ * and processes them one by one at compile time. It allows the compiler
+ * to inline reading and writing of every member.
+ *
+ * @tparam At_Least_Limiter a metafunction for work with number of fields.
+ * It's expected to be json_dto::inside_array::details::all_members_required_t,
+ * json_dto::inside_array::at_least or similar.
+ * @tparam Member_Processors types of member processors.
+ *
+ * @since v.0.3.5
+ */
+template<
+	typename At_Least_Limiter,
+	typename... Member_Processors >
+class static_reader_writer_t
+{
+	static constexpr rapidjson::SizeType members_count =
+			static_cast< rapidjson::SizeType >( sizeof...(Member_Processors) );
+
+	static_assert( 0u != members_count, "Members_Count can't be 0" );
+	static_assert(
+			At_Least_Limiter::template is_valid_members_count<members_count>::value,
+			"At_Least_Limiter has to allow at least Members_Count items in an array" );
+
+	template< std::size_t Index >
+	using index_t = std::integral_constant< std::size_t, Index >;
+
+	//! Member processors.
+	std::tuple< Member_Processors... > m_member_processors;
+
+	//! Helper method for reading a member with index Index.
+	template< std::size_t Index >
+	void
+	read_members(
+		const rapidjson::Value & from,
+		rapidjson::SizeType members_to_read,
+		index_t< Index > ) const
+	{
+		json_dto::details::with_error_path(
+			[&] {
+				const auto & processor = std::get< Index >( m_member_processors );
+				// Members that are missing in JSON have to be handled too.
+				if( Index < members_to_read )
+					processor.read( Index, from );
+				else
+					processor.on_field_not_defined();
+			},
+			[]( error_info_t & error ) { error.add_index( Index ); } );
+
+		read_members( from, members_to_read, index_t< Index + 1u >{} );
+	}
+
+	void
+	read_members(
+		const rapidjson::Value &,
+		rapidjson::SizeType,
+		index_t< members_count > ) const
+	{}
+
+	//! Helper method for writing a member with index Index.
+	template< std::size_t Index >
+	void
+	write_members(
+		rapidjson::Value & to,
+		rapidjson::MemoryPoolAllocator<> & allocator,
+		index_t< Index > ) const
+	{
+		std::get< Index >( m_member_processors ).write( to, allocator );
+
+		write_members( to, allocator, index_t< Index + 1u >{} );
+	}
+
+	void
+	write_members(
+		rapidjson::Value &,
+		rapidjson::MemoryPoolAllocator<> &,
+		index_t< members_count > ) const
+	{}
+
+public:
+	//! Initializing constructor.
+	explicit static_reader_writer_t( Member_Processors ...processors )
+		:	m_member_processors{ std::move(processors)... }
+	{}
+
+	//! Reads members from JSON value.
+	/*!
+	 * It may read less than all members if some are missing
+	 * during deserialization and @a At_Least_Limiter allows that.
+	 *
+	 * @note
+	 * It's expected that @a from is an array. An ex_t is thrown otherwise.
+	 */
+	template< typename Field_Type >
+	void
+	read( Field_Type & /*ignored*/, const rapidjson::Value & from ) const
+	{
+		if( from.IsArray() )
+		{
+			const auto members_to_read =
+					At_Least_Limiter::handle_actual_members_count( members_count, from.Size() );
+			if( json_dto::details::error_registered() )
+				return;
+
+			read_members( from, members_to_read, index_t< 0u >{} );
+		}
+		else
+			report_error( error_code_t::type_mismatch,
+					"reader_writer_t: value is not an array" );
+	}
+
+	//! Writes members into JSON value.
+	/*!
+	 * Changes type of @a to to an array and then adds all members to it.
+	 */
+	template< typename Field_Type >
+	void
+	write(
+		const Field_Type & /*ignored*/,
+		rapidjson::Value & to,
+		rapidjson::MemoryPoolAllocator<> & allocator ) const
+	{
+		to.SetArray();
+		to.Reserve( members_count, allocator );
+		write_members( to, allocator, index_t< 0u >{} );
+	}
+};
+
+/*!
+ * @brief A mixin to be reused by actual implementations of
+ * member_processor_base.
+ *
+ * It holds:
+ *
+ * - a reference to the field to be (de)serialized,
+ * - a copy of Reader_Writer instance,
+ * - a copy of Validator instance.
+ *
+ * It provides implementations of read_impl() and write_impl() methods.
+ * It's assumed that read_impl() and write_impl() will be called in
+ * the derived classes.
+ *
+ * @tparam Field_Type type of field to be (de)serialized.
+ *
+ * @tparam Reader_Writer type of reader-writer for (de)serialization of
+ * field value.
+ *
+ * @tparam Validator type of validator for checking validity of the field value.
+ *
+ * @since v.0.3.3
+ */
+template<
+	typename Field_Type,
+	typename Reader_Writer,
+	typename Validator >
+class member_processor_common_impl_t
+{
+protected:
+	//! Reference to a field to be (de)serialized.
+	/*!
+	 * @note
+	 * It's expected that this reference remains valid the whole lifetime
+	 * of member_processor_common_impl_t object.
+	 */
+	Field_Type & m_field;
+
+	//! An instance of reader-writer to be used for (de)serialization.
+	const Reader_Writer m_reader_writer;
+
+	using validator_t = ::json_dto::details::field_validator<
+			std::remove_cv_t< Field_Type >, Validator >;
+
+	//! An instance of validator to be used for checking field value validity.
+	/*!
+	 * @note Validators of lazy_t fields are wrapped. Since v.0.3.5.
+	 */
+	const typename validator_t::type m_validator;
+
+public:
+	member_processor_common_impl_t(
+		Field_Type & field,
+		Reader_Writer reader_writer,
+		Validator validator )
+		:	m_field{ field }
+		,	m_reader_writer{ std::move(reader_writer) }
+		,	m_validator{ validator_t::make( std::move(validator) ) }
+	{}
+
+	void
+	read_impl(
+		rapidjson::SizeType index,
+		const rapidjson::Value & from ) const
+	{
+		m_reader_writer.read( m_field, from[ index ] );
+		m_validator( m_field );
+	}
+
+	void
+	write_impl(
+		rapidjson::Value & to,
+		rapidjson::MemoryPoolAllocator<> & allocator ) const
+	{
+		// The value has to be passed to the validator before serialization.
+		m_validator( m_field );
+
+		// Now the field can be serialized.
+		rapidjson::Value o;
+		m_reader_writer.write( m_field, o, allocator );
+		to.PushBack( o.Move(), allocator );
+	}
+};
+
+/*!
+ * @brief Simple implementation of member_processor_base.
+ *
+ * Uses a Field_Type{} in implementation of on_field_not_defined().
+ *
+ * @note
+ * The Field_Type has to be DefaultConstructible.
+ *
+ * @tparam Field_Type type of field to be (de)serialized.
+ *
+ * @tparam Reader_Writer type of reader-writer for (de)serialization of
+ * field value.
+ *
+ * @tparam Validator type of validator for checking validity of the field value.
+ *
+ * @since v.0.3.3
+ */
+template<
+	typename Field_Type,
+	typename Reader_Writer,
+	typename Validator >
+class simplest_member_processor_t final
+	:	public member_processor_base_t
+	,	protected member_processor_common_impl_t<Field_Type, Reader_Writer, Validator>
+{
+	using common_impl_t =
+			member_processor_common_impl_t<Field_Type, Reader_Writer, Validator>;
+
+public:
+	simplest_member_processor_t(
+		Field_Type & field,
+		Reader_Writer reader_writer,
+		Validator validator )
+		:	common_impl_t{ field, std::move(reader_writer), std::move(validator) }
+	{}
+
+	void
+	read(
+		rapidjson::SizeType index,
+		const rapidjson::Value & from ) const override
+	{
+		this->read_impl( index, from );
+	}
+
+	void
+	on_field_not_defined() const override
+	{
+		this->m_field = Field_Type{};
+		// The default value has to be passed to the validator too.
+		this->m_validator( this->m_field );
+	}
+
+	void
+	write(
+		rapidjson::Value & to,
+		rapidjson::MemoryPoolAllocator<> & allocator ) const override
+	{
+		this->write_impl( to, allocator );
+	}
+};
+
+/*!
+ * @brief Implementation of member_processor_base that uses a default value
+ * specified by a user.
+ *
+ * Uses a default value specified by a user in implementation of
+ * on_field_not_defined().
+ *
+ * @tparam Field_Type type of field to be (de)serialized.
+ *
+ * @tparam Default_Value_Reference_Holder type for holding a default value.
+ * It's expected to be default_value_const_ref_holder_t<Field_Type> or
+ * default_value_rvalue_ref_holder_t<Field_Type>.
+ *
+ * @tparam Reader_Writer type of reader-writer for (de)serialization of
+ * field value.
+ *
+ * @tparam Validator type of validator for checking validity of the field value.
+ *
+ * @since v.0.3.3
+ */
+template<
+	typename Field_Type,
+	typename Default_Value_Reference_Holder,
+	typename Reader_Writer,
+	typename Validator >
+class member_with_default_value_processor_t final
+	:	public member_processor_base_t
+	,	protected member_processor_common_impl_t<Field_Type, Reader_Writer, Validator>
+{
+	using common_impl_t =
+			member_processor_common_impl_t<Field_Type, Reader_Writer, Validator>;
+
+private:
+	Default_Value_Reference_Holder m_default_value_reference_holder;
+
+public:
+	member_with_default_value_processor_t(
+		Field_Type & field,
+		Default_Value_Reference_Holder default_value_reference_holder,
+		Reader_Writer reader_writer,
+		Validator validator )
+		:	common_impl_t{ field, std::move(reader_writer), std::move(validator) }
+		,	m_default_value_reference_holder{ default_value_reference_holder }
+	{}
+
+	void
+	read(
+		rapidjson::SizeType index,
+		const rapidjson::Value & from ) const override
+	{
+		this->read_impl( index, from );
+	}
+
+	void
+	on_field_not_defined() const override
+	{
+		this->m_field = m_default_value_reference_holder.get();
+
+		// The default value has to be passed to the validator too.
+		this->m_validator( this->m_field );
+	}
+
+	void
+	write(
+		rapidjson::Value & to,
+		rapidjson::MemoryPoolAllocator<> & allocator ) const override
+	{
+		this->write_impl( to, allocator );
+	}
+};
+
+/*!
+ * @brief Helper class for holding a "const reference" to the default value.
+ *
+ * This class is used when the default value has to be copied, not moved out.
+ *
+ * @note
+ * The m_default_value may be a "reference" to a temporary value.
+ * It's assumed that this "reference" remains valid the whole life of
+ * a default_value_const_ref_holder_t object.
+ *
+ * @since v.0.3.3
+ */
+template< typename Field_Type >
+class default_value_const_ref_holder_t
+{
+	const Field_Type * m_default_value;
+
+public:
+	explicit default_value_const_ref_holder_t( const Field_Type & default_value )
+		:	m_default_value{ std::addressof(default_value) }
+	{}
+
+	JSON_DTO_NODISCARD
+	const Field_Type &
+	get() const noexcept { return *m_default_value; }
+};
+
+/*!
+ * @brief Helper class for holding a "rvalue reference" to the default value.
+ *
+ * This class is used when the default value has to be moved out, not copied.
+ *
+ * @note
+ * The m_default_value may be a "reference" to a temporary value.
+ * It's assumed that this "reference" remains valid the whole life of
+ * a default_value_rvalue_ref_holder_t object.
+ *
+ * @since v.0.3.3
+ */
+template< typename Field_Type >
+class default_value_rvalue_ref_holder_t
+{
+	Field_Type * m_default_value;
+
+public:
+	explicit default_value_rvalue_ref_holder_t( Field_Type && default_value )
+		:	m_default_value{ std::addressof(default_value) }
+	{}
+
+	JSON_DTO_NODISCARD
+	Field_Type &&
+	get() const noexcept { return std::move(*m_default_value); }
+};
+
+} /* namespace inside_array::details */
+
+/*!
+ * @brief A metafunction that specified a number of mandatory member count.
+ *
+ * Usage example:
+ * @code
+ * struct inner {
+ * 	int a;
+ * 	int b;
+ * 	int c;
+ * 	int d;
+ * };
+ *
+ * struct outer {
+ * 	inner x;
+ *
+ * 	template<typename Io> void json_io(Io & io) {
+ * 		io & json_dto::mandatory(
+ * 				json_dto::inside_array::reader_writer<
+ * 					// At least two members have to be present.
+ * 					// Otherwise an exception will be thrown.
+ * 					json_dto::inside_array::at_least<2>
+ * 				>(
+ * 					// Mandatory member. Has to be present during deserialization.
+ * 					json_dto::inside_array::member(x.a),
+ * 					// Mandatory member. Has to be present during deserialization.
+ * 					json_dto::inside_array::member(x.b),
+ * 					// Optional member. A default value will be used if it's missing during deserialization.
+ * 					json_dto::inside_array::member(x.c),
+ * 					// Optional member. A default value will be used if it's missing during deserialization.
+ * 					json_dto::inside_array::member(x.d)
+ * 				),
+ * 				"x", x )
+ * 			;
+ * 	}
+ * };
+ * @endcode
+ *
+ * @note
+ * This metafunction will lead to run-time exceptions if there are more items in
+ * an array than described fields:
+ * @code
+ * struct inner {
+ * 	int a;
+ * 	int b;
+ * 	int c;
+ * };
+ *
+ * struct outer {
+ * 	inner x;
+ *
+ * 	template<typename Io> void json_io(Io & io) {
+ * 		io & json_dto::mandatory(
+ * 				json_dto::inside_array::reader_writer<
+ * 					json_dto::inside_array::at_least<1>
+ * 				>(
+ * 					json_dto::inside_array::member(x.a),
+ * 					json_dto::inside_array::member(x.b),
+ * 					json_dto::inside_array::member(x.c)
+ * 				), "x", x );
+ * 	}
+ * };
+ * ...
+ * // An exception will be thrown here, because the array in JSON contains
+ * // more items than described members.
+ * auto obj = json_dto::from_json<outer>(R"({"x":[1, 2, 3, 4, 5]})");
+ * @endcode
+ *
+ * @since v.0.3.3
+ */
+template< std::size_t Number >
+struct at_least
+{
+	/*!
+	 * @brief Metafunction that detects if Number is not greater than Members_Count.
+	 *
+	 * The at_least metafunction can be used with
+	 * json_dto::inside_array::reader_writer only if Number is less than or
+	 * equal to Members_Count. Otherwise the at_least limitation can't be used.
+	 *
+	 * @since v.0.3.3
+	 */
+	template< rapidjson::SizeType Members_Count >
+	struct is_valid_members_count
+	{
+		static constexpr bool value = (Number <= Members_Count);
+	};
+
+	/*!
+	 * @brief Helper method that detect number of array members to be read.
+	 *
+	 * @return the value of @a actual_members (or 0 if the error
+	 * is stored by try_from_json()).
+	 *
+	 * @throw ex_t if @a actual_members is less than Number.
+	 * @throw ex_t if @a actual_members is greater than @a expected_members.
+	 *
+	 * @since v.0.3.3
+	 */
+	JSON_DTO_NODISCARD
+	static rapidjson::SizeType
+	handle_actual_members_count(
+		rapidjson::SizeType expected_members,
+		rapidjson::SizeType actual_members )
+	{
+		if( actual_members < Number )
+		{
+			report_error( error_code_t::invalid_size,
+					"inside_array: actual members count ("
+					+ std::to_string(actual_members)
+					+ ") is less than expected mandatory members count ("
+					+ std::to_string(Number) + ")" );
+			return 0u;
+		}
+		if( expected_members < actual_members )
+		{
+			report_error( error_code_t::invalid_size,
+					"inside_array: actual members count ("
+					+ std::to_string(actual_members)
+					+ ") is greater than expected members count ("
+					+ std::to_string(Number) + ")" );
+			return 0u;
+		}
+
+		return actual_members;
+	}
+};
+
+/*!
+ * @brief A special reader-writer that allows to store several values into an array
+ * and read from an array.
+ *
+ * Usage example:
+ * @code
+ * struct inner {
+ * 	int a;
+ * 	std::string b;
+ * };
+ *
+ * struct outer {
+ * 	inner x;
+ *
+ * 	template<typename Io> json_io(Io & io) {
+ * 		io & json_dto::mandatory(
+ * 			json_dto::inside_array::reader_writer(
+ * 				// All fields to be placed inside an array have
+ * 				// to be enumerated here. The order is important.
+ * 				json_dto::inside_array::member(x.a),
+ * 				json_dto::inside_array::member(x.b) ),
+ * 			"x", x);
+ * 	}
+ * };
+ *
+ * auto obj = json_dto::from_json<outer>(R"({"x":[1, "two"]})");
+ * assert(obj.x.a == 1);
+ * assert(obj.x.b == "two");
+ *
+ * obj.x.a = 42;
+ * obj.x.b = "Hello, World";
+ * auto json = json_dto::to_json(obj);
+ * assert(json == R"({"x":[42,"Hello, World"]})");
+ * @endcode
+ *
+ * By default this reader_writer requires that all members are present during
+ * deserialization. If some members may be absent then `at_least` limit has to
+ * be specified:
+ * @code
+ * struct inner {
+ * 	int a;
+ * 	int b;
+ * 	int c;
+ * 	int d;
+ * };
+ *
+ * struct outer {
+ * 	inner x;
+ *
+ * 	template<typename Io> void json_io(Io & io) {
+ * 		io & json_dto::mandatory(
+ * 				json_dto::inside_array::reader_writer<
+ * 					// At least two members have to be present.
+ * 					// Otherwise an exception will be thrown.
+ * 					json_dto::inside_array::at_least<2>
+ * 				>(
+ * 					json_dto::inside_array::member(x.a),
+ * 					json_dto::inside_array::member(x.b),
+ * 					json_dto::inside_array::member(x.c),
+ * 					json_dto::inside_array::member(x.d)
+ * 				),
+ * 				"x", x )
+ * 			;
+ * 	}
+ * };
+ *
+ * const auto o1 = json_dto::from_json<outer>(R"({"x":[1,2,3]})");
+ * // o1.x.d will be 0.
+ *
+ * const auto o2 = json_dto::from_json<outer>(R"({"x":[1,2]})");
+ * // o2.x.c and o2.x.d will be 0.
+ * @endcode
+ *
+ * This reader-writer can be used for manual (de)serialization of tuples:
+ * @code
+ * struct outer {
+ * 	std::tuple<int, std::string> x;
+ *
+ * 	template<typename Io> json_io(Io & io) {
+ * 		io & json_dto::mandatory(
+ * 			json_dto::inside_array::reader_writer(
+ * 				json_dto::inside_array::member(std::get<0>(x)),
+ * 				json_dto::inside_array::member(std::get<1>(x))),
+ * 			"x", x);
+ * 	}
+ * };
+ * @endcode
+ *
+ * @attention
+ * This function returns a temporary object that should not be stored anywhere and
+ * must be passed directly to json_dto::mandatory(), json_dto::optional(),
+ * json_dto::optional_no_default() and similar binders.
+ *
+ * @since v.0.3.3
+ */
+template<
+	typename At_Least_Limiter = inside_array::details::all_members_required_t,
+	typename... Member_Processors >
+JSON_DTO_NODISCARD
+auto
+reader_writer( Member_Processors && ...processors )
+{
+	return details::reader_writer_t<
+			sizeof...(Member_Processors),
+			At_Least_Limiter
+		>( std::forward<Member_Processors>(processors)... );
+}
+
+/*!
+ * @brief A special reader-writer that allows to store several values into
+ * an array and read from an array without virtual calls.
+ *
+ * It's used the same way as reader_writer() and has the same semantics of
+ * `at_least`:
+ * @code
+ * struct quote {
+ * 	std::int64_t time;
+ * 	double bid;
+ * 	double ask;
+ *
+ * 	template<typename Io> void json_io(Io & io) {
+ * 		io & json_dto::mandatory(
+ * 			json_dto::inside_array::static_reader_writer<
+ * 					json_dto::inside_array::at_least<2> >(
+ * 				json_dto::inside_array::member(time),
+ * 				json_dto::inside_array::member(bid),
+ * 				json_dto::inside_array::member(ask) ),
+ * 			"q", *this);
+ * 	}
+ * };
+ * @endcode
+ *
+ * Members are processed in the order of declaration, there is no
+ * virtual call for every member. It makes reading and writing of
+ * short arrays faster.
+ *
+ * @note
+ * The returned object holds copies of member processors, so it can
+ * be stored while references to fields remain valid.
+ *
+ * @since v.0.3.5
+ */
+template<
+	typename At_Least_Limiter = inside_array::details::all_members_required_t,
+	typename... Member_Processors >
+JSON_DTO_NODISCARD
+auto
+static_reader_writer( Member_Processors && ...processors )
+{
+	return details::static_reader_writer_t<
+			At_Least_Limiter,
+			std::decay_t< Member_Processors >...
+		>( std::forward<Member_Processors>(processors)... );
+}
+
+/*!
+ * @brief A special function that describes one member of an array
+ * representation.
+ *
+ * Usage example:
+ * @code
+ * struct inner {
+ * 	int a;
+ * 	int b;
+ * 	int c;
+ * 	int d;
+ * };
+ *
+ * struct outer {
+ * 	inner x;
+ *
+ * 	template<typename Io> void json_io(Io & io) {
+ * 		io & json_dto::mandatory(
+ * 				json_dto::inside_array::reader_writer< json_dto::inside_array::at_least<2> >(
+ * 					// Mandatory member.
+ * 					json_dto::inside_array::member(x.a),
+ * 					// Mandatory member.
+ * 					json_dto::inside_array::member(x.b, json_dto::min_max_constraint(-10, +10)),
+ * 					// Optional member. Will be initialized by int{} if it's absent
+ * 					// during deserialiaztion.
+ * 					json_dto::inside_array::member(x.c),
+ * 					// Optional member. Will be initialized by int{} if it's absent
+ * 					// during deserialiaztion.
+ * 					json_dto::inside_array::member(x.d, json_dto::one_of_constraint({2, 4, 6, 10, 20, 40})
+ * 				),
+ * 				"x", x )
+ * 			;
+ * 	}
+ * };
+ * @endcode
+ *
+ * @attention
+ * This function returns a temporary object that should not be stored anywhere and
+ * must be passed directly to json_dto::inside_array::reader_writer().
+ *
+ * @since v.0.3.3
+ */
+template<
+	typename Field_Type,
+	typename Validator = empty_validator_t >
+JSON_DTO_NODISCARD
+auto
+member( Field_Type & field, Validator validator = Validator{} )
+{
+	return details::simplest_member_processor_t<
+			Field_Type,
+			default_reader_writer_t,
+			Validator
+		>( field, default_reader_writer_t{}, std::move(validator) );
+}
+
+/*!
+ * @brief A special function that describes one member of an array
+ * representation.
+ *
+ * Allows to specify a default value if item is not present in an array
+ * on deserialization.
+ *
+ * Usage example:
+ * @code
+ * struct inner {
+ * 	int a;
+ * 	int b;
+ * 	int c;
+ * 	int d;
+ * };
+ *
+ * struct outer {
+ * 	inner x;
+ *
+ * 	template<typename Io> void json_io(Io & io) {
+ * 		io & json_dto::mandatory(
+ * 				json_dto::inside_array::reader_writer< json_dto::inside_array::at_least<2>(
+ * 					// Mandatory member.
+ * 					json_dto::inside_array::member(x.a),
+ * 					// Mandatory member.
+ * 					json_dto::inside_array::member(x.b, json_dto::min_max_constraint(-10, +10)),
+ * 					// Optional member. It will be initialized by 5 if it's absent during
+ * 					// deserialization.
+ * 					json_dto::inside_array::member_with_default_value(x.c, 5),
+ * 					// Optional member. It will be initialized by 6 if it's absent during
+ * 					// deserialization.
+ * 					json_dto::inside_array::member(x.d, 6, json_dto::one_of_constraint({2, 4, 6, 10, 20, 40})
+ * 				),
+ * 				"x", x )
+ * 			;
+ * 	}
+ * };
+ * @endcode
+ *
+ * @note
+ * This overload is used when the default value is represented as ordinary
+ * const- or non-const reference. A copy of default value will be made if the member
+ * is missing during deserialization.
+ * For example:
+ * @code
+ * struct inner {
+ * 	int a;
+ * 	some_complex_type b;
+ * 	another_complex_type c;
+ * 	...
+ *
+ * 	static const some_complex_type default_b;
+ * 	static another_complex_type default_c;
+ * };
+ * const some_complex_type inner::default_b{...};
+ * another_complex_type inner::default_c{...};
+ *
+ * struct outer {
+ * 	inner x;
+ *
+ * 	template<typename Io> void json_io(Io & io) {
+ * 		io & json_dto::mandatory(
+ * 				json_dto::inside_array::reader_writer< json_dto::inside_array::at_least<2>(
+ * 					// Mandatory member.
+ * 					json_dto::inside_array::member(x.a),
+ * 					// Optional member. A copy of inner::default_b will be made if
+ * 					// inner::b is missing during deserialization.
+ * 					json_dto::inside_array::member_with_default_value(x.b, inner::default_b),
+ * 					// Optional member. A copy of inner::default_c will be made if
+ * 					// inner::c is missing during deserialization.
+ * 					json_dto::inside_array::member(x.c, inner::default_c)
+ * 				),
+ * 				"x", x )
+ * 			;
+ * };
+ * @endcode
+ *
+ * @attention
+ * This function returns a temporary object that should not be stored anywhere and
+ * must be passed directly to json_dto::inside_array::reader_writer().
+ *
+ * @since v.0.3.3
+ */
+template<
+	typename Field_Type,
+	typename Validator = empty_validator_t >
+JSON_DTO_NODISCARD
+auto
+member_with_default_value(
+	Field_Type & field,
+	const Field_Type & default_value,
+	Validator validator = Validator{} )
+{
+	using default_holder_t = details::default_value_const_ref_holder_t<Field_Type>;
+
+	return details::member_with_default_value_processor_t<
+			Field_Type,
+			default_holder_t,
+			default_reader_writer_t,
+			Validator
+		>( field,
+				default_holder_t{ default_value },
+				default_reader_writer_t{},
+				std::move(validator) );
+}
+
+/*!
+ * @brief A special function that describes one member of an array
+ * representation.
+ *
+ * Allows to specify a default value if item is not present in an array
+ * on deserialization.
+ *
+ * Usage example:
+ * @code
+ * struct inner {
+ * 	int a;
+ * 	int b;
+ * 	int c;
+ * 	int d;
+ * };
+ *
+ * struct outer {
+ * 	inner x;
+ *
+ * 	template<typename Io> void json_io(Io & io) {
+ * 		io & json_dto::mandatory(
+ * 				json_dto::inside_array::reader_writer< json_dto::inside_array::at_least<2>(
+ * 					// Mandatory member.
+ * 					json_dto::inside_array::member(x.a),
+ * 					// Mandatory member.
+ * 					json_dto::inside_array::member(x.b, json_dto::min_max_constraint(-10, +10)),
+ * 					// Optional member. It will be initialized by 5 if it's absent during
+ * 					// deserialization.
+ * 					json_dto::inside_array::member_with_default_value(x.c, 5),
+ * 					// Optional member. It will be initialized by 6 if it's absent during
+ * 					// deserialization.
+ * 					json_dto::inside_array::member(x.d, 6, json_dto::one_of_constraint({2, 4, 6, 10, 20, 40})
+ * 				),
+ * 				"x", x )
+ * 			;
+ * 	}
+ * };
+ * @endcode
+ *
+ * @note
+ * This overload is used when the default value is represented as a
+ * rvalue-reference (that means that the default value is a temporary object).
+ * The value of this temporary object wlll be moved into the member if the
+ * member is missing during deserialization.
+ * For example:
+ * @code
+ * struct inner {
+ * 	int a;
+ * 	some_complex_type b;
+ * 	another_complex_type c;
+ * 	...
+ * };
+ *
+ * struct outer {
+ * 	inner x;
+ *
+ * 	template<typename Io> void json_io(Io & io) {
+ * 		io & json_dto::mandatory(
+ * 				json_dto::inside_array::reader_writer< json_dto::inside_array::at_least<2>(
+ * 					// Mandatory member.
+ * 					json_dto::inside_array::member(x.a),
+ * 					// Optional member. Value of this temporary object will be used if
+ * 					// inner::b is missing during deserialization.
+ * 					json_dto::inside_array::member_with_default_value(x.b, some_complex_type{...}),
+ * 					// Optional member. Value of this temporary object will be used if
+ * 					// inner::c is missing during deserialization.
+ * 					json_dto::inside_array::member(x.c, another_complex_type{...})
+ * 				),
+ * 				"x", x )
+ * 			;
+ * };
+ * @endcode
+ *
+ * @attention
+ * This function returns a temporary object that should not be stored anywhere and
+ * must be passed directly to json_dto::inside_array::reader_writer().
+ *
+ * @since v.0.3.3
+ */
+template<
+	typename Field_Type,
+	typename Validator = empty_validator_t >
+JSON_DTO_NODISCARD
+auto
+member_with_default_value(
+	Field_Type & field,
+	Field_Type && default_value,
+	Validator validator = Validator{} )
+{
+	using default_holder_t = details::default_value_rvalue_ref_holder_t<Field_Type>;
+
+	return details::member_with_default_value_processor_t<
+			Field_Type,
+			default_holder_t,
+			default_reader_writer_t,
+			Validator
+		>( field,
+				default_holder_t{ std::move(default_value) },
+				default_reader_writer_t{},
+				std::move(validator) );
+}
+
+/*!
+ * @brief A special function that describes one member of an array
+ * representation.
+ *
+ * Allows to specify a custom reader-writer for (de)serialization of the member.
+ *
+ * Usage example:
+ * @code
+ * struct my_special_int_reader_writer {...};
+ *
+ * struct inner {
+ * 	int a;
+ * 	int b;
+ * };
+ *
+ * struct outer {
+ * 	inner x;
+ *
+ * 	template<typename Io> void json_io(Io & io) {
+ * 		io & json_dto::mandatory(
+ * 				json_dto::inside_array::reader_writer< json_dto::inside_array::at_least<1> >(
+ * 					// Mandatory member.
+ * 					json_dto::inside_array::member(my_special_int_reader_writer{}, x.a),
+ * 					// Optional member. Will be initialized by int{} if it's absent
+ * 					// during deserialiaztion.
+ * 					json_dto::inside_array::member(
+ * 						my_special_int_reader_writer{},
+ * 						x.d,
+ * 						json_dto::one_of_constraint({2, 4, 6, 10, 20, 40})
+ * 				),
+ * 				"x", x )
+ * 			;
+ * 	}
+ * };
+ * @endcode
+ *
+ * @attention
+ * This function returns a temporary object that should not be stored anywhere and
+ * must be passed directly to json_dto::inside_array::reader_writer().
+ *
+ * @since v.0.3.3
+ */
+template<
+	typename Reader_Writer,
+	typename Field_Type,
+	typename Validator = empty_validator_t >
+JSON_DTO_NODISCARD
+auto
+member(
+	Reader_Writer && reader_writer,
+	Field_Type & field,
+	Validator validator = Validator{} )
+{
+	return details::simplest_member_processor_t<
+			Field_Type,
+			Reader_Writer,
+			Validator
+		>( field, std::forward<Reader_Writer>(reader_writer), std::move(validator) );
+}
+
+/*!
+ * @brief A special function that describes one member of an array
+ * representation.
+ *
+ * Allows to specify a custom reader-writer for (de)serialization of the member.
+ *
+ * Allows to specify a default value if item is not present in an array
+ * on deserialization.
+ *
+ * Usage example:
+ * @code
+ * struct my_special_int_reader_writer {...};
+ *
+ * struct inner {
+ * 	int a;
+ * 	int b;
+ * };
+ *
+ * struct outer {
+ * 	inner x;
+ *
+ * 	template<typename Io> void json_io(Io & io) {
+ * 		io & json_dto::mandatory(
+ * 				json_dto::inside_array::reader_writer< json_dto::inside_array::at_least<1>(
+ * 					// Mandatory member.
+ * 					json_dto::inside_array::member(my_special_int_reader_writer{}, x.a),
+ * 					// Optional member. It will be initialized by 5 if it's absent during
+ * 					// deserialization.
+ * 					json_dto::inside_array::member_with_default_value(
+ * 						my_special_int_reader_writer{},
+ * 						x.b, 5),
+ * 				),
+ * 				"x", x )
+ * 			;
+ * 	}
+ * };
+ * @endcode
+ *
+ * @note
+ * This overload is used when the default value is represented as ordinary
+ * const- or non-const reference. A copy of default value will be made if the member
+ * is missing during deserialization.
+ * For example:
+ * @code
+ * struct my_special_some_complex_type_reader_writer {...}
+ *
+ * struct inner {
+ * 	int a;
+ * 	some_complex_type b;
+ * 	...
+ *
+ * 	static const some_complex_type default_b;
+ * };
+ * const some_complex_type inner::default_b{...};
+ *
+ * struct outer {
+ * 	inner x;
+ *
+ * 	template<typename Io> void json_io(Io & io) {
+ * 		io & json_dto::mandatory(
+ * 				json_dto::inside_array::reader_writer< json_dto::inside_array::at_least<1>(
+ * 					// Mandatory member.
+ * 					json_dto::inside_array::member(x.a),
+ * 					// Optional member. A copy of inner::default_b will be made if
+ * 					// inner::b is missing during deserialization.
+ * 					json_dto::inside_array::member_with_default_value(
+ * 						my_special_some_complex_type_reader_writer{},
+ * 						x.b,
+ * 						inner::default_b),
+ * 				),
+ * 				"x", x )
+ * 			;
+ * };
+ * @endcode
+ *
+ * @attention
+ * This function returns a temporary object that should not be stored anywhere and
+ * must be passed directly to json_dto::inside_array::reader_writer().
+ *
+ * @since v.0.3.3
+ */
+template<
+	typename Reader_Writer,
+	typename Field_Type,
+	typename Validator = empty_validator_t >
+JSON_DTO_NODISCARD
+auto
+member_with_default_value(
+	Reader_Writer && reader_writer,
+	Field_Type & field,
+	const Field_Type & default_value,
+	Validator validator = Validator{} )
+{
+	using default_holder_t = details::default_value_const_ref_holder_t<Field_Type>;
+
+	return details::member_with_default_value_processor_t<
+			Field_Type,
+			default_holder_t,
+			Reader_Writer,
+			Validator
+		>( field,
+				default_holder_t{ default_value },
+				std::forward<Reader_Writer>(reader_writer),
+				std::move(validator) );
+}
+
+/*!
+ * @brief A special function that describes one member of an array
+ * representation.
+ *
+ * Allows to specify a custom reader-writer for (de)serialization of the member.
+ *
+ * Allows to specify a default value if item is not present in an array
+ * on deserialization.
+ *
+ * Usage example:
+ * @code
+ * struct my_special_int_reader_writer {...};
+ *
+ * struct inner {
+ * 	int a;
+ * 	int b;
+ * };
+ *
+ * struct outer {
+ * 	inner x;
+ *
+ * 	template<typename Io> void json_io(Io & io) {
+ * 		io & json_dto::mandatory(
+ * 				json_dto::inside_array::reader_writer< json_dto::inside_array::at_least<1>(
+ * 					// Mandatory member.
+ * 					json_dto::inside_array::member(my_special_int_reader_writer{}, x.a),
+ * 					// Optional member. It will be initialized by 5 if it's absent during
+ * 					// deserialization.
+ * 					json_dto::inside_array::member_with_default_value(
+ * 						my_special_int_reader_writer{},
+ * 						x.b, 5),
+ * 				),
+ * 				"x", x )
+ * 			;
+ * 	}
+ * };
+ * @endcode
+ *
+ * @note
+ * This overload is used when the default value is represented as a
+ * rvalue-reference (that means that the default value is a temporary object).
+ * The value of this temporary object wlll be moved into the member if the
+ * member is missing during deserialization.
+ * For example:
+ * @code
+ * struct my_special_some_complex_type_reader_writer {...}
+ *
+ * struct inner {
+ * 	int a;
+ * 	some_complex_type b;
+ * 	...
+ * };
+ *
+ * struct outer {
+ * 	inner x;
+ *
+ * 	template<typename Io> void json_io(Io & io) {
+ * 		io & json_dto::mandatory(
+ * 				json_dto::inside_array::reader_writer< json_dto::inside_array::at_least<1>(
+ * 					// Mandatory member.
+ * 					json_dto::inside_array::member(x.a),
+ * 					// Optional member. The value of a temporary object will be moved
+ * 					// into inner::b if inner::b is missing during deserialization.
+ * 					json_dto::inside_array::member_with_default_value(
+ * 						my_special_some_complex_type_reader_writer{},
+ * 						x.b,
+ * 						some_complex_type{...}),
+ * 				),
+ * 				"x", x )
+ * 			;
+ * };
+ * @endcode
+ *
+ * @attention
+ * This function returns a temporary object that should not be stored anywhere and
+ * must be passed directly to json_dto::inside_array::reader_writer().
+ *
+ * @since v.0.3.3
+ */
+template<
+	typename Reader_Writer,
+	typename Field_Type,
+	typename Validator = empty_validator_t >
+JSON_DTO_NODISCARD
+auto
+member_with_default_value(
+	Reader_Writer && reader_writer,
+	Field_Type & field,
+	Field_Type && default_value,
+	Validator validator = Validator{} )
+{
+	using default_holder_t = details::default_value_rvalue_ref_holder_t<Field_Type>;
+
+	return details::member_with_default_value_processor_t<
+			Field_Type,
+			default_holder_t,
+			Reader_Writer,
+			Validator
+		>( field,
+				default_holder_t{ std::move(default_value) },
+				std::forward<Reader_Writer>(reader_writer),
+				std::move(validator) );
+}
+
+} /* namespace inside_array */
+
+//
+// end of inside_array related stuff
+//
+
+//
+// binder_data_holder_t
+//
+/*!
+ * @brief Type of holder of data required for field binder.
+ *
+ * This type was introduced in v.0.2.12 as a part of the new customization
+ * points for binder_t class. In previous versions of json-dto binder_t hold
+ * all required data as direct members of binder_t template class. Since
+ * v.0.2.12 all that data is moved into binder_data_holder_t template and
+ * binder_t now just owns an instance of binder_data_holder_t. It allows a user
+ * to make a specialization of binder_data_holder_t template for his/her own
+ * data types.
+ *
+ * For example:
+ * @code
+namespace some_project
+{
+
+// A special proxy for field that can only be serialized, but not deserialized.
+template< typename F >
+struct serialize_only_proxy_t
+{
+	using field_type = const F;
+
+	const F * m_field;
+};
+
+// Usage example:
+//
+// template< typename Json_Io >
+// void my_type::json_io(Json_Io & io) {
+// 	io & json_dto::mandatory("attr", some_project::serialize_only(attr_))
+// 		& ...
+// 		;
+// }
+template< typename F >
+serialize_only_proxy_t<F> serialize_only( const F & field ) noexcept
+{
+	return { &field };
+}
+
+} // namespace some_project
+
+// We have to specialize json_dto::binder_data_holder_t to store
+// the content of some_project::serialize_only_proxy_t instead of
+// a reference to serialize_only_proxy_t.
+namespace json_dto
+{
+
+template<
+	typename Reader_Writer,
+	typename Field_Type,
+	typename Manopt_Policy,
+	typename Validator >
+class binder_data_holder_t<
+		Reader_Writer,
+		// NOTE the usage of `const serialize_only_proxy_t`.
+		const some_project::serialize_only_proxy_t<Field_Type>,
+		Manopt_Policy,
+		Validator >
+	:	public binder_data_holder_t<
+			Reader_Writer,
+			typename some_project::serialize_only_proxy_t<Field_Type>::field_type,
+			Manopt_Policy,
+			Validator >
+{
+	using serialize_only_proxy =
+			some_project::serialize_only_proxy_t<Field_Type>;
+
+	using actual_field_type = typename serialize_only_proxy::field_type;
+
+	using base_type = binder_data_holder_t<
+			Reader_Writer,
+			actual_field_type,
+			Manopt_Policy,
+			Validator >;
+
+public:
+	binder_data_holder_t(
+		Reader_Writer && reader_writer,
+		string_ref_t field_name,
+		const serialize_only_proxy & proxy,
+		Manopt_Policy && manopt_policy,
+		Validator && validator )
+		:	base_type{
+				std::move(reader_writer),
+				field_name,
+				// Passing an actual reference to the field.
+				*(proxy.m_field),
+				std::move(manopt_policy),
+				std::move(validator)
+			}
+	{} // The `proxy` parameter is no more needed and isn't used any more.
+};
+
+} // namespace json_dto
+
+struct my_data
+{
+	const int version_{1};
+	...
+	template<typename Json_Io>
+	void json_io(Json_Io & io)
+	{
+		io
+			// Now binder_t for `version_` field will contain
+			// a specialized version of binder_data_holder_t.
+			& json_dto::mandatory("version",
+					some_project::serialize_only(version_))
+			& ...
+			;
+	}
+};
+ * @endcode
+ *
+ * @attention
+ * A specialization of binder_data_holder_t should define type name
+ * `field_t` (see example in the code of binder_data_holder_t template).
+ *
+ * @note
+ * All getters are const-methods because binder_t access them via
+ * a const reference to binder_data_holder_t instance.
+ *
+ * @note
+ * Methods field_for_serialization() and field_for_deserialization()
+ * return just `Field_Type &` because the current versions of
+ * Manopt_Policy implementations (like mandatory_attr_t, optional_attr_t,
+ * and so on) accept `Field_Type &`. Some future versions of json-dto
+ * can get different return types for field_for_serialization() and
+ * field_for_deserialization().
+ *
+ * @tparam Reader_Writer type of reader_writer object to be used for
+ * serializing/deserializing the field.
+ *
+ * @tparam Field_Type type of the field to be (de)serialized.
+ *
+ * @tparam Manopt_Policy type of object for handling mandatory/optional
+ * policy for the field. It is expected to be mandatory_attr_t,
+ * optional_attr_t, optional_attr_null_t, or optional_nodefault_attr_t.
+ *
+ * @tparam Validator type of object for checking the validity of
+ * the field valued (check is performed before serialization and just
+ * after deserialization).
+ *
+ * @since v.0.2.12
+ */
+template<
+	typename Reader_Writer,
+	typename Field_Type,
+	typename Manopt_Policy,
+	typename Validator >
+class binder_data_holder_t
+{
+		Reader_Writer m_reader_writer;
+		field_name_t m_field_name;
+		Field_Type & m_field;
+		Manopt_Policy m_manopt_policy;
+
+		// NOTE: validators of lazy_t fields are wrapped. Since v.0.3.5.
+		using validator_t = details::field_validator<
+				std::remove_cv_t< Field_Type >, Validator >;
+
+		typename validator_t::type m_validator;
+
+	public:
+		using field_t = Field_Type;
+
+		binder_data_holder_t(
+			Reader_Writer && reader_writer,
+			field_name_t field_name,
+			Field_Type & field,
+			Manopt_Policy && manopt_policy,
+			Validator && validator )
+			:	m_reader_writer{ std::move(reader_writer) }
+			,	m_field_name{ field_name }
+			,	m_field{ field }
+			,	m_manopt_policy{ std::move( manopt_policy ) }
+			,	m_validator{ validator_t::make( std::move( validator ) ) }
+		{}
+
+		const Reader_Writer &
+		reader_writer() const noexcept { return m_reader_writer; }
+
+		const field_name_t &
+		field_name() const noexcept { return m_field_name; }
+
+		Field_Type &
+		field_for_serialization() const noexcept { return m_field; }
+
+		Field_Type &
+		field_for_deserialization() const noexcept { return m_field; }
+
+		const Manopt_Policy &
+		manopt_policy() const noexcept { return m_manopt_policy; }
+
+		const typename validator_t::type &
+		validator() const noexcept { return m_validator; }
+};
+
+//
+// binder_read_from_implementation_t
+//
+/*!
+ * @brief Type that provides the default implementation of read_from
+ * operation for a binder.
+ *
+ * This type was introduced in v.0.2.12 as a part of the new customization
+ * points for binder_t class. In previous versions of json-dto binder_t
+ * performed read_from operation by itself. Now it delegates this operation
+ * to static method of binder_read_from_implementation_t template.
+ * It allows a user to write own specialization of
+ * binder_read_from_implementation_t template for his/her types.
+ *
+ * For example:
+ * @code
+namespace some_project
+{
+
+template< typename F >
+struct ignore_after_deserialization_proxy_t
+{
+	using field_type = const F;
+
+	const F * m_field;
+};
+
+template< typename F >
+ignore_after_deserialization_proxy_t<F>
+ignore_after_deserialization( const F & field ) noexcept
+{
+	return { &field };
+}
+
+} // namespace some_project
+
+// We have to specialize json_dto::binder_data_holder_t to store
+// the content of some_project::ignore_after_deserialization_proxy_t instead of
+// a reference to ignore_after_deserialization_proxy_t.
+// We also have to specialize json_dto::binder_read_from_implementation_t
+// for right handling of some_project::ignore_after_deserialization_proxy_t.
+namespace json_dto
+{
+template<
+	typename Reader_Writer,
+	typename Field_Type,
+	typename Manopt_Policy,
+	typename Validator >
+class binder_data_holder_t<
+		Reader_Writer,
+		const some_project::ignore_after_deserialization_proxy_t<Field_Type>,
+		Manopt_Policy,
+		Validator >
+{
+	...
+};
+
+template<
+	typename Reader_Writer,
+	typename Field_Type,
+	typename Manopt_Policy,
+	typename Validator >
+struct binder_read_from_implementation_t<
+		binder_data_holder_t<
+			Reader_Writer,
+			const some_project::ignore_after_deserialization_proxy_t<Field_Type>,
+			Manopt_Policy,
+			Validator
+		>
+	>
+{
+	using proxy_type = some_project::ignore_after_deserialization_proxy_t<Field_Type>;
+
+	using data_holder_t = binder_data_holder_t<
+			Reader_Writer,
+			const proxy_type,
+			Manopt_Policy,
+			Validator >;
+
+	static void
+	read_from(
+		const data_holder_t & binder_data,
+		const rapidjson::Value & object )
+	{
+		if( !object.IsObject() )
+		{
+			throw ex_t{
+				"unable to extract field \"" +
+				std::string{ binder_data.field_name().s } + "\": "
+				"parent json type must be object" };
+		}
+
+		// Temporary object for holding deserialized value.
+		Field_Type tmp_object{};
+
+		const auto it = object.FindMember( binder_data.field_name() );
+
+		if( object.MemberEnd() != it )
+		{
+			const auto & value = it->value;
+
+			if( !value.IsNull() )
+			{
+				binder_data.reader_writer().read( tmp_object, value );
+			}
+			else
+			{
+				binder_data.manopt_policy.on_null( tmp_object );
+			}
+		}
+		else
+		{
+			binder_data.manopt_policy().on_field_not_defined( tmp_object );
+		}
+
+		binder_data.validator()( tmp_object ); // validate value.
+
+		// NOTE: the value from tmp_object will be lost.
+	}
+};
+
+} // namespace json_dto
+
+// Now we can use some_project::ignore_after_deserialization() in json_io().
+struct my_data
+{
+	const int version_{1};
+	...
+	template<typename Json_Io>
+	void json_io(Json_Io & io)
+	{
+		io
+			// Now binder_t for `version_` field will contain
+			// a specialized version of binder_data_holder_t.
+			& json_dto::mandatory("version",
+					some_project::ignore_after_deserialization(version_),
+					// NOTE: validators will be applied to deserialized value.
+					json_dto::min_max_constraint(1,3))
+			& ...
+			;
+	}
+};
+ * @endcode
+ *
+ * @since v.0.2.12
+ */
+template< typename Binder_Data_Holder >
+struct binder_read_from_implementation_t
+{
+	static void
+	read_from(
+		const Binder_Data_Holder & binder_data,
+		const rapidjson::Value & object )
+	{
+		if( !object.IsObject() )
+		{
+			report_error( error_code_t::type_mismatch,
+				"unable to extract field \"" +
+				std::string{ binder_data.field_name().s } + "\": "
+				"parent json type must be object" );
+			return;
+		}
+
+		const auto it = object.FindMember( binder_data.field_name() );
+
+		read_from_member(
+				binder_data,
+				object.MemberEnd() != it ? &it->value : nullptr );
+	}
+
+	/*!
+	 * @brief Read the field from a value of the corresponding member.
+	 *
+	 * @a value is nullptr if there is no such member.
+	 *
+	 * @note
+	 * This method is optional for specializations of
+	 * binder_read_from_implementation_t. It's used by SAX-based input and
+	 * by single-pass reading of object's members. If it's missing then
+	 * read_from() is called instead (for a temporary object with the
+	 * member in the case of SAX-based input). The presence of this method
+	 * also means that nested objects and arrays can be read into the field
+	 * directly from SAX events.
+	 *
+	 * @since v.0.3.5
+	 */
+	static void
+	read_from_member(
+		const Binder_Data_Holder & binder_data,
+		const rapidjson::Value * value )
+	{
+		static_assert(
+				!std::is_const<typename Binder_Data_Holder::field_t>::value,
+				"const object can't be deserialized" );
+
+		if( value )
+		{
+			if( !value->IsNull() )
+			{
+				details::read_owned(
+						binder_data.reader_writer(),
+						binder_data.field_for_deserialization(),
+						*value );
+			}
+			else
+			{
+				binder_data.manopt_policy().on_null(
+						binder_data.field_for_deserialization() );
+			}
+		}
+		else
+		{
+			binder_data.manopt_policy().on_field_not_defined(
+					binder_data.field_for_deserialization() );
+		}
+
+		// A value isn't validated if it isn't read inside try_from_json().
+		if( details::error_registered() )
+			return;
+
+		binder_data.validator()(
+				binder_data.field_for_deserialization() ); // validate value.
+	}
+};
+
+//
+// binder_write_to_implementation_t
+//
+/*!
+ * @brief Type that provides the default implementation of write_to
+ * operation for a binder.
+ *
+ * This type was introduced in v.0.2.12 as a part of the new customization
+ * points for binder_t class. In previous versions of json-dto binder_t
+ * performed write_to operation by itself. Now it delegates this operation
+ * to static method of binder_write_to_implementation_t template.
+ * It allows a user to write own specialization of
+ * binder_write_to_implementation_t template for his/her types.
+ *
+ * For example:
+ * @code
+namespace some_project
+{
+
+template< typename F >
+struct deserialize_only_proxy_t
+{
+	using field_type = F;
+
+	F * m_field;
+};
+
+template< typename F >
+deserialize_only_proxy_t<F> deserialize_only( F & field ) noexcept
+{
+	static_assert( !std::is_const<F>::value,
+			"deserialize_only can't be used with const objects" );
+
+	return { &field };
+}
+
+} // namespace some_project
+
+// We have to specialize json_dto::binder_data_holder_t to store
+// the content of some_project::deserialize_only_proxy_t instead of
+// a reference to deserialize_only_proxy_t.
+// We also have to specialize json_dto::binder_write_to_implementation_t
+// for right handling of some_project::deserialize_only_proxy_t.
+namespace json_dto
+{
+
+template<
+	typename Reader_Writer,
+	typename Field_Type,
+	typename Manopt_Policy,
+	typename Validator >
+class binder_data_holder_t<
+		Reader_Writer,
+		const some_project::deserialize_only_proxy_t<Field_Type>,
+		Manopt_Policy,
+		Validator >
+{
+	...
+};
+
+template<
+	typename Reader_Writer,
+	typename Field_Type,
+	typename Manopt_Policy,
+	typename Validator >
+struct binder_write_to_implementation_t<
+		binder_data_holder_t<
+			Reader_Writer,
+			const some_project::deserialize_only_proxy_t<Field_Type>,
+			Manopt_Policy,
+			Validator
+		>
+	>
+{
+	using data_holder_t = binder_data_holder_t<
+			Reader_Writer,
+			const some_project::deserialize_only_proxy_t<Field_Type>,
+			Manopt_Policy,
+			Validator >;
+
+	static void
+	write_to(
+		const data_holder_t &,
+		rapidjson::Value &,
+		rapidjson::MemoryPoolAllocator<> & )
+	{
+		// Nothing to do.
+	}
+
+};
+
+// Now we can use some_project::deserialize_only() in json_io().
+struct my_data
+{
+	int obsolete_priority_{1};
+	...
+	template<typename Json_Io>
+	void json_io(Json_Io & io)
+	{
+		io
+			// Now binder_t for `priority` field will contain
+			// a specialized version of binder_data_holder_t.
+			& json_dto::mandatory("priority",
+					some_project::deserialize_only(obsolete_priority_),
+					// NOTE: validators will be applied to deserialized value.
+					json_dto::min_max_constraint(1,9))
+			& ...
+			;
+	}
+};
+ * @endcode
+ *
+ * @since v.0.2.12
+ */
+template< typename Binder_Data_Holder >
+struct binder_write_to_implementation_t
+{
+	static void
+	write_to(
+		const Binder_Data_Holder & binder_data,
+		rapidjson::Value & object,
+		rapidjson::MemoryPoolAllocator<> & allocator )
+	{
+		binder_data.validator()(
+				binder_data.field_for_serialization() ); // validate value.
+
+		if( !binder_data.manopt_policy().is_default_value(
+				binder_data.field_for_serialization() ) )
+		{
+			rapidjson::Value value;
+
+			binder_data.reader_writer().write(
+					binder_data.field_for_serialization(),
+					value,
+					allocator );
+
+			object.AddMember(
+					binder_data.field_name(),
+					value,
+					allocator );
+		}
+	}
+
+	/*!
+	 * @brief Write the field directly into SAX writer.
+	 *
+	 * @note
+	 * This method is optional for specializations of
+	 * binder_write_to_implementation_t. If it's missing then
+	 * write_to() is used with a temporary rapidjson::Value.
+	 *
+	 * @since v.0.3.5
+	 */
+	template< typename Writer >
+	static void
+	write_to_sax(
+		const Binder_Data_Holder & binder_data,
+		Writer & writer )
+	{
+		binder_data.validator()(
+				binder_data.field_for_serialization() ); // validate value.
+
+		if( !binder_data.manopt_policy().is_default_value(
+				binder_data.field_for_serialization() ) )
+		{
+			details::sax_output::ensure_writer_accepted( writer.Key(
+					binder_data.field_name().s,
+					binder_data.field_name().length ) );
+
+			details::sax_output::write_value(
+					binder_data.reader_writer(),
+					binder_data.field_for_serialization(),
+					writer );
+		}
+	}
+};
+
+//
+// binder_t
+//
+
+//! JSON IO binder_t for a field.
+/*!
+ * @attention
+ * Since v.0.2.12, additional care should be taken when working with instances
+ * of binder_t. An instance of binder_t can hold a reference to a temporary
+ * object. For example, in such a case:
+ * @code
+ * struct demo {
+ * 	std::vector<int> keys() const { return { 1, 2, 3 }; }
+ * 	...
+ * 	// NOTE: this code is intended for serializing only!
+ * 	template< typename Json_Io >
+ * 	void json_io(Json_Io & io) {
+ * 		// NOTE: binder object returned by mandatory() function
+ * 		// will contain a reference to a temporary std::vector<int>.
+ * 		io & json_dto::mandatory("keys", keys());
+ * 		...
+ * 	}
+ * };
+ * @endcode
+ * So it's safe to pass binder_t object directly to `operator&`, but
+ * it can be unsafe to store binder_t object to be used later. Don't do
+ * that:
+ * @code
+ * struct demo {
+ * 	std::vector<int> keys() const { return { 1, 2, 3 }; }
+ * 	...
+ * 	// NOTE: this code is intended for serializing only!
+ * 	template< typename Json_Io >
+ * 	void json_io(Json_Io & io) {
+ * 		// NOTE: binder object returned by mandatory() function
+ * 		// will contain a reference to a temporary std::vector<int>.
+ * 		// This reference become invalid just after the completion
+ * 		// of line (1).
+ * 		//
+ * 		// DON'T USE binder_t THIS WAY!
+ * 		const auto keys_binder = json_dto::mandatory("keys", keys()); // (1)
+ * 		...
+ * 		io & keys_binder; // An invalid reference will be used here!!!
+ * 		...
+ * 	}
+ * };
+ * @endcode
+ *
+ * @note
+ * This template was extended in v.0.2.10 by a new template parameter
+ * Reader_Writer. This parameter specifies a type of object with
+ * two const methods `read` and `write`. Since v.0.2.10 those methods
+ * are used for reading and writting a value of Field_Type from/to
+ * rapidjson::Value. See default_reader_writer_t for an example
+ * of Reader_Writer.
+ */
+template<
+		typename Reader_Writer,
+		typename Field_Type,
+		typename Manopt_Policy,
+		typename Validator >
+class binder_t
+{
+		using data_holder_t = binder_data_holder_t<
+				Reader_Writer,
+				Field_Type,
+				Manopt_Policy,
+				Validator >;
+
+		using read_from_impl_t = binder_read_from_implementation_t<
+				data_holder_t >;
+
+		using write_to_impl_t = binder_write_to_implementation_t<
+				data_holder_t >;
+
+	public:
+		binder_t(
+			Reader_Writer && reader_writer,
+			field_name_t field_name,
+			Field_Type & field,
+			Manopt_Policy && manopt_policy,
+			Validator && validator )
+			:	m_data_holder{
+					std::move(reader_writer),
+					field_name,
+					field,
+					std::move( manopt_policy ),
+					std::move( validator )
+				}
+		{}
+
+		//! Run read operation for value.
+		void
+		read_from( const rapidjson::Value & object ) const
+		{
+			handle_errors( false, [&] {
+					instrument( false, &object, nullptr, nullptr, [&] {
+							read_from_impl_t::read_from( m_data_holder, object );
+						} );
+				} );
+		}
+
+		//! Run read operation via a dispatcher.
+		/*!
+		 * The binder is passed to @a dispatcher which decides how
+		 * the field has to be read. It's used by SAX-based input and
+		 * by single-pass reading of object's members.
+		 *
+		 * @since v.0.3.5
+		 */
+		template< typename Dispatcher >
+		void
+		read_from_dispatcher( Dispatcher & dispatcher ) const
+		{
+			handle_errors( false, [&] {
+					dispatcher.template read_field< read_from_impl_t >(
+							m_data_holder );
+				} );
+		}
+
+		//! Run read operation via single-pass reading of object's members.
+		/*!
+		 * @since v.0.3.5
+		 */
+		void
+		read_from_dispatcher( details::member_index::lookup_t & lookup ) const
+		{
+			handle_errors( false, [&] {
+					instrument( false, &lookup.object(), nullptr, nullptr, [&] {
+							lookup.read_field< read_from_impl_t >( m_data_holder );
+						} );
+				} );
+		}
+
+		//! Run write operation via a dispatcher.
+		/*!
+		 * The binder is passed to @a dispatcher which decides how
+		 * the field has to be written. It's used by delta serialization.
+		 *
+		 * @since v.0.3.5
+		 */
+		template< typename Dispatcher >
+		void
+		write_to_dispatcher( Dispatcher & dispatcher ) const
+		{
+			handle_errors( true, [&] {
+					dispatcher.template write_field< write_to_impl_t >(
+							m_data_holder );
+				} );
+		}
+
+		//! Run write operation on object.
+		void
+		write_to(
+			rapidjson::Value & object,
+			rapidjson::MemoryPoolAllocator<> & allocator ) const
+		{
+			handle_errors( true, [&] {
+					instrument( true, nullptr, &object, nullptr, [&] {
+							write_to_impl_t::write_to(
+									m_data_holder,
+									object,
+									allocator );
+						} );
+				} );
+		}
+
+		//! Run write operation on SAX writer.
+		/*!
+		 * @since v.0.3.5
+		 */
+		template< typename Writer >
+		void
+		write_to_sax( Writer & writer ) const
+		{
+			using has_sax_impl_t = std::integral_constant< bool,
+					details::sax_output::has_static_write_to_sax<
+							write_to_impl_t, data_holder_t, Writer >::value >;
+
+			handle_errors( true, [&] {
+					instrument(
+							true,
+							nullptr,
+							nullptr,
+							details::sax_output::text_position_of( writer ),
+							[&] {
+								write_to_sax_impl( writer, has_sax_impl_t{} );
+							} );
+				} );
+		}
+
+	private:
+		data_holder_t m_data_holder;
+
+		// Adds the name of the field to an error.
+		//
+		// Since v.0.3.5.
+		template< typename Action >
+		void
+		handle_errors( bool on_writing, Action && action ) const
+		{
+			details::with_error_path(
+					action,
+					[&]( error_info_t & error ) {
+						error.add_field( m_data_holder.field_name(), on_writing );
+					} );
+		}
+
+		// Passes the field to the instrumentation policy.
+		//
+		// Since v.0.3.5.
+		template< typename Action >
+		void
+		instrument(
+			bool on_writing,
+			const rapidjson::Value * source,
+			const rapidjson::Value * target,
+			const instrumentation::text_position_t * position,
+			Action && action ) const
+		{
+			instrumentation_policy_t::on_field(
+					instrumentation::field_context_t{
+						m_data_holder.field_name(),
+						on_writing,
+						source,
+						target,
+						position,
+						0u },
+					std::forward< Action >( action ) );
+		}
+
+		template< typename Writer >
+		void
+		write_to_sax_impl( Writer & writer, std::true_type ) const
+		{
+			write_to_impl_t::write_to_sax( m_data_holder, writer );
+		}
+
+		// A specialization of binder_write_to_implementation_t without
+		// write_to_sax is used. The field is written into a temporary
+		// object and the content of that object is passed to the writer.
+		template< typename Writer >
+		void
+		write_to_sax_impl( Writer & writer, std::false_type ) const
+		{
+			details::sax_output::fallback_allocator_t allocator;
+			rapidjson::Value object{ rapidjson::kObjectType };
+
+			write_to_impl_t::write_to( m_data_holder, object, allocator.get() );
+
+			details::sax_output::write_object_members( object, writer );
+		}
+};
+
+//
+// mandatory
+//
+
+//! Create bind for a mandatory JSON field with validator.
+template<
+		typename Field_Type,
+		typename Validator = empty_validator_t >
+auto
+mandatory(
+	field_name_t field_name,
+	Field_Type && field,
+	Validator validator = Validator{} )
+{
+	using binder_type_t = binder_t<
+			default_reader_writer_t,
+			// NOTE: since v.0.2.12 this way of detection of Field_Type
+			// for binder_t must be used.
+			details::meta::field_type_from_reference_t< decltype(field) >,
+			mandatory_attr_t,
+			Validator >;
+
+	return binder_type_t{
+			default_reader_writer_t{},
+			field_name,
+			field,
+			mandatory_attr_t{},
+			std::move( validator ) };
+}
+
+//! Create bind for a mandatory JSON field with validator.
+template<
+		typename Reader_Writer,
+		typename Field_Type,
+		typename Validator = empty_validator_t >
+auto
+mandatory(
+	Reader_Writer reader_writer,
+	field_name_t field_name,
+	Field_Type && field,
+	Validator validator = Validator{} )
+{
+	using binder_type_t = binder_t<
+			Reader_Writer,
+			// NOTE: since v.0.2.12 this way of detection of Field_Type
+			// for binder_t must be used.
+			details::meta::field_type_from_reference_t< decltype(field) >,
+			mandatory_attr_t,
+			Validator >;
+
+	return binder_type_t{
+			std::move(reader_writer),
+			field_name,
+			field,
+			mandatory_attr_t{},
+			std::move( validator ) };
+}
+
+//! Create bind for a mandatory JSON field with validator.
+/*!
+ * This binder has to be used in case when 'null' is allowed
+ * for mandatory attr and should be treated as default field value.
+ *
+ * For example:
+ * @code
+ * struct my_header_reader_writer
+ * {
+ * 	void read( std::string & v, ... ) const { ... }
+ * 	void write( const std::string & v, ... ) const { ... }
+ * };
+ *
+ * struct my_data
+ * {
+ * 	std::vector< std::string > headers_;
+ * 	...
+ * 	template< typename Json_Io >
+ * 	void json_io( Json_Io & io )
+ * 	{
+ * 		// headers_ receives std::vector<std::string>{} in case of 'null'.
+ * 		io & json_dto::mandatory_with_null_as_default(
+ * 				// Use a custom reader-writer for that field.
+ * 				json_dto::apply_to_content_t< my_header_reader_writer >{},
+ * 				"headers", headers_ )
+ * 			...
+ * 			;
+ * 	}
+ * };
+ * @endcode
+ *
+ * @note
+ * Type \a Field_Type has to be DefaultConstructible.
+ *
+ * @since v.0.3.0
+ */
+template<
+		typename Reader_Writer,
+		typename Field_Type,
+		typename Validator = json_dto::empty_validator_t >
+auto
+mandatory_with_null_as_default(
+	Reader_Writer reader_writer,
+	json_dto::field_name_t field_name,
+	Field_Type && field,
+	Validator validator = Validator{} )
+{
+	using binder_type_t = json_dto::binder_t<
+			Reader_Writer,
+			// NOTE: since v.0.2.12 this way of detection of Field_Type
+			// for binder_t must be used.
+			details::meta::field_type_from_reference_t< decltype(field) >,
+			mandatory_attr_with_null_as_default_t,
+			Validator >;
+
+	return binder_type_t{
+			std::move(reader_writer),
+			field_name,
+			field,
+			mandatory_attr_with_null_as_default_t{},
+			std::move( validator ) };
+}
+
+//! Create bind for a mandatory JSON field with validator.
+/*!
+ * This binder has to be used in case when 'null' is allowed
+ * for mandatory attr and should be treated as default field value.
+ *
+ * For example:
+ * @code
+ * struct my_data 
+ * {
+ * 	std::vector< std::string > headers_;
+ * 	...
+ * 	template< typename Json_Io >
+ * 	void json_io( Json_Io & io )
+ * 	{
+ * 		// headers_ receives std::vector<std::string>{} in case of 'null'.
+ * 		io & json_dto::mandatory_with_null_as_default(
+ * 				"headers", headers_ )
+ * 			...
+ * 			;
+ * 	}
+ * };
+ * @endcode
+ *
+ * @note
+ * Type \a Field_Type has to be DefaultConstructible.
+ *
+ * @since v.0.3.0
+ */
+template<
+		typename Field_Type,
+		typename Validator = json_dto::empty_validator_t >
+auto
+mandatory_with_null_as_default(
+	json_dto::field_name_t field_name,
+	Field_Type && field,
+	Validator validator = Validator{} )
+{
+	return mandatory_with_null_as_default(
+			default_reader_writer_t{},
+			field_name,
+			std::forward<Field_Type>(field),
+			std::move(validator) );
+}
+
+//
+// optional
+//
+
+//! Create bind for an optional JSON field with default value and validator.
+template<
+		typename Field_Type,
+		typename Field_Default_Value_Type,
+		typename Validator = empty_validator_t >
+auto
+optional(
+	field_name_t field_name,
+	Field_Type && field,
+	Field_Default_Value_Type default_value,
+	Validator validator = Validator{} )
+{
+	using opt_attr_t = optional_attr_t< Field_Default_Value_Type >;
+	using binder_type_t = binder_t<
+			default_reader_writer_t,
+			// NOTE: since v.0.2.12 this way of detection of Field_Type
+			// for binder_t must be used.
+			details::meta::field_type_from_reference_t< decltype(field) >,
+			opt_attr_t,
+			Validator >;
+
+	return binder_type_t{
+			default_reader_writer_t{},
+			field_name,
+			field,
+			opt_attr_t{ std::move( default_value ) },
+			std::move( validator ) };
+}
+
+//! Create bind for an optional JSON field with default value and validator.
+template<
+		typename Reader_Writer,
+		typename Field_Type,
+		typename Field_Default_Value_Type,
+		typename Validator = empty_validator_t >
+auto
+optional(
+	Reader_Writer reader_writer,
+	field_name_t field_name,
+	Field_Type && field,
+	Field_Default_Value_Type default_value,
+	Validator validator = Validator{} )
+{
+	using opt_attr_t = optional_attr_t< Field_Default_Value_Type >;
+	using binder_type_t = binder_t<
+			Reader_Writer,
+			// NOTE: since v.0.2.12 this way of detection of Field_Type
+			// for binder_t must be used.
+			details::meta::field_type_from_reference_t< decltype(field) >,
+			opt_attr_t,
+			Validator >;
+
+	return binder_type_t{
+			std::move(reader_writer),
+			field_name,
+			field,
+			opt_attr_t{ std::move( default_value ) },
+			std::move( validator ) };
+}
+
+//
+// optional_null
+//
+
+//! Create bind for an optional JSON field with null default value .
+template<
+		typename Field_Type,
+		typename Validator = empty_validator_t >
+auto
+optional_null(
+	field_name_t field_name,
+	Field_Type && field,
+	Validator validator = Validator{} )
+{
+	using binder_type_t = binder_t<
+			default_reader_writer_t,
+			// NOTE: since v.0.2.12 this way of detection of Field_Type
+			// for binder_t must be used.
+			details::meta::field_type_from_reference_t< decltype(field) >,
+			optional_attr_null_t,
+			Validator >;
+
+	return binder_type_t{
+			default_reader_writer_t{},
+			field_name,
+			field,
+			optional_attr_null_t{},
+			std::move( validator ) };
+}
+
+//! Create bind for an optional JSON field with null default value .
+template<
+		typename Reader_Writer,
+		typename Field_Type,
+		typename Validator = empty_validator_t >
+auto
+optional_null(
+	Reader_Writer reader_writer,
+	field_name_t field_name,
+	Field_Type && field,
+	Validator validator = Validator{} )
+{
+	using binder_type_t = binder_t<
+			Reader_Writer,
+			// NOTE: since v.0.2.12 this way of detection of Field_Type
+			// for binder_t must be used.
+			details::meta::field_type_from_reference_t< decltype(field) >,
+			optional_attr_null_t,
+			Validator >;
+
+	return binder_type_t{
+			std::move(reader_writer),
+			field_name,
+			field,
+			optional_attr_null_t{},
+			std::move( validator ) };
+}
+
+//
+// optional
+//
+
+//! Create bind for an optional JSON field with null default value.
+template<
+		typename Field_Type,
+		typename Validator = empty_validator_t >
+auto
+optional(
+	field_name_t field_name,
+	Field_Type & field,
+	std::nullptr_t,
+	Validator validator = Validator{} )
+{
+	return optional_null( field_name, field, std::move( validator ) );
+}
+
+//! Create bind for an optional JSON field with null default value.
+template<
+		typename Reader_Writer,
+		typename Field_Type,
+		typename Validator = empty_validator_t >
+auto
+optional(
+	Reader_Writer reader_writer,
+	field_name_t field_name,
+	Field_Type & field,
+	std::nullptr_t,
+	Validator validator = Validator{} )
+{
+	return optional_null(
+			std::move(reader_writer),
+			field_name,
+			field,
+			std::move( validator ) );
+}
+
+//
+// optional_no_default
+//
+
+//! Create bind for an optional JSON field without default value.
+template<
+		typename Field_Type,
+		typename Validator = empty_validator_t >
+auto
+optional_no_default(
+	field_name_t field_name,
+	Field_Type && field,
+	Validator validator = Validator{} )
+{
+	using binder_type_t = binder_t<
+			default_reader_writer_t,
+			// NOTE: since v.0.2.12 this way of detection of Field_Type
+			// for binder_t must be used.
+			details::meta::field_type_from_reference_t< decltype(field) >,
+			optional_nodefault_attr_t,
+			Validator >;
+
+	return binder_type_t{
+			default_reader_writer_t{},
+			field_name,
+			field,
+			optional_nodefault_attr_t{},
+			std::move( validator ) };
+}
+
+//! Create bind for an optional JSON field without default value.
+template<
+		typename Reader_Writer,
+		typename Field_Type,
+		typename Validator = empty_validator_t >
+auto
+optional_no_default(
+	Reader_Writer reader_writer,
+	field_name_t field_name,
+	Field_Type && field,
+	Validator validator = Validator{} )
+{
+	using binder_type_t = binder_t<
+			Reader_Writer,
+			// NOTE: since v.0.2.12 this way of detection of Field_Type
+			// for binder_t must be used.
+			details::meta::field_type_from_reference_t< decltype(field) >,
+			optional_nodefault_attr_t,
+			Validator >;
+
+	return binder_type_t{
+			std::move(reader_writer),
+			field_name,
+			field,
+			optional_nodefault_attr_t{},
+			std::move( validator ) };
+}
+
+template< typename Dto >
+json_input_t &
+operator >> ( json_input_t & i, Dto & v )
+{
+	details::member_index::read_dto( i.object(), v );
+	return i;
+}
+
+template< typename Dto >
+inline json_output_t &
+operator << ( json_output_t & o, const Dto & v )
+{
+	details::with_dto_instrumentation< Dto >( [&] {
+			json_io( o, const_cast< Dto & >( v ) );
+		} );
+	return o;
+}
+
+namespace details
+{
+
+/*!
+ * @brief RapidJSON's output stream that appends to std::string.
+ *
+ * @since v.0.3.5
+ */
+class string_output_stream_t
+{
+public:
+	using Ch = char;
+
+	explicit string_output_stream_t( std::string & to ) noexcept
+		:	m_to( to )
+	{}
+
+	void
+	Put( char ch ) { m_to.push_back( ch ); }
+
+	void
+	Flush() noexcept {}
+
+	//! Make space for @a count chars without reallocations for every one.
+	void
+	reserve( std::size_t count )
+	{
+		const auto required = m_to.size() + count;
+		if( m_to.capacity() < required )
+			m_to.reserve( std::max( required, m_to.capacity() * 2u ) );
+	}
+
+private:
+	std::string & m_to;
+};
+
+// RapidJSON's writers find these functions via ADL.
+inline void
+PutReserve( string_output_stream_t & stream, std::size_t count )
+{
+	stream.reserve( count );
+}
+
+inline void
+PutUnsafe( string_output_stream_t & stream, char ch )
+{
+	stream.Put( ch );
+}
+
+//! Fill @a document with the representation of @a dto.
+template< typename Dto >
+void
+write_to_document( rapidjson::Document & document, const Dto & dto )
+{
+	json_output_t jout{ document, document.GetAllocator() };
+
+	jout << dto;
+}
+
+//! Fill @a document with the representation of @a dto made by
+//! a custom Reader_Writer.
+template< typename Reader_Writer, typename Dto >
+void
+write_to_document(
+	rapidjson::Document & document,
+	const Reader_Writer & reader_writer,
+	const Dto & dto )
+{
+	reader_writer.write( dto, document, document.GetAllocator() );
+}
+
+//! Write @a document into an output stream.
+/*!
+ * The writer's stack is placed into @a stack_allocator if it's specified.
+ */
+template<
+	typename Stack_Allocator = rapidjson::CrtAllocator,
+	typename Output_Stream >
+void
+write_document(
+	const rapidjson::Value & document,
+	Output_Stream & to,
+	Stack_Allocator * stack_allocator = nullptr )
+{
+	rapidjson::Writer<
+			Output_Stream,
+			rapidjson::UTF8<>,
+			rapidjson::UTF8<>,
+			Stack_Allocator > writer( to, stack_allocator );
+	const bool result = document.Accept( writer );
+	if( !result )
+		report_error( error_code_t::write_failed,
+				"to_json: output_doc.Accept(writer) returns false" );
+}
+
+} /* namespace details */
+
+//
+// to_json
+//
+
+struct pretty_writer_params_t;
+
+/*!
+ * @brief Helper function for serialization of an object into
+ * a RapidJSON's output stream.
+ *
+ * The representation of @a dto is appended to the current content
+ * of @a to. It allows to use caller-owned buffers and to avoid copying
+ * of the result.
+ *
+ * Usage example:
+ * @code
+ * rapidjson::StringBuffer buffer;
+ * json_dto::to_json_into( buffer, my_dto );
+ * send( buffer.GetString(), buffer.GetSize() );
+ * @endcode
+ *
+ * @tparam Output_Stream type of output stream. It's expected to be
+ * rapidjson::StringBuffer or a type that satisfies RapidJSON's
+ * requirements for output streams.
+ *
+ * @since v.0.3.5
+ */
+template< typename Output_Stream, typename Dto >
+void
+to_json_into(
+	//! Target stream.
+	Output_Stream & to,
+	//! Object to be serialized.
+	const Dto & dto )
+{
+	rapidjson::Document output_doc;
+	details::write_to_document( output_doc, dto );
+
+	details::write_document( output_doc, to );
+}
+
+/*!
+ * @brief Helper function for serialization of an object into
+ * a RapidJSON's output stream with a custom Reader-Writer.
+ *
+ * @since v.0.3.5
+ */
+template< typename Reader_Writer, typename Output_Stream, typename Dto >
+// Prevents ambiguity with the version for pretty_writer.
+std::enable_if_t< !std::is_same< Dto, pretty_writer_params_t >::value >
+to_json_into(
+	//! Custom Reader_Writer to be used.
+	const Reader_Writer & reader_writer,
+	//! Target stream.
+	Output_Stream & to,
+	//! Object to be serialized.
+	const Dto & dto )
+{
+	rapidjson::Document output_doc;
+	details::write_to_document( output_doc, reader_writer, dto );
+
+	details::write_document( output_doc, to );
+}
+
+/*!
+ * @brief Helper function for serialization of an object with appending
+ * the result to a string.
+ *
+ * The capacity of @a to is reused, so serialization into the same
+ * string requires no allocations for the result after the first one.
+ *
+ * Usage example:
+ * @code
+ * std::string response = "HTTP/1.1 200 OK\r\n...\r\n\r\n";
+ * json_dto::to_json_append( response, my_dto );
+ * @endcode
+ *
+ * @since v.0.3.5
+ */
+template< typename Dto >
+void
+to_json_append(
+	//! Target string.
+	std::string & to,
+	//! Object to be serialized.
+	const Dto & dto )
+{
+	details::string_output_stream_t stream{ to };
+	to_json_into( stream, dto );
+}
+
+/*!
+ * @brief Helper function for serialization of an object with appending
+ * the result to a string with a custom Reader-Writer.
+ *
+ * @since v.0.3.5
+ */
+template< typename Reader_Writer, typename Dto >
+void
+to_json_append(
+	//! Custom Reader_Writer to be used.
+	const Reader_Writer & reader_writer,
+	//! Target string.
+	std::string & to,
+	//! Object to be serialized.
+	const Dto & dto )
+{
+	details::string_output_stream_t stream{ to };
+	to_json_into( reader_writer, stream, dto );
+}
+
+/*!
+ * @brief Helper function for serialization of an object to string.
+ */
+template< typename Dto >
+JSON_DTO_NODISCARD
+std::string
+to_json(
+	//! Object to be serialized.
+	const Dto & dto )
+{
+	std::string result;
+	to_json_append( result, dto );
+
+	return result;
+}
+
+/*!
+ * @brief Helper function for serialization of an object to string
+ * with a custom reader-writer.
+ *
+ * Usage example:
+ * @code
+ * class some_data {
+ * public:
+ * 	...
+ * 	template<typename Io> void json_io(Io & io) {...}
+ * };
+ * struct some_data_reader_writer {
+ * 	void read( some_data & obj, const rapidjson::Value & from ) const {...}
+ *
+ * 	void write( const some_data & obj, rapidjson::Value & to, rapidjson::MemoryPoolAllocator<> & allocator ) const {...}
+ * };
+ * ...
+ * some_data data_to_pack{...};
+ * auto json_string = json_dto::to_json(some_data_reader_writer{}, data_to_pack);
+ * @endcode
+ *
+ * @since v.0.3.4
+ */
+template< typename Reader_Writer, typename Dto >
+JSON_DTO_NODISCARD
+std::string
+to_json(
+	//! Custom Reader_Writer to be used.
+	const Reader_Writer & reader_writer,
+	//! Object to be serialized.
+	const Dto & dto )
+{
+	std::string result;
+	to_json_append( reader_writer, result, dto );
+
+	return result;
+}
+
+//
+// to_json with PrettyWriter
+//
+
+struct pretty_writer_params_t
+{
+	char m_indent_char{ ' ' };
+	unsigned m_indent_char_count{ 4u };
+	rapidjson::PrettyFormatOptions m_format_options{ rapidjson::kFormatDefault };
+
+	//
+	// Setters
+	//
+	pretty_writer_params_t &
+	indent_char( char ch ) &
+	{
+		m_indent_char = ch;
+		return *this;
+	}
+
+	pretty_writer_params_t &&
+	indent_char( char ch ) &&
+	{
+		return std::move(this->indent_char(ch));
+	}
+	
+	pretty_writer_params_t &
+	indent_char_count( unsigned count ) &
+	{
+		if( !count ) count = 1u;
+
+		m_indent_char_count = count;
+		return *this;
+	}
+
+	pretty_writer_params_t &&
+	indent_char_count( unsigned count ) &&
+	{
+		return std::move(this->indent_char_count(count));
+	}
+
+	pretty_writer_params_t &
+	format_options( rapidjson::PrettyFormatOptions opt ) &
+	{
+		m_format_options = opt;
+		return *this;
+	}
+
+	pretty_writer_params_t &&
+	format_options( rapidjson::PrettyFormatOptions opt ) &&
+	{
+		return std::move(this->format_options(opt));
+	}
+};
+
+namespace details
+{
+
+//! Write @a document into an output stream by using pretty_writer.
+/*!
+ * The writer's stack is placed into @a stack_allocator if it's specified.
+ */
+template<
+	typename Stack_Allocator = rapidjson::CrtAllocator,
+	typename Output_Stream >
+void
+write_document(
+	const rapidjson::Value & document,
+	Output_Stream & to,
+	const pretty_writer_params_t & writer_params,
+	Stack_Allocator * stack_allocator = nullptr )
+{
+	rapidjson::PrettyWriter<
+			Output_Stream,
+			rapidjson::UTF8<>,
+			rapidjson::UTF8<>,
+			Stack_Allocator > writer( to, stack_allocator );
+	writer.SetIndent(
+			writer_params.m_indent_char,
+			writer_params.m_indent_char_count );
+	writer.SetFormatOptions(
+			writer_params.m_format_options );
+
+	const bool result = document.Accept( writer );
+	if( !result )
+		report_error( error_code_t::write_failed,
+				"to_json: output_doc.Accept(writer) returns false" );
+}
+
+} /* namespace details */
+
+/*!
+ * @brief Helper function for serialization of an object into
+ * a RapidJSON's output stream by using pretty_writer.
+ *
+ * @since v.0.3.5
+ */
+template< typename Output_Stream, typename Dto >
+void
+to_json_into(
+	//! Target stream.
+	Output_Stream & to,
+	//! Object to be serialized.
+	const Dto & dto,
+	//! Parameters for pretty_writer.
+	pretty_writer_params_t writer_params )
+{
+	rapidjson::Document output_doc;
+	details::write_to_document( output_doc, dto );
+
+	details::write_document( output_doc, to, writer_params );
+}
+
+/*!
+ * @brief Helper function for serialization of an object into
+ * a RapidJSON's output stream by using pretty_writer and
+ * a custom Reader-Writer.
+ *
+ * @since v.0.3.5
+ */
+template< typename Reader_Writer, typename Output_Stream, typename Dto >
+void
+to_json_into(
+	//! Custom Reader_Writer to be used.
+	const Reader_Writer & reader_writer,
+	//! Target stream.
+	Output_Stream & to,
+	//! Object to be serialized.
+	const Dto & dto,
+	//! Parameters for pretty_writer.
+	pretty_writer_params_t writer_params )
+{
+	rapidjson::Document output_doc;
+	details::write_to_document( output_doc, reader_writer, dto );
+
+	details::write_document( output_doc, to, writer_params );
+}
+
+/*!
+ * @brief Helper function for serialization of an object with appending
+ * the result to a string by using pretty_writer.
+ *
+ * @since v.0.3.5
+ */
+template< typename Dto >
+void
+to_json_append(
+	//! Target string.
+	std::string & to,
+	//! Object to be serialized.
+	const Dto & dto,
+	//! Parameters for pretty_writer.
+	pretty_writer_params_t writer_params )
+{
+	details::string_output_stream_t stream{ to };
+	to_json_into( stream, dto, writer_params );
+}
+
+/*!
+ * @brief Helper function for serialization of an object with appending
+ * the result to a string by using pretty_writer and a custom
+ * Reader-Writer.
+ *
+ * @since v.0.3.5
+ */
+template< typename Reader_Writer, typename Dto >
+void
+to_json_append(
+	//! Custom Reader_Writer to be used.
+	const Reader_Writer & reader_writer,
+	//! Target string.
+	std::string & to,
+	//! Object to be serialized.
+	const Dto & dto,
+	//! Parameters for pretty_writer.
+	pretty_writer_params_t writer_params )
+{
+	details::string_output_stream_t stream{ to };
+	to_json_into( reader_writer, stream, dto, writer_params );
+}
+
+/*!
+ * @brief Helper function for serialization of an object to string
+ * by using pretty_writer.
+ */
+template< typename Dto >
+std::string
+to_json(
+	//! Object to be serialized.
+	const Dto & dto,
+	//! Parameters for pretty_writer.
+	pretty_writer_params_t writer_params )
+{
+	std::string result;
+	to_json_append( result, dto, writer_params );
+
+	return result;
+}
+
+/*!
+ * @brief Helper function for serialization of an object to string
+ * by using pretty_writer and a custom Reader-Writer.
+ *
+ * Usage example:
+ * @code
+ * class some_data {
+ * public:
+ * 	...
+ * 	template<typename Io> void json_io(Io & io) {...}
+ * };
+ * struct some_data_reader_writer {
+ * 	void read( some_data & obj, const rapidjson::Value & from ) const {...}
+ *
+ * 	void write( const some_data & obj, rapidjson::Value & to, rapidjson::MemoryPoolAllocator<> & allocator ) const {...}
+ * };
+ * ...
+ * some_data data_to_pack{...};
+ * auto json_string = json_dto::to_json( some_data_reader_writer{}, data_to_pack,
+ * 	json_dto::pretty_writer_params_t{}.indent_char(' ').indent_char_count(3) );
+ * @endcode
+ *
+ * @since v.0.3.4
+ */
+template< typename Reader_Writer, typename Dto >
+std::string
+to_json(
+	//! Custom Reader_Writer to be used.
+	const Reader_Writer & reader_writer,
+	//! Object to be serialized.
+	const Dto & dto,
+	//! Parameters for pretty_writer.
+	pretty_writer_params_t writer_params )
+{
+	std::string result;
+	to_json_append( reader_writer, result, dto, writer_params );
+
+	return result;
+}
+
+//! Helper function for checking the result of parsing.
+/*!
+ * @throw ex_t if @a result contains an error.
+ *
+ * @since v.0.3.5
+ */
+inline void
+check_parse_result(
+	const rapidjson::ParseResult & result )
+{
+	if( result.IsError() )
+	{
+		error_info_t error{ error_code_t::parse_error,
+			std::string{ "JSON parse error: '" } +
+			rapidjson::GetParseError_En( result.Code() ) +
+			"' (offset: " + std::to_string( result.Offset() ) + ")" };
+		error.set_offset( result.Offset() );
+
+		report_error( std::move(error) );
+	}
+}
+
+//FIXME: document this!
+inline void
+check_document_parse_status(
+	const rapidjson::Document & document )
+{
+	check_parse_result( rapidjson::ParseResult{
+			document.GetParseError(), document.GetErrorOffset() } );
+}
+
+//
+// NOTE: there are a lot of overloads for from_json functions.
+// It's because we have to distinguish three different cases:
+//
+// - const char *;
+// - string_ref_t;
+// - std::string.
+//
+// Unfortunately, we can't limit himself to just one overload with
+// string_ref_t, because RapidJSON's GenericStringRef has no constructor
+// that accepts std::string. So we have to have overloads for string_ref_t
+// and for std::string. But it's not enough because if const char* is
+// passed to from_json, then compiler can't decide which overload to
+// select (string_ref_t and std::string can be implicitly constructed
+// from const char *).
+//
+
+//
+// from_json
+//
+
+//! Helper function to read DTO from already parsed document.
+//!
+//! @note
+//! Type @a Type is required to be DefaultConstructible.
+template< typename Type >
+Type
+from_json(
+	//! JSON representation of value to be extracted.
+	const rapidjson::Value & json )
+{
+	json_input_t jin{ json };
+
+	Type result{};
+
+	jin >> result;
+
+	return result;
+}
+
+/*!
+ * @brief Helper function to read DTO from already parsed document by using a
+ * custom Reader_Writer object.
+ *
+ * Usage example:
+ * @code
+ * class some_data {
+ * public:
+ * 	...
+ * 	template<typename Io> void json_io(Io & io) {...}
+ * };
+ * struct some_data_reader_writer {
+ * 	void read( some_data & obj, const rapidjson::Value & from ) const {...}
+ *
+ * 	void write( const some_data & obj, rapidjson::Value & to, rapidjson::MemoryPoolAllocator<> & allocator ) const {...}
+ * };
+ * ...
+ * rapidjson::Document & doc = ...;
+ * auto unpacked_data = json_dto::from_json<some_data>( some_data_reader_writer{}, doc["SomeData"] );
+ * @endcode
+ *
+ * @note
+ * Type @a Type is required to be DefaultConstructible.
+ *
+ * @since v.0.3.4
+ */
+template< typename Type, typename Reader_Writer >
+Type
+from_json(
+	//! Custom Reader_Writer to be used.
+	const Reader_Writer & reader_writer,
+	//! JSON representation of value to be extracted.
+	const rapidjson::Value & json )
+{
+	Type result{};
+
+	details::read_owned( reader_writer, result, json );
+
+	return result;
+}
+
+//! Helper function to read from already parsed document to already
+//! constructed DTO.
+//!
+//! @note
+//! The state of @a o object is not defined if an error occurs.
+template< typename Type >
+void
+from_json(
+	//! JSON representation of value to be extracted.
+	const rapidjson::Value & json,
+	//! The receiver of the extracted value.
+	Type & o )
+{
+	json_input_t jin{ json };
+
+	const details::owned_read_t owned{ o, true };
+	jin >> o;
+}
+
+/*!
+ * Helper function to read DTO from already parsed document by
+ * using a custom Reader_Writer object.
+ *
+ * Usage example:
+ * @code
+ * class some_data {
+ * public:
+ * 	...
+ * 	template<typename Io> void json_io(Io & io) {...}
+ * };
+ * struct some_data_reader_writer {
+ * 	void read( some_data & obj, const rapidjson::Value & from ) const {...}
+ *
+ * 	void write( const some_data & obj, rapidjson::Value & to, rapidjson::MemoryPoolAllocator<> & allocator ) const {...}
+ * };
+ * ...
+ * rapidjson::Document & doc = ...;
+ * some_data unpacked_data;
+ * json_dto::from_json( some_data_reader_writer{}, doc["SomeData"], unpacked_data );
+ * @endcode
+ *
+ * @note
+ * The state of @a o object is not defined if an error occurs.
+ *
+ * @since v.0.3.4
+ */
+template< typename Type, typename Reader_Writer >
+void
+from_json(
+	//! Custom Reader_Writer to be used.
+	const Reader_Writer & reader_writer,
+	//! JSON representation of value to be extracted.
+	const rapidjson::Value & json,
+	//! The receiver of the extracted value.
+	Type & o )
+{
+	details::read_owned( reader_writer, o, json );
+}
+
+//! Helper function to read DTO from json-string in form of string_ref.
+//!
+//! @note
+//! Type @a Type is required to be DefaultConstructible.
+//!
+//! @since v.0.2.9
+template<
+	typename Type,
+	unsigned Rapidjson_Parseflags = rapidjson::kParseDefaultFlags >
+JSON_DTO_NODISCARD
+Type
+from_json(
+	//! Value to be parsed.
+	const string_ref_t & json )
+{
+	// Since v.0.3.5.
+	// The document is destroyed on return, so string views aren't allowed.
+	details::string_view_check::check_value< Type >();
+
+	rapidjson::Document document;
+
+	document.Parse< Rapidjson_Parseflags >( json.s, json.length );
+
+	check_document_parse_status( document );
+
+	return from_json<Type>( document );
+}
+
+/*!
+ * @brief Helper function to read DTO from json-string in form of string_ref
+ * with a custom Reader-Writer object.
+ *
+ * Usage example:
+ * @code
+ * class some_data {
+ * public:
+ * 	...
+ * 	template<typename Io> void json_io(Io & io) {...}
+ * };
+ * struct some_data_reader_writer {
+ * 	void read( some_data & obj, const rapidjson::Value & from ) const {...}
+ *
+ * 	void write( const some_data & obj, rapidjson::Value & to, rapidjson::MemoryPoolAllocator<> & allocator ) const {...}
+ * };
+ * ...
+ * jsom_dto::string_ref_t json_string = ...;
+ * auto unpacked_data = json_dto::from_json<some_data>( some_data_reader_writer{}, json_string );
+ * @endcode
+ *
+ * @note
+ * Type @a Type is required to be DefaultConstructible.
+ *
+ * @since v.0.3.4
+ */
+template<
+	typename Type,
+	typename Reader_Writer,
+	unsigned Rapidjson_Parseflags = rapidjson::kParseDefaultFlags >
+JSON_DTO_NODISCARD
+Type
+from_json(
+	//! Custom Reader_Writer to be used.
+	const Reader_Writer & reader_writer,
+	//! Value to be parsed.
+	const string_ref_t & json )
+{
+	rapidjson::Document document;
+
+	document.Parse< Rapidjson_Parseflags >( json.s, json.length );
+
+	check_document_parse_status( document );
+
+	return from_json<Type, Reader_Writer>( reader_writer, document );
+}
+
+//! Helper function to read DTO from json-string.
+//!
+//! @note
+//! Type @a Type is required to be DefaultConstructible.
+template<
+	typename Type,
+	unsigned Rapidjson_Parseflags = rapidjson::kParseDefaultFlags >
+JSON_DTO_NODISCARD
+Type
+from_json(
+	//! Value to be parsed.
+	const std::string & json )
+{
+	return from_json< Type, Rapidjson_Parseflags >( make_string_ref(json) );
+}
+
+//! Helper function to read DTO from json-string.
+/*!
+ * This version reads the JSON content from a raw char pointer
+ * (it's assumed that it is a null-terminated string).
+ *
+ * @note
+ * Type @a Type is required to be DefaultConstructible.
+ *
+ * @since v.0.2.9
+ */
+template<
+	typename Type,
+	unsigned Rapidjson_Parseflags = rapidjson::kParseDefaultFlags >
+JSON_DTO_NODISCARD
+Type
+from_json(
+	//! Value to be parsed.
+	const char * json )
+{
+	return from_json< Type, Rapidjson_Parseflags >( make_string_ref(json) );
+}
+
+//! Helper function to read DTO from json-string.
+/*!
+ * This version reads the JSON content from a raw char pointer
+ * (it's assumed that it is a null-terminated string).
+ *
+ * Usage example:
+ * @code
+ * class some_data {
+ * public:
+ * 	...
+ * 	template<typename Io> void json_io(Io & io) {...}
+ * };
+ * struct some_data_reader_writer {
+ * 	void read( some_data & obj, const rapidjson::Value & from ) const {...}
+ *
+ * 	void write( const some_data & obj, rapidjson::Value & to, rapidjson::MemoryPoolAllocator<> & allocator ) const {...}
+ * };
+ * ...
+ * const char * json_string = ...;
+ * auto unpacked_data = json_dto::from_json<some_data>( some_data_reader_writer{}, json_string );
+ * @endcode
+ *
+ * @note
+ * Type @a Type is required to be DefaultConstructible.
+ *
+ * @since v.0.3.4
+ */
+template<
+	typename Type,
+	typename Reader_Writer,
+	unsigned Rapidjson_Parseflags = rapidjson::kParseDefaultFlags >
+JSON_DTO_NODISCARD
+Type
+from_json(
+	//! Custom Reader_Writer to be used.
+	const Reader_Writer & reader_writer,
+	//! Value to be parsed.
+	const char * json )
+{
+	return from_json< Type, Reader_Writer, Rapidjson_Parseflags >(
+			reader_writer, make_string_ref(json) );
+}
+
+//! Helper function to read DTO from json-string.
+/*!
+ * This version reads the JSON content from a std::string.
+ *
+ * @note
+ * Type @a Type is required to be DefaultConstructible.
+ *
+ * @since v.0.3.4
+ */
+template<
+	typename Type,
+	typename Reader_Writer,
+	unsigned Rapidjson_Parseflags = rapidjson::kParseDefaultFlags >
+JSON_DTO_NODISCARD
+Type
+from_json(
+	//! Custom Reader_Writer to be used.
+	const Reader_Writer & reader_writer,
+	//! Value to be parsed.
+	const std::string & json )
+{
+	return from_json< Type, Reader_Writer, Rapidjson_Parseflags >(
+			reader_writer, make_string_ref(json) );
+}
+
+//! Helper function to read an already instantiated DTO.
 /*!
- * @brief A mixin to be reused by actual implementations of
- * member_processor_base.
- *
- * It holds:
+ * This version reads the JSON content from a string_ref_t (aka
+ * rapidjson::Value::StringRefType) object.
  *
- * - a reference to the field to be (de)serialized,
- * - a copy of Reader_Writer instance,
- * - a copy of Validator instance.
+ * @note
+ * The state of @a o object is undefined if an error occurs.
  *
- * It provides implementations of read_impl() and write_impl() methods.
- * It's assumed that read_impl() and write_impl() will be called in
- * the derived classes.
+ * @since v.0.2.9
+ */
+template<
+	typename Type,
+	unsigned Rapidjson_Parseflags = rapidjson::kParseDefaultFlags >
+void
+from_json(
+	//! Value to be parsed.
+	const string_ref_t & json,
+	//! The receiver of the extracted value.
+	Type & o )
+{
+	// Since v.0.3.5.
+	// The document is destroyed on return, so string views aren't allowed.
+	details::string_view_check::check_value< Type >();
+
+	rapidjson::Document document;
+
+	document.Parse< Rapidjson_Parseflags >( json.s, json.length );
+
+	check_document_parse_status( document );
+
+	from_json( document, o );
+}
+
+//! Helper function to read an already instantiated DTO with
+//! a custom Reader-Writer object.
+/*!
+ * This version reads the JSON content from a string_ref_t (aka
+ * rapidjson::Value::StringRefType) object.
  *
- * @tparam Field_Type type of field to be (de)serialized.
+ * Usage example:
+ * @code
+ * class some_data {
+ * public:
+ * 	...
+ * 	template<typename Io> void json_io(Io & io) {...}
+ * };
+ * struct some_data_reader_writer {
+ * 	void read( some_data & obj, const rapidjson::Value & from ) const {...}
  *
- * @tparam Reader_Writer type of reader-writer for (de)serialization of
- * field value.
+ * 	void write( const some_data & obj, rapidjson::Value & to, rapidjson::MemoryPoolAllocator<> & allocator ) const {...}
+ * };
+ * ...
+ * json_dto::string_ref_t json_string = ...;
+ * some_data unpacked_data;
+ * json_dto::from_json( some_data_reader_writer{}, json_string, unpacked_data );
+ * @endcode
  *
- * @tparam Validator type of validator for checking validity of the field value.
+ * @note
+ * The state of @a o object is undefined if an error occurs.
  *
- * @since v.0.3.3
+ * @since v.0.3.4
  */
 template<
-	typename Field_Type,
+	typename Type,
 	typename Reader_Writer,
-	typename Validator >
-class member_processor_common_impl_t
+	unsigned Rapidjson_Parseflags = rapidjson::kParseDefaultFlags >
+void
+from_json(
+	//! Custom Reader_Writer to be used.
+	const Reader_Writer & reader_writer,
+	//! Value to be parsed.
+	const string_ref_t & json,
+	//! The receiver of the extracted value.
+	Type & o )
 {
-protected:
-	//! Reference to a field to be (de)serialized.
-	/*!
-	 * @note
-	 * It's expected that this reference remains valid the whole lifetime
-	 * of member_processor_common_impl_t object.
-	 */
-	Field_Type & m_field;
+	rapidjson::Document document;
 
-	//! An instance of reader-writer to be used for (de)serialization.
-	const Reader_Writer m_reader_writer;
+	document.Parse< Rapidjson_Parseflags >( json.s, json.length );
 
-	//! An instance of validator to be used for checking field value validity.
-	const Validator m_validator;
+	check_document_parse_status( document );
 
-public:
-	member_processor_common_impl_t(
-		Field_Type & field,
-		Reader_Writer reader_writer,
-		Validator validator )
-		:	m_field{ field }
-		,	m_reader_writer{ std::move(reader_writer) }
-		,	m_validator{ std::move(validator) }
-	{}
+	from_json( reader_writer, document, o );
+}
 
-	void
-	read_impl(
-		rapidjson::SizeType index,
-		const rapidjson::Value & from ) const
-	{
-		m_reader_writer.read( m_field, from[ index ] );
-		m_validator( m_field );
-	}
+//! Helper function to read an already instantiated DTO.
+//!
+//! @note
+//! The state of @a o object is not defined if an error occurs.
+template<
+	typename Type,
+	unsigned Rapidjson_Parseflags = rapidjson::kParseDefaultFlags >
+void
+from_json(
+	//! Value to be parsed.
+	const std::string & json,
+	//! The receiver of the extracted value.
+	Type & o )
+{
+	from_json< Type, Rapidjson_Parseflags >( make_string_ref(json), o );
+}
 
-	void
-	write_impl(
-		rapidjson::Value & to,
-		rapidjson::MemoryPoolAllocator<> & allocator ) const
-	{
-		// The value has to be passed to the validator before serialization.
-		m_validator( m_field );
+//! Helper function to read an already instantiated DTO.
+/*!
+ * Usage example:
+ * @code
+ * class some_data {
+ * public:
+ * 	...
+ * 	template<typename Io> void json_io(Io & io) {...}
+ * };
+ * struct some_data_reader_writer {
+ * 	void read( some_data & obj, const rapidjson::Value & from ) const {...}
+ *
+ * 	void write( const some_data & obj, rapidjson::Value & to, rapidjson::MemoryPoolAllocator<> & allocator ) const {...}
+ * };
+ * ...
+ * const std::string json_string = ...;
+ * auto unpacked_data = json_dto::from_json<some_data>( some_data_reader_writer{}, json_string );
+ * @endcode
+ *
+ * @note
+ * The state of @a o object is not defined if an error occurs.
+ *
+ * @since v.0.3.4
+ */
+template<
+	typename Type,
+	typename Reader_Writer,
+	unsigned Rapidjson_Parseflags = rapidjson::kParseDefaultFlags >
+void
+from_json(
+	//! Custom Reader_Writer to be used.
+	const Reader_Writer & reader_writer,
+	//! Value to be parsed.
+	const std::string & json,
+	//! The receiver of the extracted value.
+	Type & o )
+{
+	from_json< Type, Reader_Writer, Rapidjson_Parseflags >(
+			reader_writer, make_string_ref(json), o );
+}
 
-		// Now the field can be serialized.
-		rapidjson::Value o;
-		m_reader_writer.write( m_field, o, allocator );
-		to.PushBack( o.Move(), allocator );
-	}
-};
+//! Helper function to read an already instantiated DTO.
+/*!
+ * This version reads the JSON content from a raw char pointer
+ * (it's assumed that it is a null-terminated string).
+ *
+ * @note
+ * The state of @a o object is not defined if an error occurs.
+ *
+ * @since v.0.2.9
+ */
+template< typename Type, unsigned Rapidjson_Parseflags = rapidjson::kParseDefaultFlags >
+void
+from_json(
+	//! Value to be parsed.
+	const char * json,
+	//! The receiver of the extracted value.
+	Type & o )
+{
+	from_json< Type, Rapidjson_Parseflags >( make_string_ref(json), o );
+}
+
+/*!
+ * @brief Helper function to read an already instantiated DTO with
+ * a custom Reader-Writer.
+ *
+ * Usage example:
+ * @code
+ * class some_data {
+ * public:
+ * 	...
+ * 	template<typename Io> void json_io(Io & io) {...}
+ * };
+ * struct some_data_reader_writer {
+ * 	void read( some_data & obj, const rapidjson::Value & from ) const {...}
+ *
+ * 	void write( const some_data & obj, rapidjson::Value & to, rapidjson::MemoryPoolAllocator<> & allocator ) const {...}
+ * };
+ * ...
+ * const char * json_string = ...;
+ * some_data unpacked_data;
+ * json_dto::from_json( some_data_reader_writer{}, json_string, unpacked_data );
+ * @endcode
+ *
+ * @note
+ * The state of @a o object is not defined if an error occurs.
+ *
+ * @since v.0.3.4
+ */
+template<
+	typename Type,
+	typename Reader_Writer,
+	unsigned Rapidjson_Parseflags = rapidjson::kParseDefaultFlags >
+void
+from_json(
+	//! Custom Reader_Writer to be used.
+	const Reader_Writer & reader_writer,
+	//! Value to be parsed.
+	const char * json,
+	//! The receiver of the extracted value.
+	Type & o )
+{
+	from_json< Type, Reader_Writer, Rapidjson_Parseflags >(
+			reader_writer, make_string_ref(json), o );
+}
+
+//
+// from_json_insitu
+//
+
+namespace details
+{
 
 /*!
- * @brief Simple implementation of member_processor_base.
- *
- * Uses a Field_Type{} in implementation of on_field_not_defined().
- *
- * @note
- * The Field_Type has to be DefaultConstructible.
- *
- * @tparam Field_Type type of field to be (de)serialized.
- *
- * @tparam Reader_Writer type of reader-writer for (de)serialization of
- * field value.
+ * @brief An in-situ input stream over a buffer of a known length.
  *
- * @tparam Validator type of validator for checking validity of the field value.
+ * Unlike rapidjson::InsituStringStream it doesn't require a null
+ * terminator: the end of the buffer is reported as '\0'.
  *
- * @since v.0.3.3
+ * @since v.0.3.5
  */
-template<
-	typename Field_Type,
-	typename Reader_Writer,
-	typename Validator >
-class simplest_member_processor_t final
-	:	public member_processor_base_t
-	,	protected member_processor_common_impl_t<Field_Type, Reader_Writer, Validator>
+class insitu_stream_t
 {
-	using common_impl_t =
-			member_processor_common_impl_t<Field_Type, Reader_Writer, Validator>;
-
 public:
-	simplest_member_processor_t(
-		Field_Type & field,
-		Reader_Writer reader_writer,
-		Validator validator )
-		:	common_impl_t{ field, std::move(reader_writer), std::move(validator) }
+	using Ch = char;
+
+	insitu_stream_t( Ch * buffer, std::size_t length ) noexcept
+		:	m_head{ buffer }
+		,	m_src{ buffer }
+		,	m_end{ buffer + length }
 	{}
 
-	void
-	read(
-		rapidjson::SizeType index,
-		const rapidjson::Value & from ) const override
+	Ch
+	Peek() const noexcept { return m_src != m_end ? *m_src : '\0'; }
+
+	Ch
+	Take() noexcept { return m_src != m_end ? *m_src++ : '\0'; }
+
+	std::size_t
+	Tell() const noexcept
 	{
-		this->read_impl( index, from );
+		return static_cast< std::size_t >( m_src - m_head );
 	}
 
+	// Unescaped strings are written over already read content,
+	// so the output never goes beyond the buffer.
+	Ch *
+	PutBegin() noexcept { return m_dst = m_src; }
+
 	void
-	on_field_not_defined() const override
+	Put( Ch c ) noexcept { *m_dst++ = c; }
+
+	std::size_t
+	PutEnd( Ch * begin ) const noexcept
 	{
-		this->m_field = Field_Type{};
-		// The default value has to be passed to the validator too.
-		this->m_validator( this->m_field );
+		return static_cast< std::size_t >( m_dst - begin );
 	}
 
 	void
-	write(
-		rapidjson::Value & to,
-		rapidjson::MemoryPoolAllocator<> & allocator ) const override
+	Flush() noexcept {}
+
+	Ch *
+	Push( std::size_t count ) noexcept
 	{
-		this->write_impl( to, allocator );
+		auto * begin = m_dst;
+		m_dst += count;
+		return begin;
 	}
+
+	void
+	Pop( std::size_t count ) noexcept { m_dst -= count; }
+
+private:
+	Ch * m_head;
+	Ch * m_src;
+	Ch * m_end;
+	Ch * m_dst{ nullptr };
 };
 
+//! Parse a mutable buffer in-situ.
+template< unsigned Rapidjson_Parseflags >
+void
+parse_insitu(
+	rapidjson::Document & document,
+	char * json,
+	std::size_t length )
+{
+	insitu_stream_t stream{ json, length };
+	document.ParseStream< Rapidjson_Parseflags | rapidjson::kParseInsituFlag >(
+			stream );
+
+	check_document_parse_status( document );
+}
+
+} /* namespace details */
+
 /*!
- * @brief Implementation of member_processor_base that uses a default value
- * specified by a user.
+ * @brief Helper function to read an already instantiated DTO from
+ * a mutable buffer in-situ.
  *
- * Uses a default value specified by a user in implementation of
- * on_field_not_defined().
+ * The content of @a json is parsed with rapidjson::kParseInsituFlag:
+ * strings are unescaped right in the buffer and aren't copied into
+ * the document. It makes parsing of string-heavy messages faster.
  *
- * @tparam Field_Type type of field to be (de)serialized.
+ * The buffer doesn't need to be null-terminated. Its content is
+ * modified during the parsing and isn't a valid JSON after that.
+ * The buffer isn't used after the return.
  *
- * @tparam Default_Value_Reference_Holder type for holding a default value.
- * It's expected to be default_value_const_ref_holder_t<Field_Type> or
- * default_value_rvalue_ref_holder_t<Field_Type>.
+ * @note
+ * The state of @a o object is not defined if an error occurs.
  *
- * @tparam Reader_Writer type of reader-writer for (de)serialization of
- * field value.
+ * @since v.0.3.5
+ */
+template< typename Type, unsigned Rapidjson_Parseflags = rapidjson::kParseDefaultFlags >
+void
+from_json_insitu(
+	//! Buffer with the value to be parsed. It will be modified.
+	char * json,
+	//! Length of the value in @a json.
+	std::size_t length,
+	//! The receiver of the extracted value.
+	Type & o )
+{
+	rapidjson::Document document;
+	details::parse_insitu< Rapidjson_Parseflags >( document, json, length );
+
+	from_json( document, o );
+}
+
+/*!
+ * @brief Helper function to read an already instantiated DTO from
+ * a mutable buffer in-situ with a custom Reader-Writer.
  *
- * @tparam Validator type of validator for checking validity of the field value.
+ * @note
+ * The state of @a o object is not defined if an error occurs.
  *
- * @since v.0.3.3
+ * @since v.0.3.5
  */
 template<
-	typename Field_Type,
-	typename Default_Value_Reference_Holder,
+	typename Type,
 	typename Reader_Writer,
-	typename Validator >
-class member_with_default_value_processor_t final
-	:	public member_processor_base_t
-	,	protected member_processor_common_impl_t<Field_Type, Reader_Writer, Validator>
+	unsigned Rapidjson_Parseflags = rapidjson::kParseDefaultFlags >
+void
+from_json_insitu(
+	//! Custom Reader_Writer to be used.
+	const Reader_Writer & reader_writer,
+	//! Buffer with the value to be parsed. It will be modified.
+	char * json,
+	//! Length of the value in @a json.
+	std::size_t length,
+	//! The receiver of the extracted value.
+	Type & o )
 {
-	using common_impl_t =
-			member_processor_common_impl_t<Field_Type, Reader_Writer, Validator>;
+	rapidjson::Document document;
+	details::parse_insitu< Rapidjson_Parseflags >( document, json, length );
 
-private:
-	Default_Value_Reference_Holder m_default_value_reference_holder;
+	from_json( reader_writer, document, o );
+}
 
-public:
-	member_with_default_value_processor_t(
-		Field_Type & field,
-		Default_Value_Reference_Holder default_value_reference_holder,
-		Reader_Writer reader_writer,
-		Validator validator )
-		:	common_impl_t{ field, std::move(reader_writer), std::move(validator) }
-		,	m_default_value_reference_holder{ default_value_reference_holder }
-	{}
+/*!
+ * @brief Helper function to read DTO from a mutable buffer in-situ.
+ *
+ * Usage example:
+ * @code
+ * std::vector< char > buffer = receive_message();
+ * auto data = json_dto::from_json_insitu< some_data >(
+ * 		buffer.data(), buffer.size() );
+ * @endcode
+ *
+ * @note
+ * Type @a Type is required to be DefaultConstructible.
+ *
+ * @since v.0.3.5
+ */
+template< typename Type, unsigned Rapidjson_Parseflags = rapidjson::kParseDefaultFlags >
+JSON_DTO_NODISCARD
+Type
+from_json_insitu(
+	//! Buffer with the value to be parsed. It will be modified.
+	char * json,
+	//! Length of the value in @a json.
+	std::size_t length )
+{
+	Type result{};
 
-	void
-	read(
-		rapidjson::SizeType index,
-		const rapidjson::Value & from ) const override
-	{
-		this->read_impl( index, from );
-	}
+	from_json_insitu< Type, Rapidjson_Parseflags >( json, length, result );
 
-	void
-	on_field_not_defined() const override
-	{
-		this->m_field = m_default_value_reference_holder.get();
+	return result;
+}
 
-		// The default value has to be passed to the validator too.
-		this->m_validator( this->m_field );
-	}
+/*!
+ * @brief Helper function to read DTO from a mutable buffer in-situ
+ * with a custom Reader-Writer.
+ *
+ * @note
+ * Type @a Type is required to be DefaultConstructible.
+ *
+ * @since v.0.3.5
+ */
+template<
+	typename Type,
+	typename Reader_Writer,
+	unsigned Rapidjson_Parseflags = rapidjson::kParseDefaultFlags >
+JSON_DTO_NODISCARD
+Type
+from_json_insitu(
+	//! Custom Reader_Writer to be used.
+	const Reader_Writer & reader_writer,
+	//! Buffer with the value to be parsed. It will be modified.
+	char * json,
+	//! Length of the value in @a json.
+	std::size_t length )
+{
+	Type result{};
 
-	void
-	write(
-		rapidjson::Value & to,
-		rapidjson::MemoryPoolAllocator<> & allocator ) const override
-	{
-		this->write_impl( to, allocator );
-	}
-};
+	from_json_insitu< Type, Reader_Writer, Rapidjson_Parseflags >(
+			reader_writer, json, length, result );
+
+	return result;
+}
 
 /*!
- * @brief Helper class for holding a "const reference" to the default value.
+ * @brief Helper function to read an already instantiated DTO from
+ * a std::string in-situ.
  *
- * This class is used when the default value has to be copied, not moved out.
+ * The string is taken by the function and is used as a buffer for
+ * the in-situ parsing.
+ *
+ * Usage example:
+ * @code
+ * std::string message = receive_message();
+ * some_data data;
+ * json_dto::from_json_insitu( std::move(message), data );
+ * @endcode
  *
  * @note
- * The m_default_value may be a "reference" to a temporary value.
- * It's assumed that this "reference" remains valid the whole life of
- * a default_value_const_ref_holder_t object.
+ * The state of @a o object is not defined if an error occurs.
  *
- * @since v.0.3.3
+ * @since v.0.3.5
  */
-template< typename Field_Type >
-class default_value_const_ref_holder_t
+template< typename Type, unsigned Rapidjson_Parseflags = rapidjson::kParseDefaultFlags >
+void
+from_json_insitu(
+	//! Value to be parsed.
+	std::string && json,
+	//! The receiver of the extracted value.
+	Type & o )
 {
-	const Field_Type * m_default_value;
+	// Since v.0.3.5.
+	// The document is destroyed on return, so string views aren't allowed.
+	details::string_view_check::check_value< Type >();
 
-public:
-	explicit default_value_const_ref_holder_t( const Field_Type & default_value )
-		:	m_default_value{ std::addressof(default_value) }
-	{}
+	std::string buffer{ std::move(json) };
 
-	JSON_DTO_NODISCARD
-	const Field_Type &
-	get() const noexcept { return *m_default_value; }
-};
+	from_json_insitu< Type, Rapidjson_Parseflags >(
+			&buffer[ 0 ], buffer.size(), o );
+}
 
 /*!
- * @brief Helper class for holding a "rvalue reference" to the default value.
+ * @brief Helper function to read an already instantiated DTO from
+ * a std::string in-situ with a custom Reader-Writer.
  *
- * This class is used when the default value has to be moved out, not copied.
+ * @note
+ * The state of @a o object is not defined if an error occurs.
+ *
+ * @since v.0.3.5
+ */
+template<
+	typename Type,
+	typename Reader_Writer,
+	unsigned Rapidjson_Parseflags = rapidjson::kParseDefaultFlags >
+void
+from_json_insitu(
+	//! Custom Reader_Writer to be used.
+	const Reader_Writer & reader_writer,
+	//! Value to be parsed.
+	std::string && json,
+	//! The receiver of the extracted value.
+	Type & o )
+{
+	std::string buffer{ std::move(json) };
+
+	from_json_insitu< Type, Reader_Writer, Rapidjson_Parseflags >(
+			reader_writer, &buffer[ 0 ], buffer.size(), o );
+}
+
+/*!
+ * @brief Helper function to read DTO from a std::string in-situ.
+ *
+ * Usage example:
+ * @code
+ * std::string message = receive_message();
+ * auto data = json_dto::from_json_insitu< some_data >( std::move(message) );
+ * @endcode
  *
  * @note
- * The m_default_value may be a "reference" to a temporary value.
- * It's assumed that this "reference" remains valid the whole life of
- * a default_value_rvalue_ref_holder_t object.
+ * Type @a Type is required to be DefaultConstructible.
  *
- * @since v.0.3.3
+ * @since v.0.3.5
  */
-template< typename Field_Type >
-class default_value_rvalue_ref_holder_t
+template< typename Type, unsigned Rapidjson_Parseflags = rapidjson::kParseDefaultFlags >
+JSON_DTO_NODISCARD
+Type
+from_json_insitu(
+	//! Value to be parsed.
+	std::string && json )
+{
+	Type result{};
+
+	from_json_insitu< Type, Rapidjson_Parseflags >( std::move(json), result );
+
+	return result;
+}
+
+/*!
+ * @brief Helper function to read DTO from a std::string in-situ
+ * with a custom Reader-Writer.
+ *
+ * @note
+ * Type @a Type is required to be DefaultConstructible.
+ *
+ * @since v.0.3.5
+ */
+template<
+	typename Type,
+	typename Reader_Writer,
+	unsigned Rapidjson_Parseflags = rapidjson::kParseDefaultFlags >
+JSON_DTO_NODISCARD
+Type
+from_json_insitu(
+	//! Custom Reader_Writer to be used.
+	const Reader_Writer & reader_writer,
+	//! Value to be parsed.
+	std::string && json )
 {
-	Field_Type * m_default_value;
+	Type result{};
 
-public:
-	explicit default_value_rvalue_ref_holder_t( Field_Type && default_value )
-		:	m_default_value{ std::addressof(default_value) }
-	{}
+	from_json_insitu< Type, Reader_Writer, Rapidjson_Parseflags >(
+			reader_writer, std::move(json), result );
 
-	JSON_DTO_NODISCARD
-	Field_Type &&
-	get() const noexcept { return std::move(*m_default_value); }
-};
+	return result;
+}
 
-} /* namespace inside_array::details */
+//
+// parsed_t
+//
+
+template< typename Type >
+class parsed_t;
+
+template<
+	typename Type,
+	unsigned Rapidjson_Parseflags = rapidjson::kParseDefaultFlags >
+JSON_DTO_NODISCARD
+parsed_t< Type >
+make_parsed( std::string && json );
 
 /*!
- * @brief A metafunction that specified a number of mandatory member count.
+ * @brief A DTO together with the source it was read from.
  *
- * Usage example:
- * @code
- * struct inner {
- * 	int a;
- * 	int b;
- * 	int c;
- * 	int d;
- * };
+ * Fields of type string_view_t (or std::string_view) refer to the source
+ * of a DTO. An instance of parsed_t owns the source buffer, the document
+ * and the DTO, so such fields are valid while the instance is alive.
  *
- * struct outer {
- * 	inner x;
+ * The source is parsed in-situ, so neither the buffer nor the document
+ * holds copies of strings.
  *
- * 	template<typename Io> void json_io(Io & io) {
- * 		io & json_dto::mandatory(
- * 				json_dto::inside_array::reader_writer<
- * 					// At least two members have to be present.
- * 					// Otherwise an exception will be thrown.
- * 					json_dto::inside_array::at_least<2>
- * 				>(
- * 					// Mandatory member. Has to be present during deserialization.
- * 					json_dto::inside_array::member(x.a),
- * 					// Mandatory member. Has to be present during deserialization.
- * 					json_dto::inside_array::member(x.b),
- * 					// Optional member. A default value will be used if it's missing during deserialization.
- * 					json_dto::inside_array::member(x.c),
- * 					// Optional member. A default value will be used if it's missing during deserialization.
- * 					json_dto::inside_array::member(x.d)
- * 				),
- * 				"x", x )
- * 			;
- * 	}
- * };
- * @endcode
+ * Instances are created by make_parsed() functions. They are movable
+ * but not copyable. Moving doesn't invalidate references to the source.
  *
- * @note
- * This metafunction will lead to run-time exceptions if there are more items in
- * an array than described fields:
+ * Usage example:
  * @code
- * struct inner {
- * 	int a;
- * 	int b;
- * 	int c;
- * };
- *
- * struct outer {
- * 	inner x;
- *
- * 	template<typename Io> void json_io(Io & io) {
- * 		io & json_dto::mandatory(
- * 				json_dto::inside_array::reader_writer<
- * 					json_dto::inside_array::at_least<1>
- * 				>(
- * 					json_dto::inside_array::member(x.a),
- * 					json_dto::inside_array::member(x.b),
- * 					json_dto::inside_array::member(x.c)
- * 				), "x", x );
- * 	}
+ * struct request_t {
+ * 	json_dto::string_view_t m_method;
+ * 	std::vector< json_dto::string_view_t > m_args;
+ * 	...
  * };
- * ...
- * // An exception will be thrown here, because the array in JSON contains
- * // more items than described members.
- * auto obj = json_dto::from_json<outer>(R"({"x":[1, 2, 3, 4, 5]})");
+ * auto request = json_dto::make_parsed< request_t >( std::move(message) );
+ * handle( request->m_method, request->m_args );
  * @endcode
  *
- * @since v.0.3.3
+ * @since v.0.3.5
  */
-template< std::size_t Number >
-struct at_least
+template< typename Type >
+class parsed_t
 {
-	/*!
-	 * @brief Metafunction that detects if Number is not greater than Members_Count.
-	 *
-	 * The at_least metafunction can be used with
-	 * json_dto::inside_array::reader_writer only if Number is less than or
-	 * equal to Members_Count. Otherwise the at_least limitation can't be used.
-	 *
-	 * @since v.0.3.3
-	 */
-	template< rapidjson::SizeType Members_Count >
-	struct is_valid_members_count
+	template< typename T, unsigned Rapidjson_Parseflags >
+	friend parsed_t< T >
+	make_parsed( std::string && json );
+
+	struct storage_t
 	{
-		static constexpr bool value = (Number <= Members_Count);
+		std::string m_buffer;
+		rapidjson::Document m_document;
+		Type m_value{};
+
+		storage_t( std::string && buffer )
+			:	m_buffer{ std::move(buffer) }
+		{}
 	};
 
-	/*!
-	 * @brief Helper method that detect number of array members to be read.
-	 *
-	 * @throw ex_t if @a actual_members is less than Number.
-	 * @throw ex_t if @a actual_members is greater than @a expected_members.
-	 *
-	 * @since v.0.3.3
-	 */
-	JSON_DTO_NODISCARD
-	static rapidjson::SizeType
-	handle_actual_members_count(
-		rapidjson::SizeType expected_members,
-		rapidjson::SizeType actual_members )
-	{
-		if( actual_members < Number )
-			throw ex_t{ "inside_array: actual members count ("
-					+ std::to_string(actual_members)
-					+ ") is less than expected mandatory members count ("
-					+ std::to_string(Number) + ")"
-				};
-		if( expected_members < actual_members )
-			throw ex_t{ "inside_array: actual members count ("
-					+ std::to_string(actual_members)
-					+ ") is greater than expected members count ("
-					+ std::to_string(Number) + ")"
-				};
+	std::unique_ptr< storage_t > m_storage;
 
-		return actual_members;
-	}
+	parsed_t( std::string && buffer )
+		:	m_storage{ new storage_t{ std::move(buffer) } }
+	{}
+
+public:
+	//! Access to the DTO.
+	const Type &
+	get() const noexcept { return m_storage->m_value; }
+
+	//! Access to the DTO.
+	Type &
+	get() noexcept { return m_storage->m_value; }
+
+	const Type &
+	operator*() const noexcept { return get(); }
+
+	Type &
+	operator*() noexcept { return get(); }
+
+	const Type *
+	operator->() const noexcept { return &get(); }
+
+	Type *
+	operator->() noexcept { return &get(); }
+
+	//! Access to the document the DTO was read from.
+	const rapidjson::Document &
+	document() const noexcept { return m_storage->m_document; }
 };
 
 /*!
- * @brief A special reader-writer that allows to store several values into an array
- * and read from an array.
- *
- * Usage example:
- * @code
- * struct inner {
- * 	int a;
- * 	std::string b;
- * };
- *
- * struct outer {
- * 	inner x;
- *
- * 	template<typename Io> json_io(Io & io) {
- * 		io & json_dto::mandatory(
- * 			json_dto::inside_array::reader_writer(
- * 				// All fields to be placed inside an array have
- * 				// to be enumerated here. The order is important.
- * 				json_dto::inside_array::member(x.a),
- * 				json_dto::inside_array::member(x.b) ),
- * 			"x", x);
- * 	}
- * };
- *
- * auto obj = json_dto::from_json<outer>(R"({"x":[1, "two"]})");
- * assert(obj.x.a == 1);
- * assert(obj.x.b == "two");
- *
- * obj.x.a = 42;
- * obj.x.b = "Hello, World";
- * auto json = json_dto::to_json(obj);
- * assert(json == R"({"x":[42,"Hello, World"]})");
- * @endcode
- *
- * By default this reader_writer requires that all members are present during
- * deserialization. If some members may be absent then `at_least` limit has to
- * be specified:
- * @code
- * struct inner {
- * 	int a;
- * 	int b;
- * 	int c;
- * 	int d;
- * };
- *
- * struct outer {
- * 	inner x;
- *
- * 	template<typename Io> void json_io(Io & io) {
- * 		io & json_dto::mandatory(
- * 				json_dto::inside_array::reader_writer<
- * 					// At least two members have to be present.
- * 					// Otherwise an exception will be thrown.
- * 					json_dto::inside_array::at_least<2>
- * 				>(
- * 					json_dto::inside_array::member(x.a),
- * 					json_dto::inside_array::member(x.b),
- * 					json_dto::inside_array::member(x.c),
- * 					json_dto::inside_array::member(x.d)
- * 				),
- * 				"x", x )
- * 			;
- * 	}
- * };
- *
- * const auto o1 = json_dto::from_json<outer>(R"({"x":[1,2,3]})");
- * // o1.x.d will be 0.
+ * @brief Read DTO from a std::string and keep it with the source.
  *
- * const auto o2 = json_dto::from_json<outer>(R"({"x":[1,2]})");
- * // o2.x.c and o2.x.d will be 0.
- * @endcode
+ * The string is taken by the function and is used as a buffer for
+ * the in-situ parsing.
  *
- * This reader-writer can be used for manual (de)serialization of tuples:
- * @code
- * struct outer {
- * 	std::tuple<int, std::string> x;
+ * @since v.0.3.5
+ */
+template< typename Type, unsigned Rapidjson_Parseflags >
+parsed_t< Type >
+make_parsed( std::string && json )
+{
+	parsed_t< Type > result{ std::move(json) };
+
+	auto & storage = *result.m_storage;
+	details::parse_insitu< Rapidjson_Parseflags >(
+			storage.m_document,
+			&storage.m_buffer[ 0 ],
+			storage.m_buffer.size() );
+
+	from_json( storage.m_document, storage.m_value );
+
+	return result;
+}
+
+/*!
+ * @brief Read DTO from a copy of a std::string and keep it with the copy.
  *
- * 	template<typename Io> json_io(Io & io) {
- * 		io & json_dto::mandatory(
- * 			json_dto::inside_array::reader_writer(
- * 				json_dto::inside_array::member(std::get<0>(x)),
- * 				json_dto::inside_array::member(std::get<1>(x))),
- * 			"x", x);
- * 	}
- * };
- * @endcode
+ * @since v.0.3.5
+ */
+template<
+	typename Type,
+	unsigned Rapidjson_Parseflags = rapidjson::kParseDefaultFlags >
+JSON_DTO_NODISCARD
+parsed_t< Type >
+make_parsed( const std::string & json )
+{
+	return make_parsed< Type, Rapidjson_Parseflags >( std::string{ json } );
+}
+
+/*!
+ * @brief Read DTO from a copy of a string_ref and keep it with the copy.
  *
- * @attention
- * This function returns a temporary object that should not be stored anywhere and
- * must be passed directly to json_dto::mandatory(), json_dto::optional(),
- * json_dto::optional_no_default() and similar binders.
+ * @since v.0.3.5
+ */
+template<
+	typename Type,
+	unsigned Rapidjson_Parseflags = rapidjson::kParseDefaultFlags >
+JSON_DTO_NODISCARD
+parsed_t< Type >
+make_parsed( const string_ref_t & json )
+{
+	return make_parsed< Type, Rapidjson_Parseflags >(
+			std::string{ json.s, json.length } );
+}
+
+/*!
+ * @brief Serialize an object into specified stream.
  *
- * @since v.0.3.3
+ * @note
+ * Default formatting will be used. If one needs pretty-formatted
+ * output then another overload has to be used.
  */
-template<
-	typename At_Least_Limiter = inside_array::details::all_members_required_t,
-	typename... Member_Processors >
-JSON_DTO_NODISCARD
-auto
-reader_writer( Member_Processors && ...processors )
+template< typename Type >
+void
+to_stream(
+	//! Target stream.
+	std::ostream & to,
+	//! Value to be serialized.
+	const Type & type )
 {
-	return details::reader_writer_t<
-			sizeof...(Member_Processors),
-			At_Least_Limiter
-		>( std::forward<Member_Processors>(processors)... );
+	rapidjson::Document output_doc;
+	json_dto::json_output_t jout{
+		output_doc, output_doc.GetAllocator() };
+
+	jout << type;
+
+	rapidjson::OStreamWrapper wrapper{ to };
+	rapidjson::Writer< rapidjson::OStreamWrapper > writer{ wrapper };
+
+	const bool result = output_doc.Accept( writer );
+	if( !result )
+		report_error( error_code_t::write_failed,
+				"to_stream: output_doc.Accept(writer) returns false" );
 }
 
 /*!
- * @brief A special function that describes one member of an array
- * representation.
+ * @brief Serialize an object into specified stream with custom
+ * Reader-Writer object.
  *
  * Usage example:
  * @code
- * struct inner {
- * 	int a;
- * 	int b;
- * 	int c;
- * 	int d;
+ * class some_data {
+ * public:
+ * 	...
+ * 	template<typename Io> void json_io(Io & io) {...}
  * };
+ * struct some_data_reader_writer {
+ * 	void read( some_data & obj, const rapidjson::Value & from ) const {...}
  *
- * struct outer {
- * 	inner x;
- *
- * 	template<typename Io> void json_io(Io & io) {
- * 		io & json_dto::mandatory(
- * 				json_dto::inside_array::reader_writer< json_dto::inside_array::at_least<2> >(
- * 					// Mandatory member.
- * 					json_dto::inside_array::member(x.a),
- * 					// Mandatory member.
- * 					json_dto::inside_array::member(x.b, json_dto::min_max_constraint(-10, +10)),
- * 					// Optional member. Will be initialized by int{} if it's absent
- * 					// during deserialiaztion.
- * 					json_dto::inside_array::member(x.c),
- * 					// Optional member. Will be initialized by int{} if it's absent
- * 					// during deserialiaztion.
- * 					json_dto::inside_array::member(x.d, json_dto::one_of_constraint({2, 4, 6, 10, 20, 40})
- * 				),
- * 				"x", x )
- * 			;
- * 	}
+ * 	void write( const some_data & obj, rapidjson::Value & to, rapidjson::MemoryPoolAllocator<> & allocator ) const {...}
  * };
+ * ...
+ * some_data data_to_pack{...};
+ * json_dto::to_stream(some_data_reader_writer{}, std::cout, data_to_pack);
  * @endcode
  *
- * @attention
- * This function returns a temporary object that should not be stored anywhere and
- * must be passed directly to json_dto::inside_array::reader_writer().
+ * @note
+ * Default formatting will be used. If one needs pretty-formatted
+ * output then another overload has to be used.
  *
- * @since v.0.3.3
+ * @since v.0.3.4
  */
 template<
-	typename Field_Type,
-	typename Validator = empty_validator_t >
-JSON_DTO_NODISCARD
-auto
-member( Field_Type & field, Validator validator = Validator{} )
+	typename Type,
+	typename Reader_Writer >
+void
+to_stream(
+	//! Custom Reader_Writer to be used.
+	const Reader_Writer & reader_writer,
+	//! Target stream.
+	std::ostream & to,
+	//! Value to be serialized.
+	const Type & type )
 {
-	return details::simplest_member_processor_t<
-			Field_Type,
-			default_reader_writer_t,
-			Validator
-		>( field, default_reader_writer_t{}, std::move(validator) );
+	rapidjson::Document output_doc;
+
+	reader_writer.write( type, output_doc, output_doc.GetAllocator() );
+
+	rapidjson::OStreamWrapper wrapper{ to };
+	rapidjson::Writer< rapidjson::OStreamWrapper > writer{ wrapper };
+
+	const bool result = output_doc.Accept( writer );
+	if( !result )
+		report_error( error_code_t::write_failed,
+				"to_stream: output_doc.Accept(writer) returns false" );
 }
 
 /*!
- * @brief A special function that describes one member of an array
- * representation.
+ * @brief Serialize an object into specified stream with using pretty-writer.
  *
- * Allows to specify a default value if item is not present in an array
- * on deserialization.
+ * @since v.0.2.14
+ */
+template< typename Type >
+void
+to_stream(
+	//! The target stream.
+	std::ostream & to,
+	//! Object to be serialized.
+	const Type & type,
+	//! Parameters for pretty-writer.
+	pretty_writer_params_t writer_params )
+{
+	rapidjson::Document output_doc;
+	json_dto::json_output_t jout{
+		output_doc, output_doc.GetAllocator() };
+
+	jout << type;
+
+	rapidjson::OStreamWrapper wrapper{ to };
+	rapidjson::PrettyWriter< rapidjson::OStreamWrapper > writer{ wrapper };
+	writer.SetIndent(
+			writer_params.m_indent_char,
+			writer_params.m_indent_char_count );
+	writer.SetFormatOptions(
+			writer_params.m_format_options );
+
+	const bool result = output_doc.Accept( writer );
+	if( !result )
+		report_error( error_code_t::write_failed,
+				"to_stream: output_doc.Accept(writer) returns false" );
+}
+
+/*!
+ * @brief Serialize an object into specified stream with 
+ * custom Reader-Writer object and using pretty-writer.
  *
  * Usage example:
  * @code
- * struct inner {
- * 	int a;
- * 	int b;
- * 	int c;
- * 	int d;
- * };
- *
- * struct outer {
- * 	inner x;
- *
- * 	template<typename Io> void json_io(Io & io) {
- * 		io & json_dto::mandatory(
- * 				json_dto::inside_array::reader_writer< json_dto::inside_array::at_least<2>(
- * 					// Mandatory member.
- * 					json_dto::inside_array::member(x.a),
- * 					// Mandatory member.
- * 					json_dto::inside_array::member(x.b, json_dto::min_max_constraint(-10, +10)),
- * 					// Optional member. It will be initialized by 5 if it's absent during
- * 					// deserialization.
- * 					json_dto::inside_array::member_with_default_value(x.c, 5),
- * 					// Optional member. It will be initialized by 6 if it's absent during
- * 					// deserialization.
- * 					json_dto::inside_array::member(x.d, 6, json_dto::one_of_constraint({2, 4, 6, 10, 20, 40})
- * 				),
- * 				"x", x )
- * 			;
- * 	}
- * };
- * @endcode
- *
- * @note
- * This overload is used when the default value is represented as ordinary
- * const- or non-const reference. A copy of default value will be made if the member
- * is missing during deserialization.
- * For example:
- * @code
- * struct inner {
- * 	int a;
- * 	some_complex_type b;
- * 	another_complex_type c;
+ * class some_data {
+ * public:
  * 	...
- *
- * 	static const some_complex_type default_b;
- * 	static another_complex_type default_c;
+ * 	template<typename Io> void json_io(Io & io) {...}
  * };
- * const some_complex_type inner::default_b{...};
- * another_complex_type inner::default_c{...};
- *
- * struct outer {
- * 	inner x;
+ * struct some_data_reader_writer {
+ * 	void read( some_data & obj, const rapidjson::Value & from ) const {...}
  *
- * 	template<typename Io> void json_io(Io & io) {
- * 		io & json_dto::mandatory(
- * 				json_dto::inside_array::reader_writer< json_dto::inside_array::at_least<2>(
- * 					// Mandatory member.
- * 					json_dto::inside_array::member(x.a),
- * 					// Optional member. A copy of inner::default_b will be made if
- * 					// inner::b is missing during deserialization.
- * 					json_dto::inside_array::member_with_default_value(x.b, inner::default_b),
- * 					// Optional member. A copy of inner::default_c will be made if
- * 					// inner::c is missing during deserialization.
- * 					json_dto::inside_array::member(x.c, inner::default_c)
- * 				),
- * 				"x", x )
- * 			;
+ * 	void write( const some_data & obj, rapidjson::Value & to, rapidjson::MemoryPoolAllocator<> & allocator ) const {...}
  * };
+ * ...
+ * some_data data_to_pack{...};
+ * json_dto::to_stream( some_data_reader_writer{}, std::cout, data_to_pack,
+ * 	json_dto::pretty_writer_params_t{}.indent_char(' ').indent_char_count(3) );
  * @endcode
  *
- * @attention
- * This function returns a temporary object that should not be stored anywhere and
- * must be passed directly to json_dto::inside_array::reader_writer().
- *
- * @since v.0.3.3
+ * @since v.0.3.4
  */
 template<
-	typename Field_Type,
-	typename Validator = empty_validator_t >
-JSON_DTO_NODISCARD
-auto
-member_with_default_value(
-	Field_Type & field,
-	const Field_Type & default_value,
-	Validator validator = Validator{} )
+	typename Type,
+	typename Reader_Writer >
+void
+to_stream(
+	//! The reader implementing serialization.
+	const Reader_Writer & reader_writer,
+	//! The target stream.
+	std::ostream & to,
+	//! Object to be serialized.
+	const Type & type,
+	//! Parameters for pretty-writer.
+	pretty_writer_params_t writer_params )
 {
-	using default_holder_t = details::default_value_const_ref_holder_t<Field_Type>;
+	rapidjson::Document output_doc;
 
-	return details::member_with_default_value_processor_t<
-			Field_Type,
-			default_holder_t,
-			default_reader_writer_t,
-			Validator
-		>( field,
-				default_holder_t{ default_value },
-				default_reader_writer_t{},
-				std::move(validator) );
+	reader_writer.write( type, output_doc, output_doc.GetAllocator() );
+
+	rapidjson::OStreamWrapper wrapper{ to };
+	rapidjson::PrettyWriter< rapidjson::OStreamWrapper > writer{ wrapper };
+	writer.SetIndent(
+			writer_params.m_indent_char,
+			writer_params.m_indent_char_count );
+	writer.SetFormatOptions(
+			writer_params.m_format_options );
+
+	const bool result = output_doc.Accept( writer );
+	if( !result )
+		report_error( error_code_t::write_failed,
+				"to_stream: output_doc.Accept(writer) returns false" );
 }
 
+//
+// SAX-based serialization
+//
+
 /*!
- * @brief A special function that describes one member of an array
- * representation.
+ * @brief Serialize an object directly into a SAX writer.
  *
- * Allows to specify a default value if item is not present in an array
- * on deserialization.
+ * No intermediate rapidjson::Document is created: binders pass values
+ * directly to @a writer. The output is the same as in the case of
+ * DOM-based serialization.
  *
- * Usage example:
- * @code
- * struct inner {
- * 	int a;
- * 	int b;
- * 	int c;
- * 	int d;
- * };
+ * Values with custom Reader_Writers (except apply_to_content_t), values
+ * of types with user-defined write_json_value and inside_array
+ * are serialized via a small temporary rapidjson::Value.
  *
- * struct outer {
- * 	inner x;
+ * @attention
+ * A type with json_io() is serialized via its json_io() even if
+ * there is an overload of write_json_value for that type. Use
+ * a custom Reader_Writer in such a case.
  *
- * 	template<typename Io> void json_io(Io & io) {
- * 		io & json_dto::mandatory(
- * 				json_dto::inside_array::reader_writer< json_dto::inside_array::at_least<2>(
- * 					// Mandatory member.
- * 					json_dto::inside_array::member(x.a),
- * 					// Mandatory member.
- * 					json_dto::inside_array::member(x.b, json_dto::min_max_constraint(-10, +10)),
- * 					// Optional member. It will be initialized by 5 if it's absent during
- * 					// deserialization.
- * 					json_dto::inside_array::member_with_default_value(x.c, 5),
- * 					// Optional member. It will be initialized by 6 if it's absent during
- * 					// deserialization.
- * 					json_dto::inside_array::member(x.d, 6, json_dto::one_of_constraint({2, 4, 6, 10, 20, 40})
- * 				),
- * 				"x", x )
- * 			;
- * 	}
- * };
+ * Usage example:
+ * @code
+ * rapidjson::StringBuffer buffer;
+ * rapidjson::Writer< rapidjson::StringBuffer > writer{ buffer };
+ * json_dto::to_writer( writer, my_dto );
  * @endcode
  *
- * @note
- * This overload is used when the default value is represented as a
- * rvalue-reference (that means that the default value is a temporary object).
- * The value of this temporary object wlll be moved into the member if the
- * member is missing during deserialization.
- * For example:
- * @code
- * struct inner {
- * 	int a;
- * 	some_complex_type b;
- * 	another_complex_type c;
- * 	...
- * };
+ * @tparam Writer type of writer. It's expected to be rapidjson::Writer,
+ * rapidjson::PrettyWriter or a type with the same interface.
  *
- * struct outer {
- * 	inner x;
+ * @since v.0.3.5
+ */
+template< typename Writer, typename Dto >
+void
+to_writer(
+	//! Target writer.
+	Writer & writer,
+	//! Object to be serialized.
+	const Dto & dto )
+{
+	details::sax_output::write_top_level_value( dto, writer );
+}
+
+/*!
+ * @brief Helper function for serialization of an object to string
+ * without intermediate rapidjson::Document.
  *
- * 	template<typename Io> void json_io(Io & io) {
- * 		io & json_dto::mandatory(
- * 				json_dto::inside_array::reader_writer< json_dto::inside_array::at_least<2>(
- * 					// Mandatory member.
- * 					json_dto::inside_array::member(x.a),
- * 					// Optional member. Value of this temporary object will be used if
- * 					// inner::b is missing during deserialization.
- * 					json_dto::inside_array::member_with_default_value(x.b, some_complex_type{...}),
- * 					// Optional member. Value of this temporary object will be used if
- * 					// inner::c is missing during deserialization.
- * 					json_dto::inside_array::member(x.c, another_complex_type{...})
- * 				),
- * 				"x", x )
- * 			;
- * };
- * @endcode
+ * @see to_writer()
  *
- * @attention
- * This function returns a temporary object that should not be stored anywhere and
- * must be passed directly to json_dto::inside_array::reader_writer().
+ * @since v.0.3.5
+ */
+template< typename Dto >
+JSON_DTO_NODISCARD
+std::string
+to_json_sax(
+	//! Object to be serialized.
+	const Dto & dto )
+{
+	rapidjson::StringBuffer buffer;
+	details::sax_output::sized_writer_t<
+			rapidjson::Writer< rapidjson::StringBuffer > > writer( buffer );
+
+	to_writer( writer, dto );
+
+	return { buffer.GetString(), buffer.GetSize() };
+}
+
+/*!
+ * @brief Helper function for serialization of an object to string
+ * by using pretty_writer and without intermediate rapidjson::Document.
  *
- * @since v.0.3.3
+ * @see to_writer()
+ *
+ * @since v.0.3.5
  */
-template<
-	typename Field_Type,
-	typename Validator = empty_validator_t >
+template< typename Dto >
 JSON_DTO_NODISCARD
-auto
-member_with_default_value(
-	Field_Type & field,
-	Field_Type && default_value,
-	Validator validator = Validator{} )
+std::string
+to_json_sax(
+	//! Object to be serialized.
+	const Dto & dto,
+	//! Parameters for pretty_writer.
+	pretty_writer_params_t writer_params )
 {
-	using default_holder_t = details::default_value_rvalue_ref_holder_t<Field_Type>;
+	rapidjson::StringBuffer buffer;
 
-	return details::member_with_default_value_processor_t<
-			Field_Type,
-			default_holder_t,
-			default_reader_writer_t,
-			Validator
-		>( field,
-				default_holder_t{ std::move(default_value) },
-				default_reader_writer_t{},
-				std::move(validator) );
+	details::sax_output::sized_writer_t<
+			rapidjson::PrettyWriter< rapidjson::StringBuffer > > writer( buffer );
+	writer.SetIndent(
+			writer_params.m_indent_char,
+			writer_params.m_indent_char_count );
+	writer.SetFormatOptions(
+			writer_params.m_format_options );
+
+	to_writer( writer, dto );
+
+	return { buffer.GetString(), buffer.GetSize() };
 }
 
 /*!
- * @brief A special function that describes one member of an array
- * representation.
+ * @brief Serialize an object into specified stream without
+ * intermediate rapidjson::Document.
  *
- * Allows to specify a custom reader-writer for (de)serialization of the member.
+ * @see to_writer()
  *
- * Usage example:
- * @code
- * struct my_special_int_reader_writer {...};
+ * @since v.0.3.5
+ */
+template< typename Type >
+void
+to_stream_sax(
+	//! Target stream.
+	std::ostream & to,
+	//! Value to be serialized.
+	const Type & type )
+{
+	rapidjson::OStreamWrapper wrapper{ to };
+	rapidjson::Writer< rapidjson::OStreamWrapper > writer{ wrapper };
+
+	to_writer( writer, type );
+}
+
+/*!
+ * @brief Serialize an object into specified stream with using
+ * pretty-writer and without intermediate rapidjson::Document.
  *
- * struct inner {
- * 	int a;
- * 	int b;
- * };
+ * @see to_writer()
  *
- * struct outer {
- * 	inner x;
+ * @since v.0.3.5
+ */
+template< typename Type >
+void
+to_stream_sax(
+	//! The target stream.
+	std::ostream & to,
+	//! Object to be serialized.
+	const Type & type,
+	//! Parameters for pretty-writer.
+	pretty_writer_params_t writer_params )
+{
+	rapidjson::OStreamWrapper wrapper{ to };
+	rapidjson::PrettyWriter< rapidjson::OStreamWrapper > writer{ wrapper };
+	writer.SetIndent(
+			writer_params.m_indent_char,
+			writer_params.m_indent_char_count );
+	writer.SetFormatOptions(
+			writer_params.m_format_options );
+
+	to_writer( writer, type );
+}
+
+//
+// SAX-based deserialization
+//
+
+namespace details
+{
+
+namespace sax_input
+{
+
+/*!
+ * @brief Parse JSON from @a stream directly into @a o.
  *
- * 	template<typename Io> void json_io(Io & io) {
- * 		io & json_dto::mandatory(
- * 				json_dto::inside_array::reader_writer< json_dto::inside_array::at_least<1> >(
- * 					// Mandatory member.
- * 					json_dto::inside_array::member(my_special_int_reader_writer{}, x.a),
- * 					// Optional member. Will be initialized by int{} if it's absent
- * 					// during deserialiaztion.
- * 					json_dto::inside_array::member(
- * 						my_special_int_reader_writer{},
- * 						x.d,
- * 						json_dto::one_of_constraint({2, 4, 6, 10, 20, 40})
- * 				),
- * 				"x", x )
- * 			;
- * 	}
- * };
- * @endcode
+ * @a source is the beginning of the text if @a stream reads it from
+ * memory. It allows raw_json_t fields to copy slices of the text.
  *
- * @attention
- * This function returns a temporary object that should not be stored anywhere and
- * must be passed directly to json_dto::inside_array::reader_writer().
+ * @since v.0.3.5
+ */
+template<
+	unsigned Rapidjson_Parseflags,
+	typename Input_Stream,
+	typename Type >
+void
+parse(
+	Input_Stream & stream,
+	Type & o,
+	const projection_t * projection = nullptr,
+	const char * source = nullptr )
+{
+	static_assert(
+			0u == ( Rapidjson_Parseflags & rapidjson::kParseInsituFlag ),
+			"kParseInsituFlag isn't supported by SAX-based input" );
+
+	context_t ctx;
+	ctx.set_projection( projection );
+	ctx.set_stream( stream );
+	if( source )
+		ctx.set_source( source );
+	ctx.frames().push< root_frame_t< Type > >( o );
+
+	handler_t handler{ ctx };
+	rapidjson::Reader reader;
+
+	const auto result =
+			reader.Parse< Rapidjson_Parseflags >( stream, handler );
+
+	handler.rethrow_if_failed( result.Offset() );
+	check_parse_result( result );
+}
+
+} /* namespace sax_input */
+
+} /* namespace details */
+
+//! Helper function to read an already instantiated DTO without
+//! building rapidjson::Document.
+/*!
+ * @note
+ * The state of @a o object is not defined if an error occurs.
+ *
+ * @since v.0.3.5
+ */
+template<
+	typename Type,
+	unsigned Rapidjson_Parseflags = rapidjson::kParseDefaultFlags >
+void
+from_json_sax(
+	//! Value to be parsed.
+	const string_ref_t & json,
+	//! The receiver of the extracted value.
+	Type & o )
+{
+	rapidjson::MemoryStream ms{ json.s, json.length };
+	rapidjson::EncodedInputStream< rapidjson::UTF8<>, rapidjson::MemoryStream > is{ ms };
+
+	details::sax_input::parse< Rapidjson_Parseflags >( is, o, nullptr, json.s );
+}
+
+//! Helper function to read an already instantiated DTO without
+//! building rapidjson::Document.
+/*!
+ * @note
+ * The state of @a o object is not defined if an error occurs.
+ *
+ * @since v.0.3.5
+ */
+template<
+	typename Type,
+	unsigned Rapidjson_Parseflags = rapidjson::kParseDefaultFlags >
+void
+from_json_sax(
+	//! Value to be parsed.
+	const std::string & json,
+	//! The receiver of the extracted value.
+	Type & o )
+{
+	from_json_sax< Type, Rapidjson_Parseflags >( make_string_ref(json), o );
+}
+
+//! Helper function to read an already instantiated DTO without
+//! building rapidjson::Document.
+/*!
+ * @note
+ * The state of @a o object is not defined if an error occurs.
  *
- * @since v.0.3.3
+ * @since v.0.3.5
  */
 template<
-	typename Reader_Writer,
-	typename Field_Type,
-	typename Validator = empty_validator_t >
-JSON_DTO_NODISCARD
-auto
-member(
-	Reader_Writer && reader_writer,
-	Field_Type & field,
-	Validator validator = Validator{} )
+	typename Type,
+	unsigned Rapidjson_Parseflags = rapidjson::kParseDefaultFlags >
+void
+from_json_sax(
+	//! Value to be parsed.
+	const char * json,
+	//! The receiver of the extracted value.
+	Type & o )
 {
-	return details::simplest_member_processor_t<
-			Field_Type,
-			Reader_Writer,
-			Validator
-		>( field, std::forward<Reader_Writer>(reader_writer), std::move(validator) );
+	from_json_sax< Type, Rapidjson_Parseflags >( make_string_ref(json), o );
 }
 
 /*!
- * @brief A special function that describes one member of an array
- * representation.
- *
- * Allows to specify a custom reader-writer for (de)serialization of the member.
+ * @brief Helper function to read only selected fields of an already
+ * instantiated DTO without building rapidjson::Document.
  *
- * Allows to specify a default value if item is not present in an array
- * on deserialization.
+ * Members of the top-level JSON object that aren't listed in
+ * @a projection are skipped by the parser, binders for fields that
+ * aren't listed are ignored.
  *
  * Usage example:
  * @code
- * struct my_special_int_reader_writer {...};
- *
- * struct inner {
- * 	int a;
- * 	int b;
- * };
- *
- * struct outer {
- * 	inner x;
- *
- * 	template<typename Io> void json_io(Io & io) {
- * 		io & json_dto::mandatory(
- * 				json_dto::inside_array::reader_writer< json_dto::inside_array::at_least<1>(
- * 					// Mandatory member.
- * 					json_dto::inside_array::member(my_special_int_reader_writer{}, x.a),
- * 					// Optional member. It will be initialized by 5 if it's absent during
- * 					// deserialization.
- * 					json_dto::inside_array::member_with_default_value(
- * 						my_special_int_reader_writer{},
- * 						x.b, 5),
- * 				),
- * 				"x", x )
- * 			;
- * 	}
- * };
+ * event_t event;
+ * json_dto::from_json_sax( json, event, json_dto::projection_t{ "id", "time" } );
  * @endcode
  *
  * @note
- * This overload is used when the default value is represented as ordinary
- * const- or non-const reference. A copy of default value will be made if the member
- * is missing during deserialization.
- * For example:
- * @code
- * struct my_special_some_complex_type_reader_writer {...}
- *
- * struct inner {
- * 	int a;
- * 	some_complex_type b;
- * 	...
- *
- * 	static const some_complex_type default_b;
- * };
- * const some_complex_type inner::default_b{...};
- *
- * struct outer {
- * 	inner x;
- *
- * 	template<typename Io> void json_io(Io & io) {
- * 		io & json_dto::mandatory(
- * 				json_dto::inside_array::reader_writer< json_dto::inside_array::at_least<1>(
- * 					// Mandatory member.
- * 					json_dto::inside_array::member(x.a),
- * 					// Optional member. A copy of inner::default_b will be made if
- * 					// inner::b is missing during deserialization.
- * 					json_dto::inside_array::member_with_default_value(
- * 						my_special_some_complex_type_reader_writer{},
- * 						x.b,
- * 						inner::default_b),
- * 				),
- * 				"x", x )
- * 			;
- * };
- * @endcode
- *
- * @attention
- * This function returns a temporary object that should not be stored anywhere and
- * must be passed directly to json_dto::inside_array::reader_writer().
+ * The state of @a o object is not defined if an error occurs.
  *
- * @since v.0.3.3
+ * @since v.0.3.5
  */
 template<
-	typename Reader_Writer,
-	typename Field_Type,
-	typename Validator = empty_validator_t >
-JSON_DTO_NODISCARD
-auto
-member_with_default_value(
-	Reader_Writer && reader_writer,
-	Field_Type & field,
-	const Field_Type & default_value,
-	Validator validator = Validator{} )
+	typename Type,
+	unsigned Rapidjson_Parseflags = rapidjson::kParseDefaultFlags >
+void
+from_json_sax(
+	//! Value to be parsed.
+	const string_ref_t & json,
+	//! The receiver of the extracted value.
+	Type & o,
+	//! Fields to be read.
+	const projection_t & projection )
 {
-	using default_holder_t = details::default_value_const_ref_holder_t<Field_Type>;
+	rapidjson::MemoryStream ms{ json.s, json.length };
+	rapidjson::EncodedInputStream< rapidjson::UTF8<>, rapidjson::MemoryStream > is{ ms };
 
-	return details::member_with_default_value_processor_t<
-			Field_Type,
-			default_holder_t,
-			Reader_Writer,
-			Validator
-		>( field,
-				default_holder_t{ default_value },
-				std::forward<Reader_Writer>(reader_writer),
-				std::move(validator) );
+	details::sax_input::parse< Rapidjson_Parseflags >(
+			is, o, &projection, json.s );
 }
 
 /*!
- * @brief A special function that describes one member of an array
- * representation.
+ * @brief Helper function to read only selected fields of an already
+ * instantiated DTO without building rapidjson::Document.
  *
- * Allows to specify a custom reader-writer for (de)serialization of the member.
+ * @since v.0.3.5
+ */
+template<
+	typename Type,
+	unsigned Rapidjson_Parseflags = rapidjson::kParseDefaultFlags >
+void
+from_json_sax(
+	//! Value to be parsed.
+	const std::string & json,
+	//! The receiver of the extracted value.
+	Type & o,
+	//! Fields to be read.
+	const projection_t & projection )
+{
+	from_json_sax< Type, Rapidjson_Parseflags >(
+			make_string_ref(json), o, projection );
+}
+
+/*!
+ * @brief Helper function to read only selected fields of an already
+ * instantiated DTO without building rapidjson::Document.
  *
- * Allows to specify a default value if item is not present in an array
- * on deserialization.
+ * @since v.0.3.5
+ */
+template<
+	typename Type,
+	unsigned Rapidjson_Parseflags = rapidjson::kParseDefaultFlags >
+void
+from_json_sax(
+	//! Value to be parsed.
+	const char * json,
+	//! The receiver of the extracted value.
+	Type & o,
+	//! Fields to be read.
+	const projection_t & projection )
+{
+	from_json_sax< Type, Rapidjson_Parseflags >(
+			make_string_ref(json), o, projection );
+}
+
+/*!
+ * @brief Helper function to read selected fields of DTO from json-string
+ * without building rapidjson::Document.
+ *
+ * Fields that aren't listed in @a projection keep values set by
+ * the default constructor of @a Type.
  *
  * Usage example:
  * @code
- * struct my_special_int_reader_writer {...};
- *
- * struct inner {
- * 	int a;
- * 	int b;
- * };
- *
- * struct outer {
- * 	inner x;
- *
- * 	template<typename Io> void json_io(Io & io) {
- * 		io & json_dto::mandatory(
- * 				json_dto::inside_array::reader_writer< json_dto::inside_array::at_least<1>(
- * 					// Mandatory member.
- * 					json_dto::inside_array::member(my_special_int_reader_writer{}, x.a),
- * 					// Optional member. It will be initialized by 5 if it's absent during
- * 					// deserialization.
- * 					json_dto::inside_array::member_with_default_value(
- * 						my_special_int_reader_writer{},
- * 						x.b, 5),
- * 				),
- * 				"x", x )
- * 			;
- * 	}
- * };
+ * const auto event = json_dto::from_json_sax< event_t >(
+ * 		json, json_dto::projection_t{ "id", "time" } );
  * @endcode
  *
- * @note
- * This overload is used when the default value is represented as a
- * rvalue-reference (that means that the default value is a temporary object).
- * The value of this temporary object wlll be moved into the member if the
- * member is missing during deserialization.
- * For example:
- * @code
- * struct my_special_some_complex_type_reader_writer {...}
+ * @since v.0.3.5
+ */
+template<
+	typename Type,
+	unsigned Rapidjson_Parseflags = rapidjson::kParseDefaultFlags >
+JSON_DTO_NODISCARD
+Type
+from_json_sax(
+	//! Value to be parsed.
+	const string_ref_t & json,
+	//! Fields to be read.
+	const projection_t & projection )
+{
+	Type result{};
+
+	from_json_sax< Type, Rapidjson_Parseflags >( json, result, projection );
+
+	return result;
+}
+
+/*!
+ * @brief Helper function to read selected fields of DTO from json-string
+ * without building rapidjson::Document.
  *
- * struct inner {
- * 	int a;
- * 	some_complex_type b;
- * 	...
- * };
+ * @since v.0.3.5
+ */
+template<
+	typename Type,
+	unsigned Rapidjson_Parseflags = rapidjson::kParseDefaultFlags >
+JSON_DTO_NODISCARD
+Type
+from_json_sax(
+	//! Value to be parsed.
+	const std::string & json,
+	//! Fields to be read.
+	const projection_t & projection )
+{
+	return from_json_sax< Type, Rapidjson_Parseflags >(
+			make_string_ref(json), projection );
+}
+
+/*!
+ * @brief Helper function to read selected fields of DTO from json-string
+ * without building rapidjson::Document.
  *
- * struct outer {
- * 	inner x;
+ * @since v.0.3.5
+ */
+template<
+	typename Type,
+	unsigned Rapidjson_Parseflags = rapidjson::kParseDefaultFlags >
+JSON_DTO_NODISCARD
+Type
+from_json_sax(
+	//! Value to be parsed.
+	const char * json,
+	//! Fields to be read.
+	const projection_t & projection )
+{
+	return from_json_sax< Type, Rapidjson_Parseflags >(
+			make_string_ref(json), projection );
+}
+
+/*!
+ * @brief Helper function to read DTO from json-string without
+ * building rapidjson::Document.
  *
- * 	template<typename Io> void json_io(Io & io) {
- * 		io & json_dto::mandatory(
- * 				json_dto::inside_array::reader_writer< json_dto::inside_array::at_least<1>(
- * 					// Mandatory member.
- * 					json_dto::inside_array::member(x.a),
- * 					// Optional member. The value of a temporary object will be moved
- * 					// into inner::b if inner::b is missing during deserialization.
- * 					json_dto::inside_array::member_with_default_value(
- * 						my_special_some_complex_type_reader_writer{},
- * 						x.b,
- * 						some_complex_type{...}),
- * 				),
- * 				"x", x )
- * 			;
- * };
+ * Events from rapidjson::Reader are passed directly to binders declared
+ * in json_io(). Manopt policies, validators and Reader_Writers work
+ * the same way as in the case of from_json(). Values with custom
+ * Reader_Writers (except apply_to_content_t), values of types with
+ * user-defined read_json_value and inside_array are collected into
+ * a temporary rapidjson::Value before reading.
+ *
+ * Usage example:
+ * @code
+ * auto msg = json_dto::from_json_sax< message_t >( json_str );
  * @endcode
  *
  * @attention
- * This function returns a temporary object that should not be stored anywhere and
- * must be passed directly to json_dto::inside_array::reader_writer().
+ * json_io() is called several times for every JSON object: when
+ * a value for a member is found and when the end of the object is
+ * reached. So json_io() has to declare the same binders in the same order
+ * every time and json_io() can't be a non-template function for
+ * json_input_t.
+ * A type with json_io() is deserialized via its json_io() even if
+ * there is an overload of read_json_value for that type.
  *
- * @since v.0.3.3
+ * @note
+ * Errors are detected during the parsing. If a JSON has several
+ * problems then the reported error can differ from the error reported
+ * by from_json(). For example, an invalid value of a field is reported
+ * even if there is a syntax error at the end of JSON.
+ *
+ * @note
+ * Type @a Type is required to be DefaultConstructible.
+ *
+ * @since v.0.3.5
  */
 template<
-	typename Reader_Writer,
-	typename Field_Type,
-	typename Validator = empty_validator_t >
+	typename Type,
+	unsigned Rapidjson_Parseflags = rapidjson::kParseDefaultFlags >
 JSON_DTO_NODISCARD
-auto
-member_with_default_value(
-	Reader_Writer && reader_writer,
-	Field_Type & field,
-	Field_Type && default_value,
-	Validator validator = Validator{} )
+Type
+from_json_sax(
+	//! Value to be parsed.
+	const string_ref_t & json )
 {
-	using default_holder_t = details::default_value_rvalue_ref_holder_t<Field_Type>;
+	Type result{};
 
-	return details::member_with_default_value_processor_t<
-			Field_Type,
-			default_holder_t,
-			Reader_Writer,
-			Validator
-		>( field,
-				default_holder_t{ std::move(default_value) },
-				std::forward<Reader_Writer>(reader_writer),
-				std::move(validator) );
-}
+	from_json_sax< Type, Rapidjson_Parseflags >( json, result );
 
-} /* namespace inside_array */
+	return result;
+}
 
-//
-// end of inside_array related stuff
-//
+//! Helper function to read DTO from json-string without
+//! building rapidjson::Document.
+/*!
+ * @note
+ * Type @a Type is required to be DefaultConstructible.
+ *
+ * @since v.0.3.5
+ */
+template<
+	typename Type,
+	unsigned Rapidjson_Parseflags = rapidjson::kParseDefaultFlags >
+JSON_DTO_NODISCARD
+Type
+from_json_sax(
+	//! Value to be parsed.
+	const std::string & json )
+{
+	return from_json_sax< Type, Rapidjson_Parseflags >( make_string_ref(json) );
+}
 
-//
-// binder_data_holder_t
-//
+//! Helper function to read DTO from json-string without
+//! building rapidjson::Document.
 /*!
- * @brief Type of holder of data required for field binder.
+ * @note
+ * Type @a Type is required to be DefaultConstructible.
  *
- * This type was introduced in v.0.2.12 as a part of the new customization
- * points for binder_t class. In previous versions of json-dto binder_t hold
- * all required data as direct members of binder_t template class. Since
- * v.0.2.12 all that data is moved into binder_data_holder_t template and
- * binder_t now just owns an instance of binder_data_holder_t. It allows a user
- * to make a specialization of binder_data_holder_t template for his/her own
- * data types.
+ * @since v.0.3.5
+ */
+template<
+	typename Type,
+	unsigned Rapidjson_Parseflags = rapidjson::kParseDefaultFlags >
+JSON_DTO_NODISCARD
+Type
+from_json_sax(
+	//! Value to be parsed.
+	const char * json )
+{
+	return from_json_sax< Type, Rapidjson_Parseflags >( make_string_ref(json) );
+}
+
+// Since v.0.3.5.
+template< typename T, typename Validator >
+void
+lazy_t< T, Validator >::decode() const
+{
+	T value;
+	if( const auto * dom = m_raw.value() )
+		default_reader_writer_t{}.read( value, *dom );
+	else
+		from_json_sax( m_raw.text(), value );
+
+	if( m_validator )
+		( *m_validator )( value );
+
+	m_value.emplace( std::move(value) );
+}
+
+//! Helper function to read an already instantiated DTO from a stream
+//! without building rapidjson::Document.
+/*!
+ * @note
+ * The state of @a o object is not defined if an error occurs.
  *
- * For example:
- * @code
-namespace some_project
+ * @since v.0.3.5
+ */
+template<
+	typename Type,
+	unsigned Rapidjson_Parseflags = rapidjson::kParseDefaultFlags >
+void
+from_stream_sax(
+	//! Source stream.
+	std::istream & from,
+	//! The receiver of the extracted value.
+	Type & o )
 {
+	rapidjson::IStreamWrapper wrapper{ from };
 
-// A special proxy for field that can only be serialized, but not deserialized.
-template< typename F >
-struct serialize_only_proxy_t
+	details::sax_input::parse< Rapidjson_Parseflags >( wrapper, o );
+}
+
+//! Helper function to read DTO from a stream without building
+//! rapidjson::Document.
+/*!
+ * @note
+ * Type @a Type is required to be DefaultConstructible.
+ *
+ * @since v.0.3.5
+ */
+template<
+	typename Type,
+	unsigned Rapidjson_Parseflags = rapidjson::kParseDefaultFlags >
+JSON_DTO_NODISCARD
+Type
+from_stream_sax(
+	//! Source stream.
+	std::istream & from )
 {
-	using field_type = const F;
+	Type result{};
+	from_stream_sax< Type, Rapidjson_Parseflags >( from, result );
 
-	const F * m_field;
-};
+	return result;
+}
 
-// Usage example:
-//
-// template< typename Json_Io >
-// void my_type::json_io(Json_Io & io) {
-// 	io & json_dto::mandatory("attr", some_project::serialize_only(attr_))
-// 		& ...
-// 		;
-// }
-template< typename F >
-serialize_only_proxy_t<F> serialize_only( const F & field ) noexcept
+//! Helper function to read an already instantiated DTO.
+/*!
+ * @note
+ * The state of @a o object is not defined if an error occurs.
+ */
+template< typename Type, unsigned Rapidjson_Parseflags = rapidjson::kParseDefaultFlags >
+void
+from_stream(
+	//! Source stream.
+	std::istream & from,
+	//! The receiver of the extracted value.
+	Type & o )
 {
-	return { &field };
+	// Since v.0.3.5.
+	// The document is destroyed on return, so string views aren't allowed.
+	details::string_view_check::check_value< Type >();
+
+	rapidjson::IStreamWrapper wrapper{ from };
+
+	rapidjson::Document document;
+	json_dto::json_input_t jin{ document };
+
+	document.ParseStream< Rapidjson_Parseflags >( wrapper );
+
+	check_document_parse_status( document );
+
+	const details::owned_read_t owned{ o, true };
+	jin >> o;
 }
 
-} // namespace some_project
+//! Helper function to read an already instantiated DTO with
+//! custom Reader-Writer.
+/*!
+ * @note
+ * The state of @a o object is not defined if an error occurs.
+ *
+ * @since v.0.3.4
+ */
+template<
+	typename Type,
+	typename Reader_Writer,
+	unsigned Rapidjson_Parseflags = rapidjson::kParseDefaultFlags >
+void
+from_stream(
+	//! Custom Reader_Writer to be used.
+	const Reader_Writer & reader_writer,
+	//! Source stream.
+	std::istream & from,
+	//! The receiver of the extracted value.
+	Type & o)
+{
+	rapidjson::IStreamWrapper wrapper{ from };
 
-// We have to specialize json_dto::binder_data_holder_t to store
-// the content of some_project::serialize_only_proxy_t instead of
-// a reference to serialize_only_proxy_t.
-namespace json_dto
+	rapidjson::Document document;
+	document.ParseStream< Rapidjson_Parseflags >( wrapper );
+	check_document_parse_status( document );
+
+	details::read_owned( reader_writer, o, document );
+}
+
+//! Helper function to read DTO from a stream.
+/*!
+ * @note
+ * Type @a Type is required to be DefaultConstructible.
+ */
+template< typename Type, unsigned Rapidjson_Parseflags = rapidjson::kParseDefaultFlags >
+JSON_DTO_NODISCARD
+Type
+from_stream(
+	//! Source stream.
+	std::istream & from )
 {
+	Type result;
+	from_stream< Type, Rapidjson_Parseflags >( from, result );
+
+	return result;
+}
 
+//! Helper function to read DTO from a stream with custom Reader-Writer.
+/*!
+ * @note
+ * Type @a Type is required to be DefaultConstructible.
+ *
+ * @since v.0.3.4
+ */
 template<
+	typename Type,
 	typename Reader_Writer,
-	typename Field_Type,
-	typename Manopt_Policy,
-	typename Validator >
-class binder_data_holder_t<
-		Reader_Writer,
-		// NOTE the usage of `const serialize_only_proxy_t`.
-		const some_project::serialize_only_proxy_t<Field_Type>,
-		Manopt_Policy,
-		Validator >
-	:	public binder_data_holder_t<
-			Reader_Writer,
-			typename some_project::serialize_only_proxy_t<Field_Type>::field_type,
-			Manopt_Policy,
-			Validator >
+	unsigned Rapidjson_Parseflags = rapidjson::kParseDefaultFlags >
+JSON_DTO_NODISCARD
+Type
+from_stream(
+	//! Custom Reader_Writer to be used.
+	const Reader_Writer & reader_writer,
+	//! Source stream.
+	std::istream & from )
+{
+	Type result;
+	from_stream< Type, Reader_Writer, Rapidjson_Parseflags >(
+			reader_writer, from, result );
+
+	return result;
+}
+
+//
+// Reusable parse context
+//
+
+namespace details
+{
+
+/*!
+ * @brief Allocator for RapidJSON's stacks that keeps memory between uses.
+ *
+ * Stacks of documents, readers and writers release their memory via
+ * static Free() and allocate it again next time. This allocator gives
+ * them the same blocks every time (in the order of requests after
+ * reset()) and releases blocks only in the destructor.
+ *
+ * @since v.0.3.5
+ */
+class retained_stack_allocator_t
 {
-	using serialize_only_proxy =
-			some_project::serialize_only_proxy_t<Field_Type>;
+public:
+	static const bool kNeedFree = false;
 
-	using actual_field_type = typename serialize_only_proxy::field_type;
+	retained_stack_allocator_t() = default;
+	retained_stack_allocator_t( const retained_stack_allocator_t & ) = delete;
+	retained_stack_allocator_t &
+	operator=( const retained_stack_allocator_t & ) = delete;
 
-	using base_type = binder_data_holder_t<
-			Reader_Writer,
-			actual_field_type,
-			Manopt_Policy,
-			Validator >;
+	~retained_stack_allocator_t()
+	{
+		for( auto & b : m_blocks )
+			std::free( b.m_data );
+	}
 
-public:
-	binder_data_holder_t(
-		Reader_Writer && reader_writer,
-		string_ref_t field_name,
-		const serialize_only_proxy & proxy,
-		Manopt_Policy && manopt_policy,
-		Validator && validator )
-		:	base_type{
-				std::move(reader_writer),
-				field_name,
-				// Passing an actual reference to the field.
-				*(proxy.m_field),
-				std::move(manopt_policy),
-				std::move(validator)
+	//! Make all blocks available for the next use.
+	void
+	reset() noexcept { m_used = 0u; }
+
+	//! Count of allocations and reallocations of blocks.
+	std::size_t
+	allocations() const noexcept { return m_allocations; }
+
+	//! Total size of blocks.
+	std::size_t
+	retained() const noexcept
+	{
+		std::size_t result = 0u;
+		for( const auto & b : m_blocks )
+			result += b.m_capacity;
+
+		return result;
+	}
+
+	void *
+	Malloc( std::size_t size )
+	{
+		if( !size )
+			return nullptr;
+
+		if( m_used == m_blocks.size() )
+			m_blocks.push_back( block_t{} );
+
+		auto & b = m_blocks[ m_used++ ];
+		ensure_capacity( b, size );
+
+		return b.m_data;
+	}
+
+	void *
+	Realloc( void * original, std::size_t original_size, std::size_t new_size )
+	{
+		if( !original )
+			return Malloc( new_size );
+
+		for( std::size_t i = 0u; i != m_used; ++i )
+		{
+			auto & b = m_blocks[ i ];
+			if( original == b.m_data )
+			{
+				ensure_capacity( b, new_size );
+				return b.m_data;
 			}
-	{} // The `proxy` parameter is no more needed and isn't used any more.
-};
+		}
 
-} // namespace json_dto
+		// Shouldn't happen: the memory isn't from this allocator.
+		auto * result = Malloc( new_size );
+		std::memcpy( result, original, std::min( original_size, new_size ) );
 
-struct my_data
-{
-	const int version_{1};
-	...
-	template<typename Json_Io>
-	void json_io(Json_Io & io)
+		return result;
+	}
+
+	static void
+	Free( void * ) noexcept {}
+
+private:
+	struct block_t
 	{
-		io
-			// Now binder_t for `version_` field will contain
-			// a specialized version of binder_data_holder_t.
-			& json_dto::mandatory("version",
-					some_project::serialize_only(version_))
-			& ...
-			;
+		void * m_data{ nullptr };
+		std::size_t m_capacity{ 0u };
+	};
+
+	std::vector< block_t > m_blocks;
+	//! Count of blocks given since the last reset().
+	std::size_t m_used{ 0u };
+	std::size_t m_allocations{ 0u };
+
+	void
+	ensure_capacity( block_t & b, std::size_t size )
+	{
+		if( b.m_capacity < size )
+		{
+			// The content is kept by realloc. It's required by Realloc().
+			auto * data = std::realloc( b.m_data, size );
+			if( !data )
+				throw std::bad_alloc{};
+
+			b.m_data = data;
+			b.m_capacity = size;
+			++m_allocations;
+		}
 	}
 };
- * @endcode
- *
- * @attention
- * A specialization of binder_data_holder_t should define type name
- * `field_t` (see example in the code of binder_data_holder_t template).
- *
- * @note
- * All getters are const-methods because binder_t access them via
- * a const reference to binder_data_holder_t instance.
- *
- * @note
- * Methods field_for_serialization() and field_for_deserialization()
- * return just `Field_Type &` because the current versions of
- * Manopt_Policy implementations (like mandatory_attr_t, optional_attr_t,
- * and so on) accept `Field_Type &`. Some future versions of json-dto
- * can get different return types for field_for_serialization() and
- * field_for_deserialization().
- *
- * @tparam Reader_Writer type of reader_writer object to be used for
- * serializing/deserializing the field.
- *
- * @tparam Field_Type type of the field to be (de)serialized.
- *
- * @tparam Manopt_Policy type of object for handling mandatory/optional
- * policy for the field. It is expected to be mandatory_attr_t,
- * optional_attr_t, optional_attr_null_t, or optional_nodefault_attr_t.
+
+/*!
+ * @brief A document whose values are placed into a retained buffer.
  *
- * @tparam Validator type of object for checking the validity of
- * the field valued (check is performed before serialization and just
- * after deserialization).
+ * If values of a document don't fit into the buffer, they are placed
+ * into additional chunks, and the buffer is enlarged by the next reset().
+ * So after a few similar documents memory isn't allocated at all.
  *
- * @since v.0.2.12
+ * @since v.0.3.5
  */
-template<
-	typename Reader_Writer,
-	typename Field_Type,
-	typename Manopt_Policy,
-	typename Validator >
-class binder_data_holder_t
+template< typename Stack_Allocator >
+class pooled_document_t
 {
-		Reader_Writer m_reader_writer;
-		string_ref_t m_field_name;
-		Field_Type & m_field;
-		Manopt_Policy m_manopt_policy;
-		Validator m_validator;
+public:
+	using allocator_t = rapidjson::MemoryPoolAllocator<>;
+	using document_t = rapidjson::GenericDocument<
+			rapidjson::UTF8<>, allocator_t, Stack_Allocator >;
+
+	//! RapidJSON requires space for a chunk header in a user buffer.
+	static constexpr std::size_t min_chunk_size = 256u;
+
+	pooled_document_t(
+		std::size_t chunk_size,
+		std::size_t stack_capacity,
+		Stack_Allocator * stack_allocator )
+		:	m_chunk_size{ std::max( chunk_size, std::size_t{ min_chunk_size } ) }
+		,	m_stack_capacity{ stack_capacity }
+		,	m_stack_allocator{ stack_allocator }
+	{
+		m_storage = make_storage( m_chunk_size );
+	}
 
-	public:
-		using field_t = Field_Type;
+	//! Make the document empty.
+	document_t &
+	reset()
+	{
+		if( overflowed() )
+		{
+			// The buffer is enlarged to hold all values of the previous
+			// document. Its memory is released before the allocation.
+			const auto buffer_size =
+					m_storage->m_allocator.Capacity() + m_chunk_size;
 
-		binder_data_holder_t(
-			Reader_Writer && reader_writer,
-			string_ref_t field_name,
-			Field_Type & field,
-			Manopt_Policy && manopt_policy,
-			Validator && validator )
-			:	m_reader_writer{ std::move(reader_writer) }
-			,	m_field_name{ field_name }
-			,	m_field{ field }
-			,	m_manopt_policy{ std::move( manopt_policy ) }
-			,	m_validator{ std::move( validator ) }
-		{}
+			m_storage.reset();
+			m_storage = make_storage( buffer_size );
+		}
+		else
+		{
+			m_storage->m_document.SetNull();
+			m_storage->m_allocator.Clear();
+		}
 
-		const Reader_Writer &
-		reader_writer() const noexcept { return m_reader_writer; }
+		return m_storage->m_document;
+	}
 
-		const string_ref_t &
-		field_name() const noexcept { return m_field_name; }
+	document_t &
+	document() noexcept { return m_storage->m_document; }
 
-		Field_Type &
-		field_for_serialization() const noexcept { return m_field; }
+	//! Are some values placed outside of the buffer?
+	bool
+	overflowed() const
+	{
+		return m_storage->m_allocator.Capacity() > m_storage->m_capacity;
+	}
 
-		Field_Type &
-		field_for_deserialization() const noexcept { return m_field; }
+	std::size_t
+	chunk_size() const noexcept { return m_chunk_size; }
 
-		const Manopt_Policy &
-		manopt_policy() const noexcept { return m_manopt_policy; }
+	//! Bytes occupied by values of the document.
+	std::size_t
+	bytes_in_use() const { return m_storage->m_allocator.Size(); }
 
-		const Validator &
-		validator() const noexcept { return m_validator; }
-};
+	std::size_t
+	buffer_size() const noexcept { return m_storage->m_buffer_size; }
 
-//
-// binder_read_from_implementation_t
-//
-/*!
- * @brief Type that provides the default implementation of read_from
- * operation for a binder.
- *
- * This type was introduced in v.0.2.12 as a part of the new customization
- * points for binder_t class. In previous versions of json-dto binder_t
- * performed read_from operation by itself. Now it delegates this operation
- * to static method of binder_read_from_implementation_t template.
- * It allows a user to write own specialization of
- * binder_read_from_implementation_t template for his/her types.
- *
- * For example:
- * @code
-namespace some_project
-{
+	//! Count of buffers allocated since the creation.
+	std::size_t
+	buffers_allocated() const noexcept { return m_buffers_allocated; }
 
-template< typename F >
-struct ignore_after_deserialization_proxy_t
-{
-	using field_type = const F;
+private:
+	struct storage_t
+	{
+		storage_t(
+			std::size_t buffer_size,
+			std::size_t chunk_size,
+			std::size_t stack_capacity,
+			Stack_Allocator * stack_allocator )
+			:	m_buffer_size{ buffer_size }
+			,	m_buffer{ new char[ buffer_size ] }
+			,	m_allocator{ m_buffer.get(), buffer_size, chunk_size }
+			,	m_capacity{ m_allocator.Capacity() }
+			,	m_document{ &m_allocator, stack_capacity, stack_allocator }
+		{}
 
-	const F * m_field;
-};
+		const std::size_t m_buffer_size;
+		std::unique_ptr< char[] > m_buffer;
+		allocator_t m_allocator;
+		const std::size_t m_capacity;
+		document_t m_document;
+	};
 
-template< typename F >
-ignore_after_deserialization_proxy_t<F>
-ignore_after_deserialization( const F & field ) noexcept
-{
-	return { &field };
-}
+	const std::size_t m_chunk_size;
+	const std::size_t m_stack_capacity;
+	Stack_Allocator * const m_stack_allocator;
+	std::unique_ptr< storage_t > m_storage;
+	std::size_t m_buffers_allocated{ 0u };
 
-} // namespace some_project
+	std::unique_ptr< storage_t >
+	make_storage( std::size_t buffer_size )
+	{
+		std::unique_ptr< storage_t > storage{ new storage_t{
+				buffer_size,
+				m_chunk_size,
+				m_stack_capacity,
+				m_stack_allocator } };
 
-// We have to specialize json_dto::binder_data_holder_t to store
-// the content of some_project::ignore_after_deserialization_proxy_t instead of
-// a reference to ignore_after_deserialization_proxy_t.
-// We also have to specialize json_dto::binder_read_from_implementation_t
-// for right handling of some_project::ignore_after_deserialization_proxy_t.
-namespace json_dto
-{
-template<
-	typename Reader_Writer,
-	typename Field_Type,
-	typename Manopt_Policy,
-	typename Validator >
-class binder_data_holder_t<
-		Reader_Writer,
-		const some_project::ignore_after_deserialization_proxy_t<Field_Type>,
-		Manopt_Policy,
-		Validator >
+		++m_buffers_allocated;
+
+		return storage;
+	}
+};
+
+} /* namespace details */
+
+//! Statistics of a parse_context_t.
+/*!
+ * @since v.0.3.5
+ */
+struct parse_context_stats_t
 {
-	...
+	//! Count of parsed documents.
+	std::size_t m_documents{};
+	//! Bytes occupied by values of the last parsed document.
+	std::size_t m_bytes_in_use{};
+	//! Bytes retained by the context between parsings.
+	std::size_t m_bytes_retained{};
+	//! Count of chunks allocated for the retained memory.
+	std::size_t m_chunks_allocated{};
+	//! Count of parsings that required memory beyond the retained one.
+	/*!
+	 * The retained memory is enlarged before the next parsing
+	 * after such a parsing.
+	 */
+	std::size_t m_overflows{};
 };
 
-template<
-	typename Reader_Writer,
-	typename Field_Type,
-	typename Manopt_Policy,
-	typename Validator >
-struct binder_read_from_implementation_t<
-		binder_data_holder_t<
-			Reader_Writer,
-			const some_project::ignore_after_deserialization_proxy_t<Field_Type>,
-			Manopt_Policy,
-			Validator
-		>
-	>
+/*!
+ * @brief A context for parsing of a series of JSON documents.
+ *
+ * Every from_json() and from_stream() function without a context
+ * creates a new rapidjson::Document. Memory for its values and for its
+ * parse stack is allocated during parsing and deallocated after it.
+ *
+ * parse_context_t owns a document and memory for values and for the
+ * parse stack and reuses all of them for every next parsing. When some
+ * parsing requires more memory than the context has, the memory is
+ * enlarged, so after a few parsings of similar documents there are no
+ * memory allocations at all.
+ *
+ * Usage example:
+ * @code
+ * json_dto::parse_context_t ctx;
+ * for( const auto & message : incoming_messages )
+ * {
+ * 	some_data data;
+ * 	json_dto::from_json( ctx, message, data );
+ * 	...
+ * }
+ * @endcode
+ *
+ * @attention
+ * The document obtained from parse() is valid until the next parsing
+ * by the same context. The context is not thread-safe.
+ *
+ * @since v.0.3.5
+ */
+class parse_context_t
 {
-	using proxy_type = some_project::ignore_after_deserialization_proxy_t<Field_Type>;
+public:
+	//! The default size of memory for values and of additional chunks.
+	static constexpr std::size_t default_chunk_size = 64u * 1024u;
+	//! The default initial capacity of the parse stack.
+	static constexpr std::size_t default_stack_capacity = 1024u;
 
-	using data_holder_t = binder_data_holder_t<
-			Reader_Writer,
-			const proxy_type,
-			Manopt_Policy,
-			Validator >;
+	/*!
+	 * @param chunk_size The initial size of memory for values. It's also
+	 * the size of chunks allocated if a document doesn't fit into it.
+	 * @param stack_capacity The initial capacity of the parse stack.
+	 */
+	explicit parse_context_t(
+		std::size_t chunk_size = default_chunk_size,
+		std::size_t stack_capacity = default_stack_capacity )
+		:	m_values{ chunk_size, stack_capacity, &m_stack_allocator }
+	{
+		update_memory_stats();
+	}
+
+	parse_context_t( const parse_context_t & ) = delete;
+	parse_context_t & operator=( const parse_context_t & ) = delete;
+
+	//! Parse a JSON string.
+	/*!
+	 * @throw ex_t if the string is not a valid JSON.
+	 *
+	 * @return The parsed document. It's valid until the next parsing.
+	 */
+	template< unsigned Rapidjson_Parseflags = rapidjson::kParseDefaultFlags >
+	const rapidjson::Value &
+	parse( const string_ref_t & json )
+	{
+		auto & document = prepare();
+		document.Parse< Rapidjson_Parseflags >( json.s, json.length );
 
-	static void
-	read_from(
-		const data_holder_t & binder_data,
-		const rapidjson::Value & object )
+		return complete();
+	}
+
+	//! Parse a JSON from a RapidJSON's input stream.
+	/*!
+	 * @throw ex_t if the stream doesn't contain a valid JSON.
+	 *
+	 * @return The parsed document. It's valid until the next parsing.
+	 */
+	template<
+		unsigned Rapidjson_Parseflags = rapidjson::kParseDefaultFlags,
+		typename Input_Stream >
+	const rapidjson::Value &
+	parse_stream( Input_Stream & stream )
 	{
-		if( !object.IsObject() )
-		{
-			throw ex_t{
-				"unable to extract field \"" +
-				std::string{ binder_data.field_name().s } + "\": "
-				"parent json type must be object" };
-		}
+		auto & document = prepare();
+		document.ParseStream< Rapidjson_Parseflags >( stream );
 
-		// Temporary object for holding deserialized value.
-		Field_Type tmp_object{};
+		return complete();
+	}
 
-		const auto it = object.FindMember( binder_data.field_name() );
+	//! Size of chunks.
+	std::size_t
+	chunk_size() const noexcept { return m_values.chunk_size(); }
 
-		if( object.MemberEnd() != it )
-		{
-			const auto & value = it->value;
+	//! Statistics of the context.
+	const parse_context_stats_t &
+	stats() const noexcept { return m_stats; }
 
-			if( !value.IsNull() )
-			{
-				binder_data.reader_writer().read( tmp_object, value );
-			}
-			else
-			{
-				binder_data.manopt_policy.on_null( tmp_object );
-			}
-		}
-		else
-		{
-			binder_data.manopt_policy().on_field_not_defined( tmp_object );
-		}
+private:
+	using document_t =
+			details::pooled_document_t< details::retained_stack_allocator_t >::document_t;
 
-		binder_data.validator()( tmp_object ); // validate value.
+	parse_context_stats_t m_stats;
+	details::retained_stack_allocator_t m_stack_allocator;
+	details::pooled_document_t< details::retained_stack_allocator_t > m_values;
+	//! Count of stack allocations before the current parsing.
+	std::size_t m_stack_allocations_before{ 0u };
 
-		// NOTE: the value from tmp_object will be lost.
+	void
+	update_memory_stats() noexcept
+	{
+		m_stats.m_bytes_retained =
+				m_values.buffer_size() + m_stack_allocator.retained();
+		m_stats.m_chunks_allocated =
+				m_values.buffers_allocated() + m_stack_allocator.allocations();
 	}
-};
 
-} // namespace json_dto
+	//! Make the document empty before the next parsing.
+	document_t &
+	prepare()
+	{
+		auto & document = m_values.reset();
 
-// Now we can use some_project::ignore_after_deserialization() in json_io().
-struct my_data
-{
-	const int version_{1};
-	...
-	template<typename Json_Io>
-	void json_io(Json_Io & io)
+		m_stack_allocator.reset();
+		m_stack_allocations_before = m_stack_allocator.allocations();
+
+		return document;
+	}
+
+	//! Update statistics and check the result of the parsing.
+	const rapidjson::Value &
+	complete()
 	{
-		io
-			// Now binder_t for `version_` field will contain
-			// a specialized version of binder_data_holder_t.
-			& json_dto::mandatory("version",
-					some_project::ignore_after_deserialization(version_),
-					// NOTE: validators will be applied to deserialized value.
-					json_dto::min_max_constraint(1,3))
-			& ...
-			;
+		const auto & document = m_values.document();
+
+		++m_stats.m_documents;
+		m_stats.m_bytes_in_use = m_values.bytes_in_use();
+		update_memory_stats();
+		if( m_values.overflowed() ||
+				m_stack_allocations_before != m_stack_allocator.allocations() )
+			++m_stats.m_overflows;
+
+		check_parse_result( rapidjson::ParseResult{
+				document.GetParseError(), document.GetErrorOffset() } );
+
+		return document;
 	}
 };
- * @endcode
+
+//! Helper function to read an already instantiated DTO by using
+//! a parse context.
+/*!
+ * @note
+ * The state of @a o object is not defined if an error occurs.
  *
- * @since v.0.2.12
+ * @since v.0.3.5
  */
-template< typename Binder_Data_Holder >
-struct binder_read_from_implementation_t
+template<
+	typename Type,
+	unsigned Rapidjson_Parseflags = rapidjson::kParseDefaultFlags >
+void
+from_json(
+	//! Context for parsing.
+	parse_context_t & context,
+	//! Value to be parsed.
+	const string_ref_t & json,
+	//! The receiver of the extracted value.
+	Type & o )
 {
-	static void
-	read_from(
-		const Binder_Data_Holder & binder_data,
-		const rapidjson::Value & object )
-	{
-		static_assert(
-				!std::is_const<typename Binder_Data_Holder::field_t>::value,
-				"const object can't be deserialized" );
+	from_json( context.parse< Rapidjson_Parseflags >( json ), o );
+}
 
-		if( !object.IsObject() )
-		{
-			throw ex_t{
-				"unable to extract field \"" +
-				std::string{ binder_data.field_name().s } + "\": "
-				"parent json type must be object" };
-		}
+//! Helper function to read an already instantiated DTO by using
+//! a parse context.
+/*!
+ * @note
+ * The state of @a o object is not defined if an error occurs.
+ *
+ * @since v.0.3.5
+ */
+template<
+	typename Type,
+	unsigned Rapidjson_Parseflags = rapidjson::kParseDefaultFlags >
+void
+from_json(
+	//! Context for parsing.
+	parse_context_t & context,
+	//! Value to be parsed.
+	const std::string & json,
+	//! The receiver of the extracted value.
+	Type & o )
+{
+	from_json< Type, Rapidjson_Parseflags >(
+			context, make_string_ref( json ), o );
+}
 
-		const auto it = object.FindMember( binder_data.field_name() );
+//! Helper function to read an already instantiated DTO by using
+//! a parse context.
+/*!
+ * This version reads the JSON content from a raw char pointer
+ * (it's assumed that it is a null-terminated string).
+ *
+ * @note
+ * The state of @a o object is not defined if an error occurs.
+ *
+ * @since v.0.3.5
+ */
+template<
+	typename Type,
+	unsigned Rapidjson_Parseflags = rapidjson::kParseDefaultFlags >
+void
+from_json(
+	//! Context for parsing.
+	parse_context_t & context,
+	//! Value to be parsed.
+	const char * json,
+	//! The receiver of the extracted value.
+	Type & o )
+{
+	from_json< Type, Rapidjson_Parseflags >(
+			context, make_string_ref( json ), o );
+}
 
-		if( object.MemberEnd() != it )
-		{
-			const auto & value = it->value;
+//! Helper function to read DTO by using a parse context.
+/*!
+ * @note
+ * Type @a Type is required to be DefaultConstructible.
+ *
+ * @since v.0.3.5
+ */
+template<
+	typename Type,
+	unsigned Rapidjson_Parseflags = rapidjson::kParseDefaultFlags >
+JSON_DTO_NODISCARD
+Type
+from_json(
+	//! Context for parsing.
+	parse_context_t & context,
+	//! Value to be parsed.
+	const string_ref_t & json )
+{
+	Type result{};
+	from_json< Type, Rapidjson_Parseflags >( context, json, result );
 
-			if( !value.IsNull() )
-			{
-				binder_data.reader_writer().read(
-						binder_data.field_for_deserialization(), value );
-			}
-			else
-			{
-				binder_data.manopt_policy().on_null(
-						binder_data.field_for_deserialization() );
-			}
-		}
-		else
-		{
-			binder_data.manopt_policy().on_field_not_defined(
-					binder_data.field_for_deserialization() );
-		}
+	return result;
+}
 
-		binder_data.validator()(
-				binder_data.field_for_deserialization() ); // validate value.
-	}
-};
+//! Helper function to read DTO by using a parse context.
+/*!
+ * @note
+ * Type @a Type is required to be DefaultConstructible.
+ *
+ * @since v.0.3.5
+ */
+template<
+	typename Type,
+	unsigned Rapidjson_Parseflags = rapidjson::kParseDefaultFlags >
+JSON_DTO_NODISCARD
+Type
+from_json(
+	//! Context for parsing.
+	parse_context_t & context,
+	//! Value to be parsed.
+	const std::string & json )
+{
+	return from_json< Type, Rapidjson_Parseflags >(
+			context, make_string_ref( json ) );
+}
 
-//
-// binder_write_to_implementation_t
-//
+//! Helper function to read DTO by using a parse context.
 /*!
- * @brief Type that provides the default implementation of write_to
- * operation for a binder.
+ * This version reads the JSON content from a raw char pointer
+ * (it's assumed that it is a null-terminated string).
  *
- * This type was introduced in v.0.2.12 as a part of the new customization
- * points for binder_t class. In previous versions of json-dto binder_t
- * performed write_to operation by itself. Now it delegates this operation
- * to static method of binder_write_to_implementation_t template.
- * It allows a user to write own specialization of
- * binder_write_to_implementation_t template for his/her types.
+ * @note
+ * Type @a Type is required to be DefaultConstructible.
  *
- * For example:
- * @code
-namespace some_project
+ * @since v.0.3.5
+ */
+template<
+	typename Type,
+	unsigned Rapidjson_Parseflags = rapidjson::kParseDefaultFlags >
+JSON_DTO_NODISCARD
+Type
+from_json(
+	//! Context for parsing.
+	parse_context_t & context,
+	//! Value to be parsed.
+	const char * json )
 {
+	return from_json< Type, Rapidjson_Parseflags >(
+			context, make_string_ref( json ) );
+}
 
-template< typename F >
-struct deserialize_only_proxy_t
+//! Helper function to read an already instantiated DTO from a stream
+//! by using a parse context.
+/*!
+ * @note
+ * The state of @a o object is not defined if an error occurs.
+ *
+ * @since v.0.3.5
+ */
+template<
+	typename Type,
+	unsigned Rapidjson_Parseflags = rapidjson::kParseDefaultFlags >
+void
+from_stream(
+	//! Context for parsing.
+	parse_context_t & context,
+	//! Source stream.
+	std::istream & from,
+	//! The receiver of the extracted value.
+	Type & o )
 {
-	using field_type = F;
+	rapidjson::IStreamWrapper wrapper{ from };
 
-	F * m_field;
-};
+	from_json( context.parse_stream< Rapidjson_Parseflags >( wrapper ), o );
+}
 
-template< typename F >
-deserialize_only_proxy_t<F> deserialize_only( F & field ) noexcept
-{
-	static_assert( !std::is_const<F>::value,
-			"deserialize_only can't be used with const objects" );
+//! Helper function to read DTO from a stream by using a parse context.
+/*!
+ * @note
+ * Type @a Type is required to be DefaultConstructible.
+ *
+ * @since v.0.3.5
+ */
+template<
+	typename Type,
+	unsigned Rapidjson_Parseflags = rapidjson::kParseDefaultFlags >
+JSON_DTO_NODISCARD
+Type
+from_stream(
+	//! Context for parsing.
+	parse_context_t & context,
+	//! Source stream.
+	std::istream & from )
+{
+	Type result{};
+	from_stream< Type, Rapidjson_Parseflags >( context, from, result );
 
-	return { &field };
+	return result;
 }
 
-} // namespace some_project
+//
+// Reusable serializer
+//
 
-// We have to specialize json_dto::binder_data_holder_t to store
-// the content of some_project::deserialize_only_proxy_t instead of
-// a reference to deserialize_only_proxy_t.
-// We also have to specialize json_dto::binder_write_to_implementation_t
-// for right handling of some_project::deserialize_only_proxy_t.
-namespace json_dto
+/*!
+ * @brief A serializer for a series of objects.
+ *
+ * Every to_json() call creates a new rapidjson::Document and a new
+ * string for the result. serializer_t keeps memory for values of its
+ * document and its output buffer between calls, so after a few calls
+ * for similar objects there are no memory allocations at all.
+ *
+ * The result is the same as the result of to_json() for the same object
+ * and the same parameters.
+ *
+ * Usage example:
+ * @code
+ * json_dto::serializer_t serializer;
+ * for( const auto & reply : replies )
+ * {
+ * 	// The result is valid until the next call.
+ * 	const std::string & json = serializer.to_json( reply );
+ * 	send( json.data(), json.size() );
+ * }
+ *
+ * // Append the representation to a caller-owned string.
+ * std::string response = make_headers();
+ * serializer.to_json_append( response, some_reply );
+ * @endcode
+ *
+ * @attention
+ * The serializer is not thread-safe.
+ *
+ * @since v.0.3.5
+ */
+class serializer_t
 {
+public:
+	//! The default size of memory for values and of additional chunks.
+	static constexpr std::size_t default_chunk_size = 64u * 1024u;
 
-template<
-	typename Reader_Writer,
-	typename Field_Type,
-	typename Manopt_Policy,
-	typename Validator >
-class binder_data_holder_t<
-		Reader_Writer,
-		const some_project::deserialize_only_proxy_t<Field_Type>,
-		Manopt_Policy,
-		Validator >
-{
-	...
-};
+	/*!
+	 * @param chunk_size The initial size of memory for values. It's also
+	 * the size of chunks allocated if a document doesn't fit into it.
+	 */
+	explicit serializer_t( std::size_t chunk_size = default_chunk_size )
+		// The parse stack of the document is never used.
+		:	m_values{ chunk_size, 0u, nullptr }
+	{}
 
-template<
-	typename Reader_Writer,
-	typename Field_Type,
-	typename Manopt_Policy,
-	typename Validator >
-struct binder_write_to_implementation_t<
-		binder_data_holder_t<
-			Reader_Writer,
-			const some_project::deserialize_only_proxy_t<Field_Type>,
-			Manopt_Policy,
-			Validator
-		>
-	>
-{
-	using data_holder_t = binder_data_holder_t<
-			Reader_Writer,
-			const some_project::deserialize_only_proxy_t<Field_Type>,
-			Manopt_Policy,
-			Validator >;
+	serializer_t( const serializer_t & ) = delete;
+	serializer_t & operator=( const serializer_t & ) = delete;
 
-	static void
-	write_to(
-		const data_holder_t &,
-		rapidjson::Value &,
-		rapidjson::MemoryPoolAllocator<> & )
+	//! Serialize an object into the internal buffer.
+	/*!
+	 * @return The internal buffer. It's valid until the next call.
+	 */
+	template< typename Dto >
+	const std::string &
+	to_json( const Dto & dto )
 	{
-		// Nothing to do.
+		m_buffer.clear();
+		to_json_append( m_buffer, dto );
+
+		return m_buffer;
 	}
 
-};
+	//! Serialize an object into the internal buffer with
+	//! a custom Reader-Writer.
+	/*!
+	 * @return The internal buffer. It's valid until the next call.
+	 */
+	template< typename Reader_Writer, typename Dto >
+	const std::string &
+	to_json( const Reader_Writer & reader_writer, const Dto & dto )
+	{
+		m_buffer.clear();
+		to_json_append( reader_writer, m_buffer, dto );
 
-// Now we can use some_project::deserialize_only() in json_io().
-struct my_data
-{
-	int obsolete_priority_{1};
-	...
-	template<typename Json_Io>
-	void json_io(Json_Io & io)
+		return m_buffer;
+	}
+
+	//! Serialize an object into the internal buffer by using
+	//! pretty_writer.
+	/*!
+	 * @return The internal buffer. It's valid until the next call.
+	 */
+	template< typename Dto >
+	const std::string &
+	to_json( const Dto & dto, pretty_writer_params_t writer_params )
 	{
-		io
-			// Now binder_t for `priority` field will contain
-			// a specialized version of binder_data_holder_t.
-			& json_dto::mandatory("priority",
-					some_project::deserialize_only(obsolete_priority_),
-					// NOTE: validators will be applied to deserialized value.
-					json_dto::min_max_constraint(1,9))
-			& ...
-			;
+		m_buffer.clear();
+		to_json_append( m_buffer, dto, writer_params );
+
+		return m_buffer;
 	}
-};
- * @endcode
- *
- * @since v.0.2.12
- */
-template< typename Binder_Data_Holder >
-struct binder_write_to_implementation_t
-{
-	static void
-	write_to(
-		const Binder_Data_Holder & binder_data,
-		rapidjson::Value & object,
-		rapidjson::MemoryPoolAllocator<> & allocator )
+
+	//! Serialize an object into the internal buffer by using
+	//! pretty_writer and a custom Reader-Writer.
+	/*!
+	 * @return The internal buffer. It's valid until the next call.
+	 */
+	template< typename Reader_Writer, typename Dto >
+	const std::string &
+	to_json(
+		const Reader_Writer & reader_writer,
+		const Dto & dto,
+		pretty_writer_params_t writer_params )
 	{
-		binder_data.validator()(
-				binder_data.field_for_serialization() ); // validate value.
+		m_buffer.clear();
+		to_json_append( reader_writer, m_buffer, dto, writer_params );
 
-		if( !binder_data.manopt_policy().is_default_value(
-				binder_data.field_for_serialization() ) )
-		{
-			rapidjson::Value value;
+		return m_buffer;
+	}
 
-			binder_data.reader_writer().write(
-					binder_data.field_for_serialization(),
-					value,
-					allocator );
+	//! Serialize an object with appending the result to @a to.
+	template< typename Dto >
+	void
+	to_json_append( std::string & to, const Dto & dto )
+	{
+		details::string_output_stream_t stream{ to };
+		to_json_into( stream, dto );
+	}
 
-			object.AddMember(
-					binder_data.field_name(),
-					value,
-					allocator );
-		}
+	//! Serialize an object with appending the result to @a to with
+	//! a custom Reader-Writer.
+	template< typename Reader_Writer, typename Dto >
+	void
+	to_json_append(
+		const Reader_Writer & reader_writer,
+		std::string & to,
+		const Dto & dto )
+	{
+		details::string_output_stream_t stream{ to };
+		to_json_into( reader_writer, stream, dto );
 	}
-};
 
-//
-// binder_t
-//
+	//! Serialize an object with appending the result to @a to by using
+	//! pretty_writer.
+	template< typename Dto >
+	void
+	to_json_append(
+		std::string & to,
+		const Dto & dto,
+		pretty_writer_params_t writer_params )
+	{
+		details::string_output_stream_t stream{ to };
+		to_json_into( stream, dto, writer_params );
+	}
 
-//! JSON IO binder_t for a field.
-/*!
- * @attention
- * Since v.0.2.12, additional care should be taken when working with instances
- * of binder_t. An instance of binder_t can hold a reference to a temporary
- * object. For example, in such a case:
- * @code
- * struct demo {
- * 	std::vector<int> keys() const { return { 1, 2, 3 }; }
- * 	...
- * 	// NOTE: this code is intended for serializing only!
- * 	template< typename Json_Io >
- * 	void json_io(Json_Io & io) {
- * 		// NOTE: binder object returned by mandatory() function
- * 		// will contain a reference to a temporary std::vector<int>.
- * 		io & json_dto::mandatory("keys", keys());
- * 		...
- * 	}
- * };
- * @endcode
- * So it's safe to pass binder_t object directly to `operator&`, but
- * it can be unsafe to store binder_t object to be used later. Don't do
- * that:
- * @code
- * struct demo {
- * 	std::vector<int> keys() const { return { 1, 2, 3 }; }
- * 	...
- * 	// NOTE: this code is intended for serializing only!
- * 	template< typename Json_Io >
- * 	void json_io(Json_Io & io) {
- * 		// NOTE: binder object returned by mandatory() function
- * 		// will contain a reference to a temporary std::vector<int>.
- * 		// This reference become invalid just after the completion
- * 		// of line (1).
- * 		//
- * 		// DON'T USE binder_t THIS WAY!
- * 		const auto keys_binder = json_dto::mandatory("keys", keys()); // (1)
- * 		...
- * 		io & keys_binder; // An invalid reference will be used here!!!
- * 		...
- * 	}
- * };
- * @endcode
- *
- * @note
- * This template was extended in v.0.2.10 by a new template parameter
- * Reader_Writer. This parameter specifies a type of object with
- * two const methods `read` and `write`. Since v.0.2.10 those methods
- * are used for reading and writting a value of Field_Type from/to
- * rapidjson::Value. See default_reader_writer_t for an example
- * of Reader_Writer.
- */
-template<
-		typename Reader_Writer,
-		typename Field_Type,
-		typename Manopt_Policy,
-		typename Validator >
-class binder_t
-{
-		using data_holder_t = binder_data_holder_t<
-				Reader_Writer,
-				Field_Type,
-				Manopt_Policy,
-				Validator >;
+	//! Serialize an object with appending the result to @a to by using
+	//! pretty_writer and a custom Reader-Writer.
+	template< typename Reader_Writer, typename Dto >
+	void
+	to_json_append(
+		const Reader_Writer & reader_writer,
+		std::string & to,
+		const Dto & dto,
+		pretty_writer_params_t writer_params )
+	{
+		details::string_output_stream_t stream{ to };
+		to_json_into( reader_writer, stream, dto, writer_params );
+	}
 
-		using read_from_impl_t = binder_read_from_implementation_t<
-				data_holder_t >;
+	//! Serialize an object into a RapidJSON's output stream.
+	template< typename Output_Stream, typename Dto >
+	void
+	to_json_into( Output_Stream & to, const Dto & dto )
+	{
+		auto & document = m_values.reset();
+		details::write_to_document( document, dto );
 
-		using write_to_impl_t = binder_write_to_implementation_t<
-				data_holder_t >;
+		m_stack_allocator.reset();
+		details::write_document( document, to, &m_stack_allocator );
+	}
 
-	public:
-		binder_t(
-			Reader_Writer && reader_writer,
-			string_ref_t field_name,
-			Field_Type & field,
-			Manopt_Policy && manopt_policy,
-			Validator && validator )
-			:	m_data_holder{
-					std::move(reader_writer),
-					field_name,
-					field,
-					std::move( manopt_policy ),
-					std::move( validator )
-				}
-		{}
+	//! Serialize an object into a RapidJSON's output stream with
+	//! a custom Reader-Writer.
+	template< typename Reader_Writer, typename Output_Stream, typename Dto >
+	// Prevents ambiguity with the version for pretty_writer.
+	std::enable_if_t< !std::is_same< Dto, pretty_writer_params_t >::value >
+	to_json_into(
+		const Reader_Writer & reader_writer,
+		Output_Stream & to,
+		const Dto & dto )
+	{
+		auto & document = m_values.reset();
+		details::write_to_document( document, reader_writer, dto );
 
-		//! Run read operation for value.
-		void
-		read_from( const rapidjson::Value & object ) const
-		{
-			try
-			{
-				read_from_impl_t::read_from( m_data_holder, object );
-			}
-			catch( const std::exception & ex )
-			{
-				throw ex_t{
-						"error reading field \"" +
-						std::string{ m_data_holder.field_name().s } +
-						"\": " +
-						ex.what() };
-			}
-		}
+		m_stack_allocator.reset();
+		details::write_document( document, to, &m_stack_allocator );
+	}
 
-		//! Run write operation on object.
-		void
-		write_to(
-			rapidjson::Value & object,
-			rapidjson::MemoryPoolAllocator<> & allocator ) const
-		{
-			try
-			{
-				write_to_impl_t::write_to(
-						m_data_holder,
-						object,
-						allocator );
-			}
-			catch( const std::exception & ex )
-			{
-				throw ex_t{
-						"error writing field \"" +
-						std::string{ m_data_holder.field_name().s } +
-						"\": " +
-						ex.what() };
-			}
-		}
+	//! Serialize an object into a RapidJSON's output stream by using
+	//! pretty_writer.
+	template< typename Output_Stream, typename Dto >
+	void
+	to_json_into(
+		Output_Stream & to,
+		const Dto & dto,
+		pretty_writer_params_t writer_params )
+	{
+		auto & document = m_values.reset();
+		details::write_to_document( document, dto );
+
+		m_stack_allocator.reset();
+		details::write_document(
+				document, to, writer_params, &m_stack_allocator );
+	}
 
-	private:
-		data_holder_t m_data_holder;
+	//! Serialize an object into a RapidJSON's output stream by using
+	//! pretty_writer and a custom Reader-Writer.
+	template< typename Reader_Writer, typename Output_Stream, typename Dto >
+	void
+	to_json_into(
+		const Reader_Writer & reader_writer,
+		Output_Stream & to,
+		const Dto & dto,
+		pretty_writer_params_t writer_params )
+	{
+		auto & document = m_values.reset();
+		details::write_to_document( document, reader_writer, dto );
+
+		m_stack_allocator.reset();
+		details::write_document(
+				document, to, writer_params, &m_stack_allocator );
+	}
+
+	//! Size of chunks.
+	std::size_t
+	chunk_size() const noexcept { return m_values.chunk_size(); }
+
+	//! Bytes retained by the serializer between calls.
+	std::size_t
+	bytes_retained() const noexcept
+	{
+		return m_values.buffer_size() + m_stack_allocator.retained() +
+				m_buffer.capacity();
+	}
+
+private:
+	details::pooled_document_t< rapidjson::CrtAllocator > m_values;
+	//! Memory for stacks of writers.
+	details::retained_stack_allocator_t m_stack_allocator;
+	//! Buffer for to_json().
+	std::string m_buffer;
 };
 
+
 //
-// mandatory
+// Non-throwing API
 //
 
-//! Create bind for a mandatory JSON field with validator.
-template<
-		typename Field_Type,
-		typename Validator = empty_validator_t >
-auto
-mandatory(
-	string_ref_t field_name,
-	Field_Type && field,
-	Validator validator = Validator{} )
+namespace details
 {
-	using binder_type_t = binder_t<
-			default_reader_writer_t,
-			// NOTE: since v.0.2.12 this way of detection of Field_Type
-			// for binder_t must be used.
-			details::meta::field_type_from_reference_t< decltype(field) >,
-			mandatory_attr_t,
-			Validator >;
-
-	return binder_type_t{
-			default_reader_writer_t{},
-			field_name,
-			field,
-			mandatory_attr_t{},
-			std::move( validator ) };
-}
 
-//! Create bind for a mandatory JSON field with validator.
-template<
-		typename Reader_Writer,
-		typename Field_Type,
-		typename Validator = empty_validator_t >
-auto
-mandatory(
-	Reader_Writer reader_writer,
-	string_ref_t field_name,
-	Field_Type && field,
-	Validator validator = Validator{} )
+//! Run @a action with errors stored instead of being thrown.
+/*!
+ * @since v.0.3.5
+ */
+template< typename Action >
+error_info_t
+try_invoke( Action && action )
 {
-	using binder_type_t = binder_t<
-			Reader_Writer,
-			// NOTE: since v.0.2.12 this way of detection of Field_Type
-			// for binder_t must be used.
-			details::meta::field_type_from_reference_t< decltype(field) >,
-			mandatory_attr_t,
-			Validator >;
+	struct sink_guard_t
+	{
+		error_info_t * const m_previous;
 
-	return binder_type_t{
-			std::move(reader_writer),
-			field_name,
-			field,
-			mandatory_attr_t{},
-			std::move( validator ) };
+		explicit sink_guard_t( error_info_t & error ) noexcept
+			:	m_previous{ error_sink() }
+		{
+			error_sink() = &error;
+		}
+
+		~sink_guard_t() noexcept
+		{
+			error_sink() = m_previous;
+		}
+	};
+
+	error_info_t error;
+	{
+		sink_guard_t guard{ error };
+		try
+		{
+			action();
+		}
+		catch( const std::exception & ex )
+		{
+			// It's an exception from user's code or from an allocator.
+			if( !error )
+				error = error_info_of( ex );
+		}
+	}
+
+	return error;
 }
 
-//! Create bind for a mandatory JSON field with validator.
+} /* namespace details */
+
 /*!
- * This binder has to be used in case when 'null' is allowed
- * for mandatory attr and should be treated as default field value.
+ * @brief Read an already instantiated DTO from already parsed document
+ * without exceptions.
  *
- * For example:
- * @code
- * struct my_header_reader_writer
- * {
- * 	void read( std::string & v, ... ) const { ... }
- * 	void write( const std::string & v, ... ) const { ... }
- * };
+ * The first error is returned as error_info_t. json_dto's own reading
+ * functions don't throw exceptions in that mode. Reading functions called
+ * from user's code (custom Reader_Writers, user-defined read_json_value)
+ * throw ex_t as usual, and exceptions from user's code are caught and
+ * returned as error_info_t too.
  *
- * struct my_data
- * {
- * 	std::vector< std::string > headers_;
- * 	...
- * 	template< typename Json_Io >
- * 	void json_io( Json_Io & io )
- * 	{
- * 		// headers_ receives std::vector<std::string>{} in case of 'null'.
- * 		io & json_dto::mandatory_with_null_as_default(
- * 				// Use a custom reader-writer for that field.
- * 				json_dto::apply_to_content_t< my_header_reader_writer >{},
- * 				"headers", headers_ )
- * 			...
- * 			;
- * 	}
- * };
+ * Usage example:
+ * @code
+ * message_t msg;
+ * const auto error = json_dto::try_from_json( json_string, msg );
+ * if( error )
+ * 	log_error( error.message() );
  * @endcode
  *
  * @note
- * Type \a Field_Type has to be DefaultConstructible.
+ * The state of @a o object is not defined if an error occurs.
  *
- * @since v.0.3.0
+ * @note
+ * Reading by SAX parser (from_json_sax()) isn't supported.
+ *
+ * @since v.0.3.5
  */
-template<
-		typename Reader_Writer,
-		typename Field_Type,
-		typename Validator = json_dto::empty_validator_t >
-auto
-mandatory_with_null_as_default(
-	Reader_Writer reader_writer,
-	json_dto::string_ref_t field_name,
-	Field_Type && field,
-	Validator validator = Validator{} )
+template< typename Type >
+JSON_DTO_NODISCARD
+error_info_t
+try_from_json(
+	//! JSON representation of value to be extracted.
+	const rapidjson::Value & json,
+	//! The receiver of the extracted value.
+	Type & o )
 {
-	using binder_type_t = json_dto::binder_t<
-			Reader_Writer,
-			// NOTE: since v.0.2.12 this way of detection of Field_Type
-			// for binder_t must be used.
-			details::meta::field_type_from_reference_t< decltype(field) >,
-			mandatory_attr_with_null_as_default_t,
-			Validator >;
-
-	return binder_type_t{
-			std::move(reader_writer),
-			field_name,
-			field,
-			mandatory_attr_with_null_as_default_t{},
-			std::move( validator ) };
+	return details::try_invoke( [&] { from_json( json, o ); } );
 }
 
-//! Create bind for a mandatory JSON field with validator.
 /*!
- * This binder has to be used in case when 'null' is allowed
- * for mandatory attr and should be treated as default field value.
- *
- * For example:
- * @code
- * struct my_data 
- * {
- * 	std::vector< std::string > headers_;
- * 	...
- * 	template< typename Json_Io >
- * 	void json_io( Json_Io & io )
- * 	{
- * 		// headers_ receives std::vector<std::string>{} in case of 'null'.
- * 		io & json_dto::mandatory_with_null_as_default(
- * 				"headers", headers_ )
- * 			...
- * 			;
- * 	}
- * };
- * @endcode
+ * @brief A version of try_from_json() with a custom Reader_Writer.
  *
- * @note
- * Type \a Field_Type has to be DefaultConstructible.
- *
- * @since v.0.3.0
+ * @since v.0.3.5
  */
-template<
-		typename Field_Type,
-		typename Validator = json_dto::empty_validator_t >
-auto
-mandatory_with_null_as_default(
-	json_dto::string_ref_t field_name,
-	Field_Type && field,
-	Validator validator = Validator{} )
-{
-	return mandatory_with_null_as_default(
-			default_reader_writer_t{},
-			field_name,
-			std::forward<Field_Type>(field),
-			std::move(validator) );
-}
-
-//
-// optional
-//
-
-//! Create bind for an optional JSON field with default value and validator.
-template<
-		typename Field_Type,
-		typename Field_Default_Value_Type,
-		typename Validator = empty_validator_t >
-auto
-optional(
-	string_ref_t field_name,
-	Field_Type && field,
-	Field_Default_Value_Type default_value,
-	Validator validator = Validator{} )
+template< typename Type, typename Reader_Writer >
+JSON_DTO_NODISCARD
+error_info_t
+try_from_json(
+	//! Custom Reader_Writer to be used.
+	const Reader_Writer & reader_writer,
+	//! JSON representation of value to be extracted.
+	const rapidjson::Value & json,
+	//! The receiver of the extracted value.
+	Type & o )
 {
-	using opt_attr_t = optional_attr_t< Field_Default_Value_Type >;
-	using binder_type_t = binder_t<
-			default_reader_writer_t,
-			// NOTE: since v.0.2.12 this way of detection of Field_Type
-			// for binder_t must be used.
-			details::meta::field_type_from_reference_t< decltype(field) >,
-			opt_attr_t,
-			Validator >;
-
-	return binder_type_t{
-			default_reader_writer_t{},
-			field_name,
-			field,
-			opt_attr_t{ std::move( default_value ) },
-			std::move( validator ) };
+	return details::try_invoke( [&] { from_json( reader_writer, json, o ); } );
 }
 
-//! Create bind for an optional JSON field with default value and validator.
+/*!
+ * @brief Parse JSON string and read DTO without exceptions.
+ *
+ * The offset of a parse error is available via error_info_t::offset().
+ *
+ * @since v.0.3.5
+ */
 template<
-		typename Reader_Writer,
-		typename Field_Type,
-		typename Field_Default_Value_Type,
-		typename Validator = empty_validator_t >
-auto
-optional(
-	Reader_Writer reader_writer,
-	string_ref_t field_name,
-	Field_Type && field,
-	Field_Default_Value_Type default_value,
-	Validator validator = Validator{} )
-{
-	using opt_attr_t = optional_attr_t< Field_Default_Value_Type >;
-	using binder_type_t = binder_t<
-			Reader_Writer,
-			// NOTE: since v.0.2.12 this way of detection of Field_Type
-			// for binder_t must be used.
-			details::meta::field_type_from_reference_t< decltype(field) >,
-			opt_attr_t,
-			Validator >;
-
-	return binder_type_t{
-			std::move(reader_writer),
-			field_name,
-			field,
-			opt_attr_t{ std::move( default_value ) },
-			std::move( validator ) };
+	typename Type,
+	unsigned Rapidjson_Parseflags = rapidjson::kParseDefaultFlags >
+JSON_DTO_NODISCARD
+error_info_t
+try_from_json(
+	//! Value to be parsed.
+	const string_ref_t & json,
+	//! The receiver of the extracted value.
+	Type & o )
+{
+	return details::try_invoke( [&] {
+			from_json< Type, Rapidjson_Parseflags >( json, o );
+		} );
 }
 
-//
-// optional_null
-//
-
-//! Create bind for an optional JSON field with null default value .
+/*!
+ * @brief A version of try_from_json() with a custom Reader_Writer.
+ *
+ * @since v.0.3.5
+ */
 template<
-		typename Field_Type,
-		typename Validator = empty_validator_t >
-auto
-optional_null(
-	string_ref_t field_name,
-	Field_Type && field,
-	Validator validator = Validator{} )
+	typename Type,
+	typename Reader_Writer,
+	unsigned Rapidjson_Parseflags = rapidjson::kParseDefaultFlags >
+JSON_DTO_NODISCARD
+error_info_t
+try_from_json(
+	//! Custom Reader_Writer to be used.
+	const Reader_Writer & reader_writer,
+	//! Value to be parsed.
+	const string_ref_t & json,
+	//! The receiver of the extracted value.
+	Type & o )
 {
-	using binder_type_t = binder_t<
-			default_reader_writer_t,
-			// NOTE: since v.0.2.12 this way of detection of Field_Type
-			// for binder_t must be used.
-			details::meta::field_type_from_reference_t< decltype(field) >,
-			optional_attr_null_t,
-			Validator >;
-
-	return binder_type_t{
-			default_reader_writer_t{},
-			field_name,
-			field,
-			optional_attr_null_t{},
-			std::move( validator ) };
+	return details::try_invoke( [&] {
+			from_json< Type, Reader_Writer, Rapidjson_Parseflags >(
+					reader_writer, json, o );
+		} );
 }
 
-//! Create bind for an optional JSON field with null default value .
+/*!
+ * @brief Parse JSON string and read DTO without exceptions.
+ *
+ * @since v.0.3.5
+ */
 template<
-		typename Reader_Writer,
-		typename Field_Type,
-		typename Validator = empty_validator_t >
-auto
-optional_null(
-	Reader_Writer reader_writer,
-	string_ref_t field_name,
-	Field_Type && field,
-	Validator validator = Validator{} )
+	typename Type,
+	unsigned Rapidjson_Parseflags = rapidjson::kParseDefaultFlags >
+JSON_DTO_NODISCARD
+error_info_t
+try_from_json(
+	//! Value to be parsed.
+	const std::string & json,
+	//! The receiver of the extracted value.
+	Type & o )
 {
-	using binder_type_t = binder_t<
-			Reader_Writer,
-			// NOTE: since v.0.2.12 this way of detection of Field_Type
-			// for binder_t must be used.
-			details::meta::field_type_from_reference_t< decltype(field) >,
-			optional_attr_null_t,
-			Validator >;
-
-	return binder_type_t{
-			std::move(reader_writer),
-			field_name,
-			field,
-			optional_attr_null_t{},
-			std::move( validator ) };
+	return try_from_json< Type, Rapidjson_Parseflags >(
+			make_string_ref( json ), o );
 }
 
-//
-// optional
-//
-
-//! Create bind for an optional JSON field with null default value.
+/*!
+ * @brief A version of try_from_json() with a custom Reader_Writer.
+ *
+ * @since v.0.3.5
+ */
 template<
-		typename Field_Type,
-		typename Validator = empty_validator_t >
-auto
-optional(
-	string_ref_t field_name,
-	Field_Type & field,
-	std::nullptr_t,
-	Validator validator = Validator{} )
+	typename Type,
+	typename Reader_Writer,
+	unsigned Rapidjson_Parseflags = rapidjson::kParseDefaultFlags >
+JSON_DTO_NODISCARD
+error_info_t
+try_from_json(
+	//! Custom Reader_Writer to be used.
+	const Reader_Writer & reader_writer,
+	//! Value to be parsed.
+	const std::string & json,
+	//! The receiver of the extracted value.
+	Type & o )
 {
-	return optional_null( field_name, field, std::move( validator ) );
+	return try_from_json< Type, Reader_Writer, Rapidjson_Parseflags >(
+			reader_writer, make_string_ref( json ), o );
 }
 
-//! Create bind for an optional JSON field with null default value.
+/*!
+ * @brief Parse JSON string and read DTO without exceptions.
+ *
+ * This version reads the JSON content from a raw char pointer
+ * (it's assumed that it is a null-terminated string).
+ *
+ * @since v.0.3.5
+ */
 template<
-		typename Reader_Writer,
-		typename Field_Type,
-		typename Validator = empty_validator_t >
-auto
-optional(
-	Reader_Writer reader_writer,
-	string_ref_t field_name,
-	Field_Type & field,
-	std::nullptr_t,
-	Validator validator = Validator{} )
+	typename Type,
+	unsigned Rapidjson_Parseflags = rapidjson::kParseDefaultFlags >
+JSON_DTO_NODISCARD
+error_info_t
+try_from_json(
+	//! Value to be parsed.
+	const char * json,
+	//! The receiver of the extracted value.
+	Type & o )
 {
-	return optional_null(
-			std::move(reader_writer),
-			field_name,
-			field,
-			std::move( validator ) );
+	return try_from_json< Type, Rapidjson_Parseflags >(
+			make_string_ref( json ), o );
 }
 
-//
-// optional_no_default
-//
-
-//! Create bind for an optional JSON field without default value.
+/*!
+ * @brief A version of try_from_json() with a custom Reader_Writer.
+ *
+ * @since v.0.3.5
+ */
 template<
-		typename Field_Type,
-		typename Validator = empty_validator_t >
-auto
-optional_no_default(
-	string_ref_t field_name,
-	Field_Type && field,
-	Validator validator = Validator{} )
+	typename Type,
+	typename Reader_Writer,
+	unsigned Rapidjson_Parseflags = rapidjson::kParseDefaultFlags >
+JSON_DTO_NODISCARD
+error_info_t
+try_from_json(
+	//! Custom Reader_Writer to be used.
+	const Reader_Writer & reader_writer,
+	//! Value to be parsed.
+	const char * json,
+	//! The receiver of the extracted value.
+	Type & o )
 {
-	using binder_type_t = binder_t<
-			default_reader_writer_t,
-			// NOTE: since v.0.2.12 this way of detection of Field_Type
-			// for binder_t must be used.
-			details::meta::field_type_from_reference_t< decltype(field) >,
-			optional_nodefault_attr_t,
-			Validator >;
-
-	return binder_type_t{
-			default_reader_writer_t{},
-			field_name,
-			field,
-			optional_nodefault_attr_t{},
-			std::move( validator ) };
+	return try_from_json< Type, Reader_Writer, Rapidjson_Parseflags >(
+			reader_writer, make_string_ref( json ), o );
 }
 
-//! Create bind for an optional JSON field without default value.
+/*!
+ * @brief Parse JSON string by using a parse context and read DTO
+ * without exceptions.
+ *
+ * @since v.0.3.5
+ */
 template<
-		typename Reader_Writer,
-		typename Field_Type,
-		typename Validator = empty_validator_t >
-auto
-optional_no_default(
-	Reader_Writer reader_writer,
-	string_ref_t field_name,
-	Field_Type && field,
-	Validator validator = Validator{} )
+	typename Type,
+	unsigned Rapidjson_Parseflags = rapidjson::kParseDefaultFlags >
+JSON_DTO_NODISCARD
+error_info_t
+try_from_json(
+	//! Context for parsing.
+	parse_context_t & context,
+	//! Value to be parsed.
+	const string_ref_t & json,
+	//! The receiver of the extracted value.
+	Type & o )
 {
-	using binder_type_t = binder_t<
-			Reader_Writer,
-			// NOTE: since v.0.2.12 this way of detection of Field_Type
-			// for binder_t must be used.
-			details::meta::field_type_from_reference_t< decltype(field) >,
-			optional_nodefault_attr_t,
-			Validator >;
-
-	return binder_type_t{
-			std::move(reader_writer),
-			field_name,
-			field,
-			optional_nodefault_attr_t{},
-			std::move( validator ) };
+	return details::try_invoke( [&] {
+			from_json< Type, Rapidjson_Parseflags >( context, json, o );
+		} );
 }
 
-template< typename Dto >
-json_input_t &
-operator >> ( json_input_t & i, Dto & v )
+/*!
+ * @brief Parse JSON string by using a parse context and read DTO
+ * without exceptions.
+ *
+ * @since v.0.3.5
+ */
+template<
+	typename Type,
+	unsigned Rapidjson_Parseflags = rapidjson::kParseDefaultFlags >
+JSON_DTO_NODISCARD
+error_info_t
+try_from_json(
+	//! Context for parsing.
+	parse_context_t & context,
+	//! Value to be parsed.
+	const std::string & json,
+	//! The receiver of the extracted value.
+	Type & o )
 {
-	json_io( i, v );
-	return i;
+	return try_from_json< Type, Rapidjson_Parseflags >(
+			context, make_string_ref( json ), o );
 }
 
-template< typename Dto >
-inline json_output_t &
-operator << ( json_output_t & o, const Dto & v )
+/*!
+ * @brief Parse JSON string by using a parse context and read DTO
+ * without exceptions.
+ *
+ * This version reads the JSON content from a raw char pointer
+ * (it's assumed that it is a null-terminated string).
+ *
+ * @since v.0.3.5
+ */
+template<
+	typename Type,
+	unsigned Rapidjson_Parseflags = rapidjson::kParseDefaultFlags >
+JSON_DTO_NODISCARD
+error_info_t
+try_from_json(
+	//! Context for parsing.
+	parse_context_t & context,
+	//! Value to be parsed.
+	const char * json,
+	//! The receiver of the extracted value.
+	Type & o )
 {
-	json_io( o, const_cast< Dto & >( v ) );
-	return o;
+	return try_from_json< Type, Rapidjson_Parseflags >(
+			context, make_string_ref( json ), o );
 }
 
-//
-// to_json
-//
-
 /*!
- * @brief Helper function for serialization of an object to string.
+ * @brief Serialize an object into a string without exceptions.
+ *
+ * The previous content of @a to is replaced. @a to is empty if
+ * an error occurs.
+ *
+ * Usage example:
+ * @code
+ * std::string json;
+ * if( const auto error = json_dto::try_to_json( reply, json ) )
+ * 	log_error( error.message() );
+ * @endcode
+ *
+ * @since v.0.3.5
  */
 template< typename Dto >
 JSON_DTO_NODISCARD
-std::string
-to_json(
-	//! Object to be serialized.
-	const Dto & dto )
-{
-	rapidjson::Document output_doc;
-	json_output_t jout{
-		output_doc, output_doc.GetAllocator() };
-
-	jout << dto;
-
-	rapidjson::StringBuffer buffer;
-	rapidjson::Writer< rapidjson::StringBuffer > writer( buffer );
-	const bool result = output_doc.Accept( writer );
-	if( !result )
-		throw ex_t{ "to_json: output_doc.Accept(writer) returns false" };
+error_info_t
+try_to_json(
+	//! Object to be serialized.
+	const Dto & dto,
+	//! The receiver of the result.
+	std::string & to )
+{
+	to.clear();
+	auto error = details::try_invoke( [&] { to_json_append( to, dto ); } );
+	if( error )
+		to.clear();
 
-	return { buffer.GetString(), buffer.GetSize() };
+	return error;
 }
 
 /*!
- * @brief Helper function for serialization of an object to string
- * with a custom reader-writer.
- *
- * Usage example:
- * @code
- * class some_data {
- * public:
- * 	...
- * 	template<typename Io> void json_io(Io & io) {...}
- * };
- * struct some_data_reader_writer {
- * 	void read( some_data & obj, const rapidjson::Value & from ) const {...}
+ * @brief A version of try_to_json() with a custom Reader_Writer.
  *
- * 	void write( const some_data & obj, rapidjson::Value & to, rapidjson::MemoryPoolAllocator<> & allocator ) const {...}
- * };
- * ...
- * some_data data_to_pack{...};
- * auto json_string = json_dto::to_json(some_data_reader_writer{}, data_to_pack);
- * @endcode
- *
- * @since v.0.3.4
+ * @since v.0.3.5
  */
 template< typename Reader_Writer, typename Dto >
 JSON_DTO_NODISCARD
-std::string
-to_json(
+error_info_t
+try_to_json(
 	//! Custom Reader_Writer to be used.
 	const Reader_Writer & reader_writer,
 	//! Object to be serialized.
-	const Dto & dto )
+	const Dto & dto,
+	//! The receiver of the result.
+	std::string & to )
 {
-	rapidjson::Document output_doc;
-
-	reader_writer.write( dto, output_doc, output_doc.GetAllocator() );
-
-	rapidjson::StringBuffer buffer;
-	rapidjson::Writer< rapidjson::StringBuffer > writer( buffer );
-	const bool result = output_doc.Accept( writer );
-	if( !result )
-		throw ex_t{ "to_json: output_doc.Accept(writer) returns false" };
-
-	return { buffer.GetString(), buffer.GetSize() };
+	to.clear();
+	auto error = details::try_invoke( [&] {
+			to_json_append( reader_writer, to, dto );
+		} );
+	if( error )
+		to.clear();
+
+	return error;
 }
 
+
 //
-// to_json with PrettyWriter
+// Delta serialization
 //
 
-struct pretty_writer_params_t
+namespace details
 {
-	char m_indent_char{ ' ' };
-	unsigned m_indent_char_count{ 4u };
-	rapidjson::PrettyFormatOptions m_format_options{ rapidjson::kFormatDefault };
-
-	//
-	// Setters
-	//
-	pretty_writer_params_t &
-	indent_char( char ch ) &
-	{
-		m_indent_char = ch;
-		return *this;
-	}
 
-	pretty_writer_params_t &&
-	indent_char( char ch ) &&
-	{
-		return std::move(this->indent_char(ch));
-	}
-	
-	pretty_writer_params_t &
-	indent_char_count( unsigned count ) &
-	{
-		if( !count ) count = 1u;
+namespace delta
+{
 
-		m_indent_char_count = count;
-		return *this;
-	}
+template< typename T, typename = meta::void_t<> >
+struct has_equal_to : public std::false_type {};
 
-	pretty_writer_params_t &&
-	indent_char_count( unsigned count ) &&
-	{
-		return std::move(this->indent_char_count(count));
-	}
+template< typename T >
+struct has_equal_to<
+		T,
+		meta::void_t< decltype( static_cast< bool >(
+				std::declval< const T & >() == std::declval< const T & >() ) ) > >
+	:	public std::true_type
+{};
 
-	pretty_writer_params_t &
-	format_options( rapidjson::PrettyFormatOptions opt ) &
-	{
-		m_format_options = opt;
-		return *this;
-	}
+/*!
+ * @brief Detector of types that can be compared by operator==.
+ *
+ * STL containers and std::pair declare operator== for any items,
+ * so their items are checked too. nullable_t isn't comparable because
+ * two empty values aren't equal for it.
+ *
+ * @since v.0.3.5
+ */
+template< typename T, bool Is_Container = meta::is_stl_like_container< T >::value >
+struct is_comparable : public has_equal_to< T > {};
 
-	pretty_writer_params_t &&
-	format_options( rapidjson::PrettyFormatOptions opt ) &&
-	{
-		return std::move(this->format_options(opt));
-	}
+template< typename T >
+struct is_comparable< T, true >
+{
+	static constexpr bool value =
+			has_equal_to< T >::value &&
+			is_comparable< typename T::value_type >::value;
 };
 
-/*!
- * @brief Helper function for serialization of an object to string
- * by using pretty_writer.
- */
-template< typename Dto >
-std::string
-to_json(
-	//! Object to be serialized.
-	const Dto & dto,
-	//! Parameters for pretty_writer.
-	pretty_writer_params_t writer_params )
+template< typename A, typename B >
+struct is_comparable< std::pair< A, B >, false >
 {
-	rapidjson::Document output_doc;
-	json_output_t jout{
-		output_doc, output_doc.GetAllocator() };
+	static constexpr bool value =
+			is_comparable< std::remove_cv_t< A > >::value &&
+			is_comparable< B >::value;
+};
 
-	jout << dto;
+template< typename T >
+struct is_comparable< nullable_t< T >, false > : public std::false_type {};
 
-	rapidjson::StringBuffer buffer;
+#if defined( JSON_DTO_SUPPORTS_STD_OPTIONAL )
+template< typename T >
+struct is_comparable< cpp17::optional< T >, false > : public is_comparable< T > {};
+#endif
 
-	rapidjson::PrettyWriter< rapidjson::StringBuffer > writer( buffer );
-	writer.SetIndent(
-			writer_params.m_indent_char,
-			writer_params.m_indent_char_count );
-	writer.SetFormatOptions(
-			writer_params.m_format_options );
+template< typename Reader_Writer, typename T >
+bool
+values_equal(
+	const Reader_Writer &,
+	const T & a,
+	const T & b,
+	std::true_type /*is_comparable*/ )
+{
+	return a == b;
+}
 
-	const bool result = output_doc.Accept( writer );
-	if( !result )
-		throw ex_t{ "to_json: output_doc.Accept(writer) returns false" };
+// Values that can't be compared directly are compared
+// in the serialized form.
+template< typename Reader_Writer, typename T >
+bool
+values_equal(
+	const Reader_Writer & reader_writer,
+	const T & a,
+	const T & b,
+	std::false_type /*is_comparable*/ )
+{
+	sax_output::fallback_allocator_t allocator;
+	rapidjson::Value va;
+	rapidjson::Value vb;
+	reader_writer.write( a, va, allocator.get() );
+	reader_writer.write( b, vb, allocator.get() );
 
-	return { buffer.GetString(), buffer.GetSize() };
+	return va == vb;
 }
 
+template< typename Dto >
+void
+write_dto_delta(
+	const Dto & current,
+	const Dto & baseline,
+	rapidjson::Value & object,
+	rapidjson::MemoryPoolAllocator<> & allocator );
+
 /*!
- * @brief Helper function for serialization of an object to string
- * by using pretty_writer and a custom Reader-Writer.
+ * @brief Write @a current into @a to if it differs from @a baseline.
  *
- * Usage example:
- * @code
- * class some_data {
- * public:
- * 	...
- * 	template<typename Io> void json_io(Io & io) {...}
- * };
- * struct some_data_reader_writer {
- * 	void read( some_data & obj, const rapidjson::Value & from ) const {...}
+ * Nested DTOs and map-like containers are written as objects with
+ * changed members only.
  *
- * 	void write( const some_data & obj, rapidjson::Value & to, rapidjson::MemoryPoolAllocator<> & allocator ) const {...}
- * };
- * ...
- * some_data data_to_pack{...};
- * auto json_string = json_dto::to_json( some_data_reader_writer{}, data_to_pack,
- * 	json_dto::pretty_writer_params_t{}.indent_char(' ').indent_char_count(3) );
- * @endcode
+ * @return true if the value is written.
  *
- * @since v.0.3.4
+ * @since v.0.3.5
  */
-template< typename Reader_Writer, typename Dto >
-std::string
-to_json(
-	//! Custom Reader_Writer to be used.
+template< typename Reader_Writer, typename T >
+bool
+write_if_changed(
 	const Reader_Writer & reader_writer,
-	//! Object to be serialized.
-	const Dto & dto,
-	//! Parameters for pretty_writer.
-	pretty_writer_params_t writer_params )
-{
-	rapidjson::Document output_doc;
-
-	reader_writer.write( dto, output_doc, output_doc.GetAllocator() );
-
-	rapidjson::StringBuffer buffer;
-
-	rapidjson::PrettyWriter< rapidjson::StringBuffer > writer( buffer );
-	writer.SetIndent(
-			writer_params.m_indent_char,
-			writer_params.m_indent_char_count );
-	writer.SetFormatOptions(
-			writer_params.m_format_options );
+	const T & current,
+	const T & baseline,
+	rapidjson::Value & to,
+	rapidjson::MemoryPoolAllocator<> & allocator );
 
-	const bool result = output_doc.Accept( writer );
-	if( !result )
-		throw ex_t{ "to_json: output_doc.Accept(writer) returns false" };
+// The default case: the whole value is written.
+template< typename Tag, typename Reader_Writer, typename T >
+bool
+write_if_changed_impl(
+	Tag,
+	const Reader_Writer & reader_writer,
+	const T & current,
+	const T & baseline,
+	rapidjson::Value & to,
+	rapidjson::MemoryPoolAllocator<> & allocator )
+{
+	if( values_equal( reader_writer, current, baseline,
+			std::integral_constant< bool, is_comparable< T >::value >{} ) )
+		return false;
 
-	return { buffer.GetString(), buffer.GetSize() };
+	reader_writer.write( current, to, allocator );
+	return true;
 }
 
-//FIXME: document this!
-inline void
-check_document_parse_status(
-	const rapidjson::Document & document )
+template< typename Reader_Writer, typename T >
+bool
+write_if_changed_impl(
+	sax_output::value_kind_tag_t< sax_output::value_kind_t::dto >,
+	const Reader_Writer &,
+	const T & current,
+	const T & baseline,
+	rapidjson::Value & to,
+	rapidjson::MemoryPoolAllocator<> & allocator )
 {
-	if( document.HasParseError() )
-	{
-		throw ex_t{
-			std::string{ "JSON parse error: '" } +
-			rapidjson::GetParseError_En( document.GetParseError() ) +
-			"' (offset: " + std::to_string( document.GetErrorOffset() ) + ")" };
-	}
+	write_dto_delta( current, baseline, to, allocator );
+	return 0u != to.MemberCount();
 }
 
-//
-// NOTE: there are a lot of overloads for from_json functions.
-// It's because we have to distinguish three different cases:
-//
-// - const char *;
-// - string_ref_t;
-// - std::string.
-//
-// Unfortunately, we can't limit himself to just one overload with
-// string_ref_t, because RapidJSON's GenericStringRef has no constructor
-// that accepts std::string. So we have to have overloads for string_ref_t
-// and for std::string. But it's not enough because if const char* is
-// passed to from_json, then compiler can't decide which overload to
-// select (string_ref_t and std::string can be implicitly constructed
-// from const char *).
-//
-
-//
-// from_json
-//
-
-//! Helper function to read DTO from already parsed document.
-//!
-//! @note
-//! Type @a Type is required to be DefaultConstructible.
-template< typename Type >
-Type
-from_json(
-	//! JSON representation of value to be extracted.
-	const rapidjson::Value & json )
+template< typename Reader_Writer, typename Key >
+void
+add_map_member(
+	const Reader_Writer & reader_writer,
+	const Key & key,
+	rapidjson::Value & value,
+	rapidjson::Value & to,
+	rapidjson::MemoryPoolAllocator<> & allocator )
 {
-	json_input_t jin{ json };
-
-	Type result{};
+	rapidjson::Value name;
 
-	jin >> result;
+	// It is necessary to have const_key_ref as a lvalue to pass a
+	// const reference to it to write() method of the reader_writer.
+	auto const_key_ref = const_map_key( key );
+	reader_writer.write( const_key_ref, name, allocator );
 
-	return result;
+	to.AddMember( name, value, allocator );
 }
 
-/*!
- * @brief Helper function to read DTO from already parsed document by using a
- * custom Reader_Writer object.
- *
- * Usage example:
- * @code
- * class some_data {
- * public:
- * 	...
- * 	template<typename Io> void json_io(Io & io) {...}
- * };
- * struct some_data_reader_writer {
- * 	void read( some_data & obj, const rapidjson::Value & from ) const {...}
- *
- * 	void write( const some_data & obj, rapidjson::Value & to, rapidjson::MemoryPoolAllocator<> & allocator ) const {...}
- * };
- * ...
- * rapidjson::Document & doc = ...;
- * auto unpacked_data = json_dto::from_json<some_data>( some_data_reader_writer{}, doc["SomeData"] );
- * @endcode
- *
- * @note
- * Type @a Type is required to be DefaultConstructible.
- *
- * @since v.0.3.4
- */
-template< typename Type, typename Reader_Writer >
-Type
-from_json(
-	//! Custom Reader_Writer to be used.
+// Changed and new entries are written, removed entries are written as null.
+template< typename Reader_Writer, typename T >
+bool
+write_map_delta(
 	const Reader_Writer & reader_writer,
-	//! JSON representation of value to be extracted.
-	const rapidjson::Value & json )
+	const T & current,
+	const T & baseline,
+	rapidjson::Value & to,
+	rapidjson::MemoryPoolAllocator<> & allocator,
+	std::true_type /*has_unique_keys*/ )
 {
-	Type result{};
+	const auto & item_reader_writer =
+			sax_output::content_reader_writer< Reader_Writer >::get( reader_writer );
 
-	reader_writer.read( result, json );
+	to.SetObject();
+	for( const auto & kv : current )
+	{
+		rapidjson::Value value;
 
-	return result;
+		const auto it = baseline.find( kv.first );
+		if( baseline.end() == it )
+			item_reader_writer.write( kv.second, value, allocator );
+		else if( !write_if_changed(
+				item_reader_writer, kv.second, it->second, value, allocator ) )
+			continue;
+
+		add_map_member( item_reader_writer, kv.first, value, to, allocator );
+	}
+
+	for( const auto & kv : baseline )
+		if( current.end() == current.find( kv.first ) )
+		{
+			rapidjson::Value null;
+			add_map_member( item_reader_writer, kv.first, null, to, allocator );
+		}
+
+	return 0u != to.MemberCount();
 }
 
-//! Helper function to read from already parsed document to already
-//! constructed DTO.
-//!
-//! @note
-//! The state of @a o object is not defined if an error occurs.
-template< typename Type >
-void
-from_json(
-	//! JSON representation of value to be extracted.
-	const rapidjson::Value & json,
-	//! The receiver of the extracted value.
-	Type & o )
+// Multimaps are written completely.
+template< typename Reader_Writer, typename T >
+bool
+write_map_delta(
+	const Reader_Writer & reader_writer,
+	const T & current,
+	const T & baseline,
+	rapidjson::Value & to,
+	rapidjson::MemoryPoolAllocator<> & allocator,
+	std::false_type /*has_unique_keys*/ )
 {
-	json_input_t jin{ json };
-
-	jin >> o;
+	return write_if_changed_impl(
+			sax_output::value_kind_tag_t< sax_output::value_kind_t::via_dom >{},
+			reader_writer,
+			current,
+			baseline,
+			to,
+			allocator );
 }
 
-/*!
- * Helper function to read DTO from already parsed document by
- * using a custom Reader_Writer object.
- *
- * Usage example:
- * @code
- * class some_data {
- * public:
- * 	...
- * 	template<typename Io> void json_io(Io & io) {...}
- * };
- * struct some_data_reader_writer {
- * 	void read( some_data & obj, const rapidjson::Value & from ) const {...}
- *
- * 	void write( const some_data & obj, rapidjson::Value & to, rapidjson::MemoryPoolAllocator<> & allocator ) const {...}
- * };
- * ...
- * rapidjson::Document & doc = ...;
- * some_data unpacked_data;
- * json_dto::from_json( some_data_reader_writer{}, doc["SomeData"], unpacked_data );
- * @endcode
- *
- * @note
- * The state of @a o object is not defined if an error occurs.
- *
- * @since v.0.3.4
- */
-template< typename Type, typename Reader_Writer >
-void
-from_json(
-	//! Custom Reader_Writer to be used.
+template< typename Reader_Writer, typename T >
+bool
+write_if_changed_impl(
+	sax_output::value_kind_tag_t< sax_output::value_kind_t::map >,
 	const Reader_Writer & reader_writer,
-	//! JSON representation of value to be extracted.
-	const rapidjson::Value & json,
-	//! The receiver of the extracted value.
-	Type & o )
+	const T & current,
+	const T & baseline,
+	rapidjson::Value & to,
+	rapidjson::MemoryPoolAllocator<> & allocator )
 {
-	reader_writer.read( o, json );
+	return write_map_delta( reader_writer, current, baseline, to, allocator,
+			reuse::has_unique_keys< T >{} );
 }
 
-//! Helper function to read DTO from json-string in form of string_ref.
-//!
-//! @note
-//! Type @a Type is required to be DefaultConstructible.
-//!
-//! @since v.0.2.9
-template<
-	typename Type,
-	unsigned Rapidjson_Parseflags = rapidjson::kParseDefaultFlags >
-JSON_DTO_NODISCARD
-Type
-from_json(
-	//! Value to be parsed.
-	const string_ref_t & json )
+// An empty value is written as null, the content of non-empty
+// values is compared.
+template< typename Reader_Writer, typename T >
+bool
+write_content_delta(
+	const Reader_Writer & reader_writer,
+	const T & current,
+	const T & baseline,
+	rapidjson::Value & to,
+	rapidjson::MemoryPoolAllocator<> & allocator )
 {
-	rapidjson::Document document;
+	const auto & content_reader_writer =
+			sax_output::content_reader_writer< Reader_Writer >::get( reader_writer );
 
-	document.Parse< Rapidjson_Parseflags >( json.s, json.length );
+	if( !current )
+	{
+		if( !baseline )
+			return false;
 
-	check_document_parse_status( document );
+		to.SetNull();
+		return true;
+	}
 
-	return from_json<Type>( document );
+	if( !baseline )
+	{
+		content_reader_writer.write( *current, to, allocator );
+		return true;
+	}
+
+	return write_if_changed(
+			content_reader_writer, *current, *baseline, to, allocator );
 }
 
-/*!
- * @brief Helper function to read DTO from json-string in form of string_ref
- * with a custom Reader-Writer object.
- *
- * Usage example:
- * @code
- * class some_data {
- * public:
- * 	...
- * 	template<typename Io> void json_io(Io & io) {...}
- * };
- * struct some_data_reader_writer {
- * 	void read( some_data & obj, const rapidjson::Value & from ) const {...}
- *
- * 	void write( const some_data & obj, rapidjson::Value & to, rapidjson::MemoryPoolAllocator<> & allocator ) const {...}
- * };
- * ...
- * jsom_dto::string_ref_t json_string = ...;
- * auto unpacked_data = json_dto::from_json<some_data>( some_data_reader_writer{}, json_string );
- * @endcode
- *
- * @note
- * Type @a Type is required to be DefaultConstructible.
- *
- * @since v.0.3.4
- */
-template<
-	typename Type,
-	typename Reader_Writer,
-	unsigned Rapidjson_Parseflags = rapidjson::kParseDefaultFlags >
-JSON_DTO_NODISCARD
-Type
-from_json(
-	//! Custom Reader_Writer to be used.
+template< typename Reader_Writer, typename T >
+bool
+write_if_changed_impl(
+	sax_output::value_kind_tag_t< sax_output::value_kind_t::nullable >,
 	const Reader_Writer & reader_writer,
-	//! Value to be parsed.
-	const string_ref_t & json )
+	const T & current,
+	const T & baseline,
+	rapidjson::Value & to,
+	rapidjson::MemoryPoolAllocator<> & allocator )
 {
-	rapidjson::Document document;
-
-	document.Parse< Rapidjson_Parseflags >( json.s, json.length );
-
-	check_document_parse_status( document );
+	return write_content_delta( reader_writer, current, baseline, to, allocator );
+}
 
-	return from_json<Type, Reader_Writer>( reader_writer, document );
+template< typename Reader_Writer, typename T >
+bool
+write_if_changed_impl(
+	sax_output::value_kind_tag_t< sax_output::value_kind_t::optional >,
+	const Reader_Writer & reader_writer,
+	const T & current,
+	const T & baseline,
+	rapidjson::Value & to,
+	rapidjson::MemoryPoolAllocator<> & allocator )
+{
+	return write_content_delta( reader_writer, current, baseline, to, allocator );
 }
 
-//! Helper function to read DTO from json-string.
-//!
-//! @note
-//! Type @a Type is required to be DefaultConstructible.
-template<
-	typename Type,
-	unsigned Rapidjson_Parseflags = rapidjson::kParseDefaultFlags >
-JSON_DTO_NODISCARD
-Type
-from_json(
-	//! Value to be parsed.
-	const std::string & json )
+template< typename Reader_Writer, typename T >
+bool
+write_if_changed(
+	const Reader_Writer & reader_writer,
+	const T & current,
+	const T & baseline,
+	rapidjson::Value & to,
+	rapidjson::MemoryPoolAllocator<> & allocator )
 {
-	return from_json< Type, Rapidjson_Parseflags >( make_string_ref(json) );
+	using tag_t = sax_output::value_kind_tag_t<
+			sax_output::detect_output_value_kind<
+					Reader_Writer,
+					T,
+					json_output_t >() >;
+
+	return write_if_changed_impl(
+			tag_t{}, reader_writer, current, baseline, to, allocator );
 }
 
-//! Helper function to read DTO from json-string.
+template< typename Dto >
+void
+patch_dto( const rapidjson::Value & patch, Dto & dto );
+
 /*!
- * This version reads the JSON content from a raw char pointer
- * (it's assumed that it is a null-terminated string).
+ * @brief Turns merge patch mode off while a new value is read.
  *
- * @note
- * Type @a Type is required to be DefaultConstructible.
+ * Values that replace fields are read completely even in merge patch mode.
  *
- * @since v.0.2.9
+ * @since v.0.3.5
  */
-template<
-	typename Type,
-	unsigned Rapidjson_Parseflags = rapidjson::kParseDefaultFlags >
-JSON_DTO_NODISCARD
-Type
-from_json(
-	//! Value to be parsed.
-	const char * json )
+class full_read_t
 {
-	return from_json< Type, Rapidjson_Parseflags >( make_string_ref(json) );
-}
+	const bool m_previous;
+
+public:
+	full_read_t() noexcept
+		:	m_previous{ merge_patch_mode_flag() }
+	{
+		merge_patch_mode_flag() = false;
+	}
+
+	full_read_t( const full_read_t & ) = delete;
+	full_read_t &
+	operator=( const full_read_t & ) = delete;
+
+	~full_read_t() noexcept
+	{
+		merge_patch_mode_flag() = m_previous;
+	}
+};
 
-//! Helper function to read DTO from json-string.
 /*!
- * This version reads the JSON content from a raw char pointer
- * (it's assumed that it is a null-terminated string).
- *
- * Usage example:
- * @code
- * class some_data {
- * public:
- * 	...
- * 	template<typename Io> void json_io(Io & io) {...}
- * };
- * struct some_data_reader_writer {
- * 	void read( some_data & obj, const rapidjson::Value & from ) const {...}
- *
- * 	void write( const some_data & obj, rapidjson::Value & to, rapidjson::MemoryPoolAllocator<> & allocator ) const {...}
- * };
- * ...
- * const char * json_string = ...;
- * auto unpacked_data = json_dto::from_json<some_data>( some_data_reader_writer{}, json_string );
- * @endcode
+ * @brief Update @a field by @a patch in place.
  *
- * @note
- * Type @a Type is required to be DefaultConstructible.
+ * @return false if @a field has to be read from @a patch in the usual way.
  *
- * @since v.0.3.4
+ * @since v.0.3.5
  */
-template<
-	typename Type,
-	typename Reader_Writer,
-	unsigned Rapidjson_Parseflags = rapidjson::kParseDefaultFlags >
-JSON_DTO_NODISCARD
-Type
-from_json(
-	//! Custom Reader_Writer to be used.
+template< typename Reader_Writer, typename T >
+bool
+patch_value(
 	const Reader_Writer & reader_writer,
-	//! Value to be parsed.
-	const char * json )
+	T & field,
+	const rapidjson::Value & patch );
+
+template< typename Tag, typename Reader_Writer, typename T >
+bool
+patch_value_impl(
+	Tag,
+	const Reader_Writer &,
+	T &,
+	const rapidjson::Value & )
 {
-	return from_json< Type, Reader_Writer, Rapidjson_Parseflags >(
-			reader_writer, make_string_ref(json) );
+	return false;
 }
 
-//! Helper function to read DTO from json-string.
-/*!
- * This version reads the JSON content from a std::string.
- *
- * @note
- * Type @a Type is required to be DefaultConstructible.
- *
- * @since v.0.3.4
- */
-template<
-	typename Type,
-	typename Reader_Writer,
-	unsigned Rapidjson_Parseflags = rapidjson::kParseDefaultFlags >
-JSON_DTO_NODISCARD
-Type
-from_json(
-	//! Custom Reader_Writer to be used.
+template< typename Reader_Writer, typename T >
+bool
+patch_value_impl(
+	sax_output::value_kind_tag_t< sax_output::value_kind_t::dto >,
+	const Reader_Writer &,
+	T & field,
+	const rapidjson::Value & patch )
+{
+	if( !patch.IsObject() )
+		return false;
+
+	patch_dto( patch, field );
+	return true;
+}
+
+// null removes an entry, other entries are updated or inserted.
+template< typename Reader_Writer, typename T >
+bool
+patch_map(
 	const Reader_Writer & reader_writer,
-	//! Value to be parsed.
-	const std::string & json )
+	T & field,
+	const rapidjson::Value & patch,
+	std::true_type /*has_unique_keys*/ )
+{
+	const auto & item_reader_writer =
+			sax_output::content_reader_writer< Reader_Writer >::get( reader_writer );
+
+	typename T::key_type key{};
+	for_each_member( patch, [&]( const rapidjson::Value::Member & member ) {
+			const auto existing = reuse::find_entry(
+					field, field.end(), item_reader_writer, member.name, key );
+
+			if( member.value.IsNull() )
+			{
+				if( field.end() != existing )
+					field.erase( existing );
+			}
+			else if( field.end() != existing )
+			{
+				if( !patch_value( item_reader_writer, existing->second, member.value ) )
+				{
+					full_read_t full_read;
+					item_reader_writer.read( existing->second, member.value );
+				}
+			}
+			else
+			{
+				full_read_t full_read;
+				item_reader_writer.read(
+						associative_containers::emplace_key( field, key ).m_it->second,
+						member.value );
+			}
+		} );
+
+	return true;
+}
+
+template< typename Reader_Writer, typename T >
+bool
+patch_map(
+	const Reader_Writer &,
+	T &,
+	const rapidjson::Value &,
+	std::false_type /*has_unique_keys*/ )
 {
-	return from_json< Type, Reader_Writer, Rapidjson_Parseflags >(
-			reader_writer, make_string_ref(json) );
+	return false;
 }
 
-//! Helper function to read an already instantiated DTO.
-/*!
- * This version reads the JSON content from a string_ref_t (aka
- * rapidjson::Value::StringRefType) object.
- *
- * @note
- * The state of @a o object is undefined if an error occurs.
- *
- * @since v.0.2.9
- */
-template<
-	typename Type,
-	unsigned Rapidjson_Parseflags = rapidjson::kParseDefaultFlags >
-void
-from_json(
-	//! Value to be parsed.
-	const string_ref_t & json,
-	//! The receiver of the extracted value.
-	Type & o )
+template< typename Reader_Writer, typename T >
+bool
+patch_value_impl(
+	sax_output::value_kind_tag_t< sax_output::value_kind_t::map >,
+	const Reader_Writer & reader_writer,
+	T & field,
+	const rapidjson::Value & patch )
 {
-	rapidjson::Document document;
+	if( !patch.IsObject() )
+		return false;
 
-	document.Parse< Rapidjson_Parseflags >( json.s, json.length );
+	return patch_map( reader_writer, field, patch, reuse::has_unique_keys< T >{} );
+}
 
-	check_document_parse_status( document );
+// The content of a non-empty value is patched.
+template< typename Reader_Writer, typename T >
+bool
+patch_content(
+	const Reader_Writer & reader_writer,
+	T & field,
+	const rapidjson::Value & patch )
+{
+	if( patch.IsNull() || !field )
+		return false;
 
-	from_json( document, o );
+	return patch_value(
+			sax_output::content_reader_writer< Reader_Writer >::get( reader_writer ),
+			*field,
+			patch );
 }
 
-//! Helper function to read an already instantiated DTO with
-//! a custom Reader-Writer object.
-/*!
- * This version reads the JSON content from a string_ref_t (aka
- * rapidjson::Value::StringRefType) object.
- *
- * Usage example:
- * @code
- * class some_data {
- * public:
- * 	...
- * 	template<typename Io> void json_io(Io & io) {...}
- * };
- * struct some_data_reader_writer {
- * 	void read( some_data & obj, const rapidjson::Value & from ) const {...}
- *
- * 	void write( const some_data & obj, rapidjson::Value & to, rapidjson::MemoryPoolAllocator<> & allocator ) const {...}
- * };
- * ...
- * json_dto::string_ref_t json_string = ...;
- * some_data unpacked_data;
- * json_dto::from_json( some_data_reader_writer{}, json_string, unpacked_data );
- * @endcode
- *
- * @note
- * The state of @a o object is undefined if an error occurs.
- *
- * @since v.0.3.4
- */
-template<
-	typename Type,
-	typename Reader_Writer,
-	unsigned Rapidjson_Parseflags = rapidjson::kParseDefaultFlags >
-void
-from_json(
-	//! Custom Reader_Writer to be used.
+template< typename Reader_Writer, typename T >
+bool
+patch_value_impl(
+	sax_output::value_kind_tag_t< sax_output::value_kind_t::nullable >,
 	const Reader_Writer & reader_writer,
-	//! Value to be parsed.
-	const string_ref_t & json,
-	//! The receiver of the extracted value.
-	Type & o )
+	T & field,
+	const rapidjson::Value & patch )
 {
-	rapidjson::Document document;
+	return patch_content( reader_writer, field, patch );
+}
 
-	document.Parse< Rapidjson_Parseflags >( json.s, json.length );
+template< typename Reader_Writer, typename T >
+bool
+patch_value_impl(
+	sax_output::value_kind_tag_t< sax_output::value_kind_t::optional >,
+	const Reader_Writer & reader_writer,
+	T & field,
+	const rapidjson::Value & patch )
+{
+	return patch_content( reader_writer, field, patch );
+}
 
-	check_document_parse_status( document );
+template< typename Reader_Writer, typename T >
+bool
+patch_value(
+	const Reader_Writer & reader_writer,
+	T & field,
+	const rapidjson::Value & patch )
+{
+	// Constant fields are handled by the usual readers.
+	using tag_t = sax_output::value_kind_tag_t<
+			std::is_const< T >::value ?
+					sax_output::value_kind_t::via_dom :
+					sax_output::detect_value_kind<
+							Reader_Writer,
+							std::remove_cv_t< T >,
+							json_input_t >() >;
+
+	return patch_value_impl( tag_t{}, reader_writer, field, patch );
+}
 
-	from_json( reader_writer, document, o );
+// Merge patch mode: null removes the field.
+template< typename Tag, typename Manopt_Policy, typename T >
+void
+remove_field_impl( Tag, const Manopt_Policy & manopt_policy, T & field )
+{
+	manopt_policy.on_field_not_defined( field );
 }
 
-//! Helper function to read an already instantiated DTO.
-//!
-//! @note
-//! The state of @a o object is not defined if an error occurs.
-template<
-	typename Type,
-	unsigned Rapidjson_Parseflags = rapidjson::kParseDefaultFlags >
+template< typename Manopt_Policy, typename T >
 void
-from_json(
-	//! Value to be parsed.
-	const std::string & json,
-	//! The receiver of the extracted value.
-	Type & o )
+remove_field_impl(
+	sax_output::value_kind_tag_t< sax_output::value_kind_t::nullable >,
+	const Manopt_Policy &,
+	T & field )
 {
-	from_json< Type, Rapidjson_Parseflags >( make_string_ref(json), o );
+	field.reset();
 }
 
-//! Helper function to read an already instantiated DTO.
-/*!
- * Usage example:
- * @code
- * class some_data {
- * public:
- * 	...
- * 	template<typename Io> void json_io(Io & io) {...}
- * };
- * struct some_data_reader_writer {
- * 	void read( some_data & obj, const rapidjson::Value & from ) const {...}
- *
- * 	void write( const some_data & obj, rapidjson::Value & to, rapidjson::MemoryPoolAllocator<> & allocator ) const {...}
- * };
- * ...
- * const std::string json_string = ...;
- * auto unpacked_data = json_dto::from_json<some_data>( some_data_reader_writer{}, json_string );
- * @endcode
- *
- * @note
- * The state of @a o object is not defined if an error occurs.
- *
- * @since v.0.3.4
- */
-template<
-	typename Type,
-	typename Reader_Writer,
-	unsigned Rapidjson_Parseflags = rapidjson::kParseDefaultFlags >
+template< typename Manopt_Policy, typename T >
 void
-from_json(
-	//! Custom Reader_Writer to be used.
-	const Reader_Writer & reader_writer,
-	//! Value to be parsed.
-	const std::string & json,
-	//! The receiver of the extracted value.
-	Type & o )
+remove_field_impl(
+	sax_output::value_kind_tag_t< sax_output::value_kind_t::optional >,
+	const Manopt_Policy &,
+	T & field )
 {
-	from_json< Type, Reader_Writer, Rapidjson_Parseflags >(
-			reader_writer, make_string_ref(json), o );
+	// std::experimental::optional has no reset().
+	field = T{};
 }
 
-//! Helper function to read an already instantiated DTO.
-/*!
- * This version reads the JSON content from a raw char pointer
- * (it's assumed that it is a null-terminated string).
- *
- * @note
- * The state of @a o object is not defined if an error occurs.
- *
- * @since v.0.2.9
- */
-template< typename Type, unsigned Rapidjson_Parseflags = rapidjson::kParseDefaultFlags >
+template< typename Data_Holder >
 void
-from_json(
-	//! Value to be parsed.
-	const char * json,
-	//! The receiver of the extracted value.
-	Type & o )
+remove_field( const Data_Holder & holder )
 {
-	from_json< Type, Rapidjson_Parseflags >( make_string_ref(json), o );
+	using reader_writer_t = std::decay_t< decltype( holder.reader_writer() ) >;
+	using field_t = std::remove_reference_t<
+			decltype( holder.field_for_deserialization() ) >;
+
+	using tag_t = sax_output::value_kind_tag_t<
+			std::is_const< field_t >::value ?
+					sax_output::value_kind_t::via_dom :
+					sax_output::detect_value_kind<
+							reader_writer_t,
+							std::remove_cv_t< field_t >,
+							json_input_t >() >;
+
+	remove_field_impl(
+			tag_t{},
+			holder.manopt_policy(),
+			holder.field_for_deserialization() );
 }
 
+} /* namespace delta */
+
+} /* namespace details */
+
+//
+// json_delta_baseline_t
+//
+
 /*!
- * @brief Helper function to read an already instantiated DTO with
- * a custom Reader-Writer.
+ * @brief Collector of fields of the baseline object for to_json_delta().
  *
- * Usage example:
- * @code
- * class some_data {
- * public:
- * 	...
- * 	template<typename Io> void json_io(Io & io) {...}
- * };
- * struct some_data_reader_writer {
- * 	void read( some_data & obj, const rapidjson::Value & from ) const {...}
- *
- * 	void write( const some_data & obj, rapidjson::Value & to, rapidjson::MemoryPoolAllocator<> & allocator ) const {...}
- * };
- * ...
- * const char * json_string = ...;
- * some_data unpacked_data;
- * json_dto::from_json( some_data_reader_writer{}, json_string, unpacked_data );
- * @endcode
- *
- * @note
- * The state of @a o object is not defined if an error occurs.
+ * Fields are identified by positions of their binders in json_io().
  *
- * @since v.0.3.4
+ * @since v.0.3.5
  */
-template<
-	typename Type,
-	typename Reader_Writer,
-	unsigned Rapidjson_Parseflags = rapidjson::kParseDefaultFlags >
-void
-from_json(
-	//! Custom Reader_Writer to be used.
-	const Reader_Writer & reader_writer,
-	//! Value to be parsed.
-	const char * json,
-	//! The receiver of the extracted value.
-	Type & o )
+class json_delta_baseline_t
 {
-	from_json< Type, Reader_Writer, Rapidjson_Parseflags >(
-			reader_writer, make_string_ref(json), o );
-}
+	public:
+		template< typename Binder >
+		json_delta_baseline_t &
+		operator & ( const Binder & b )
+		{
+			b.write_to_dispatcher( *this );
+			return *this;
+		}
+
+		template< typename Write_To_Impl, typename Data_Holder >
+		void
+		write_field( const Data_Holder & holder )
+		{
+			m_fields.push_back( &holder.field_for_serialization() );
+		}
+
+		const std::vector< const void * > &
+		fields() const noexcept { return m_fields; }
+
+	private:
+		std::vector< const void * > m_fields;
+};
+
+//
+// json_delta_output_t
+//
 
 /*!
- * @brief Serialize an object into specified stream.
+ * @brief Output object for writing fields that differ from fields
+ * of the baseline object.
  *
- * @note
- * Default formatting will be used. If one needs pretty-formatted
- * output then another overload has to be used.
+ * @since v.0.3.5
  */
-template< typename Type >
-void
-to_stream(
-	//! Target stream.
-	std::ostream & to,
-	//! Value to be serialized.
-	const Type & type )
+class json_delta_output_t
 {
-	rapidjson::Document output_doc;
-	json_dto::json_output_t jout{
-		output_doc, output_doc.GetAllocator() };
+	public:
+		json_delta_output_t(
+			rapidjson::Value & object,
+			rapidjson::MemoryPoolAllocator<> & allocator,
+			const std::vector< const void * > & baseline )
+			:	m_object{ object }
+			,	m_allocator{ allocator }
+			,	m_baseline{ baseline }
+		{
+			m_object.SetObject();
+		}
 
-	jout << type;
+		template< typename Binder >
+		json_delta_output_t &
+		operator & ( const Binder & b )
+		{
+			b.write_to_dispatcher( *this );
+			return *this;
+		}
 
-	rapidjson::OStreamWrapper wrapper{ to };
-	rapidjson::Writer< rapidjson::OStreamWrapper > writer{ wrapper };
+		template< typename Write_To_Impl, typename Data_Holder >
+		void
+		write_field( const Data_Holder & holder )
+		{
+			using field_t = std::decay_t<
+					decltype( holder.field_for_serialization() ) >;
+
+			if( m_baseline.size() <= m_index )
+				return report_error( error_code_t::other,
+						"json_io() binds different fields for the current and "
+						"the baseline objects" );
+
+			const field_t & current = holder.field_for_serialization();
+			const field_t & baseline =
+					*static_cast< const field_t * >( m_baseline[ m_index++ ] );
+
+			holder.validator()( current ); // validate value.
+
+			rapidjson::Value value;
+			if( details::delta::write_if_changed(
+					holder.reader_writer(), current, baseline, value, m_allocator ) )
+				m_object.AddMember( holder.field_name(), value, m_allocator );
+		}
+
+	private:
+		rapidjson::Value & m_object;
+		rapidjson::MemoryPoolAllocator<> & m_allocator;
+
+		const std::vector< const void * > & m_baseline;
+		std::size_t m_index{ 0u };
+};
 
-	const bool result = output_doc.Accept( writer );
-	if( !result )
-		throw ex_t{ "to_stream: output_doc.Accept(writer) returns false" };
-}
+//
+// json_patch_input_t
+//
 
 /*!
- * @brief Serialize an object into specified stream with custom
- * Reader-Writer object.
- *
- * Usage example:
- * @code
- * class some_data {
- * public:
- * 	...
- * 	template<typename Io> void json_io(Io & io) {...}
- * };
- * struct some_data_reader_writer {
- * 	void read( some_data & obj, const rapidjson::Value & from ) const {...}
- *
- * 	void write( const some_data & obj, rapidjson::Value & to, rapidjson::MemoryPoolAllocator<> & allocator ) const {...}
- * };
- * ...
- * some_data data_to_pack{...};
- * json_dto::to_stream(some_data_reader_writer{}, std::cout, data_to_pack);
- * @endcode
+ * @brief Input object for reading a delta or a merge patch.
  *
- * @note
- * Default formatting will be used. If one needs pretty-formatted
- * output then another overload has to be used.
+ * Fields that are missing in the delta are left untouched.
  *
- * @since v.0.3.4
+ * @since v.0.3.5
  */
-template<
-	typename Type,
-	typename Reader_Writer >
-void
-to_stream(
-	//! Custom Reader_Writer to be used.
-	const Reader_Writer & reader_writer,
-	//! Target stream.
-	std::ostream & to,
-	//! Value to be serialized.
-	const Type & type )
+class json_patch_input_t
 {
-	rapidjson::Document output_doc;
+	public:
+		explicit json_patch_input_t( const rapidjson::Value & object )
+			:	m_object{ object }
+		{}
 
-	reader_writer.write( type, output_doc, output_doc.GetAllocator() );
+		template< typename Binder >
+		json_patch_input_t &
+		operator & ( const Binder & b )
+		{
+			read_binder(
+					b, details::member_index::has_read_from_dispatcher< Binder >{} );
+			return *this;
+		}
 
-	rapidjson::OStreamWrapper wrapper{ to };
-	rapidjson::Writer< rapidjson::OStreamWrapper > writer{ wrapper };
+		template< typename Read_From_Impl, typename Data_Holder >
+		void
+		read_field( const Data_Holder & holder )
+		{
+			if( !m_object.IsObject() )
+			{
+				report_error( error_code_t::type_mismatch,
+					"unable to extract field \"" +
+					std::string{ holder.field_name().s } + "\": "
+					"parent json type must be object" );
+				return;
+			}
 
-	const bool result = output_doc.Accept( writer );
-	if( !result )
-		throw ex_t{ "to_stream: output_doc.Accept(writer) returns false" };
-}
+			const auto it = m_object.FindMember( holder.field_name() );
+			if( m_object.MemberEnd() == it )
+				return;
 
-/*!
- * @brief Serialize an object into specified stream with using pretty-writer.
- *
- * @since v.0.2.14
- */
-template< typename Type >
+			patch_field< Read_From_Impl >(
+					holder,
+					it->value,
+					details::meta::has_static_read_from_member<
+							Read_From_Impl, Data_Holder >{} );
+		}
+
+	private:
+		const rapidjson::Value & m_object;
+
+		template< typename Read_From_Impl, typename Data_Holder >
+		void
+		patch_field(
+			const Data_Holder & holder,
+			const rapidjson::Value & value,
+			std::true_type /*has_read_from_member*/ )
+		{
+			auto & field = holder.field_for_deserialization();
+			if( value.IsNull() && merge_patch_mode_t::active() )
+				details::delta::remove_field( holder );
+			else if( !details::delta::patch_value(
+					holder.reader_writer(), field, value ) )
+			{
+				details::delta::full_read_t full_read;
+				Read_From_Impl::read_from_member( holder, &value );
+				return;
+			}
+
+			// A value isn't validated if it isn't read inside try_from_json().
+			if( !details::error_registered() )
+				holder.validator()( field ); // validate value.
+		}
+
+		// A custom implementation reads the field completely.
+		template< typename Read_From_Impl, typename Data_Holder >
+		void
+		patch_field(
+			const Data_Holder & holder,
+			const rapidjson::Value &,
+			std::false_type /*has_read_from_member*/ )
+		{
+			details::delta::full_read_t full_read;
+			Read_From_Impl::read_from( holder, m_object );
+		}
+
+		template< typename Binder >
+		void
+		read_binder( const Binder & b, std::true_type /*has_dispatcher*/ )
+		{
+			b.read_from_dispatcher( *this );
+		}
+
+		// A custom binder reads its field completely.
+		template< typename Binder >
+		void
+		read_binder( const Binder & b, std::false_type /*has_dispatcher*/ )
+		{
+			details::delta::full_read_t full_read;
+			b.read_from( m_object );
+		}
+};
+
+namespace details
+{
+
+namespace delta
+{
+
+template< typename Dto >
 void
-to_stream(
-	//! The target stream.
-	std::ostream & to,
-	//! Object to be serialized.
-	const Type & type,
-	//! Parameters for pretty-writer.
-	pretty_writer_params_t writer_params )
+write_dto_delta(
+	const Dto & current,
+	const Dto & baseline,
+	rapidjson::Value & object,
+	rapidjson::MemoryPoolAllocator<> & allocator )
 {
-	rapidjson::Document output_doc;
-	json_dto::json_output_t jout{
-		output_doc, output_doc.GetAllocator() };
+	json_delta_baseline_t fields;
+	json_io( fields, const_cast< Dto & >( baseline ) );
 
-	jout << type;
+	json_delta_output_t output{ object, allocator, fields.fields() };
+	json_io( output, const_cast< Dto & >( current ) );
+}
 
-	rapidjson::OStreamWrapper wrapper{ to };
-	rapidjson::PrettyWriter< rapidjson::OStreamWrapper > writer{ wrapper };
-	writer.SetIndent(
-			writer_params.m_indent_char,
-			writer_params.m_indent_char_count );
-	writer.SetFormatOptions(
-			writer_params.m_format_options );
+template< typename Dto >
+void
+patch_dto( const rapidjson::Value & patch, Dto & dto )
+{
+	json_patch_input_t input{ patch };
+	json_io( input, dto );
+}
 
-	const bool result = output_doc.Accept( writer );
-	if( !result )
-		throw ex_t{ "to_stream: output_doc.Accept(writer) returns false" };
+template< typename Binder >
+void
+read_member( const Binder & b, const rapidjson::Value & object )
+{
+	json_patch_input_t input{ object };
+	input & b;
 }
 
+} /* namespace delta */
+
+} /* namespace details */
+
 /*!
- * @brief Serialize an object into specified stream with 
- * custom Reader-Writer object and using pretty-writer.
+ * @brief Serialize fields of @a current that differ from fields
+ * of @a baseline.
+ *
+ * Fields are compared by operator== if it's available for their types,
+ * otherwise serialized values are compared. The result has the format
+ * of JSON Merge Patch (RFC 7386):
+ *
+ * - nested DTOs are written as objects with changed fields only;
+ * - map-like containers (except multimaps) are written as objects with
+ *   changed and new entries only, removed entries are written as null;
+ * - empty nullable_t and std::optional are written as null;
+ * - other values (including arrays) are written completely.
+ *
+ * The result is applied by apply_delta(). An empty object means that
+ * there are no changes.
  *
  * Usage example:
  * @code
- * class some_data {
- * public:
- * 	...
- * 	template<typename Io> void json_io(Io & io) {...}
- * };
- * struct some_data_reader_writer {
- * 	void read( some_data & obj, const rapidjson::Value & from ) const {...}
- *
- * 	void write( const some_data & obj, rapidjson::Value & to, rapidjson::MemoryPoolAllocator<> & allocator ) const {...}
- * };
+ * state_t previous = current;
+ * ... // Modification of current.
+ * send( json_dto::to_json_delta( current, previous ) );
  * ...
- * some_data data_to_pack{...};
- * json_dto::to_stream( some_data_reader_writer{}, std::cout, data_to_pack,
- * 	json_dto::pretty_writer_params_t{}.indent_char(' ').indent_char_count(3) );
+ * json_dto::apply_delta( received, replica );
  * @endcode
  *
- * @since v.0.3.4
+ * @attention
+ * json_io() has to bind the same fields in the same order for both
+ * objects. Binders have to refer to fields of the objects, as standard
+ * binders do. Custom specializations of
+ * binder_write_to_implementation_t aren't used.
+ *
+ * @note
+ * Changed values are written even if they are equal to the default
+ * values of optional fields.
+ *
+ * @since v.0.3.5
  */
-template<
-	typename Type,
-	typename Reader_Writer >
-void
-to_stream(
-	//! The reader implementing serialization.
-	const Reader_Writer & reader_writer,
-	//! The target stream.
-	std::ostream & to,
+template< typename Dto >
+JSON_DTO_NODISCARD
+std::string
+to_json_delta(
 	//! Object to be serialized.
-	const Type & type,
-	//! Parameters for pretty-writer.
-	pretty_writer_params_t writer_params )
+	const Dto & current,
+	//! The previous state of the object.
+	const Dto & baseline )
 {
 	rapidjson::Document output_doc;
+	details::delta::write_dto_delta(
+			current, baseline, output_doc, output_doc.GetAllocator() );
 
-	reader_writer.write( type, output_doc, output_doc.GetAllocator() );
-
-	rapidjson::OStreamWrapper wrapper{ to };
-	rapidjson::PrettyWriter< rapidjson::OStreamWrapper > writer{ wrapper };
-	writer.SetIndent(
-			writer_params.m_indent_char,
-			writer_params.m_indent_char_count );
-	writer.SetFormatOptions(
-			writer_params.m_format_options );
+	std::string result;
+	details::string_output_stream_t stream{ result };
+	details::write_document( output_doc, stream );
 
-	const bool result = output_doc.Accept( writer );
-	if( !result )
-		throw ex_t{ "to_stream: output_doc.Accept(writer) returns false" };
+	return result;
 }
 
-//! Helper function to read an already instantiated DTO.
 /*!
+ * @brief Update @a dto by a delta from to_json_delta().
+ *
+ * Fields that are missing in @a delta are left untouched. Nested DTOs
+ * and map-like containers (except multimaps) are updated in place,
+ * null removes an entry of map-like container. Other fields are read
+ * in the usual way (including handling of null and validation).
+ *
  * @note
- * The state of @a o object is not defined if an error occurs.
+ * The state of @a dto object is not defined if an error occurs.
+ *
+ * @since v.0.3.5
  */
-template< typename Type, unsigned Rapidjson_Parseflags = rapidjson::kParseDefaultFlags >
+template< typename Dto >
 void
-from_stream(
-	//! Source stream.
-	std::istream & from,
-	//! The receiver of the extracted value.
-	Type & o )
+apply_delta(
+	//! The delta to be applied.
+	const rapidjson::Value & delta,
+	//! Object to be updated.
+	Dto & dto )
 {
-	rapidjson::IStreamWrapper wrapper{ from };
-
-	rapidjson::Document document;
-	json_dto::json_input_t jin{ document };
-
-	document.ParseStream< Rapidjson_Parseflags >( wrapper );
-
-	check_document_parse_status( document );
+	if( !delta.IsObject() )
+		return report_error( error_code_t::type_mismatch,
+				"delta must be an object" );
 
-	jin >> o;
+	details::delta::patch_dto( delta, dto );
 }
 
-//! Helper function to read an already instantiated DTO with
-//! custom Reader-Writer.
 /*!
- * @note
- * The state of @a o object is not defined if an error occurs.
+ * @brief Update @a dto by a delta from to_json_delta().
  *
- * @since v.0.3.4
+ * @since v.0.3.5
  */
 template<
-	typename Type,
-	typename Reader_Writer,
+	typename Dto,
 	unsigned Rapidjson_Parseflags = rapidjson::kParseDefaultFlags >
 void
-from_stream(
-	//! Custom Reader_Writer to be used.
-	const Reader_Writer & reader_writer,
-	//! Source stream.
-	std::istream & from,
-	//! The receiver of the extracted value.
-	Type & o)
+apply_delta(
+	//! The delta to be applied.
+	const string_ref_t & delta,
+	//! Object to be updated.
+	Dto & dto )
 {
-	rapidjson::IStreamWrapper wrapper{ from };
-
 	rapidjson::Document document;
-	document.ParseStream< Rapidjson_Parseflags >( wrapper );
+
+	document.Parse< Rapidjson_Parseflags >( delta.s, delta.length );
+
 	check_document_parse_status( document );
 
-	reader_writer.read( o, document );
+	apply_delta( static_cast< const rapidjson::Value & >( document ), dto );
 }
 
-//! Helper function to read DTO from a stream.
 /*!
- * @note
- * Type @a Type is required to be DefaultConstructible.
+ * @brief Update @a dto by a delta from to_json_delta().
+ *
+ * @since v.0.3.5
  */
-template< typename Type, unsigned Rapidjson_Parseflags = rapidjson::kParseDefaultFlags >
-JSON_DTO_NODISCARD
-Type
-from_stream(
-	//! Source stream.
-	std::istream & from )
+template<
+	typename Dto,
+	unsigned Rapidjson_Parseflags = rapidjson::kParseDefaultFlags >
+void
+apply_delta(
+	//! The delta to be applied.
+	const std::string & delta,
+	//! Object to be updated.
+	Dto & dto )
 {
-	Type result;
-	from_stream< Type, Rapidjson_Parseflags >( from, result );
-
-	return result;
+	apply_delta< Dto, Rapidjson_Parseflags >( make_string_ref( delta ), dto );
 }
 
-//! Helper function to read DTO from a stream with custom Reader-Writer.
 /*!
- * @note
- * Type @a Type is required to be DefaultConstructible.
+ * @brief Update @a dto by a delta from to_json_delta().
  *
- * @since v.0.3.4
+ * @since v.0.3.5
  */
 template<
-	typename Type,
-	typename Reader_Writer,
+	typename Dto,
 	unsigned Rapidjson_Parseflags = rapidjson::kParseDefaultFlags >
-JSON_DTO_NODISCARD
-Type
-from_stream(
-	//! Custom Reader_Writer to be used.
-	const Reader_Writer & reader_writer,
-	//! Source stream.
-	std::istream & from )
+void
+apply_delta(
+	//! The delta to be applied.
+	const char * delta,
+	//! Object to be updated.
+	Dto & dto )
 {
-	Type result;
-	from_stream< Type, Reader_Writer, Rapidjson_Parseflags >(
-			reader_writer, from, result );
-
-	return result;
+	apply_delta< Dto, Rapidjson_Parseflags >( make_string_ref( delta ), dto );
 }
 
 } /* namespace json_dto */
@@ -16,7 +16,7 @@ namespace json_dto
 inline void
 validator_error( const std::string & error_message )
 {
-	throw ex_t{ error_message };
+	report_error( error_code_t::validation_failed, error_message );
 }
 
 //
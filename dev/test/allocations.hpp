@@ -0,0 +1,125 @@
+#pragma once
+
+// Counting of heap allocations for tests.
+//
+// The header replaces the global operator new and operator delete,
+// so it must be included into only one translation unit of a test.
+
+#include <cstddef>
+#include <cstdlib>
+#include <new>
+
+#include <rapidjson/allocators.h>
+
+// GCC reports mismatched new/delete if the replacements are inlined.
+#if defined( __GNUC__ )
+	#define JSON_DTO_TEST_NOINLINE __attribute__(( noinline ))
+#else
+	#define JSON_DTO_TEST_NOINLINE
+#endif
+
+inline std::size_t &
+allocation_count() noexcept
+{
+	static thread_local std::size_t count = 0u;
+	return count;
+}
+
+JSON_DTO_TEST_NOINLINE void *
+operator new( std::size_t size )
+{
+	++allocation_count();
+	if( void * p = std::malloc( size ? size : 1u ) )
+		return p;
+	throw std::bad_alloc{};
+}
+
+JSON_DTO_TEST_NOINLINE void *
+operator new( std::size_t size, const std::nothrow_t & ) noexcept
+{
+	++allocation_count();
+	return std::malloc( size ? size : 1u );
+}
+
+JSON_DTO_TEST_NOINLINE void
+operator delete( void * p ) noexcept
+{
+	std::free( p );
+}
+
+JSON_DTO_TEST_NOINLINE void
+operator delete( void * p, std::size_t ) noexcept
+{
+	std::free( p );
+}
+
+JSON_DTO_TEST_NOINLINE void
+operator delete( void * p, const std::nothrow_t & ) noexcept
+{
+	std::free( p );
+}
+
+// Base allocator for rapidjson that counts allocations too.
+// rapidjson::CrtAllocator uses std::malloc and isn't counted by
+// the replacement of operator new.
+//
+// Usage example:
+//
+// rapidjson::GenericDocument<
+// 		rapidjson::UTF8<>,
+// 		rapidjson::MemoryPoolAllocator<>,
+// 		counting_allocator_t > document;
+//
+class counting_allocator_t
+{
+public:
+	static const bool kNeedFree = true;
+
+	void *
+	Malloc( std::size_t size )
+	{
+		if( !size )
+			return nullptr;
+
+		++allocation_count();
+		return std::malloc( size );
+	}
+
+	void *
+	Realloc( void * original, std::size_t, std::size_t new_size )
+	{
+		if( !new_size )
+		{
+			std::free( original );
+			return nullptr;
+		}
+
+		++allocation_count();
+		return std::realloc( original, new_size );
+	}
+
+	static void
+	Free( void * p ) noexcept
+	{
+		std::free( p );
+	}
+};
+
+// Allocator for rapidjson values with memory in a local buffer.
+// Writing of values into it doesn't allocate until the buffer is full.
+template< std::size_t Size = 4096u >
+struct buffered_allocator_t
+{
+	alignas( 8 ) char m_buffer[ Size ];
+	rapidjson::MemoryPoolAllocator<> m_allocator{ m_buffer, Size };
+};
+
+// Count of allocations made by the current thread in action().
+template< typename Action >
+std::size_t
+allocations_of( Action && action )
+{
+	const auto before = allocation_count();
+	action();
+	return allocation_count() - before;
+}
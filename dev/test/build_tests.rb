@@ -23,5 +23,24 @@ MxxRu::Cpp::composite_target {
 	required_prj( "test/write_const_objects/prj.ut.rb" )
 	required_prj( "test/serialize_only_with_reader_writer/prj.ut.rb" )
 	required_prj( "test/issue_20_vector_of_nullable/prj.ut.rb" )
+	required_prj( "test/sax_output/prj.ut.rb" )
+	required_prj( "test/sax_input/prj.ut.rb" )
+	required_prj( "test/member_index/prj.ut.rb" )
+	required_prj( "test/parse_context/prj.ut.rb" )
+	required_prj( "test/serializer/prj.ut.rb" )
+	required_prj( "test/from_json_insitu/prj.ut.rb" )
+	required_prj( "test/string_view/prj.ut.rb" )
+	required_prj( "test/reuse_mode/prj.ut.rb" )
+	required_prj( "test/numeric_arrays/prj.ut.rb" )
+	required_prj( "test/in_place/prj.ut.rb" )
+	required_prj( "test/try_from_json/prj.ut.rb" )
+	required_prj( "test/error_path/prj.ut.rb" )
+	required_prj( "test/instrumentation/prj.ut.rb" )
+	required_prj( "test/projection/prj.ut.rb" )
+	required_prj( "test/raw_json/prj.ut.rb" )
+	required_prj( "test/lazy/prj.ut.rb" )
+	required_prj( "test/delta/prj.ut.rb" )
+	required_prj( "test/merge_patch/prj.ut.rb" )
+	required_prj( "test/msgpack/prj.ut.rb" )
 }
 
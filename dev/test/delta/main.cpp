@@ -0,0 +1,182 @@
+#include <catch2/catch.hpp>
+
+#include <map>
+#include <string>
+#include <vector>
+
+#include <json_dto/pub.hpp>
+#include <json_dto/validators.hpp>
+
+#include <test/helper.hpp>
+
+using namespace json_dto;
+
+struct position_t
+{
+	double m_x{};
+	double m_y{};
+
+	template< typename Json_Io >
+	void
+	json_io( Json_Io & io )
+	{
+		io
+			& mandatory( "x", m_x )
+			& mandatory( "y", m_y );
+	}
+};
+
+struct unit_t
+{
+	std::string m_name;
+	position_t m_position;
+	int m_health{};
+	std::vector< int > m_items;
+	std::map< std::string, position_t > m_waypoints;
+	nullable_t< std::string > m_target;
+
+	template< typename Json_Io >
+	void
+	json_io( Json_Io & io )
+	{
+		io
+			& mandatory( "name", m_name )
+			& mandatory( "position", m_position )
+			& mandatory( "health", m_health, min_max_constraint( 0, 100 ) )
+			& mandatory( "items", m_items )
+			& mandatory( "waypoints", m_waypoints )
+			& mandatory( "target", m_target );
+	}
+};
+
+// A type with non-intrusive json_io.
+struct frame_size_t
+{
+	int m_width{};
+	int m_height{};
+};
+
+namespace json_dto
+{
+
+template< typename Json_Io >
+void
+json_io( Json_Io & io, frame_size_t & s )
+{
+	io
+		& mandatory( "width", s.m_width )
+		& mandatory( "height", s.m_height );
+}
+
+} /* namespace json_dto */
+
+unit_t
+make_unit()
+{
+	unit_t unit;
+	unit.m_name = "scout";
+	unit.m_position = position_t{ 1.0, 2.0 };
+	unit.m_health = 100;
+	unit.m_items = { 1, 2 };
+	unit.m_waypoints[ "a" ] = position_t{ 0.0, 0.0 };
+	unit.m_waypoints[ "b" ] = position_t{ 5.0, 5.0 };
+
+	return unit;
+}
+
+TEST_CASE( "no changes" , "[delta]" )
+{
+	const auto unit = make_unit();
+
+	REQUIRE( "{}" == to_json_delta( unit, unit ) );
+	REQUIRE( "{}" == to_json_delta( unit, make_unit() ) );
+}
+
+TEST_CASE( "changed fields" , "[delta]" )
+{
+	const auto baseline = make_unit();
+	auto current = baseline;
+
+	current.m_position.m_y = 3.0;
+	current.m_health = 50;
+	REQUIRE( R"({"position":{"y":3.0},"health":50})" ==
+			to_json_delta( current, baseline ) );
+
+	// Arrays are written completely.
+	current = baseline;
+	current.m_items.push_back( 3 );
+	REQUIRE( R"({"items":[1,2,3]})" == to_json_delta( current, baseline ) );
+
+	// Entries of maps are compared separately.
+	current = baseline;
+	current.m_waypoints[ "b" ].m_x = 4.0;
+	current.m_waypoints[ "c" ] = position_t{ 7.0, 8.0 };
+	current.m_waypoints.erase( "a" );
+	REQUIRE( R"({"waypoints":{"b":{"x":4.0},"c":{"x":7.0,"y":8.0},"a":null}})" ==
+			to_json_delta( current, baseline ) );
+
+	// Empty nullable_t is written as null.
+	current = baseline;
+	current.m_target = "base";
+	REQUIRE( R"({"target":"base"})" == to_json_delta( current, baseline ) );
+	REQUIRE( R"({"target":null})" == to_json_delta( baseline, current ) );
+
+	// Values are validated.
+	current = baseline;
+	current.m_health = 101;
+	REQUIRE_THROWS_AS( to_json_delta( current, baseline ), ex_t );
+}
+
+TEST_CASE( "apply" , "[delta]" )
+{
+	const auto baseline = make_unit();
+	auto current = baseline;
+
+	current.m_name = "sniper";
+	current.m_position.m_x = -1.0;
+	current.m_items.clear();
+	current.m_waypoints[ "b" ].m_y = 6.0;
+	current.m_waypoints[ "c" ] = position_t{ 7.0, 8.0 };
+	current.m_waypoints.erase( "a" );
+	current.m_target = "base";
+
+	auto replica = baseline;
+	apply_delta( to_json_delta( current, baseline ), replica );
+	REQUIRE( to_json( current ) == to_json( replica ) );
+
+	apply_delta( to_json_delta( baseline, current ), replica );
+	REQUIRE( to_json( baseline ) == to_json( replica ) );
+
+	// Missing fields are left untouched.
+	apply_delta( R"({"position":{"y":0}})", replica );
+	REQUIRE( "scout" == replica.m_name );
+	REQUIRE( equal( 1.0, replica.m_position.m_x ) );
+	REQUIRE( equal( 0.0, replica.m_position.m_y ) );
+	REQUIRE( 2 == replica.m_waypoints.size() );
+}
+
+TEST_CASE( "apply errors" , "[delta]" )
+{
+	auto replica = make_unit();
+
+	REQUIRE_THROWS_WITH( apply_delta( "[]", replica ),
+			"delta must be an object" );
+	REQUIRE_THROWS_AS( apply_delta( R"({"health":"full"})", replica ), ex_t );
+	REQUIRE_THROWS_AS( apply_delta( R"({"health":1000})", replica ), ex_t );
+	REQUIRE_THROWS_AS( apply_delta( R"({"name":null})", replica ), ex_t );
+	REQUIRE_THROWS_AS( apply_delta( R"({"health":)", replica ), ex_t );
+}
+
+TEST_CASE( "non-intrusive json_io" , "[delta]" )
+{
+	const frame_size_t baseline{ 640, 480 };
+	frame_size_t current{ 800, 480 };
+
+	REQUIRE( "{}" == to_json_delta( baseline, baseline ) );
+	REQUIRE( R"({"width":800})" == to_json_delta( current, baseline ) );
+
+	auto replica = baseline;
+	apply_delta( to_json_delta( current, baseline ), replica );
+	REQUIRE( 800 == replica.m_width );
+	REQUIRE( 480 == replica.m_height );
+}
@@ -0,0 +1,10 @@
+require 'mxx_ru/cpp'
+MxxRu::Cpp::exe_target {
+	required_prj 'rapidjson_mxxru/prj.rb'
+	required_prj 'test/catch_main/prj.rb'
+
+	target( "_unit.test.delta" )
+
+	cpp_source( "main.cpp" )
+}
+
@@ -0,0 +1,318 @@
+#include <catch2/catch.hpp>
+
+#include <array>
+#include <deque>
+#include <iostream>
+#include <map>
+#include <set>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <json_dto/pub.hpp>
+
+#include <test/helper.hpp>
+
+using namespace json_dto;
+
+struct point_t
+{
+	int m_x{};
+	int m_y{};
+
+	template< typename Json_Io >
+	void
+	json_io( Json_Io & io )
+	{
+		io
+			& mandatory( "x", m_x )
+			& mandatory( "y", m_y );
+	}
+};
+
+struct shape_t
+{
+	std::vector< point_t > m_points;
+	std::map< std::string, point_t > m_anchors;
+	std::array< std::int8_t, 2 > m_pair{};
+	std::deque< std::set< int > > m_groups;
+	point_t m_center;
+
+	template< typename Json_Io >
+	void
+	json_io( Json_Io & io )
+	{
+		io
+			& optional( "points", m_points, std::vector< point_t >{} )
+			& optional( "anchors/~", m_anchors,
+					std::map< std::string, point_t >{} )
+			& optional( "pair", m_pair, std::array< std::int8_t, 2 >{} )
+			& optional( "groups", m_groups, std::deque< std::set< int > >{} )
+			& optional_no_default(
+					inside_array::reader_writer(
+						inside_array::member( m_center.m_x ),
+						inside_array::member( m_center.m_y ) ),
+					"center", m_center );
+	}
+};
+
+struct drawing_t
+{
+	std::vector< shape_t > m_shapes;
+
+	template< typename Json_Io >
+	void
+	json_io( Json_Io & io )
+	{
+		io & mandatory( "shapes", m_shapes );
+	}
+};
+
+std::string
+shapes( const std::string & second_shape )
+{
+	return R"({"shapes":[{},)" + second_shape + "]}";
+}
+
+// Reads JSON by all readers and checks the error.
+void
+check_error(
+	const std::string & json,
+	error_code_t expected_code,
+	const std::string & expected_pointer,
+	const std::string & expected_message )
+{
+	drawing_t drawing;
+	const auto error = try_from_json( json, drawing );
+	REQUIRE( expected_code == error.code() );
+	REQUIRE( expected_pointer == error.json_pointer() );
+	REQUIRE( expected_message == error.message() );
+
+	try
+	{
+		from_json( json, drawing );
+		FAIL( "an exception is expected" );
+	}
+	catch( const ex_t & ex )
+	{
+		REQUIRE( expected_code == ex.code() );
+		REQUIRE( expected_pointer == ex.info().json_pointer() );
+		REQUIRE( expected_message == ex.what() );
+		REQUIRE( 0u == ex.info().offset() );
+	}
+
+	try
+	{
+		from_json_sax( json, drawing );
+		FAIL( "an exception is expected" );
+	}
+	catch( const ex_t & ex )
+	{
+		REQUIRE( expected_code == ex.code() );
+		REQUIRE( expected_pointer == ex.info().json_pointer() );
+		REQUIRE( expected_message == ex.what() );
+		// The offset where the parsing was stopped.
+		REQUIRE( 0u != ex.info().offset() );
+		REQUIRE( json.size() > ex.info().offset() );
+	}
+}
+
+TEST_CASE( "paths to failed values" , "[error_path]" )
+{
+	check_error( shapes( R"({"points":[{"x":1,"y":2},{"x":1,"y":"2"}]})" ),
+			error_code_t::type_mismatch,
+			"/shapes/1/points/1/y",
+			"error reading field \"shapes\": error reading field \"points\": "
+			"error reading field \"y\": value is not std::int32_t" );
+
+	check_error( shapes( R"({"points":[{"x":1}]})" ),
+			error_code_t::missing_field,
+			"/shapes/1/points/0/y",
+			"error reading field \"shapes\": error reading field \"points\": "
+			"error reading field \"y\": mandatory field doesn't exist" );
+
+	check_error( shapes( R"({"anchors/~":{"a/b":{"x":1,"y":true}}})" ),
+			error_code_t::type_mismatch,
+			"/shapes/1/anchors~1~0/a~1b/y",
+			"error reading field \"shapes\": error reading field \"anchors/~\": "
+			"error reading field \"y\": value is not std::int32_t" );
+
+	check_error( shapes( R"({"pair":[1,1000]})" ),
+			error_code_t::out_of_range,
+			"/shapes/1/pair/1",
+			"error reading field \"shapes\": error reading field \"pair\": "
+			"value is out of int8: 1000" );
+
+	check_error( shapes( R"({"groups":[[1],[2,"3"]]})" ),
+			error_code_t::type_mismatch,
+			"/shapes/1/groups/1/1",
+			"error reading field \"shapes\": error reading field \"groups\": "
+			"value is not std::int32_t" );
+
+	check_error( R"({"shapes":{}})",
+			error_code_t::type_mismatch,
+			"/shapes",
+			"error reading field \"shapes\": value is not an array" );
+}
+
+TEST_CASE( "paths inside arrays" , "[error_path]" )
+{
+	drawing_t drawing;
+
+	const auto error = try_from_json(
+			shapes( R"({"center":[1,"2"]})" ), drawing );
+	REQUIRE( error_code_t::type_mismatch == error.code() );
+	REQUIRE( "/shapes/1/center/1" == error.json_pointer() );
+
+	REQUIRE_THROWS_WITH(
+			from_json( shapes( R"({"center":[1,"2"]})" ), drawing ),
+			"error reading field \"shapes\": error reading field \"center\": "
+			"value is not std::int32_t" );
+}
+
+TEST_CASE( "structured path" , "[error_path]" )
+{
+	drawing_t drawing;
+	const auto error = try_from_json(
+			shapes( R"({"anchors/~":{"a":{"x":"1"}}})" ), drawing );
+
+	const auto path = error.path();
+	REQUIRE( 5u == path.size() );
+	REQUIRE( 5u == error.path_size() );
+
+	using kind_t = error_path_item_t::kind_t;
+
+	REQUIRE( kind_t::field == path[ 0 ].kind() );
+	REQUIRE( "shapes" == std::string{ path[ 0 ].name().s } );
+	REQUIRE( kind_t::index == path[ 1 ].kind() );
+	REQUIRE( 1u == path[ 1 ].index() );
+	REQUIRE( kind_t::field == path[ 2 ].kind() );
+	REQUIRE( "anchors/~" == std::string{ path[ 2 ].name().s } );
+	REQUIRE( kind_t::key == path[ 3 ].kind() );
+	REQUIRE( "a" == std::string{
+			path[ 3 ].name().s, path[ 3 ].name().length } );
+	REQUIRE( kind_t::field == path[ 4 ].kind() );
+	REQUIRE( "x" == std::string{ path[ 4 ].name().s } );
+	REQUIRE( "value is not std::int32_t" == error.description() );
+	REQUIRE_FALSE( error.on_writing() );
+}
+
+TEST_CASE( "reuse mode" , "[error_path]" )
+{
+	drawing_t drawing;
+	from_json( shapes( R"({"points":[{"x":1,"y":2}]})" ), drawing );
+
+	reuse_mode_t reuse;
+	check_error( shapes( R"({"points":[{"x":1,"y":2},{"x":1}]})" ),
+			error_code_t::missing_field,
+			"/shapes/1/points/1/y",
+			"error reading field \"shapes\": error reading field \"points\": "
+			"error reading field \"y\": mandatory field doesn't exist" );
+}
+
+TEST_CASE( "message of ex_t" , "[error_path]" )
+{
+	ex_t ex{ error_code_t::type_mismatch, "failure" };
+	REQUIRE( std::string{ "failure" } == ex.what() );
+
+	ex.info().add_index( 3u );
+	REQUIRE( std::string{ "failure" } == ex.what() );
+
+	ex.info().add_field( make_string_ref( "inner" ), false );
+	REQUIRE( std::string{ "error reading field \"inner\": failure" } ==
+			ex.what() );
+
+	ex.info().add_field( make_string_ref( "outer" ), false );
+	REQUIRE( std::string{ "error reading field \"outer\": "
+			"error reading field \"inner\": failure" } == ex.what() );
+	REQUIRE( "/outer/inner/3" == ex.info().json_pointer() );
+
+	// A copy builds its own message.
+	const ex_t copy{ ex };
+	REQUIRE( std::string{ ex.what() } == copy.what() );
+
+	// Exceptions created by user code.
+	ex_t user_ex{ "custom error" };
+	REQUIRE( error_code_t::other == user_ex.code() );
+	REQUIRE( "custom error" == user_ex.info().description() );
+}
+
+TEST_CASE( "message of ex_t in several threads" , "[error_path]" )
+{
+	ex_t ex{ error_code_t::type_mismatch, "failure" };
+	ex.info().add_field( make_string_ref( "inner" ), false );
+	ex.info().add_index( 1u );
+	ex.info().add_field( make_string_ref( "outer" ), false );
+
+	const std::string expected{ "error reading field \"outer\": "
+			"error reading field \"inner\": failure" };
+
+	std::vector< std::string > messages( 4u );
+	std::vector< std::thread > threads;
+	for( auto & m : messages )
+		threads.emplace_back( [&ex, &m] { m = ex.what(); } );
+	for( auto & t : threads )
+		t.join();
+
+	for( const auto & m : messages )
+		REQUIRE( expected == m );
+	REQUIRE( expected == ex.what() );
+}
+
+// The name of the field is an array of chars.
+const char weight_name[] = "weight";
+
+struct weighted_t
+{
+	int m_weight{};
+
+	template< typename Json_Io >
+	void
+	json_io( Json_Io & io )
+	{
+		io & mandatory( weight_name, m_weight );
+	}
+};
+
+TEST_CASE( "static names are referenced" , "[error_path]" )
+{
+	weighted_t dto;
+	const auto error = try_from_json( R"({"weight":"x"})", dto );
+	REQUIRE( "/weight" == error.json_pointer() );
+	REQUIRE( weight_name == error.path().front().name().s );
+	REQUIRE( 6u == error.path().front().name().length );
+
+	// The name isn't static if it's passed as string_ref_t.
+	field_name_t static_name{ weight_name };
+	field_name_t copied_name{ string_ref_t{ weight_name } };
+	REQUIRE( static_name.is_static() );
+	REQUIRE_FALSE( copied_name.is_static() );
+	REQUIRE( weight_name !=
+			error_path_item_t::field( copied_name ).name().s );
+}
+
+// The name of the field is built in json_io().
+struct indexed_field_t
+{
+	int m_index{ 1 };
+	int m_value{};
+
+	template< typename Json_Io >
+	void
+	json_io( Json_Io & io )
+	{
+		const std::string name = "value_" + std::to_string( m_index );
+		io & mandatory( string_ref_t{ name.c_str() }, m_value );
+	}
+};
+
+TEST_CASE( "names built in json_io" , "[error_path]" )
+{
+	REQUIRE_THROWS_WITH( from_json< indexed_field_t >( R"({"value_1":"x"})" ),
+			"error reading field \"value_1\": value is not std::int32_t" );
+
+	indexed_field_t dto;
+	const auto error = try_from_json( R"({"value_2":1})", dto );
+	REQUIRE( "/value_1" == error.json_pointer() );
+	REQUIRE( "value_1" == std::string( error.path().front().name().s ) );
+}
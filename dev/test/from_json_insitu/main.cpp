@@ -0,0 +1,139 @@
+#include <catch2/catch.hpp>
+
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include <json_dto/pub.hpp>
+
+#include <test/helper.hpp>
+
+using namespace json_dto;
+
+struct item_t
+{
+	int m_id{};
+	std::string m_name;
+	std::vector< std::string > m_tags;
+
+	template< typename Json_Io >
+	void
+	json_io( Json_Io & io )
+	{
+		io
+			& mandatory( "id", m_id )
+			& mandatory( "name", m_name )
+			& optional( "tags", m_tags, std::vector< std::string >{} );
+	}
+};
+
+// Reads an item from an array [id, name].
+struct short_item_reader_t
+{
+	void
+	read( item_t & v, const rapidjson::Value & from ) const
+	{
+		read_json_value( v.m_id, from[ 0 ] );
+		read_json_value( v.m_name, from[ 1 ] );
+	}
+
+	void
+	write(
+		const item_t &,
+		rapidjson::Value &,
+		rapidjson::MemoryPoolAllocator<> & ) const
+	{}
+};
+
+TEST_CASE( "from mutable buffer" , "[from_json_insitu]" )
+{
+	const std::string json =
+			R"({"id":1,"name":"a \"quoted\"\nЖ","tags":["x","\\y"]})";
+
+	std::vector< char > buffer( json.begin(), json.end() );
+
+	item_t item;
+	from_json_insitu( buffer.data(), buffer.size(), item );
+	REQUIRE( 1 == item.m_id );
+	REQUIRE( "a \"quoted\"\n\xD0\x96" == item.m_name );
+	REQUIRE( std::vector< std::string >{ "x", "\\y" } == item.m_tags );
+
+	// The buffer is modified by the parsing.
+	REQUIRE( json != std::string( buffer.begin(), buffer.end() ) );
+
+	buffer.assign( json.begin(), json.end() );
+	const auto copy = from_json_insitu< item_t >(
+			buffer.data(), buffer.size() );
+	REQUIRE( item.m_name == copy.m_name );
+	REQUIRE( item.m_tags == copy.m_tags );
+}
+
+TEST_CASE( "buffer isn't null-terminated" , "[from_json_insitu]" )
+{
+	// Only a part of the buffer has to be parsed.
+	std::string buffer = R"({"id":2,"name":"b"}{"id":3,"name":"c"})";
+	const auto item = from_json_insitu< item_t >( &buffer[ 0 ], 19u );
+	REQUIRE( 2 == item.m_id );
+	REQUIRE( "b" == item.m_name );
+
+	// The string value is cut by the end of the buffer.
+	std::string cut = R"({"id":2,"name":"bbbb"})";
+	REQUIRE_THROWS_WITH( from_json_insitu< item_t >( &cut[ 0 ], 18u ),
+			"JSON parse error: 'Missing a closing quotation mark in string.' "
+			"(offset: 18)" );
+}
+
+TEST_CASE( "from std::string" , "[from_json_insitu]" )
+{
+	std::string json = R"({"id":4,"name":"d\td","tags":["t"]})";
+
+	item_t item;
+	from_json_insitu( std::string{ json }, item );
+	REQUIRE( 4 == item.m_id );
+	REQUIRE( "d\td" == item.m_name );
+
+	const auto copy = from_json_insitu< item_t >( std::move(json) );
+	REQUIRE( item.m_name == copy.m_name );
+	REQUIRE( item.m_tags == copy.m_tags );
+
+	REQUIRE_THROWS_WITH( from_json_insitu< item_t >( std::string{ "{" } ),
+			"JSON parse error: 'Missing a name for object member.' "
+			"(offset: 1)" );
+	REQUIRE_THROWS_WITH(
+			from_json_insitu< item_t >( std::string{ R"({"id":1})" } ),
+			"error reading field \"name\": mandatory field doesn't exist" );
+}
+
+TEST_CASE( "parse flags" , "[from_json_insitu]" )
+{
+	const std::string json = R"({"id":5,"name":"e",})";
+
+	REQUIRE_THROWS_AS( from_json_insitu< item_t >( std::string{ json } ),
+			json_dto::ex_t );
+
+	const auto item = from_json_insitu<
+			item_t, rapidjson::kParseTrailingCommasFlag >( std::string{ json } );
+	REQUIRE( "e" == item.m_name );
+}
+
+TEST_CASE( "custom Reader-Writer" , "[from_json_insitu]" )
+{
+	const std::string json = R"([6,"f\/f"])";
+
+	std::string buffer = json;
+	item_t item;
+	from_json_insitu( short_item_reader_t{}, &buffer[ 0 ], buffer.size(), item );
+	REQUIRE( 6 == item.m_id );
+	REQUIRE( "f/f" == item.m_name );
+
+	buffer = json;
+	REQUIRE( "f/f" == from_json_insitu< item_t >(
+			short_item_reader_t{}, &buffer[ 0 ], buffer.size() ).m_name );
+
+	item_t from_string;
+	from_json_insitu( short_item_reader_t{}, std::string{ json }, from_string );
+	REQUIRE( 6 == from_string.m_id );
+
+	REQUIRE( "f/f" == from_json_insitu< item_t >(
+			short_item_reader_t{}, std::string{ json } ).m_name );
+}
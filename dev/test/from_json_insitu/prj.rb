@@ -0,0 +1,10 @@
+require 'mxx_ru/cpp'
+MxxRu::Cpp::exe_target {
+	required_prj 'rapidjson_mxxru/prj.rb'
+	required_prj 'test/catch_main/prj.rb'
+
+	target( "_unit.test.from_json_insitu" )
+
+	cpp_source( "main.cpp" )
+}
+
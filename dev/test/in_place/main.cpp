@@ -0,0 +1,170 @@
+#include <catch2/catch.hpp>
+
+#include <deque>
+#include <forward_list>
+#include <iostream>
+#include <list>
+#include <map>
+#include <set>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include <json_dto/pub.hpp>
+
+#include <test/helper.hpp>
+
+using namespace json_dto;
+
+// A DTO that counts moves and copies.
+struct tracked_t
+{
+	static int moves;
+
+	int m_id{};
+
+	tracked_t() = default;
+	tracked_t( const tracked_t & o ) : m_id{ o.m_id } { ++moves; }
+	tracked_t( tracked_t && o ) noexcept : m_id{ o.m_id } { ++moves; }
+
+	tracked_t &
+	operator=( const tracked_t & o ) { m_id = o.m_id; ++moves; return *this; }
+	tracked_t &
+	operator=( tracked_t && o ) noexcept { m_id = o.m_id; ++moves; return *this; }
+
+	bool
+	operator<( const tracked_t & o ) const { return m_id < o.m_id; }
+
+	template< typename Json_Io >
+	void
+	json_io( Json_Io & io )
+	{
+		io & mandatory( "id", m_id );
+	}
+};
+
+int tracked_t::moves = 0;
+
+struct data_t
+{
+	std::vector< tracked_t > m_vector;
+	std::deque< tracked_t > m_deque;
+	std::list< tracked_t > m_list;
+	std::forward_list< tracked_t > m_forward_list;
+	std::map< std::string, tracked_t > m_map;
+	std::unordered_map< std::string, tracked_t > m_hash;
+	std::multimap< std::string, tracked_t > m_multimap;
+	nullable_t< tracked_t > m_nullable;
+#if defined( JSON_DTO_SUPPORTS_STD_OPTIONAL )
+	cpp17::optional< tracked_t > m_optional;
+#endif
+
+	template< typename Json_Io >
+	void
+	json_io( Json_Io & io )
+	{
+		io
+			& mandatory( "vector", m_vector )
+			& mandatory( "deque", m_deque )
+			& mandatory( "list", m_list )
+			& mandatory( "forward_list", m_forward_list )
+			& mandatory( "map", m_map )
+			& mandatory( "hash", m_hash )
+			& mandatory( "multimap", m_multimap )
+			& mandatory( "nullable", m_nullable )
+#if defined( JSON_DTO_SUPPORTS_STD_OPTIONAL )
+			& mandatory( "optional", m_optional )
+#endif
+			;
+	}
+};
+
+const std::string data_json =
+		R"({"vector":[{"id":1},{"id":2}],"deque":[{"id":3},{"id":4}],)"
+		R"("list":[{"id":5}],"forward_list":[{"id":6},{"id":7}],)"
+		R"("map":{"a":{"id":8},"b":{"id":9}},"hash":{"c":{"id":10}},)"
+		R"("multimap":{"d":{"id":11},"d":{"id":12}},"nullable":{"id":13})"
+#if defined( JSON_DTO_SUPPORTS_STD_OPTIONAL )
+		R"(,"optional":{"id":14})"
+#endif
+		"}";
+
+template< typename Reader >
+void
+check_data( Reader && reader )
+{
+	data_t data;
+	data.m_vector.reserve( 2u );
+
+	tracked_t::moves = 0;
+	reader( data );
+	REQUIRE( 0 == tracked_t::moves );
+
+	REQUIRE( 2 == data.m_vector[ 1 ].m_id );
+	REQUIRE( 4 == data.m_deque[ 1 ].m_id );
+	REQUIRE( 5 == data.m_list.front().m_id );
+	REQUIRE( 7 == std::next( data.m_forward_list.begin() )->m_id );
+	REQUIRE( 9 == data.m_map[ "b" ].m_id );
+	REQUIRE( 10 == data.m_hash[ "c" ].m_id );
+	REQUIRE( 2u == data.m_multimap.size() );
+	REQUIRE( 13 == data.m_nullable->m_id );
+#if defined( JSON_DTO_SUPPORTS_STD_OPTIONAL )
+	REQUIRE( 14 == data.m_optional->m_id );
+#endif
+
+	REQUIRE( data_json == to_json( data ) );
+}
+
+TEST_CASE( "items are read in place" , "[in_place]" )
+{
+	check_data( []( data_t & data ) { from_json( data_json, data ); } );
+}
+
+TEST_CASE( "items are read in place by SAX parser" , "[in_place]" )
+{
+	check_data( []( data_t & data ) { from_json_sax( data_json, data ); } );
+}
+
+TEST_CASE( "duplicate keys" , "[in_place]" )
+{
+	const std::string json = R"({"a":{"id":1},"a":{"id":2}})";
+
+	// The first value is kept.
+	REQUIRE( 1 == ( from_json< std::map< std::string, tracked_t > >( json )
+			.at( "a" ).m_id ) );
+	REQUIRE( 1 == ( from_json_sax< std::map< std::string, tracked_t > >( json )
+			.at( "a" ).m_id ) );
+
+	// But all values are checked.
+	REQUIRE_THROWS_WITH(
+			( from_json< std::map< std::string, tracked_t > >(
+					R"({"a":{"id":1},"a":{}})" ) ),
+			"error reading field \"id\": mandatory field doesn't exist" );
+}
+
+TEST_CASE( "containers with immutable items" , "[in_place]" )
+{
+	REQUIRE( ( std::set< int >{ 1, 2 } ) ==
+			from_json< std::set< int > >( R"([2,1,2])" ) );
+	REQUIRE( ( std::set< int >{ 1, 2 } ) ==
+			from_json_sax< std::set< int > >( R"([2,1,2])" ) );
+
+	REQUIRE( ( std::vector< bool >{ true, false } ) ==
+			from_json< std::vector< bool > >( R"([true,false])" ) );
+	REQUIRE( ( std::vector< bool >{ true, false } ) ==
+			from_json_sax< std::vector< bool > >( R"([true,false])" ) );
+
+	const auto set = from_json_sax< std::set< tracked_t > >(
+			R"([{"id":2},{"id":1}])" );
+	REQUIRE( 1 == set.begin()->m_id );
+}
+
+TEST_CASE( "nullable_t::emplace" , "[in_place]" )
+{
+	nullable_t< std::vector< int > > v{ std::vector< int >{ 1, 2 } };
+
+	auto & content = v.emplace();
+	REQUIRE( v );
+	REQUIRE( content.empty() );
+	REQUIRE( &content == &*v );
+}
@@ -8,6 +8,8 @@
 #include <json_dto/pub.hpp>
 #include <json_dto/validators.hpp>
 
+#include <test/allocations.hpp>
+
 namespace test
 {
 
@@ -354,6 +356,54 @@ struct constrained_values_t
 	}
 };
 
+// The same members are described by reader_writer() and
+// static_reader_writer().
+template< bool Static >
+struct quote_t
+{
+	std::int64_t m_time{};
+	double m_bid{};
+	double m_ask{};
+	int m_volume{};
+	std::string m_venue;
+
+	template< typename... Members >
+	static auto
+	make_reader_writer( std::true_type, Members && ...members )
+	{
+		return json_dto::inside_array::static_reader_writer<
+				json_dto::inside_array::at_least<3> >(
+					std::forward<Members>(members)... );
+	}
+
+	template< typename... Members >
+	static auto
+	make_reader_writer( std::false_type, Members && ...members )
+	{
+		return json_dto::inside_array::reader_writer<
+				json_dto::inside_array::at_least<3> >(
+					std::forward<Members>(members)... );
+	}
+
+	template< typename Json_Io >
+	void
+	json_io( Json_Io & io )
+	{
+		io
+			& json_dto::mandatory(
+					make_reader_writer( std::integral_constant< bool, Static >{},
+						json_dto::inside_array::member( m_time ),
+						json_dto::inside_array::member(
+							simple_int_reader_writter_t{}, m_volume ),
+						json_dto::inside_array::member( m_bid ),
+						json_dto::inside_array::member_with_default_value(
+							m_ask, 100.0, json_dto::min_max_constraint( 0.0, 1000.0 ) ),
+						json_dto::inside_array::member_with_default_value(
+							m_venue, std::string{ "none" } ) ),
+					"q", *this );
+	}
+};
+
 } /* namespace test */
 
 using namespace test;
@@ -804,3 +854,80 @@ TEST_CASE( "inside-array-validators" , "[inside-array][validators][reader-writer
 	}
 }
 
+
+TEST_CASE( "inside-array-allocation-budgets" , "[inside-array][allocations]" )
+{
+	rapidjson::Document doc;
+	doc.Parse( R"({"x":[1,"a string that doesn't fit into std::string",2]})" );
+
+	// The first reading allocates the string and the index of members.
+	simple_outer_t r;
+	json_dto::from_json( doc, r );
+
+	// Capacity of the string is reused.
+	REQUIRE( 0u == allocations_of( [&] { json_dto::from_json( doc, r ); } ) );
+
+	doc.Parse( R"({"x":[54,-1,"five",24678]})" );
+	tuple_holder_t t;
+	json_dto::from_json( doc, t );
+	REQUIRE( 0u == allocations_of( [&] { json_dto::from_json( doc, t ); } ) );
+
+	buffered_allocator_t<> values;
+	rapidjson::Value value;
+	REQUIRE( 0u == allocations_of( [&] {
+			json_dto::write_json_value( r, value, values.m_allocator );
+			json_dto::write_json_value( t, value, values.m_allocator );
+		} ) );
+	REQUIRE( -1 == value[ "x" ][ 1 ].GetInt() );
+}
+
+TEST_CASE( "inside-array-static-reader-writer" , "[inside-array][static]" )
+{
+	for( const std::string json : {
+			R"({"q":[1,2,3.5,4.5,"x"]})",
+			R"({"q":[1,2,3.5,4.5]})",
+			R"({"q":[1,2,3.5]})" } )
+	{
+		const auto dynamic_quote = json_dto::from_json< quote_t< false > >( json );
+		const auto static_quote = json_dto::from_json< quote_t< true > >( json );
+
+		REQUIRE( dynamic_quote.m_bid == static_quote.m_bid );
+		REQUIRE( dynamic_quote.m_ask == static_quote.m_ask );
+		REQUIRE( dynamic_quote.m_venue == static_quote.m_venue );
+		REQUIRE( json_dto::to_json( dynamic_quote ) ==
+				json_dto::to_json( static_quote ) );
+		REQUIRE( json_dto::to_json( dynamic_quote ) ==
+				json_dto::to_json_sax( static_quote ) );
+		REQUIRE( json_dto::to_json( static_quote ) == json_dto::to_json(
+				json_dto::from_json_sax< quote_t< true > >( json ) ) );
+	}
+
+	const auto q = json_dto::from_json< quote_t< true > >( R"({"q":[1,2,3]})" );
+	REQUIRE( 100.0 == q.m_ask );
+	REQUIRE( "none" == q.m_venue );
+
+	// The same errors.
+	for( const std::string json : {
+			R"({"q":[1,2]})",
+			R"({"q":[1,2,3,4,"x",5]})",
+			R"({"q":{}})",
+			R"({"q":[1,2,3,4000]})",
+			R"({"q":[1,2,"3"]})" } )
+	{
+		quote_t< false > dynamic_quote;
+		quote_t< true > static_quote;
+
+		const auto dynamic_error = json_dto::try_from_json( json, dynamic_quote );
+		const auto static_error = json_dto::try_from_json( json, static_quote );
+		REQUIRE( dynamic_error );
+		REQUIRE( dynamic_error.code() == static_error.code() );
+		REQUIRE( dynamic_error.json_pointer() == static_error.json_pointer() );
+		REQUIRE( dynamic_error.message() == static_error.message() );
+
+		REQUIRE_THROWS( json_dto::from_json( json, static_quote ) );
+	}
+
+	quote_t< true > invalid;
+	invalid.m_ask = -1.0;
+	REQUIRE_THROWS( json_dto::to_json( invalid ) );
+}
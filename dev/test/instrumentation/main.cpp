@@ -0,0 +1,289 @@
+#include <catch2/catch.hpp>
+
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <typeinfo>
+#include <vector>
+
+#define JSON_DTO_INSTRUMENTATION
+#include <json_dto/pub.hpp>
+
+#include <test/helper.hpp>
+#include <test/allocations.hpp>
+
+using namespace json_dto;
+
+struct point_t
+{
+	int m_x{};
+	int m_y{};
+
+	template< typename Json_Io >
+	void
+	json_io( Json_Io & io )
+	{
+		io
+			& mandatory( "x", m_x )
+			& mandatory( "y", m_y );
+	}
+};
+
+struct route_t
+{
+	std::string m_name;
+	std::vector< point_t > m_points;
+
+	template< typename Json_Io >
+	void
+	json_io( Json_Io & io )
+	{
+		io
+			& mandatory( "name", m_name )
+			& mandatory( "points", m_points );
+	}
+};
+
+const std::string route_json =
+		R"({"name":"a long name of the route",)"
+		R"("points":[{"x":1,"y":2},{"x":3,"y":40}]})";
+
+// Finds statistics of a field.
+const instrumentation::field_record_t *
+find(
+	const std::vector< instrumentation::field_record_t > & records,
+	const std::type_info & dto,
+	const std::string & field,
+	bool on_writing )
+{
+	for( const auto & r : records )
+		if( dto.name() == r.m_dto_type && field == r.m_field_name &&
+				on_writing == r.m_on_writing )
+			return &r;
+
+	return nullptr;
+}
+
+TEST_CASE( "reading" , "[instrumentation]" )
+{
+	auto & registry = instrumentation::registry();
+	registry.reset();
+
+	route_t route;
+	from_json( route_json, route );
+
+	const auto records = registry.snapshot();
+	REQUIRE( 4u == records.size() );
+
+	const auto * name = find( records, typeid( route_t ), "name", false );
+	REQUIRE( name );
+	REQUIRE( 1u == name->m_stats.m_calls );
+	// Sizes aren't known for fields read from DOM.
+	REQUIRE( 0u == name->m_stats.m_bytes );
+	// Allocations aren't counted without a counter.
+	REQUIRE( 0u == name->m_stats.m_allocations );
+
+	const auto * points = find( records, typeid( route_t ), "points", false );
+	REQUIRE( points );
+	REQUIRE( 1u == points->m_stats.m_calls );
+
+	const auto * y = find( records, typeid( point_t ), "y", false );
+	REQUIRE( y );
+	REQUIRE( 2u == y->m_stats.m_calls );
+
+	// Fields are sorted by time.
+	for( std::size_t i = 1u; i < records.size(); ++i )
+		REQUIRE( records[ i - 1u ].m_stats.m_nanoseconds >=
+				records[ i ].m_stats.m_nanoseconds );
+
+	// Statistics are accumulated.
+	from_json( route_json, route );
+	REQUIRE( 2u == find( registry.snapshot(), typeid( route_t ), "name", false )
+			->m_stats.m_calls );
+}
+
+TEST_CASE( "reading via SAX" , "[instrumentation]" )
+{
+	auto & registry = instrumentation::registry();
+	registry.reset();
+
+	route_t route;
+	from_json_sax( route_json, route );
+	REQUIRE( 2u == route.m_points.size() );
+
+	auto records = registry.snapshot();
+	REQUIRE( 4u == records.size() );
+
+	// Sizes of fields read by from_json_sax() include names and separators,
+	// so they are the same as for to_json_sax().
+	const auto * name = find( records, typeid( route_t ), "name", false );
+	REQUIRE( name );
+	REQUIRE( 1u == name->m_stats.m_calls );
+	REQUIRE( 33u == name->m_stats.m_bytes );
+	REQUIRE( 40u == find( records, typeid( route_t ), "points", false )
+			->m_stats.m_bytes );
+	REQUIRE( 10u == find( records, typeid( point_t ), "x", false )
+			->m_stats.m_bytes );
+	REQUIRE( 13u == find( records, typeid( point_t ), "y", false )
+			->m_stats.m_bytes );
+
+	// Whitespaces before a field are counted for it, unknown members aren't.
+	registry.reset();
+	std::istringstream stream{
+			R"({ "points" : [], "unknown":{"x":1},)"
+			"\n\t\"name\":\"n\"}" };
+	from_stream_sax( stream, route );
+	REQUIRE( "n" == route.m_name );
+
+	records = registry.snapshot();
+	REQUIRE( 2u == records.size() );
+	REQUIRE( 14u == find( records, typeid( route_t ), "points", false )
+			->m_stats.m_bytes );
+	REQUIRE( 13u == find( records, typeid( route_t ), "name", false )
+			->m_stats.m_bytes );
+
+	// The first member of an object has no separator.
+	registry.reset();
+	from_json_sax( R"({"name":"a","points":[{"y":2,"x":1}]})", route );
+
+	records = registry.snapshot();
+	REQUIRE( 10u == find( records, typeid( route_t ), "name", false )
+			->m_stats.m_bytes );
+	REQUIRE( 5u == find( records, typeid( point_t ), "y", false )
+			->m_stats.m_bytes );
+	REQUIRE( 6u == find( records, typeid( point_t ), "x", false )
+			->m_stats.m_bytes );
+}
+
+TEST_CASE( "writing" , "[instrumentation]" )
+{
+	auto & registry = instrumentation::registry();
+	registry.reset();
+
+	const auto route = from_json< route_t >( route_json );
+	registry.reset();
+
+	REQUIRE( route_json == to_json( route ) );
+
+	auto records = registry.snapshot();
+	REQUIRE( 4u == records.size() );
+
+	const auto * name = find( records, typeid( route_t ), "name", true );
+	REQUIRE( name );
+	// Sizes aren't known for fields written to DOM.
+	REQUIRE( 0u == name->m_stats.m_bytes );
+
+	const auto * x = find( records, typeid( point_t ), "x", true );
+	REQUIRE( x );
+	REQUIRE( 2u == x->m_stats.m_calls );
+
+	// Sizes of fields written by to_json_sax() include names and separators.
+	registry.reset();
+	REQUIRE( route_json == to_json_sax( route ) );
+
+	records = registry.snapshot();
+	REQUIRE( 4u == records.size() );
+	REQUIRE( 33u == find( records, typeid( route_t ), "name", true )
+			->m_stats.m_bytes );
+	REQUIRE( 40u == find( records, typeid( route_t ), "points", true )
+			->m_stats.m_bytes );
+	REQUIRE( 10u == find( records, typeid( point_t ), "x", true )
+			->m_stats.m_bytes );
+	REQUIRE( 13u == find( records, typeid( point_t ), "y", true )
+			->m_stats.m_bytes );
+
+	// Fields written to streams are counted without bytes.
+	registry.reset();
+	std::ostringstream stream;
+	to_stream( stream, route );
+	REQUIRE( route_json == stream.str() );
+
+	records = registry.snapshot();
+	REQUIRE( 4u == records.size() );
+	REQUIRE( 2u == find( records, typeid( point_t ), "y", true )
+			->m_stats.m_calls );
+}
+
+TEST_CASE( "failed fields" , "[instrumentation]" )
+{
+	auto & registry = instrumentation::registry();
+	registry.reset();
+
+	route_t route;
+	REQUIRE( try_from_json( R"({"name":1})", route ) );
+
+	// Only successful reads are recorded.
+	REQUIRE( registry.snapshot().empty() );
+
+	REQUIRE_THROWS( from_json( R"({"name":"a","points":[{"x":1}]})", route ) );
+
+	const auto records = registry.snapshot();
+	REQUIRE( 2u == records.size() );
+	REQUIRE( find( records, typeid( route_t ), "name", false ) );
+	REQUIRE( find( records, typeid( point_t ), "x", false ) );
+}
+
+TEST_CASE( "allocations" , "[instrumentation]" )
+{
+	auto & registry = instrumentation::registry();
+	registry.reset();
+	registry.set_allocation_counter( [] {
+			return static_cast< std::uint64_t >( allocation_count() );
+		} );
+
+	route_t route;
+	from_json( route_json, route );
+
+	const auto records = registry.snapshot();
+	registry.set_allocation_counter( nullptr );
+
+	// The name doesn't fit into a small string buffer.
+	REQUIRE( 1u <= find( records, typeid( route_t ), "name", false )
+			->m_stats.m_allocations );
+	REQUIRE( 1u <= find( records, typeid( route_t ), "points", false )
+			->m_stats.m_allocations );
+	REQUIRE( 0u == find( records, typeid( point_t ), "x", false )
+			->m_stats.m_allocations );
+}
+
+TEST_CASE( "several threads" , "[instrumentation]" )
+{
+	auto & registry = instrumentation::registry();
+	registry.reset();
+
+	const auto read = [] {
+		route_t route;
+		for( int i = 0; i != 10; ++i )
+			from_json( route_json, route );
+	};
+
+	read();
+	{
+		// Statistics of finished threads are kept.
+		std::thread first{ read };
+		first.join();
+		std::thread second{ read };
+		std::thread third{ read };
+		second.join();
+		third.join();
+	}
+
+	auto records = registry.snapshot();
+	REQUIRE( 4u == records.size() );
+	REQUIRE( 40u == find( records, typeid( route_t ), "name", false )
+			->m_stats.m_calls );
+	REQUIRE( 80u == find( records, typeid( point_t ), "x", false )
+			->m_stats.m_calls );
+
+	// Shards of finished threads are merged when another thread starts.
+	std::thread fourth{ read };
+	fourth.join();
+
+	records = registry.snapshot();
+	REQUIRE( 50u == find( records, typeid( route_t ), "name", false )
+			->m_stats.m_calls );
+
+	registry.reset();
+	REQUIRE( registry.snapshot().empty() );
+}
@@ -0,0 +1,176 @@
+#include <catch2/catch.hpp>
+
+#include <string>
+#include <vector>
+
+#include <json_dto/pub.hpp>
+#include <json_dto/validators.hpp>
+
+#include <test/helper.hpp>
+
+using namespace json_dto;
+
+struct record_t
+{
+	std::string m_name;
+	int m_value{};
+
+	template< typename Json_Io >
+	void
+	json_io( Json_Io & io )
+	{
+		io
+			& mandatory( "name", m_name )
+			& mandatory( "value", m_value );
+	}
+};
+
+struct event_t
+{
+	std::string m_kind;
+	lazy_t< std::vector< record_t > > m_records;
+	lazy_t< std::vector< double >, min_max_validator_t< double > > m_prices;
+	lazy_t< int > m_priority;
+
+	template< typename Json_Io >
+	void
+	json_io( Json_Io & io )
+	{
+		io
+			& mandatory( "kind", m_kind )
+			& mandatory( "records", m_records )
+			& mandatory( "prices", m_prices, min_max_constraint( 0.0, 100.0 ) )
+			& optional( "priority", m_priority, 5 );
+	}
+};
+
+const std::string event_json =
+		R"({"kind":"audit","records":[ {"name":"a","value":1},)"
+		R"( {"name":"b","value":2} ],"prices":[1.5, 2],"priority":1})";
+
+TEST_CASE( "decoding on access" , "[lazy][sax]" )
+{
+	auto event = from_json_sax< event_t >( event_json );
+
+	REQUIRE( "audit" == event.m_kind );
+	REQUIRE( !event.m_records.is_decoded() );
+	REQUIRE( R"([ {"name":"a","value":1}, {"name":"b","value":2} ])" ==
+			event.m_records.raw().str() );
+
+	// Values that aren't modified are written as is.
+	REQUIRE( event_json == to_json_sax( event ) );
+
+	const auto & records = event.m_records.get();
+	REQUIRE( event.m_records.is_decoded() );
+	REQUIRE( 2 == records.size() );
+	REQUIRE( "b" == records[ 1 ].m_name );
+	REQUIRE( 2 == event.m_records->back().m_value );
+	// The decoded value is cached.
+	REQUIRE( &records == &*event.m_records );
+
+	REQUIRE( 1 == *event.m_priority );
+	REQUIRE( event_json == to_json_sax( event ) );
+
+	// Modified values are encoded.
+	event.m_records.get_mutable().pop_back();
+	event.m_priority = 3;
+	REQUIRE( event.m_records.raw().empty() );
+	REQUIRE( R"({"kind":"audit","records":[{"name":"a","value":1}],)"
+			R"("prices":[1.5, 2],"priority":3})" == to_json_sax( event ) );
+}
+
+TEST_CASE( "DOM" , "[lazy][dom]" )
+{
+	auto event = from_json< event_t >( event_json );
+
+	REQUIRE( !event.m_prices.is_decoded() );
+	// A copy of the parsed value is kept.
+	REQUIRE( event.m_prices.raw().value() );
+	REQUIRE( "[1.5,2]" == event.m_prices.raw().str() );
+
+	const auto compact =
+			R"({"kind":"audit","records":[{"name":"a","value":1},)"
+			R"({"name":"b","value":2}],"prices":[1.5,2],"priority":1})";
+	REQUIRE( compact == to_json( event ) );
+
+	REQUIRE( 2 == event.m_prices.get().size() );
+	REQUIRE( equal( 2.0, event.m_prices.get()[ 1 ] ) );
+	REQUIRE( compact == to_json( event ) );
+}
+
+TEST_CASE( "defaults" , "[lazy]" )
+{
+	// Missing optional field receives the decoded default value.
+	auto event = from_json_sax< event_t >(
+			R"({"kind":"","records":[],"prices":[]})" );
+	REQUIRE( event.m_priority.is_decoded() );
+	REQUIRE( 5 == event.m_priority.get() );
+
+	// The default value isn't written.
+	REQUIRE( R"({"kind":"","records":[],"prices":[]})" ==
+			to_json_sax( event ) );
+
+	// A default-constructed value holds T{}.
+	event_t empty;
+	REQUIRE( empty.m_records.is_decoded() );
+	REQUIRE( empty.m_records->empty() );
+	REQUIRE( R"({"kind":"","records":[],"prices":[],"priority":0})" ==
+			to_json( empty ) );
+}
+
+TEST_CASE( "deferred errors" , "[lazy]" )
+{
+	// Values are validated at decoding.
+	auto event = from_json_sax< event_t >(
+			R"({"kind":"","records":[{"name":1}],"prices":[1,1000]})" );
+
+	REQUIRE_THROWS_WITH( event.m_prices.get(),
+			"invalid value: 1000.000000, must be in "
+			"[ 0.000000, 100.000000 ]" );
+	REQUIRE_THROWS_WITH( event.m_records.get(),
+			"error reading field \"name\": value is not std::string" );
+	REQUIRE( !event.m_records.is_decoded() );
+
+	// The same for DOM-based reading.
+	event = from_json< event_t >(
+			R"({"kind":"","records":[],"prices":[-1]})" );
+	REQUIRE_THROWS_AS( event.m_prices.get(), ex_t );
+
+	// Decoded values are validated on writing.
+	event.m_prices = std::vector< double >{ 1.0, 101.0 };
+	REQUIRE_THROWS_AS( to_json( event ), ex_t );
+	REQUIRE_THROWS_AS( to_json_sax( event ), ex_t );
+
+	// The next reading replaces the value.
+	from_json_sax( R"({"kind":"","records":[],"prices":[2]})", event );
+	REQUIRE( 1 == event.m_prices.get().size() );
+}
+
+TEST_CASE( "comparison" , "[lazy]" )
+{
+	const auto from_text = from_json_sax< event_t >( event_json );
+	const auto from_dom = from_json< event_t >( event_json );
+
+	// Values aren't decoded for comparisons.
+	REQUIRE( from_text.m_prices == from_dom.m_prices );
+	REQUIRE( from_dom.m_priority == 1 );
+	REQUIRE( from_text.m_priority != 2 );
+	REQUIRE( lazy_t< int >{ 1 } == from_dom.m_priority );
+	REQUIRE( from_dom.m_priority != lazy_t< int >{ 3 } );
+	REQUIRE( !from_text.m_prices.is_decoded() );
+	REQUIRE( !from_dom.m_prices.is_decoded() );
+	REQUIRE( !from_text.m_priority.is_decoded() );
+	REQUIRE( !from_dom.m_priority.is_decoded() );
+
+	// Decoded values are compared directly.
+	REQUIRE( 2u == from_text.m_prices->size() );
+	REQUIRE( from_text.m_prices == from_dom.m_prices );
+	REQUIRE( from_dom.m_prices == from_text.m_prices );
+
+	// The default value is compared without decoding on writing.
+	const auto with_default = from_json< event_t >(
+			R"({"kind":"","records":[],"prices":[],"priority":5})" );
+	REQUIRE( R"({"kind":"","records":[],"prices":[]})" ==
+			to_json( with_default ) );
+	REQUIRE( !with_default.m_priority.is_decoded() );
+}
@@ -0,0 +1,415 @@
+#include <catch2/catch.hpp>
+
+#include <array>
+#include <iostream>
+#include <string>
+
+#include <rapidjson/document.h>
+
+#include <json_dto/pub.hpp>
+
+#include <test/helper.hpp>
+
+using namespace json_dto;
+
+struct point_t
+{
+	int m_x{};
+	int m_y{};
+	nullable_t< int > m_z;
+	std::string m_label{ "none" };
+
+	template< typename Json_Io >
+	void
+	json_io( Json_Io & io )
+	{
+		io
+			& mandatory( "x", m_x )
+			& optional( "y", m_y, -1 )
+			& optional_null( "z", m_z )
+			& mandatory_with_null_as_default( "label", m_label );
+	}
+};
+
+TEST_CASE( "repeated reads" , "[member_index]" )
+{
+	// The first read records names of fields, the next ones use the index.
+	for( int i = 0; i != 3; ++i )
+	{
+		const auto p = from_json< point_t >(
+				R"({"label":"a","z":3,"y":2,"x":1})" );
+		REQUIRE( 1 == p.m_x );
+		REQUIRE( 2 == p.m_y );
+		REQUIRE( 3 == *p.m_z );
+		REQUIRE( "a" == p.m_label );
+	}
+
+	const auto p = from_json< point_t >(
+			R"({"unknown":[1,2,3],"x":4,"label":null,"x":5})" );
+	REQUIRE( 4 == p.m_x );
+	REQUIRE( -1 == p.m_y );
+	REQUIRE( !p.m_z );
+	REQUIRE( p.m_label.empty() );
+
+	const auto points = from_json< std::vector< point_t > >(
+			R"([{"x":1,"label":"1"},{"y":2,"x":3,"z":null,"label":"2"}])" );
+	REQUIRE( 2u == points.size() );
+	REQUIRE( 3 == points[ 1 ].m_x );
+	REQUIRE( !points[ 1 ].m_z );
+}
+
+TEST_CASE( "errors" , "[member_index]" )
+{
+	// Make sure that the index exists.
+	REQUIRE( 0 == from_json< point_t >( R"({"x":0,"label":""})" ).m_x );
+
+	REQUIRE_THROWS_WITH( from_json< point_t >( R"({"y":1,"label":""})" ),
+			"error reading field \"x\": mandatory field doesn't exist" );
+	REQUIRE_THROWS_WITH( from_json< point_t >( R"({"x":null,"label":""})" ),
+			"error reading field \"x\": non nullable field is null" );
+	REQUIRE_THROWS_WITH( from_json< point_t >( R"({"x":1,"z":"1","label":""})" ),
+			"error reading field \"z\": value is not std::int32_t" );
+	REQUIRE_THROWS_WITH( from_json< point_t >( R"([])" ),
+			"error reading field \"x\": unable to extract field \"x\": "
+			"parent json type must be object" );
+}
+
+// json_io() depends on values of fields.
+struct shape_t
+{
+	std::string m_kind;
+	int m_radius{};
+	int m_width{};
+	int m_height{};
+
+	template< typename Json_Io >
+	void
+	json_io( Json_Io & io )
+	{
+		io & mandatory( "kind", m_kind );
+		if( "circle" == m_kind )
+			io & mandatory( "radius", m_radius );
+		else
+			io & mandatory( "width", m_width ) & mandatory( "height", m_height );
+	}
+};
+
+TEST_CASE( "json_io with conditions" , "[member_index]" )
+{
+	const auto c1 = from_json< shape_t >( R"({"radius":3,"kind":"circle"})" );
+	REQUIRE( 3 == c1.m_radius );
+
+	const auto r = from_json< shape_t >(
+			R"({"height":2,"kind":"rect","width":1})" );
+	REQUIRE( 1 == r.m_width );
+	REQUIRE( 2 == r.m_height );
+
+	const auto c2 = from_json< shape_t >( R"({"kind":"circle","radius":5})" );
+	REQUIRE( 5 == c2.m_radius );
+
+	REQUIRE_THROWS_WITH( from_json< shape_t >( R"({"kind":"rect","width":1})" ),
+			"error reading field \"height\": mandatory field doesn't exist" );
+}
+
+// Several fields with the same name.
+struct same_names_t
+{
+	int m_first{};
+	nullable_t< int > m_copy;
+	std::string m_second;
+
+	template< typename Json_Io >
+	void
+	json_io( Json_Io & io )
+	{
+		io
+			& mandatory( "value", m_first )
+			& mandatory( "value", m_copy )
+			& optional( "text", m_second, "default" );
+	}
+};
+
+TEST_CASE( "fields with the same name" , "[member_index]" )
+{
+	for( int i = 0; i != 2; ++i )
+	{
+		const auto v = from_json< same_names_t >( R"({"value":42})" );
+		REQUIRE( 42 == v.m_first );
+		REQUIRE( 42 == *v.m_copy );
+		REQUIRE( "default" == v.m_second );
+	}
+}
+
+// A DTO with many fields.
+struct wide_t
+{
+	static constexpr std::size_t size = 48u;
+
+	std::array< std::string, size > m_names;
+	std::array< int, size > m_values{};
+
+	wide_t()
+	{
+		for( std::size_t i = 0u; i != size; ++i )
+			m_names[ i ] = "field_" + std::to_string( i );
+	}
+
+	template< typename Json_Io >
+	void
+	json_io( Json_Io & io )
+	{
+		for( std::size_t i = 0u; i != size; ++i )
+			io & optional(
+					string_ref_t{ m_names[ i ].c_str() }, m_values[ i ], -1 );
+	}
+};
+
+TEST_CASE( "many fields" , "[member_index]" )
+{
+	wide_t expected;
+	for( std::size_t i = 0u; i != wide_t::size; ++i )
+		expected.m_values[ i ] = static_cast< int >( i * 2u );
+	expected.m_values[ 7u ] = -1;
+
+	std::string json = "{";
+	for( std::size_t i = wide_t::size; i != 0u; --i )
+		if( 7u != i - 1u )
+		{
+			json += "\"field_" + std::to_string( i - 1u ) + "\":" +
+					std::to_string( ( i - 1u ) * 2u );
+			json += 1u == i ? "}" : ",";
+		}
+
+	for( int i = 0; i != 2; ++i )
+	{
+		const auto v = from_json< wide_t >( json );
+		REQUIRE( expected.m_values == v.m_values );
+	}
+}
+
+namespace test_stuff
+{
+
+template< typename F >
+struct legacy_field_t
+{
+	F & m_field;
+};
+
+template< typename F >
+legacy_field_t< F > legacy( F & field ) noexcept { return { field }; }
+
+} /* namespace test_stuff */
+
+namespace json_dto
+{
+
+template<
+	typename Reader_Writer,
+	typename Field_Type,
+	typename Manopt_Policy,
+	typename Validator >
+class binder_data_holder_t<
+		Reader_Writer,
+		const test_stuff::legacy_field_t< Field_Type >,
+		Manopt_Policy,
+		Validator >
+{
+	string_ref_t m_field_name;
+	test_stuff::legacy_field_t< Field_Type > m_field;
+
+public:
+	binder_data_holder_t(
+		Reader_Writer &&,
+		string_ref_t field_name,
+		const test_stuff::legacy_field_t< Field_Type > & field,
+		Manopt_Policy &&,
+		Validator && )
+		:	m_field_name{ field_name }
+		,	m_field{ field }
+	{}
+
+	const string_ref_t &
+	field_name() const noexcept { return m_field_name; }
+
+	Field_Type &
+	field_for_deserialization() const noexcept { return m_field.m_field; }
+};
+
+// A specialization without read_from_member() method.
+template<
+	typename Reader_Writer,
+	typename Field_Type,
+	typename Manopt_Policy,
+	typename Validator >
+struct binder_read_from_implementation_t<
+		binder_data_holder_t<
+			Reader_Writer,
+			const test_stuff::legacy_field_t< Field_Type >,
+			Manopt_Policy,
+			Validator
+		>
+	>
+{
+	using data_holder_t = binder_data_holder_t<
+			Reader_Writer,
+			const test_stuff::legacy_field_t< Field_Type >,
+			Manopt_Policy,
+			Validator >;
+
+	static void
+	read_from(
+		const data_holder_t & binder_data,
+		const rapidjson::Value & object )
+	{
+		const auto it = object.FindMember( binder_data.field_name() );
+		if( object.MemberEnd() != it )
+			read_json_value( binder_data.field_for_deserialization(), it->value );
+		else
+			binder_data.field_for_deserialization() = Field_Type{ -1 };
+	}
+};
+
+} /* namespace json_dto */
+
+struct with_legacy_field_t
+{
+	int m_first{};
+	int m_legacy{};
+	int m_last{};
+
+	template< typename Json_Io >
+	void
+	json_io( Json_Io & io )
+	{
+		io
+			& mandatory( "first", m_first )
+			& mandatory( "legacy", test_stuff::legacy( m_legacy ) )
+			& mandatory( "last", m_last );
+	}
+};
+
+TEST_CASE( "binder without read_from_member" , "[member_index]" )
+{
+	for( int i = 0; i != 2; ++i )
+	{
+		const auto v = from_json< with_legacy_field_t >(
+				R"({"last":3,"legacy":2,"first":1})" );
+		REQUIRE( 1 == v.m_first );
+		REQUIRE( 2 == v.m_legacy );
+		REQUIRE( 3 == v.m_last );
+
+		REQUIRE( -1 == from_json< with_legacy_field_t >(
+				R"({"last":3,"first":1})" ).m_legacy );
+	}
+}
+
+// A DTO that is big enough for the single-pass reading.
+struct ordered_t
+{
+	int m_a{};
+	int m_b{};
+	int m_c{};
+	int m_d{};
+	int m_e{};
+	int m_f{};
+
+	template< typename Json_Io >
+	void
+	json_io( Json_Io & io )
+	{
+		io
+			& mandatory( "a", m_a )
+			& mandatory( "b", m_b )
+			& mandatory( "c", m_c )
+			& mandatory( "d", m_d )
+			& mandatory( "e", m_e )
+			& optional( "f", m_f, -1 );
+	}
+};
+
+TEST_CASE( "order of members" , "[member_index]" )
+{
+	// Members in the order of declaration, in another fixed order and
+	// in a changing order must give the same result.
+	const char * jsons[] = {
+		R"({"a":1,"b":2,"c":3,"d":4,"e":5})",
+		R"({"e":5,"d":4,"c":3,"b":2,"a":1})",
+		R"({"e":5,"d":4,"c":3,"b":2,"a":1})",
+		R"({"b":2,"extra":0,"d":4,"a":1,"e":5,"c":3})",
+		R"({"c":3,"a":1,"e":5,"b":2,"d":4})",
+		R"({"a":1,"c":3,"d":4,"e":5,"b":2})",
+		R"({"a":1,"b":2,"c":3,"d":4,"e":5})"
+	};
+
+	for( int i = 0; i != 2; ++i )
+		for( const auto * json : jsons )
+		{
+			const auto v = from_json< ordered_t >( json );
+			REQUIRE( 1 == v.m_a );
+			REQUIRE( 2 == v.m_b );
+			REQUIRE( 3 == v.m_c );
+			REQUIRE( 4 == v.m_d );
+			REQUIRE( 5 == v.m_e );
+			REQUIRE( -1 == v.m_f );
+		}
+
+	REQUIRE_THROWS_WITH(
+			from_json< ordered_t >( R"({"a":1,"b":2,"c":3,"e":5,"f":6})" ),
+			"error reading field \"d\": mandatory field doesn't exist" );
+
+	// The first occurrence of a member is used even if the next one
+	// is at the expected position.
+	for( int i = 0; i != 2; ++i )
+	{
+		const auto v = from_json< ordered_t >(
+				R"({"a":1,"a":7,"b":2,"c":3,"b":8,"c":9,"d":4,"e":5,"f":6})" );
+		REQUIRE( 1 == v.m_a );
+		REQUIRE( 2 == v.m_b );
+		REQUIRE( 3 == v.m_c );
+		REQUIRE( 6 == v.m_f );
+	}
+}
+
+// A DTO that isn't read by other tests.
+struct late_index_t
+{
+	int m_a{};
+	int m_b{};
+	int m_c{};
+	std::string m_d;
+
+	template< typename Json_Io >
+	void
+	json_io( Json_Io & io )
+	{
+		io
+			& mandatory( "a", m_a )
+			& mandatory( "b", m_b )
+			& mandatory( "c", m_c )
+			& mandatory( "d", m_d );
+	}
+};
+
+TEST_CASE( "index after failed reads" , "[member_index]" )
+{
+	using holder_t = details::member_index::index_holder_t< late_index_t >;
+
+	late_index_t v;
+	REQUIRE_THROWS( from_json( R"({"a":"1","b":2,"c":3,"d":"4"})", v ) );
+	REQUIRE( nullptr == holder_t::instance().get() );
+
+	REQUIRE( try_from_json( R"({"b":2,"c":"3","d":"4"})", v ) );
+	REQUIRE( nullptr == holder_t::instance().get() );
+
+	REQUIRE_FALSE( try_from_json( R"({"d":"4","c":3,"b":2,"a":1})", v ) );
+	REQUIRE( nullptr != holder_t::instance().get() );
+	REQUIRE( 4u == holder_t::instance().get()->binders() );
+	REQUIRE( 4u == holder_t::instance().get()->slots() );
+
+	v = from_json< late_index_t >( R"({"d":"8","c":7,"b":6,"a":5})" );
+	REQUIRE( 5 == v.m_a );
+	REQUIRE( 6 == v.m_b );
+	REQUIRE( 7 == v.m_c );
+	REQUIRE( "8" == v.m_d );
+}
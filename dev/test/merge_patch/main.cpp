@@ -0,0 +1,174 @@
+#include <catch2/catch.hpp>
+
+#include <map>
+#include <string>
+#include <vector>
+
+#include <json_dto/pub.hpp>
+#include <json_dto/validators.hpp>
+
+#include <test/helper.hpp>
+
+using namespace json_dto;
+
+struct author_t
+{
+	std::string m_given_name;
+	nullable_t< std::string > m_family_name;
+
+	template< typename Json_Io >
+	void
+	json_io( Json_Io & io )
+	{
+		io
+			& mandatory( "givenName", m_given_name )
+			& optional_null( "familyName", m_family_name );
+	}
+};
+
+struct document_t
+{
+	std::string m_title;
+	author_t m_author;
+	std::vector< std::string > m_tags;
+	std::string m_content;
+	nullable_t< std::string > m_phone_number;
+
+	template< typename Json_Io >
+	void
+	json_io( Json_Io & io )
+	{
+		io
+			& mandatory( "title", m_title )
+			& mandatory( "author", m_author )
+			& mandatory( "tags", m_tags )
+			& mandatory( "content", m_content )
+			& optional_null( "phoneNumber", m_phone_number );
+	}
+};
+
+TEST_CASE( "example from RFC 7386" , "[merge_patch]" )
+{
+	auto document = from_json< document_t >(
+			R"({"title":"Goodbye!",)"
+			R"("author":{"givenName":"John","familyName":"Doe"},)"
+			R"("tags":["example","sample"],)"
+			R"("content":"This will be unchanged"})" );
+
+	{
+		merge_patch_mode_t merge_patch;
+		REQUIRE( merge_patch_mode_t::active() );
+
+		from_json(
+				R"({"title":"Hello!","phoneNumber":"+01-123-456-7890",)"
+				R"("author":{"familyName":null},"tags":["example"]})",
+				document );
+	}
+	REQUIRE( !merge_patch_mode_t::active() );
+
+	REQUIRE( R"({"title":"Hello!","author":{"givenName":"John"},)"
+			R"("tags":["example"],"content":"This will be unchanged",)"
+			R"("phoneNumber":"+01-123-456-7890"})" == to_json( document ) );
+
+	// Missing mandatory fields are required without the mode.
+	REQUIRE_THROWS_AS( from_json( R"({"title":"Hello!"})", document ), ex_t );
+}
+
+struct settings_t
+{
+	int m_level{};
+	int m_retries{};
+	std::map< std::string, author_t > m_owners;
+	std::vector< author_t > m_reviewers;
+	nullable_t< author_t > m_maintainer;
+
+	template< typename Json_Io >
+	void
+	json_io( Json_Io & io )
+	{
+		io
+			& mandatory( "level", m_level, min_max_constraint( 0, 10 ) )
+			& optional( "retries", m_retries, 3 )
+			& mandatory( "owners", m_owners )
+			& mandatory( "reviewers", m_reviewers )
+			& optional_null( "maintainer", m_maintainer );
+	}
+};
+
+settings_t
+make_settings()
+{
+	return from_json< settings_t >(
+			R"({"level":1,"retries":5,)"
+			R"("owners":{"a":{"givenName":"Ann"},"b":{"givenName":"Bob"}},)"
+			R"("reviewers":[{"givenName":"Carl"}],)"
+			R"("maintainer":{"givenName":"Dan"}})" );
+}
+
+TEST_CASE( "null" , "[merge_patch]" )
+{
+	auto settings = make_settings();
+
+	merge_patch_mode_t merge_patch;
+
+	// Optional fields receive default values.
+	from_json( R"({"retries":null,"owners":{"a":null}})", settings );
+	REQUIRE( 3 == settings.m_retries );
+	REQUIRE( 1 == settings.m_owners.size() );
+	REQUIRE( "Bob" == settings.m_owners.at( "b" ).m_given_name );
+
+	from_json( R"({"maintainer":null})", settings );
+	REQUIRE( !settings.m_maintainer );
+
+	// Mandatory fields can't be removed.
+	REQUIRE_THROWS_WITH( from_json( R"({"level":null})", settings ),
+			"error reading field \"level\": mandatory field doesn't exist" );
+}
+
+TEST_CASE( "nested values" , "[merge_patch]" )
+{
+	auto settings = make_settings();
+
+	merge_patch_mode_t merge_patch;
+
+	from_json(
+			R"({"owners":{"b":{"familyName":"Brown"},"c":{"givenName":"Cid"}},)"
+			R"("maintainer":{"familyName":"Doe"}})",
+			settings );
+	REQUIRE( 3 == settings.m_owners.size() );
+	REQUIRE( "Bob" == settings.m_owners.at( "b" ).m_given_name );
+	REQUIRE( "Brown" == *settings.m_owners.at( "b" ).m_family_name );
+	REQUIRE( "Cid" == settings.m_owners.at( "c" ).m_given_name );
+	REQUIRE( "Dan" == settings.m_maintainer->m_given_name );
+	REQUIRE( "Doe" == *settings.m_maintainer->m_family_name );
+	REQUIRE( 1 == settings.m_level );
+
+	// New values are read completely.
+	REQUIRE_THROWS_AS(
+			from_json( R"({"owners":{"d":{"familyName":"Doe"}}})", settings ),
+			ex_t );
+	REQUIRE_THROWS_AS(
+			from_json( R"({"reviewers":[{"familyName":"Doe"}]})", settings ),
+			ex_t );
+
+	from_json( R"({"reviewers":[{"givenName":"Eve"},{"givenName":"Fay"}]})",
+			settings );
+	REQUIRE( 2 == settings.m_reviewers.size() );
+	REQUIRE( "Fay" == settings.m_reviewers.back().m_given_name );
+}
+
+TEST_CASE( "errors" , "[merge_patch]" )
+{
+	auto settings = make_settings();
+
+	merge_patch_mode_t merge_patch;
+
+	REQUIRE_THROWS_AS( from_json( R"({"level":11})", settings ), ex_t );
+	REQUIRE_THROWS_AS( from_json( R"({"level":"high"})", settings ), ex_t );
+	REQUIRE_THROWS_AS( from_json( R"([])", settings ), ex_t );
+
+	const auto error = try_from_json(
+			R"({"owners":{"a":{"givenName":1}}})", settings );
+	REQUIRE( error_code_t::type_mismatch == error.code() );
+	REQUIRE( "/owners/a/givenName" == error.json_pointer() );
+}
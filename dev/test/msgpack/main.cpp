@@ -0,0 +1,306 @@
+#include <catch2/catch.hpp>
+
+#include <cstdint>
+#include <cstdio>
+#include <map>
+#include <string>
+#include <vector>
+
+#include <json_dto/pub.hpp>
+#include <json_dto/validators.hpp>
+#include <json_dto/msgpack.hpp>
+
+#include <test/helper.hpp>
+
+using namespace json_dto;
+
+std::string
+bytes( std::initializer_list< unsigned char > values )
+{
+	return std::string( values.begin(), values.end() );
+}
+
+struct point_t
+{
+	int m_x{};
+	int m_y{};
+};
+
+struct data_t
+{
+	std::string m_name;
+	std::int64_t m_min{};
+	std::uint64_t m_max{};
+	double m_ratio{};
+	bool m_flag{};
+	std::vector< std::int32_t > m_values;
+	std::map< std::string, double > m_weights;
+	nullable_t< std::string > m_comment;
+	int m_level{};
+	point_t m_point;
+
+	template< typename Json_Io >
+	void
+	json_io( Json_Io & io )
+	{
+		io
+			& mandatory( "name", m_name )
+			& mandatory( "min", m_min )
+			& mandatory( "max", m_max )
+			& mandatory( "ratio", m_ratio )
+			& mandatory( "flag", m_flag )
+			& mandatory( "values", m_values )
+			& mandatory( "weights", m_weights )
+			& mandatory( "comment", m_comment )
+			& optional( "level", m_level, 1, min_max_constraint( 0, 10 ) )
+			& mandatory(
+					inside_array::reader_writer(
+						inside_array::member( m_point.m_x ),
+						inside_array::member( m_point.m_y ) ),
+					"point", m_point );
+	}
+};
+
+data_t
+make_data()
+{
+	data_t data;
+	data.m_name = std::string( 40u, 'n' );
+	data.m_min = std::numeric_limits< std::int64_t >::min();
+	data.m_max = std::numeric_limits< std::uint64_t >::max();
+	data.m_ratio = 0.1;
+	data.m_flag = true;
+	data.m_values = { 0, 127, 128, 255, 256, 65535, 65536, -1, -32, -33,
+			-128, -129, -32768, -32769,
+			std::numeric_limits< std::int32_t >::min() };
+	data.m_weights[ "a" ] = 0.5;
+	data.m_weights[ "b" ] = -1e300;
+	data.m_level = 3;
+	data.m_point = point_t{ 10, -10 };
+
+	return data;
+}
+
+TEST_CASE( "round trip" , "[msgpack]" )
+{
+	const auto data = make_data();
+
+	const auto packed = to_msgpack( data );
+	REQUIRE( packed.size() < to_json( data ).size() );
+
+	const auto unpacked = from_msgpack< data_t >( packed );
+	REQUIRE( to_json( data ) == to_json( unpacked ) );
+
+	data_t other;
+	from_msgpack( packed, other );
+	REQUIRE( to_json( data ) == to_json( other ) );
+}
+
+TEST_CASE( "encoding" , "[msgpack]" )
+{
+	auto data = make_data();
+	data.m_values = { 1, -1, 200, -200, 70000 };
+
+	const auto packed = to_msgpack( data.m_values );
+	REQUIRE( bytes( { 0x95, 0x01, 0xff, 0xcc, 0xc8, 0xd1, 0xff, 0x38,
+			0xce, 0x00, 0x01, 0x11, 0x70 } ) == packed );
+
+	REQUIRE( bytes( { 0x82, 0xa1, 'a', 0xca, 0x3f, 0x00, 0x00, 0x00,
+			0xa1, 'b', 0xcb, 0x3f, 0xb9, 0x99, 0x99, 0x99, 0x99, 0x99, 0x9a } ) ==
+			to_msgpack( std::map< std::string, double >{
+					{ "a", 0.5 }, { "b", 0.1 } } ) );
+
+	REQUIRE( bytes( { 0x92, 0xc0, 0xc3 } ) ==
+			to_msgpack( std::vector< nullable_t< bool > >{
+					nullable_t< bool >{}, nullable_t< bool >{ true } } ) );
+
+	REQUIRE( bytes( { 0x92, 0xbf } ) + std::string( 31u, 's' ) +
+			bytes( { 0xd9, 0x20 } ) + std::string( 32u, 's' ) ==
+			to_msgpack( std::vector< std::string >{
+					std::string( 31u, 's' ), std::string( 32u, 's' ) } ) );
+}
+
+struct mixed_t
+{
+	int m_x{};
+	std::vector< int > m_y;
+	double m_z{};
+
+	template< typename Json_Io >
+	void
+	json_io( Json_Io & io )
+	{
+		io
+			& mandatory( "x", m_x )
+			& mandatory( "y", m_y )
+			& mandatory( "z", m_z );
+	}
+};
+
+TEST_CASE( "decoding" , "[msgpack]" )
+{
+	// Long forms, bin and float32 are accepted.
+	const auto packed =
+			bytes( { 0x83,
+				0xda, 0x00, 0x01, 'x', 0xd2, 0x00, 0x00, 0x00, 0x05,
+				0xc4, 0x01, 'y', 0xdc, 0x00, 0x02, 0xcd, 0x00, 0x01, 0xd0, 0xfe,
+				0xa1, 'z', 0xca, 0x40, 0x20, 0x00, 0x00 } );
+
+	const auto mixed = from_msgpack< mixed_t >( packed );
+	REQUIRE( 5 == mixed.m_x );
+	REQUIRE( std::vector< int >{ 1, -2 } == mixed.m_y );
+	REQUIRE( equal( 2.5, mixed.m_z ) );
+}
+
+TEST_CASE( "long containers" , "[msgpack]" )
+{
+	std::vector< int > values( 15u, 1 );
+
+	auto packed = to_msgpack( values );
+	REQUIRE( 16u == packed.size() );
+	REQUIRE( '\x9f' == packed[ 0u ] );
+
+	values.push_back( 1 );
+	packed = to_msgpack( values );
+	REQUIRE( bytes( { 0xdc, 0x00, 0x10, 0x01 } ) == packed.substr( 0u, 4u ) );
+	REQUIRE( 19u == packed.size() );
+
+	// Headers of nested containers are patched independently.
+	std::vector< std::vector< int > > nested{
+			std::vector< int >( 70000u, 2 ), std::vector< int >( 16u, 3 ) };
+	std::map< std::string, std::vector< int > > keyed;
+	for( int i = 0; i != 20; ++i )
+		keyed[ std::string( 1u, static_cast< char >( 'a' + i ) ) ] =
+				std::vector< int >( static_cast< std::size_t >( i ), i );
+
+	packed = to_msgpack( nested );
+	REQUIRE( bytes( { 0x92, 0xdd, 0x00, 0x01, 0x11, 0x70 } ) ==
+			packed.substr( 0u, 6u ) );
+	REQUIRE( nested == from_msgpack< decltype(nested) >( packed ) );
+
+	packed = to_msgpack( keyed );
+	REQUIRE( bytes( { 0xde, 0x00, 0x14 } ) == packed.substr( 0u, 3u ) );
+	REQUIRE( keyed == from_msgpack< decltype(keyed) >( packed ) );
+}
+
+struct with_raw_t
+{
+	raw_json_t m_raw;
+	int m_x{};
+
+	template< typename Json_Io >
+	void
+	json_io( Json_Io & io )
+	{
+		io
+			& mandatory( "raw", m_raw )
+			& mandatory( "x", m_x );
+	}
+};
+
+TEST_CASE( "raw_json_t" , "[msgpack]" )
+{
+	with_raw_t data;
+	data.m_raw = raw_json_t{
+			R"({"a":[1,-2,2.5,"s",null,true],"b":{}})" };
+	data.m_x = 3;
+
+	const auto packed = to_msgpack( data );
+	REQUIRE( to_msgpack( from_json< with_raw_t >( to_json( data ) ) ) ==
+			packed );
+
+	// A value read from MessagePack is kept as a copy of the DOM.
+	const auto unpacked = from_msgpack< with_raw_t >( packed );
+	REQUIRE( nullptr != unpacked.m_raw.value() );
+	REQUIRE( unpacked.m_raw == data.m_raw );
+	REQUIRE( 3 == unpacked.m_x );
+	REQUIRE( packed == to_msgpack( unpacked ) );
+
+	data.m_raw = raw_json_t{ "[1," };
+	std::string to{ "prefix" };
+	REQUIRE_THROWS_AS( to_msgpack_append( to, data ), ex_t );
+	REQUIRE( "prefix" == to );
+}
+
+struct hex_reader_writer_t
+{
+	void
+	read( int & v, const rapidjson::Value & from ) const
+	{
+		v = std::stoi( from.GetString(), nullptr, 16 );
+	}
+
+	void
+	write(
+		const int & v,
+		rapidjson::Value & to,
+		rapidjson::MemoryPoolAllocator<> & allocator ) const
+	{
+		char buf[ 32 ];
+		std::snprintf( buf, sizeof( buf ), "%x", v );
+		to.SetString( buf, allocator );
+	}
+};
+
+TEST_CASE( "custom Reader_Writer" , "[msgpack]" )
+{
+	const auto packed = to_msgpack( hex_reader_writer_t{}, 255 );
+	REQUIRE( bytes( { 0xa2, 'f', 'f' } ) == packed );
+
+	REQUIRE( 255 == from_msgpack< int >( hex_reader_writer_t{}, packed ) );
+
+	int value{};
+	from_msgpack( hex_reader_writer_t{}, packed, value );
+	REQUIRE( 255 == value );
+
+	const auto items = to_msgpack(
+			apply_to_content_t< hex_reader_writer_t >{},
+			std::vector< int >{ 16, 1 } );
+	REQUIRE( bytes( { 0x92, 0xa2, '1', '0', 0xa1, '1' } ) == items );
+
+	std::vector< int > read_items;
+	from_msgpack(
+			apply_to_content_t< hex_reader_writer_t >{}, items, read_items );
+	REQUIRE( std::vector< int >{ 16, 1 } == read_items );
+}
+
+TEST_CASE( "errors" , "[msgpack]" )
+{
+	const auto packed = to_msgpack( make_data() );
+
+	REQUIRE_THROWS_WITH(
+			from_msgpack< std::vector< std::string > >(
+					to_msgpack( std::vector< std::string >{ "abcdef" } )
+						.substr( 0u, 5u ) ),
+			"MessagePack parse error: 'unexpected end of data' (offset: 2)" );
+	REQUIRE_THROWS_AS(
+			from_msgpack< data_t >( packed.substr( 0u, packed.size() - 1u ) ),
+			ex_t );
+	REQUIRE_THROWS_WITH(
+			from_msgpack< data_t >( packed + bytes( { 0xc0 } ) ),
+			"MessagePack parse error: 'unexpected data after the root value' "
+			"(offset: " + std::to_string( packed.size() ) + ")" );
+	REQUIRE_THROWS_WITH(
+			from_msgpack< data_t >( bytes( { 0x81, 0x01, 0x02 } ) ),
+			"MessagePack parse error: 'a key of a map must be a string' "
+			"(offset: 2)" );
+	REQUIRE_THROWS_WITH(
+			from_msgpack< data_t >( bytes( { 0xd4, 0x01, 0x02 } ) ),
+			"MessagePack parse error: 'unsupported type' (offset: 0)" );
+	REQUIRE_THROWS_WITH(
+			from_msgpack< data_t >( bytes( { 0xdd, 0xff, 0xff, 0xff, 0xff } ) ),
+			"MessagePack parse error: 'unexpected end of data' (offset: 5)" );
+	REQUIRE_THROWS_WITH(
+			from_msgpack< std::vector< int > >(
+					std::string( 1000u, static_cast< char >( 0x91 ) ) + '\0' ),
+			"MessagePack parse error: 'too deep nesting' (offset: 513)" );
+
+	// Errors of reading are reported as for JSON.
+	auto data = make_data();
+	data.m_level = 11;
+	REQUIRE_THROWS_AS( to_msgpack( data ), ex_t );
+	REQUIRE_THROWS_AS( from_msgpack< data_t >( bytes( { 0x80 } ) ), ex_t );
+	REQUIRE_THROWS_AS(
+			from_msgpack< data_t >( to_msgpack( std::vector< int >{ 1 } ) ),
+			ex_t );
+}
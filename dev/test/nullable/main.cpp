@@ -6,6 +6,8 @@
 #include <rapidjson/document.h>
 #include <json_dto/pub.hpp>
 
+#include <test/allocations.hpp>
+
 using namespace json_dto;
 
 TEST_CASE("constructors", "[basic]" )
@@ -373,3 +375,32 @@ TEST_CASE("nullable_t inside array", "[basic]" )
 	}
 }
 
+
+TEST_CASE("allocation budgets", "[basic]" )
+{
+	rapidjson::Document doc;
+	doc.Parse( R"([1,null,3])" );
+
+	// Values are stored inside nullable_t.
+	std::vector< nullable_t< int > > v;
+	REQUIRE( 1u == allocations_of( [&] { from_json( doc, v ); } ) );
+	REQUIRE( 0u == allocations_of( [&] { from_json( doc, v ); } ) );
+	REQUIRE_FALSE( v[ 1 ] );
+
+	// A new vector is created for a value read without reuse_mode_t.
+	nullable_t< std::vector< int > > nv;
+	doc.Parse( R"([1,2,3])" );
+	REQUIRE( 1u == allocations_of( [&] { read_json_value( nv, doc ); } ) );
+	REQUIRE( 1u == allocations_of( [&] { read_json_value( nv, doc ); } ) );
+	{
+		reuse_mode_t reuse;
+		REQUIRE( 0u == allocations_of( [&] { read_json_value( nv, doc ); } ) );
+	}
+
+	buffered_allocator_t<> values;
+	rapidjson::Value value;
+	REQUIRE( 0u == allocations_of( [&] {
+			write_json_value( v, value, values.m_allocator );
+			write_json_value( nv, value, values.m_allocator );
+		} ) );
+}
@@ -0,0 +1,207 @@
+#include <catch2/catch.hpp>
+
+#include <array>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include <json_dto/pub.hpp>
+
+#include <test/helper.hpp>
+
+using namespace json_dto;
+
+template< typename T >
+void
+check_roundtrip( const std::string & json )
+{
+	const auto vec = from_json< std::vector< T > >( json );
+	REQUIRE( json == to_json( vec ) );
+
+	REQUIRE( vec == from_json_sax< std::vector< T > >( json ) );
+	REQUIRE( json == to_json_sax( vec ) );
+}
+
+TEST_CASE( "vectors of numbers" , "[numeric_arrays]" )
+{
+	check_roundtrip< std::int8_t >( R"([-128,0,127])" );
+	check_roundtrip< std::uint8_t >( R"([0,1,255])" );
+	check_roundtrip< std::int16_t >( R"([-32768,0,32767])" );
+	check_roundtrip< std::uint16_t >( R"([0,65535])" );
+	check_roundtrip< std::int32_t >( R"([-2147483648,0,2147483647])" );
+	check_roundtrip< std::uint32_t >( R"([0,4294967295])" );
+	check_roundtrip< std::int64_t >(
+			R"([-9223372036854775808,0,9223372036854775807])" );
+	check_roundtrip< std::uint64_t >( R"([0,18446744073709551615])" );
+	check_roundtrip< float >( R"([0.5,-1.25])" );
+	check_roundtrip< double >( R"([0.5,-1.25,1e100])" );
+	check_roundtrip< double >( R"([])" );
+
+	// Items of other types are accepted as usual.
+	REQUIRE( ( std::vector< double >{ 1.0, 2.5 } ) ==
+			from_json< std::vector< double > >( R"([1,2.5])" ) );
+
+	// An existing content is replaced.
+	std::vector< int > vec{ 1, 2, 3, 4 };
+	from_json( R"([5,6])", vec );
+	REQUIRE( ( std::vector< int >{ 5, 6 } ) == vec );
+}
+
+// JSON pointer to the failed value.
+template< typename Action >
+std::string
+pointer_of_error( Action && action )
+{
+	try
+	{
+		action();
+	}
+	catch( const ex_t & ex )
+	{
+		return ex.info().json_pointer();
+	}
+
+	return "no error";
+}
+
+TEST_CASE( "errors" , "[numeric_arrays]" )
+{
+	REQUIRE_THROWS_WITH(
+			from_json< std::vector< std::int8_t > >( R"([1,128])" ),
+			"value is out of int8: 128" );
+	REQUIRE_THROWS_WITH(
+			from_json< std::vector< int > >( R"([1,"2"])" ),
+			"value is not std::int32_t" );
+	REQUIRE_THROWS_WITH(
+			from_json< std::vector< double > >( R"({"a":1})" ),
+			"value is not an array" );
+	REQUIRE_THROWS_WITH(
+			( from_json< std::array< int, 3 > >( R"([1,2])" ) ),
+			"invalid size of array: 2 (expected 3)" );
+	REQUIRE_THROWS_WITH(
+			( from_json< std::array< int, 3 > >( R"(1)" ) ),
+			"value is not an array" );
+
+	// The index of the failed item is in the path.
+	REQUIRE( "/1/1" == pointer_of_error( [] {
+			(void)from_json< std::vector< std::vector< std::uint16_t > > >(
+					R"([[1],[2,65536]])" );
+		} ) );
+}
+
+TEST_CASE( "errors via SAX" , "[numeric_arrays]" )
+{
+	REQUIRE_THROWS_WITH(
+			from_json_sax< std::vector< std::int8_t > >( R"([1,128])" ),
+			"value is out of int8: 128" );
+	REQUIRE_THROWS_WITH(
+			from_json_sax< std::vector< int > >( R"([1,"2"])" ),
+			"value is not std::int32_t" );
+	REQUIRE( "/2" == pointer_of_error( [] {
+			(void)from_json_sax< std::vector< int > >( R"([1,2,[3]])" );
+		} ) );
+	REQUIRE( "/1/1" == pointer_of_error( [] {
+			(void)from_json_sax< std::vector< std::vector< std::uint16_t > > >(
+					R"([[1],[2,65536]])" );
+		} ) );
+	REQUIRE( "" == pointer_of_error( [] {
+			(void)from_json_sax< std::array< int, 1 > >( R"([1,2])" );
+		} ) );
+	REQUIRE_THROWS_WITH(
+			from_json_sax< std::vector< double > >( R"({"a":1})" ),
+			"value is not an array" );
+	REQUIRE_THROWS_WITH(
+			( from_json_sax< std::array< int, 3 > >( R"([1,2])" ) ),
+			"invalid size of array: 2 (expected 3)" );
+	REQUIRE_THROWS_WITH(
+			( from_json_sax< std::array< int, 1 > >( R"([1,2])" ) ),
+			"invalid size of array: 2 (expected 1)" );
+	REQUIRE_THROWS_WITH(
+			( from_json_sax< std::array< int, 3 > >( R"(1)" ) ),
+			"value is not an array" );
+}
+
+struct point_t
+{
+	std::array< double, 3 > m_coords;
+	std::array< std::string, 2 > m_labels;
+	std::vector< std::array< std::int16_t, 2 > > m_segments;
+
+	template< typename Json_Io >
+	void
+	json_io( Json_Io & io )
+	{
+		io
+			& mandatory( "coords", m_coords )
+			& mandatory( "labels", m_labels )
+			& mandatory( "segments", m_segments );
+	}
+};
+
+TEST_CASE( "std::array" , "[numeric_arrays]" )
+{
+	const std::string json = R"({"coords":[1.5,2.0,-3.0],)"
+			R"("labels":["a","b"],"segments":[[1,2],[3,4]]})";
+
+	const auto point = from_json< point_t >( json );
+	REQUIRE( -3.0 == point.m_coords[ 2 ] );
+	REQUIRE( "b" == point.m_labels[ 1 ] );
+	REQUIRE( 2u == point.m_segments.size() );
+	REQUIRE( 4 == point.m_segments[ 1 ][ 1 ] );
+
+	REQUIRE( json == to_json( point ) );
+	REQUIRE( json == to_json_sax( point ) );
+
+	const auto from_sax = from_json_sax< point_t >( json );
+	REQUIRE( point.m_coords == from_sax.m_coords );
+	REQUIRE( point.m_labels == from_sax.m_labels );
+	REQUIRE( point.m_segments == from_sax.m_segments );
+}
+
+// Stores numbers multiplied by 10.
+struct scaled_reader_writer_t
+{
+	void
+	read( double & v, const rapidjson::Value & from ) const
+	{
+		read_json_value( v, from );
+		v /= 10.0;
+	}
+
+	void
+	write(
+		const double & v,
+		rapidjson::Value & to,
+		rapidjson::MemoryPoolAllocator<> & allocator ) const
+	{
+		write_json_value( v * 10.0, to, allocator );
+	}
+};
+
+struct scaled_t
+{
+	std::vector< double > m_values;
+	std::array< double, 2 > m_pair;
+
+	template< typename Json_Io >
+	void
+	json_io( Json_Io & io )
+	{
+		io
+			& mandatory( apply_to_content_t< scaled_reader_writer_t >{},
+					"values", m_values )
+			& mandatory( apply_to_content_t< scaled_reader_writer_t >{},
+					"pair", m_pair );
+	}
+};
+
+TEST_CASE( "custom Reader-Writer" , "[numeric_arrays]" )
+{
+	const std::string json = R"({"values":[10.0,25.0],"pair":[5.0,0.0]})";
+
+	const auto scaled = from_json< scaled_t >( json );
+	REQUIRE( ( std::vector< double >{ 1.0, 2.5 } ) == scaled.m_values );
+	REQUIRE( 0.5 == scaled.m_pair[ 0 ] );
+
+	REQUIRE( json == to_json( scaled ) );
+}
@@ -0,0 +1,147 @@
+#include <catch2/catch.hpp>
+
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <json_dto/pub.hpp>
+
+#include <test/helper.hpp>
+
+using namespace json_dto;
+
+struct item_t
+{
+	int m_id{};
+	std::string m_name;
+	std::vector< int > m_values;
+
+	template< typename Json_Io >
+	void
+	json_io( Json_Io & io )
+	{
+		io
+			& mandatory( "id", m_id )
+			& mandatory( "name", m_name )
+			& optional( "values", m_values, std::vector< int >{} );
+	}
+};
+
+std::string
+make_json( int id, std::size_t values )
+{
+	item_t item;
+	item.m_id = id;
+	item.m_name = "item #" + std::to_string( id );
+	for( std::size_t i = 0u; i != values; ++i )
+		item.m_values.push_back( static_cast< int >( i ) );
+
+	return to_json( item );
+}
+
+TEST_CASE( "read with context" , "[parse_context]" )
+{
+	parse_context_t ctx;
+
+	for( int i = 0; i != 10; ++i )
+	{
+		const auto json = make_json( i, 10u );
+
+		item_t item;
+		from_json( ctx, json, item );
+		REQUIRE( i == item.m_id );
+		REQUIRE( "item #" + std::to_string( i ) == item.m_name );
+		REQUIRE( 10u == item.m_values.size() );
+
+		const auto copy = from_json< item_t >( ctx, json.c_str() );
+		REQUIRE( item.m_name == copy.m_name );
+
+		const auto ref = from_json< item_t >( ctx, make_string_ref( json ) );
+		REQUIRE( item.m_values == ref.m_values );
+	}
+
+	REQUIRE( 30u == ctx.stats().m_documents );
+	REQUIRE( 0u < ctx.stats().m_bytes_in_use );
+}
+
+TEST_CASE( "read from stream with context" , "[parse_context]" )
+{
+	parse_context_t ctx;
+
+	for( int i = 0; i != 3; ++i )
+	{
+		std::istringstream from{ make_json( i, 3u ) };
+		const auto item = from_stream< item_t >( ctx, from );
+		REQUIRE( i == item.m_id );
+		REQUIRE( 3u == item.m_values.size() );
+	}
+}
+
+TEST_CASE( "parse flags" , "[parse_context]" )
+{
+	parse_context_t ctx;
+
+	const std::string json = R"({"id":1,"name":"a",})";
+	REQUIRE_THROWS_AS( from_json< item_t >( ctx, json ), json_dto::ex_t );
+
+	const auto item = from_json<
+				item_t, rapidjson::kParseTrailingCommasFlag >( ctx, json );
+	REQUIRE( "a" == item.m_name );
+}
+
+TEST_CASE( "errors" , "[parse_context]" )
+{
+	parse_context_t ctx;
+
+	REQUIRE_THROWS_WITH( from_json< item_t >( ctx, R"({"id":1,)" ),
+			"JSON parse error: 'Missing a name for object member.' "
+			"(offset: 8)" );
+	REQUIRE_THROWS_WITH( from_json< item_t >( ctx, R"({"id":1})" ),
+			"error reading field \"name\": mandatory field doesn't exist" );
+
+	// The context can be used after errors.
+	const auto item = from_json< item_t >( ctx, make_json( 5, 1u ) );
+	REQUIRE( 5 == item.m_id );
+
+	REQUIRE( 3u == ctx.stats().m_documents );
+}
+
+TEST_CASE( "retained memory" , "[parse_context]" )
+{
+	parse_context_t ctx{ 512u, 64u };
+	REQUIRE( 512u == ctx.chunk_size() );
+	REQUIRE( 1u == ctx.stats().m_chunks_allocated );
+
+	// A document that doesn't fit into the initial memory.
+	const auto big = make_json( 1, 1000u );
+	const auto small = make_json( 2, 10u );
+
+	REQUIRE( 1000u == from_json< item_t >( ctx, big ).m_values.size() );
+	REQUIRE( 1u == ctx.stats().m_overflows );
+
+	// The memory is enlarged before the next parsing and then
+	// it's enough for documents of the same size.
+	REQUIRE( 1000u == from_json< item_t >( ctx, big ).m_values.size() );
+	const auto chunks = ctx.stats().m_chunks_allocated;
+	const auto retained = ctx.stats().m_bytes_retained;
+
+	for( int i = 0; i != 5; ++i )
+	{
+		REQUIRE( 1000u == from_json< item_t >( ctx, big ).m_values.size() );
+		REQUIRE( 10u == from_json< item_t >( ctx, small ).m_values.size() );
+	}
+
+	const auto stats = ctx.stats();
+	REQUIRE( chunks == stats.m_chunks_allocated );
+	REQUIRE( retained == stats.m_bytes_retained );
+	REQUIRE( 1u == stats.m_overflows );
+	REQUIRE( 12u == stats.m_documents );
+	REQUIRE( stats.m_bytes_in_use < stats.m_bytes_retained );
+
+	// The document is valid until the next parsing.
+	const auto & document = ctx.parse( make_string_ref( big ) );
+	REQUIRE( document.IsObject() );
+	REQUIRE( 1000u == document[ "values" ].Size() );
+	REQUIRE( chunks == ctx.stats().m_chunks_allocated );
+}
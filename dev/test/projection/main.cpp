@@ -0,0 +1,155 @@
+#include <catch2/catch.hpp>
+
+#include <iostream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include <json_dto/pub.hpp>
+#include <json_dto/validators.hpp>
+
+#include <test/helper.hpp>
+
+using namespace json_dto;
+
+struct user_t
+{
+	std::string m_name;
+	int m_age{};
+
+	template< typename Json_Io >
+	void
+	json_io( Json_Io & io )
+	{
+		io
+			& mandatory( "name", m_name )
+			& mandatory( "age", m_age );
+	}
+};
+
+// Fails if a value is read.
+struct failing_reader_writer_t
+{
+	void
+	read( int &, const rapidjson::Value & ) const
+	{
+		throw std::runtime_error{ "the field must not be read" };
+	}
+
+	void
+	write(
+		const int & v,
+		rapidjson::Value & to,
+		rapidjson::MemoryPoolAllocator<> & ) const
+	{
+		to.SetInt( v );
+	}
+};
+
+struct event_t
+{
+	std::int64_t m_id{};
+	std::string m_kind{ "unknown" };
+	double m_price{};
+	user_t m_user;
+	std::vector< int > m_history;
+	int m_checked{ -1 };
+	nullable_t< std::string > m_comment;
+
+	template< typename Json_Io >
+	void
+	json_io( Json_Io & io )
+	{
+		io
+			& mandatory( "id", m_id )
+			& optional( "kind", m_kind, "none" )
+			& mandatory( "price", m_price, min_max_constraint( 0.0, 100.0 ) )
+			& mandatory( "user", m_user )
+			& mandatory( "history", m_history )
+			& mandatory( failing_reader_writer_t{}, "checked", m_checked )
+			& optional_null( "comment", m_comment );
+	}
+};
+
+const std::string event_json =
+		R"({"id":42,"kind":"trade","price":10.5,)"
+		R"("user":{"name":"Bob","age":33},)"
+		R"("history":[1,2,3,[4,{"a":[5]}]],"checked":1,"comment":null})";
+
+TEST_CASE( "selected fields" , "[projection]" )
+{
+	event_t event;
+	from_json_sax( event_json, event, projection_t{ "id", "price" } );
+
+	REQUIRE( 42 == event.m_id );
+	REQUIRE( equal( 10.5, event.m_price ) );
+
+	// Other fields aren't touched, even optional ones.
+	REQUIRE( "unknown" == event.m_kind );
+	REQUIRE( event.m_user.m_name.empty() );
+	REQUIRE( event.m_history.empty() );
+	REQUIRE( -1 == event.m_checked );
+}
+
+TEST_CASE( "nested objects" , "[projection]" )
+{
+	const auto event = from_json_sax< event_t >(
+			event_json, projection_t{ "user", "kind" } );
+
+	REQUIRE( "trade" == event.m_kind );
+	// Nested DTOs are read completely.
+	REQUIRE( "Bob" == event.m_user.m_name );
+	REQUIRE( 33 == event.m_user.m_age );
+	REQUIRE( 0 == event.m_id );
+
+	// The projection isn't applied to nested objects.
+	REQUIRE_THROWS_WITH(
+			from_json_sax< event_t >(
+					R"({"user":{"name":"Bob"}})", projection_t{ "user" } ),
+			"error reading field \"user\": error reading field \"age\": "
+			"mandatory field doesn't exist" );
+}
+
+TEST_CASE( "missing and invalid fields" , "[projection]" )
+{
+	const projection_t projection{ std::vector< std::string >{ "id", "kind" } };
+
+	// Mandatory fields that aren't selected aren't required.
+	auto event = from_json_sax< event_t >( R"({"id":1})", projection );
+	REQUIRE( 1 == event.m_id );
+	REQUIRE( "none" == event.m_kind );
+
+	// Values that aren't selected aren't checked.
+	event = from_json_sax< event_t >(
+			R"({"price":1000,"user":[],"history":{"a":"b"},"id":2})",
+			projection );
+	REQUIRE( 2 == event.m_id );
+
+	// But selected fields are checked.
+	REQUIRE_THROWS_WITH(
+			from_json_sax< event_t >( R"({"kind":"trade"})", projection ),
+			"error reading field \"id\": mandatory field doesn't exist" );
+	REQUIRE_THROWS_WITH(
+			from_json_sax< event_t >( R"({"id":"1"})", projection ),
+			"error reading field \"id\": value is not std::int64_t" );
+	REQUIRE_THROWS_WITH(
+			from_json_sax< event_t >(
+					R"({"id":1,"price":1000})", projection_t{ "id", "price" } ),
+			"error reading field \"price\": invalid value: 1000.000000, "
+			"must be in [ 0.000000, 100.000000 ]" );
+
+	// Syntax errors are detected in skipped values too.
+	REQUIRE_THROWS_AS(
+			from_json_sax< event_t >( R"({"id":1,"user":{"name":]})", projection ),
+			ex_t );
+}
+
+TEST_CASE( "empty projection" , "[projection]" )
+{
+	event_t event;
+	event.m_id = 3;
+	from_json_sax( event_json.c_str(), event,
+			projection_t{ std::vector< std::string >{} } );
+	REQUIRE( 3 == event.m_id );
+	REQUIRE( "unknown" == event.m_kind );
+}
@@ -0,0 +1,160 @@
+#include <catch2/catch.hpp>
+
+#include <algorithm>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <json_dto/pub.hpp>
+
+#include <test/helper.hpp>
+
+using namespace json_dto;
+
+struct envelope_t
+{
+	std::string m_route;
+	raw_json_t m_payload;
+	nullable_t< raw_json_t > m_extensions;
+	int m_hops{};
+
+	template< typename Json_Io >
+	void
+	json_io( Json_Io & io )
+	{
+		io
+			& mandatory( "route", m_route )
+			& mandatory( "payload", m_payload )
+			& optional( "extensions", m_extensions, nullptr )
+			& mandatory( "hops", m_hops );
+	}
+};
+
+const std::string envelope_json =
+		R"({"route":"a.b", "payload": { "x" : [1, 2.50, {"y":null}],)"
+		R"( "s":"A\n" } ,"hops":1})";
+
+TEST_CASE( "source slices" , "[raw_json][sax]" )
+{
+	const auto envelope = from_json_sax< envelope_t >( envelope_json );
+
+	REQUIRE( "a.b" == envelope.m_route );
+	REQUIRE( R"({ "x" : [1, 2.50, {"y":null}], "s":"A\n" })" ==
+			envelope.m_payload.str() );
+	REQUIRE( !envelope.m_extensions );
+	REQUIRE( 1 == envelope.m_hops );
+
+	// The slice is written verbatim.
+	REQUIRE( R"({"route":"a.b","payload":{ "x" : [1, 2.50, {"y":null}],)"
+			R"( "s":"A\n" },"hops":1})" == to_json_sax( envelope ) );
+
+	// Arrays, nested raw values and containers of them.
+	const auto nested = from_json_sax< envelope_t >(
+			R"({"route":"","payload":[ [], {} ],)"
+			R"("extensions":{"a" : 1},"hops":2})" );
+	REQUIRE( "[ [], {} ]" == nested.m_payload.str() );
+	REQUIRE( nested.m_extensions );
+	REQUIRE( R"({"a" : 1})" == nested.m_extensions->str() );
+
+	const auto items = from_json_sax< std::vector< raw_json_t > >(
+			R"([ {"a":[1]}, [ 2 ] ,{} ])" );
+	REQUIRE( 3 == items.size() );
+	REQUIRE( R"({"a":[1]})" == items[ 0 ].str() );
+	REQUIRE( "[ 2 ]" == items[ 1 ].str() );
+	REQUIRE( "{}" == items[ 2 ].str() );
+
+	REQUIRE( R"([ 1,{ "b" : 2 } ])" ==
+			from_json_sax< raw_json_t >( R"([ 1,{ "b" : 2 } ])" ).str() );
+}
+
+TEST_CASE( "scalars" , "[raw_json]" )
+{
+	// Scalars are serialized from the parsed values.
+	const std::string json =
+			R"({"route":"","payload":"t\u0065xt","hops":0})";
+
+	REQUIRE( R"("text")" == from_json_sax< envelope_t >( json ).m_payload.str() );
+	REQUIRE( R"("text")" == from_json< envelope_t >( json ).m_payload.str() );
+
+	REQUIRE( "-42" == from_json_sax< envelope_t >(
+			R"({"route":"","payload":-42,"hops":0})" ).m_payload.str() );
+	REQUIRE( "true" == from_json< envelope_t >(
+			R"({"route":"","payload":true,"hops":0})" ).m_payload.str() );
+
+	// null is handled by binders as for other types.
+	REQUIRE( !from_json_sax< envelope_t >(
+			R"({"route":"","payload":1,"extensions":null,"hops":0})" )
+					.m_extensions );
+	REQUIRE_THROWS_AS(
+			from_json_sax< envelope_t >(
+					R"({"route":"","payload":null,"hops":0})" ),
+			ex_t );
+}
+
+TEST_CASE( "serialized values" , "[raw_json][dom]" )
+{
+	const std::string compact =
+			R"({"route":"a.b","payload":{"x":[1,2.5,{"y":null}],"s":"A\n"},)"
+			R"("hops":1})";
+
+	// DOM-based reader keeps a copy of the parsed value.
+	const auto envelope = from_json< envelope_t >( envelope_json );
+	REQUIRE( envelope.m_payload.value() );
+	REQUIRE( envelope.m_payload.text().empty() );
+	REQUIRE( R"({"x":[1,2.5,{"y":null}],"s":"A\n"})" ==
+			envelope.m_payload.str() );
+	REQUIRE( rapidjson::kObjectType == envelope.m_payload.type() );
+
+	// So does the reader from a stream.
+	std::istringstream from{ envelope_json };
+	REQUIRE( from_stream_sax< envelope_t >( from ).m_payload.value() );
+
+	// The copy is written without parsing.
+	REQUIRE( compact == to_json( envelope ) );
+	REQUIRE( compact == to_json_sax( envelope ) );
+
+	// The text is parsed to be compared with a copy of a value.
+	const auto slice = from_json_sax< envelope_t >( envelope_json );
+	REQUIRE( slice.m_payload == envelope.m_payload );
+	REQUIRE( envelope.m_payload == slice.m_payload );
+	REQUIRE( slice.m_payload != raw_json_t{ "{}" } );
+	REQUIRE( raw_json_t{ "{}" } != envelope.m_payload );
+
+	// DOM-based writer parses the text.
+	REQUIRE( compact == to_json( slice ) );
+}
+
+TEST_CASE( "copies of in-situ values" , "[raw_json][dom]" )
+{
+	std::string buffer = R"({"route":"","payload":{"a":"text"},"hops":0})";
+	const auto envelope = from_json_insitu< envelope_t >(
+			&buffer[ 0 ], buffer.size() );
+
+	// Strings of the copy don't refer to the buffer.
+	std::fill( buffer.begin(), buffer.end(), 'x' );
+	REQUIRE( R"({"a":"text"})" == envelope.m_payload.str() );
+
+	// Copies of raw_json_t share the value.
+	const auto copy = envelope.m_payload;
+	REQUIRE( copy.value() == envelope.m_payload.value() );
+}
+
+TEST_CASE( "empty and invalid values" , "[raw_json]" )
+{
+	envelope_t envelope;
+	envelope.m_route = "r";
+
+	REQUIRE( R"({"route":"r","payload":null,"hops":0})" == to_json( envelope ) );
+	REQUIRE( R"({"route":"r","payload":null,"hops":0})" ==
+			to_json_sax( envelope ) );
+
+	envelope.m_payload = raw_json_t{ R"({"a":)" };
+	REQUIRE_THROWS_AS( to_json( envelope ), ex_t );
+
+	// Types of values for pretty writers.
+	REQUIRE( rapidjson::kObjectType == raw_json_t{ "{}" }.type() );
+	REQUIRE( rapidjson::kArrayType == raw_json_t{ "[]" }.type() );
+	REQUIRE( rapidjson::kStringType == raw_json_t{ R"("")" }.type() );
+	REQUIRE( rapidjson::kNumberType == raw_json_t{ "-1" }.type() );
+	REQUIRE( rapidjson::kNullType == raw_json_t{}.type() );
+}
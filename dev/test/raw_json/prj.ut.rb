@@ -0,0 +1,7 @@
+require 'mxx_ru/binary_unittest'
+
+Mxx_ru::setup_target(
+	Mxx_ru::Binary_unittest_target.new(
+		"test/raw_json/prj.ut.rb",
+		"test/raw_json/prj.rb" )
+)
@@ -0,0 +1,253 @@
+#include <catch2/catch.hpp>
+
+#include <deque>
+#include <forward_list>
+#include <iostream>
+#include <list>
+#include <map>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include <json_dto/pub.hpp>
+
+#include <test/helper.hpp>
+#include <test/allocations.hpp>
+
+using namespace json_dto;
+
+struct item_t
+{
+	std::string m_name;
+	std::vector< int > m_values;
+	nullable_t< std::string > m_comment;
+
+	template< typename Json_Io >
+	void
+	json_io( Json_Io & io )
+	{
+		io
+			& mandatory( "name", m_name )
+			& mandatory( "values", m_values )
+			& optional_null( "comment", m_comment );
+	}
+};
+
+struct state_t
+{
+	std::vector< item_t > m_items;
+	std::map< std::string, std::vector< int > > m_groups;
+
+	template< typename Json_Io >
+	void
+	json_io( Json_Io & io )
+	{
+		io
+			& mandatory( "items", m_items )
+			& mandatory( "groups", m_groups );
+	}
+};
+
+const std::string long_name_1 = "a name that doesn't fit into SSO buffer #1";
+const std::string long_name_2 = "a name that doesn't fit into SSO buffer #2";
+
+std::string
+make_json( std::size_t items, const std::string & name )
+{
+	state_t state;
+	for( std::size_t i = 0u; i != items; ++i )
+	{
+		item_t item;
+		item.m_name = name;
+		item.m_values.assign( i + 1u, static_cast< int >( i ) );
+		if( i % 2u )
+			item.m_comment = name;
+		state.m_items.push_back( std::move( item ) );
+	}
+	state.m_groups[ "first" ] = { 1, 2, 3 };
+	if( items > 1u )
+		state.m_groups[ "second" ] = { 4 };
+
+	return to_json( state );
+}
+
+TEST_CASE( "the same results as usual reading" , "[reuse_mode]" )
+{
+	state_t state;
+	for( const auto & json : {
+			make_json( 3u, long_name_1 ),
+			make_json( 5u, long_name_2 ),
+			make_json( 1u, long_name_1 ),
+			make_json( 0u, long_name_2 ),
+			make_json( 4u, long_name_1 ) } )
+	{
+		reuse_mode_t reuse;
+		from_json( json, state );
+		REQUIRE( json == to_json( state ) );
+	}
+}
+
+TEST_CASE( "memory is reused" , "[reuse_mode]" )
+{
+	state_t state;
+	from_json( make_json( 4u, long_name_1 ), state );
+
+	const auto * items = state.m_items.data();
+	const auto * name = state.m_items[ 1 ].m_name.data();
+	const auto * values = state.m_items[ 3 ].m_values.data();
+	const auto * comment = state.m_items[ 1 ].m_comment->data();
+	const auto * group = state.m_groups[ "first" ].data();
+
+	{
+		reuse_mode_t reuse;
+		from_json( make_json( 4u, long_name_2 ), state );
+	}
+	REQUIRE( long_name_2 == state.m_items[ 1 ].m_name );
+	REQUIRE( items == state.m_items.data() );
+	REQUIRE( name == state.m_items[ 1 ].m_name.data() );
+	REQUIRE( values == state.m_items[ 3 ].m_values.data() );
+	REQUIRE( comment == state.m_items[ 1 ].m_comment->data() );
+	REQUIRE( group == state.m_groups[ "first" ].data() );
+
+	// Shrinking at the tail.
+	{
+		reuse_mode_t reuse;
+		from_json( make_json( 2u, long_name_1 ), state );
+	}
+	REQUIRE( 2u == state.m_items.size() );
+	REQUIRE( items == state.m_items.data() );
+	REQUIRE( name == state.m_items[ 1 ].m_name.data() );
+}
+
+TEST_CASE( "mode is scoped" , "[reuse_mode]" )
+{
+	REQUIRE( !reuse_mode_t::active() );
+	{
+		reuse_mode_t outer;
+		REQUIRE( reuse_mode_t::active() );
+		{
+			reuse_mode_t inner;
+			REQUIRE( reuse_mode_t::active() );
+		}
+		REQUIRE( reuse_mode_t::active() );
+	}
+	REQUIRE( !reuse_mode_t::active() );
+}
+
+template< typename C >
+void
+check_sequence( C cnt )
+{
+	reuse_mode_t reuse;
+
+	from_json( R"([1,2,3])", cnt );
+	REQUIRE( R"([1,2,3])" == to_json( cnt ) );
+
+	from_json( R"([4,5,6,7,8])", cnt );
+	REQUIRE( R"([4,5,6,7,8])" == to_json( cnt ) );
+
+	from_json( R"([9])", cnt );
+	REQUIRE( R"([9])" == to_json( cnt ) );
+
+	from_json( R"([])", cnt );
+	REQUIRE( R"([])" == to_json( cnt ) );
+}
+
+TEST_CASE( "sequence containers" , "[reuse_mode]" )
+{
+	check_sequence( std::vector< int >{} );
+	check_sequence( std::deque< int >{} );
+	check_sequence( std::list< int >{} );
+	check_sequence( std::forward_list< int >{} );
+
+	reuse_mode_t reuse;
+	std::vector< bool > flags{ true, true, true };
+	from_json( R"([false,true])", flags );
+	REQUIRE( ( std::vector< bool >{ false, true } ) == flags );
+}
+
+TEST_CASE( "map-like containers" , "[reuse_mode]" )
+{
+	reuse_mode_t reuse;
+
+	std::map< std::string, std::vector< int > > map{
+			{ "a", { 1 } }, { "b", { 2 } } };
+	const auto * a = map[ "a" ].data();
+
+	// A new key.
+	from_json( R"({"a":[3],"b":[4],"c":[5]})", map );
+	REQUIRE( R"({"a":[3],"b":[4],"c":[5]})" == to_json( map ) );
+	REQUIRE( a == map[ "a" ].data() );
+
+	// A missing key.
+	from_json( R"({"a":[6],"c":[7]})", map );
+	REQUIRE( R"({"a":[6],"c":[7]})" == to_json( map ) );
+
+	std::unordered_map< std::string, int > hash{ { "x", 1 }, { "y", 2 } };
+	from_json( R"({"y":3,"z":4})", hash );
+	REQUIRE( 2u == hash.size() );
+	REQUIRE( 3 == hash[ "y" ] );
+	REQUIRE( 4 == hash[ "z" ] );
+
+	// Duplicate keys: the first value is used, as in the usual reading.
+	std::map< std::string, int > dups{ { "a", 0 }, { "b", 7 } };
+	from_json( R"({"a":1,"a":2})", dups );
+	REQUIRE( R"({"a":1})" == to_json( dups ) );
+
+	from_json( R"({"c":1,"c":2,"a":3})", dups );
+	REQUIRE( R"({"a":3,"c":1})" == to_json( dups ) );
+	REQUIRE( to_json( dups ) == to_json(
+			from_json< std::map< std::string, int > >(
+					R"({"c":1,"c":2,"a":3})" ) ) );
+
+	// Multimaps are read in the usual way.
+	std::multimap< std::string, int > multi{ { "x", 1 }, { "x", 2 } };
+	from_json( R"({"x":3})", multi );
+	REQUIRE( R"({"x":3})" == to_json( multi ) );
+}
+
+struct holder_t
+{
+	nullable_t< std::vector< int > > m_v;
+
+	template< typename Json_Io >
+	void
+	json_io( Json_Io & io )
+	{
+		io & mandatory( "v", m_v );
+	}
+};
+
+TEST_CASE( "nullable values" , "[reuse_mode]" )
+{
+	reuse_mode_t reuse;
+
+	holder_t holder;
+	holder.m_v = std::vector< int >{ 1, 2, 3 };
+	const auto * data = holder.m_v->data();
+
+	from_json( R"({"v":[4,5]})", holder );
+	REQUIRE( ( std::vector< int >{ 4, 5 } ) == *holder.m_v );
+	REQUIRE( data == holder.m_v->data() );
+
+	from_json( R"({"v":null})", holder );
+	REQUIRE( !holder.m_v );
+
+	from_json( R"({"v":[6]})", holder );
+	REQUIRE( ( std::vector< int >{ 6 } ) == *holder.m_v );
+}
+
+TEST_CASE( "no allocations" , "[reuse_mode]" )
+{
+	rapidjson::Document doc;
+	doc.Parse( make_json( 4u, long_name_1 ).c_str() );
+
+	state_t state;
+	from_json( doc, state );
+
+	reuse_mode_t reuse;
+	REQUIRE( 0u == allocations_of( [&] { from_json( doc, state ); } ) );
+
+	doc.Parse( make_json( 3u, long_name_2 ).c_str() );
+	REQUIRE( 0u == allocations_of( [&] { from_json( doc, state ); } ) );
+}
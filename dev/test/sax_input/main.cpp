@@ -0,0 +1,612 @@
+#include <catch2/catch.hpp>
+
+#include <iostream>
+#include <sstream>
+#include <limits>
+#include <deque>
+#include <list>
+#include <forward_list>
+#include <set>
+#include <map>
+#include <tuple>
+
+#include <rapidjson/document.h>
+
+#include <json_dto/pub.hpp>
+#include <json_dto/validators.hpp>
+
+#include <test/helper.hpp>
+
+using namespace json_dto;
+
+// Reads the same JSON via DOM and via SAX and compares the results.
+template< typename T >
+void
+check_same_result( const std::string & json )
+{
+	T dom;
+	from_json( json, dom );
+
+	T sax;
+	from_json_sax( json, sax );
+
+	REQUIRE( to_json( dom ) == to_json( sax ) );
+}
+
+// Reads the same JSON via DOM and via SAX and compares the errors.
+template< typename T >
+std::string
+check_same_error( const std::string & json )
+{
+	std::string dom_error;
+	try { T dom; from_json( json, dom ); }
+	catch( const ex_t & ex ) { dom_error = ex.what(); }
+
+	std::string sax_error;
+	try { T sax; from_json_sax( json, sax ); }
+	catch( const ex_t & ex ) { sax_error = ex.what(); }
+
+	REQUIRE( !dom_error.empty() );
+	REQUIRE( dom_error == sax_error );
+
+	return sax_error;
+}
+
+struct scalars_t
+{
+	bool m_bool{};
+	std::int8_t m_int8{};
+	std::uint8_t m_uint8{};
+	std::int16_t m_int16{};
+	std::uint16_t m_uint16{};
+	std::int32_t m_int32{};
+	std::uint32_t m_uint32{};
+	std::int64_t m_int64{};
+	std::uint64_t m_uint64{};
+	float m_float{};
+	double m_double{};
+	std::string m_string;
+
+	template< typename Json_Io >
+	void
+	json_io( Json_Io & io )
+	{
+		io
+			& mandatory( "bool", m_bool )
+			& mandatory( "int8", m_int8 )
+			& mandatory( "uint8", m_uint8 )
+			& mandatory( "int16", m_int16 )
+			& mandatory( "uint16", m_uint16 )
+			& mandatory( "int32", m_int32 )
+			& mandatory( "uint32", m_uint32 )
+			& mandatory( "int64", m_int64 )
+			& mandatory( "uint64", m_uint64 )
+			& mandatory( "float", m_float )
+			& mandatory( "double", m_double )
+			& mandatory( "string", m_string );
+	}
+};
+
+struct point_t
+{
+	int m_x{};
+	int m_y{};
+
+	template< typename Json_Io >
+	void
+	json_io( Json_Io & io )
+	{
+		io
+			& mandatory( "x", m_x )
+			& optional( "y", m_y, 0 );
+	}
+};
+
+// DTO with non-intrusive json_io.
+struct sizes_t
+{
+	unsigned m_w{};
+	unsigned m_h{};
+};
+
+namespace json_dto
+{
+
+template< typename Json_Io >
+void
+json_io( Json_Io & io, sizes_t & v )
+{
+	io & mandatory( "w", v.m_w ) & mandatory( "h", v.m_h );
+}
+
+} /* namespace json_dto */
+
+// Reads int from a string and writes it as a string.
+struct int_as_string_reader_writer_t
+{
+	void
+	read( int & v, const rapidjson::Value & from ) const
+	{
+		std::string str;
+		read_json_value( str, from );
+		v = std::stoi( str );
+	}
+
+	void
+	write(
+		const int & v,
+		rapidjson::Value & to,
+		rapidjson::MemoryPoolAllocator<> & allocator ) const
+	{
+		const auto str = std::to_string( v );
+		to.SetString( str.data(),
+				static_cast< rapidjson::SizeType >( str.size() ),
+				allocator );
+	}
+};
+
+// A type with user-defined read_json_value and without json_io.
+struct tag_t
+{
+	std::string m_name;
+};
+
+void
+write_json_value(
+	const tag_t & v,
+	rapidjson::Value & to,
+	rapidjson::MemoryPoolAllocator<> & allocator )
+{
+	json_dto::write_json_value( v.m_name, to, allocator );
+}
+
+void
+read_json_value( tag_t & v, const rapidjson::Value & from )
+{
+	json_dto::read_json_value( v.m_name, from );
+}
+
+struct complex_t
+{
+	point_t m_point;
+	sizes_t m_size;
+	nullable_t< point_t > m_null_point{ point_t{ 1, 1 } };
+	nullable_t< point_t > m_some_point;
+	std::vector< int > m_ints;
+	std::vector< bool > m_bools;
+	std::deque< std::string > m_strings;
+	std::list< point_t > m_points;
+	std::forward_list< double > m_doubles;
+	std::set< int > m_set;
+	std::map< std::string, point_t > m_map;
+	std::multimap< std::string, int > m_multimap;
+	std::vector< nullable_t< int > > m_nullables;
+	std::vector< std::vector< int > > m_matrix;
+	std::map< std::string, std::vector< point_t > > m_point_groups;
+	nullable_t< std::vector< int > > m_nullable_ints;
+	int m_custom{};
+	std::vector< int > m_custom_items;
+	nullable_t< int > m_custom_nullable;
+	tag_t m_tag;
+	std::vector< tag_t > m_tags;
+	std::tuple< int, std::string, point_t > m_tuple;
+	rapidjson::Document m_document;
+	int m_default{ 0 };
+	std::string m_null_as_default{ "value" };
+
+	template< typename Json_Io >
+	void
+	json_io( Json_Io & io )
+	{
+		io
+			& mandatory( "point", m_point )
+			& mandatory( "size", m_size )
+			& mandatory( "null_point", m_null_point )
+			& optional( "some_point", m_some_point, nullptr )
+			& mandatory( "ints", m_ints )
+			& mandatory( "bools", m_bools )
+			& mandatory( "strings", m_strings )
+			& mandatory( "points", m_points )
+			& mandatory( "doubles", m_doubles )
+			& mandatory( "set", m_set )
+			& mandatory( "map", m_map )
+			& mandatory( "multimap", m_multimap )
+			& mandatory( "nullables", m_nullables )
+			& mandatory( "matrix", m_matrix )
+			& mandatory( "point_groups", m_point_groups )
+			& optional( "nullable_ints", m_nullable_ints, nullptr )
+			& mandatory( int_as_string_reader_writer_t{}, "custom", m_custom )
+			& mandatory(
+					apply_to_content_t< int_as_string_reader_writer_t >{},
+					"custom_items", m_custom_items )
+			& mandatory(
+					apply_to_content_t< int_as_string_reader_writer_t >{},
+					"custom_nullable", m_custom_nullable )
+			& mandatory( "tag", m_tag )
+			& mandatory( "tags", m_tags )
+			& mandatory(
+					inside_array::reader_writer(
+						inside_array::member( std::get<0>( m_tuple ) ),
+						inside_array::member( std::get<1>( m_tuple ) ),
+						inside_array::member( std::get<2>( m_tuple ) ) ),
+					"tuple", m_tuple )
+			& mandatory( "document", m_document )
+			& optional( "default", m_default, 42 )
+			& mandatory_with_null_as_default(
+					"null_as_default", m_null_as_default );
+	}
+};
+
+const char * const complex_json = R"JSON({
+	"point":{"x":1,"y":2},
+	"size":{"w":640,"h":480},
+	"null_point":null,
+	"some_point":{"x":3},
+	"ints":[1,2,3],
+	"bools":[true,false],
+	"strings":["a","b\n\"c\""],
+	"points":[{"x":4,"y":5},{"x":6}],
+	"doubles":[0.5,1.5],
+	"set":[3,1,2],
+	"map":{"one":{"x":1,"y":1},"two":{"x":2,"y":2}},
+	"multimap":{"k":1,"k":2},
+	"nullables":[1,null],
+	"matrix":[[1],[],[2,3]],
+	"point_groups":{"a":[{"x":1}],"b":[]},
+	"nullable_ints":[4,5],
+	"custom":"42",
+	"custom_items":["7","8"],
+	"custom_nullable":"9",
+	"tag":"tag",
+	"tags":["a","b"],
+	"tuple":[1,"two",{"x":3,"y":4}],
+	"document":{"a":[1,2,{"b":null}],"c":"d"},
+	"null_as_default":null
+})JSON";
+
+TEST_CASE( "scalars" , "[sax][scalars]" )
+{
+	const std::string json =
+			R"({"bool":true,"int8":-8,"uint8":8,"int16":-16,"uint16":16,)"
+			R"("int32":-2147483648,"uint32":4294967295,)"
+			R"("int64":-9223372036854775808,"uint64":18446744073709551615,)"
+			R"("float":3.25,"double":2.718281828459,)"
+			R"("string":"Hello, \"World\"\n"})";
+
+	check_same_result< scalars_t >( json );
+
+	const auto sax = from_json_sax< scalars_t >( json );
+	REQUIRE( sax.m_bool );
+	REQUIRE( -8 == sax.m_int8 );
+	REQUIRE( std::numeric_limits< std::int32_t >::min() == sax.m_int32 );
+	REQUIRE( std::numeric_limits< std::uint64_t >::max() == sax.m_uint64 );
+	REQUIRE( equal( 2.718281828459, sax.m_double ) );
+	REQUIRE( "Hello, \"World\"\n" == sax.m_string );
+	REQUIRE( json == to_json( sax ) );
+}
+
+TEST_CASE( "complex DTO" , "[sax][complex]" )
+{
+	check_same_result< complex_t >( complex_json );
+
+	const auto sax = from_json_sax< complex_t >( complex_json );
+	REQUIRE( !sax.m_null_point );
+	REQUIRE( 3 == sax.m_some_point->m_x );
+	REQUIRE( 3u == sax.m_set.size() );
+	REQUIRE( 2u == sax.m_multimap.size() );
+	REQUIRE( 42 == sax.m_custom );
+	REQUIRE( "two" == std::get<1>( sax.m_tuple ) );
+	REQUIRE( "d" == std::string{ sax.m_document[ "c" ].GetString() } );
+	REQUIRE( 42 == sax.m_default );
+	REQUIRE( sax.m_null_as_default.empty() );
+	REQUIRE( zip_json_str( complex_json ) != to_json( sax ) );
+}
+
+TEST_CASE( "unknown and duplicate members" , "[sax][members]" )
+{
+	const std::string json = R"({"z":{"x":[1,{"y":2}]},"x":1,"y":{},"x":2})";
+
+	REQUIRE_THROWS_AS( from_json_sax< point_t >( json ), ex_t );
+
+	const std::string json2 = R"({"z":{"x":[1,{"y":2}]},"x":1,"w":[[]],"x":2})";
+	check_same_result< point_t >( json2 );
+	REQUIRE( 1 == from_json_sax< point_t >( json2 ).m_x );
+}
+
+// DTO with json_io that depends on the state of an object.
+struct shape_t
+{
+	bool m_circle{ true };
+	int m_radius{};
+	int m_width{};
+
+	template< typename Json_Io >
+	void
+	json_io( Json_Io & io )
+	{
+		if( m_circle )
+			io & mandatory( "radius", m_radius );
+		else
+			io & mandatory( "width", m_width ) & optional( "radius", m_radius, 0 );
+	}
+};
+
+TEST_CASE( "different binders for the same type" , "[sax][members]" )
+{
+	shape_t circle;
+	from_json_sax( R"({"width":1,"radius":2})", circle );
+	REQUIRE( 2 == circle.m_radius );
+	REQUIRE( 0 == circle.m_width );
+
+	shape_t square;
+	square.m_circle = false;
+	from_json_sax( R"({"radius":3,"width":4})", square );
+	REQUIRE( 3 == square.m_radius );
+	REQUIRE( 4 == square.m_width );
+
+	shape_t another_circle;
+	from_json_sax( R"({"radius":5})", another_circle );
+	REQUIRE( 5 == another_circle.m_radius );
+}
+
+TEST_CASE( "top-level values" , "[sax][top-level]" )
+{
+	REQUIRE( 42 == from_json_sax< int >( "42" ) );
+	REQUIRE( "str" == from_json_sax< std::string >( R"("str")" ) );
+
+	const auto points = from_json_sax< std::vector< point_t > >(
+			R"([{"x":1,"y":2},{"x":3}])" );
+	REQUIRE( 2u == points.size() );
+	REQUIRE( 3 == points[ 1 ].m_x );
+
+	const auto map = from_json_sax< std::map< std::string, std::vector< int > > >(
+			R"({"a":[1,2],"b":[]})" );
+	REQUIRE( R"({"a":[1,2],"b":[]})" == to_json( map ) );
+}
+
+TEST_CASE( "streams" , "[sax][stream]" )
+{
+	std::istringstream dom_stream{ complex_json };
+	complex_t dom;
+	from_stream( dom_stream, dom );
+
+	std::istringstream sax_stream{ complex_json };
+	complex_t sax;
+	from_stream_sax( sax_stream, sax );
+
+	REQUIRE( to_json( dom ) == to_json( sax ) );
+
+	std::istringstream point_stream{ R"({"x":1,"y":2})" };
+	REQUIRE( 2 == from_stream_sax< point_t >( point_stream ).m_y );
+}
+
+struct validated_t
+{
+	int m_value{};
+
+	template< typename Json_Io >
+	void
+	json_io( Json_Io & io )
+	{
+		io & mandatory( "value", m_value, min_max_constraint( 0, 10 ) );
+	}
+};
+
+struct outer_validated_t
+{
+	validated_t m_inner;
+	std::vector< validated_t > m_items;
+
+	template< typename Json_Io >
+	void
+	json_io( Json_Io & io )
+	{
+		io
+			& mandatory( "inner", m_inner )
+			& optional( "items", m_items, std::vector< validated_t >{} );
+	}
+};
+
+// Makes a copy of complex_json with one fragment replaced.
+std::string
+replace( const std::string & what, const std::string & with )
+{
+	std::string json{ complex_json };
+	const auto pos = json.find( what );
+	REQUIRE( std::string::npos != pos );
+
+	return json.replace( pos, what.size(), with );
+}
+
+TEST_CASE( "errors" , "[sax][errors]" )
+{
+	REQUIRE( "error reading field \"inner\": error reading field \"value\": "
+			"invalid value: 100, must be in [ 0, 10 ]" ==
+		check_same_error< outer_validated_t >( R"({"inner":{"value":100}})" ) );
+
+	check_same_error< outer_validated_t >(
+			R"({"inner":{"value":1},"items":[{"value":2},{"value":-1}]})" );
+	check_same_error< outer_validated_t >(
+			R"({"inner":{"value":1},"items":[{"value":2},{}]})" );
+	check_same_error< outer_validated_t >(
+			R"({"inner":{"value":1},"items":{}})" );
+	check_same_error< outer_validated_t >( R"({"inner":{"value":"1"}})" );
+	check_same_error< outer_validated_t >( R"({"inner":[]})" );
+	check_same_error< outer_validated_t >( R"({"items":[]})" );
+	check_same_error< outer_validated_t >( R"([])" );
+	check_same_error< outer_validated_t >( R"({"inner":{"value":1})" );
+	check_same_error< outer_validated_t >( R"({"inner":{"value":1}} {})" );
+	check_same_error< complex_t >( replace( "[1,2,3]", "[1,\"2\"]" ) );
+	check_same_error< complex_t >( replace( "[1,2,3]", "null" ) );
+	check_same_error< complex_t >( replace( "{\"x\":2,\"y\":2}", "1" ) );
+	check_same_error< complex_t >( replace( "{\"x\":3}", "[]" ) );
+	check_same_error< complex_t >( replace( "\"42\"", "42" ) );
+	check_same_error< complex_t >( replace( "[4,5]", "[4,{}]" ) );
+	check_same_error< std::vector< int > >( R"([1,2,{}])" );
+}
+
+namespace test_stuff
+{
+
+template< typename F >
+struct legacy_field_t
+{
+	F & m_field;
+};
+
+template< typename F >
+legacy_field_t< F > legacy( F & field ) noexcept { return { field }; }
+
+} /* namespace test_stuff */
+
+namespace json_dto
+{
+
+template<
+	typename Reader_Writer,
+	typename Field_Type,
+	typename Manopt_Policy,
+	typename Validator >
+class binder_data_holder_t<
+		Reader_Writer,
+		const test_stuff::legacy_field_t< Field_Type >,
+		Manopt_Policy,
+		Validator >
+{
+	Reader_Writer m_reader_writer;
+	string_ref_t m_field_name;
+	test_stuff::legacy_field_t< Field_Type > m_field;
+	Manopt_Policy m_manopt_policy;
+	Validator m_validator;
+
+public:
+	binder_data_holder_t(
+		Reader_Writer && reader_writer,
+		string_ref_t field_name,
+		const test_stuff::legacy_field_t< Field_Type > & field,
+		Manopt_Policy && manopt_policy,
+		Validator && validator )
+		:	m_reader_writer{ std::move(reader_writer) }
+		,	m_field_name{ field_name }
+		,	m_field{ field }
+		,	m_manopt_policy{ std::move(manopt_policy) }
+		,	m_validator{ std::move(validator) }
+	{}
+
+	const Reader_Writer &
+	reader_writer() const noexcept { return m_reader_writer; }
+
+	const string_ref_t &
+	field_name() const noexcept { return m_field_name; }
+
+	Field_Type &
+	field_for_deserialization() const noexcept { return m_field.m_field; }
+
+	const Manopt_Policy &
+	manopt_policy() const noexcept { return m_manopt_policy; }
+
+	const Validator &
+	validator() const noexcept { return m_validator; }
+};
+
+// A specialization without read_from_member() method.
+template<
+	typename Reader_Writer,
+	typename Field_Type,
+	typename Manopt_Policy,
+	typename Validator >
+struct binder_read_from_implementation_t<
+		binder_data_holder_t<
+			Reader_Writer,
+			const test_stuff::legacy_field_t< Field_Type >,
+			Manopt_Policy,
+			Validator
+		>
+	>
+{
+	using data_holder_t = binder_data_holder_t<
+			Reader_Writer,
+			const test_stuff::legacy_field_t< Field_Type >,
+			Manopt_Policy,
+			Validator >;
+
+	static void
+	read_from(
+		const data_holder_t & binder_data,
+		const rapidjson::Value & object )
+	{
+		const auto it = object.FindMember( binder_data.field_name() );
+		if( object.MemberEnd() != it )
+			read_json_value( binder_data.field_for_deserialization(), it->value );
+		else
+			binder_data.field_for_deserialization() = Field_Type{ -1 };
+	}
+};
+
+} /* namespace json_dto */
+
+struct with_legacy_field_t
+{
+	int m_first{};
+	std::vector< int > m_legacy;
+	std::string m_legacy_string;
+	std::vector< int > m_missing;
+	int m_last{};
+
+	template< typename Json_Io >
+	void
+	json_io( Json_Io & io )
+	{
+		io
+			& mandatory( "first", m_first )
+			& mandatory( "legacy_values", test_stuff::legacy( m_legacy ) )
+			& mandatory( "legacy_string", test_stuff::legacy( m_legacy_string ) )
+			& mandatory( "missing", test_stuff::legacy( m_missing ) )
+			& mandatory( "last", m_last );
+	}
+};
+
+TEST_CASE( "binder without read_from_member" , "[sax][custom_binder]" )
+{
+	const auto sax = from_json_sax< with_legacy_field_t >(
+			R"({"first":1,"legacy_values":[2,3],"legacy_string":"str","last":4})" );
+
+	REQUIRE( 1 == sax.m_first );
+	REQUIRE( std::vector< int >{ 2, 3 } == sax.m_legacy );
+	REQUIRE( "str" == sax.m_legacy_string );
+	REQUIRE( std::vector< int >{ -1 } == sax.m_missing );
+	REQUIRE( 4 == sax.m_last );
+}
+
+#if defined( JSON_DTO_SUPPORTS_STD_OPTIONAL )
+
+struct with_std_optional_t
+{
+	json_dto::cpp17::optional< point_t > m_point;
+	json_dto::cpp17::optional< std::vector< int > > m_values;
+	json_dto::cpp17::optional< int > m_missing;
+
+	template< typename Json_Io >
+	void
+	json_io( Json_Io & io )
+	{
+		io
+			& optional_no_default( "point", m_point )
+			& optional_no_default( "values", m_values )
+			& optional_no_default( "missing", m_missing );
+	}
+};
+
+TEST_CASE( "std::optional" , "[sax][std_optional]" )
+{
+	const std::string json = R"({"point":{"x":1,"y":2},"values":[1,2]})";
+
+	check_same_result< with_std_optional_t >( json );
+
+	const auto sax = from_json_sax< with_std_optional_t >( json );
+	REQUIRE( 2 == sax.m_point->m_y );
+	REQUIRE( 2u == sax.m_values->size() );
+	REQUIRE( !sax.m_missing );
+}
+
+#endif
@@ -0,0 +1,491 @@
+#include <catch2/catch.hpp>
+
+#include <iostream>
+#include <sstream>
+#include <limits>
+#include <deque>
+#include <list>
+#include <forward_list>
+#include <set>
+#include <map>
+#include <unordered_map>
+#include <tuple>
+
+#include <rapidjson/document.h>
+
+#include <json_dto/pub.hpp>
+#include <json_dto/validators.hpp>
+
+#include <test/helper.hpp>
+
+using namespace json_dto;
+
+struct scalars_t
+{
+	bool m_bool{ true };
+	std::int8_t m_int8{ -8 };
+	std::uint8_t m_uint8{ 8 };
+	std::int16_t m_int16{ -16 };
+	std::uint16_t m_uint16{ 16 };
+	std::int32_t m_int32{ std::numeric_limits< std::int32_t >::min() };
+	std::uint32_t m_uint32{ std::numeric_limits< std::uint32_t >::max() };
+	std::int64_t m_int64{ std::numeric_limits< std::int64_t >::min() };
+	std::uint64_t m_uint64{ std::numeric_limits< std::uint64_t >::max() };
+	float m_float{ 3.25f };
+	double m_double{ 2.718281828459 };
+	std::string m_string{ "Hello, \"World\"\n" };
+
+	template< typename Json_Io >
+	void
+	json_io( Json_Io & io )
+	{
+		io
+			& mandatory( "bool", m_bool )
+			& mandatory( "int8", m_int8 )
+			& mandatory( "uint8", m_uint8 )
+			& mandatory( "int16", m_int16 )
+			& mandatory( "uint16", m_uint16 )
+			& mandatory( "int32", m_int32 )
+			& mandatory( "uint32", m_uint32 )
+			& mandatory( "int64", m_int64 )
+			& mandatory( "uint64", m_uint64 )
+			& mandatory( "float", m_float )
+			& mandatory( "double", m_double )
+			& mandatory( "string", m_string )
+			& mandatory( "string_ref", make_string_ref( "ref" ) );
+	}
+};
+
+struct point_t
+{
+	int m_x{};
+	int m_y{};
+
+	template< typename Json_Io >
+	void
+	json_io( Json_Io & io )
+	{
+		io
+			& mandatory( "x", m_x )
+			& optional( "y", m_y, 0 );
+	}
+};
+
+// DTO with non-intrusive json_io.
+struct sizes_t
+{
+	unsigned m_w{};
+	unsigned m_h{};
+};
+
+namespace json_dto
+{
+
+template< typename Json_Io >
+void
+json_io( Json_Io & io, sizes_t & v )
+{
+	io & mandatory( "w", v.m_w ) & mandatory( "h", v.m_h );
+}
+
+} /* namespace json_dto */
+
+struct custom_int_reader_writer_t
+{
+	void
+	read( int & v, const rapidjson::Value & from ) const
+	{
+		read_json_value( v, from );
+	}
+
+	void
+	write(
+		const int & v,
+		rapidjson::Value & to,
+		rapidjson::MemoryPoolAllocator<> & allocator ) const
+	{
+		const auto str = std::to_string( v );
+		to.SetString( str.data(),
+				static_cast< rapidjson::SizeType >( str.size() ),
+				allocator );
+	}
+};
+
+// A type with user-defined write_json_value and without json_io.
+struct tag_t
+{
+	std::string m_name;
+};
+
+void
+write_json_value(
+	const tag_t & v,
+	rapidjson::Value & to,
+	rapidjson::MemoryPoolAllocator<> & allocator )
+{
+	const std::string s = "#" + v.m_name;
+	json_dto::write_json_value( s, to, allocator );
+}
+
+void
+read_json_value( tag_t & v, const rapidjson::Value & from )
+{
+	json_dto::read_json_value( v.m_name, from );
+}
+
+struct complex_t
+{
+	point_t m_point{ 1, 2 };
+	sizes_t m_size{ 640, 480 };
+	nullable_t< point_t > m_null_point{};
+	nullable_t< point_t > m_some_point{ point_t{ 3, 0 } };
+	std::vector< int > m_ints{ 1, 2, 3 };
+	std::vector< bool > m_bools{ true, false };
+	std::deque< std::string > m_strings{ "a", "b" };
+	std::list< point_t > m_points{ point_t{ 4, 5 }, point_t{ 6, 0 } };
+	std::forward_list< double > m_doubles{ 0.5, 1.5 };
+	std::set< int > m_set{ 3, 1, 2 };
+	std::map< std::string, point_t > m_map{
+			{ "one", point_t{ 1, 1 } }, { "two", point_t{ 2, 2 } } };
+	std::multimap< std::string, int > m_multimap{
+			{ "k", 1 }, { "k", 2 } };
+	std::vector< nullable_t< int > > m_nullables{
+			nullable_t< int >{ 1 }, nullable_t< int >{} };
+	std::vector< std::vector< int > > m_matrix{ { 1 }, {}, { 2, 3 } };
+	int m_custom{ 42 };
+	std::vector< int > m_custom_items{ 7, 8 };
+	nullable_t< int > m_custom_nullable{ 9 };
+	tag_t m_tag{ "tag" };
+	std::map< std::string, tag_t > m_tags{ { "t", tag_t{ "v" } } };
+	std::tuple< int, std::string, point_t > m_tuple{ 1, "two", point_t{ 3, 4 } };
+	rapidjson::Document m_document;
+	int m_default{ 0 };
+
+	complex_t()
+	{
+		m_document.Parse( R"({"a":[1,2,{"b":null}],"c":"d"})" );
+	}
+
+	template< typename Json_Io >
+	void
+	json_io( Json_Io & io )
+	{
+		io
+			& mandatory( "point", m_point )
+			& mandatory( "size", m_size )
+			& mandatory( "null_point", m_null_point )
+			& optional( "some_point", m_some_point, nullptr )
+			& mandatory( "ints", m_ints )
+			& mandatory( "bools", m_bools )
+			& mandatory( "strings", m_strings )
+			& mandatory( "points", m_points )
+			& mandatory( "doubles", m_doubles )
+			& mandatory( "set", m_set )
+			& mandatory( "map", m_map )
+			& mandatory( "multimap", m_multimap )
+			& mandatory( "nullables", m_nullables )
+			& mandatory( "matrix", m_matrix )
+			& mandatory( custom_int_reader_writer_t{}, "custom", m_custom )
+			& mandatory(
+					apply_to_content_t< custom_int_reader_writer_t >{},
+					"custom_items", m_custom_items )
+			& mandatory(
+					apply_to_content_t< custom_int_reader_writer_t >{},
+					"custom_nullable", m_custom_nullable )
+			& mandatory( "tag", m_tag )
+			& mandatory( "tags", m_tags )
+			& mandatory(
+					inside_array::reader_writer(
+						inside_array::member( std::get<0>( m_tuple ) ),
+						inside_array::member( std::get<1>( m_tuple ) ),
+						inside_array::member( std::get<2>( m_tuple ) ) ),
+					"tuple", m_tuple )
+			& mandatory( "document", m_document )
+			& optional( "default", m_default, 0 );
+	}
+};
+
+TEST_CASE( "scalars" , "[sax][scalars]" )
+{
+	const scalars_t dto;
+
+	const auto dom = to_json( dto );
+	const auto sax = to_json_sax( dto );
+
+	REQUIRE( dom == sax );
+	REQUIRE( R"({"bool":true,"int8":-8,"uint8":8,"int16":-16,"uint16":16,)"
+			R"("int32":-2147483648,"uint32":4294967295,)"
+			R"("int64":-9223372036854775808,"uint64":18446744073709551615,)"
+			R"("float":3.25,"double":2.718281828459,)"
+			R"("string":"Hello, \"World\"\n","string_ref":"ref"})" == sax );
+}
+
+TEST_CASE( "complex DTO" , "[sax][complex]" )
+{
+	const complex_t dto;
+
+	const auto dom = to_json( dto );
+	const auto sax = to_json_sax( dto );
+
+	REQUIRE( dom == sax );
+	REQUIRE( zip_json_str( R"JSON({
+		"point":{"x":1,"y":2},
+		"size":{"w":640,"h":480},
+		"null_point":null,
+		"some_point":{"x":3},
+		"ints":[1,2,3],
+		"bools":[true,false],
+		"strings":["a","b"],
+		"points":[{"x":4,"y":5},{"x":6}],
+		"doubles":[0.5,1.5],
+		"set":[1,2,3],
+		"map":{"one":{"x":1,"y":1},"two":{"x":2,"y":2}},
+		"multimap":{"k":1,"k":2},
+		"nullables":[1,null],
+		"matrix":[[1],[],[2,3]],
+		"custom":"42",
+		"custom_items":["7","8"],
+		"custom_nullable":"9",
+		"tag":"#tag",
+		"tags":{"t":"#v"},
+		"tuple":[1,"two",{"x":3,"y":4}],
+		"document":{"a":[1,2,{"b":null}],"c":"d"}
+	})JSON" ) == sax );
+}
+
+TEST_CASE( "pretty writer" , "[sax][pretty]" )
+{
+	const complex_t dto;
+
+	REQUIRE( to_json( dto, pretty_writer_params_t{} ) ==
+			to_json_sax( dto, pretty_writer_params_t{} ) );
+
+	const auto params = pretty_writer_params_t{}
+			.indent_char( '\t' )
+			.indent_char_count( 1u )
+			.format_options( rapidjson::kFormatSingleLineArray );
+
+	REQUIRE( to_json( dto, params ) == to_json_sax( dto, params ) );
+}
+
+TEST_CASE( "streams" , "[sax][stream]" )
+{
+	const complex_t dto;
+
+	std::ostringstream dom;
+	to_stream( dom, dto );
+
+	std::ostringstream sax;
+	to_stream_sax( sax, dto );
+
+	REQUIRE( dom.str() == sax.str() );
+
+	std::ostringstream pretty_dom;
+	to_stream( pretty_dom, dto, pretty_writer_params_t{} );
+
+	std::ostringstream pretty_sax;
+	to_stream_sax( pretty_sax, dto, pretty_writer_params_t{} );
+
+	REQUIRE( pretty_dom.str() == pretty_sax.str() );
+}
+
+TEST_CASE( "top-level containers" , "[sax][top-level]" )
+{
+	const std::vector< point_t > points{ point_t{ 1, 2 }, point_t{ 3, 0 } };
+	REQUIRE( to_json( points ) == to_json_sax( points ) );
+	REQUIRE( R"([{"x":1,"y":2},{"x":3}])" == to_json_sax( points ) );
+
+	const std::map< std::string, std::vector< int > > map{
+			{ "a", { 1, 2 } }, { "b", {} } };
+	REQUIRE( to_json( map ) == to_json_sax( map ) );
+	REQUIRE( R"({"a":[1,2],"b":[]})" == to_json_sax( map ) );
+}
+
+struct validated_t
+{
+	int m_value{ 100 };
+
+	template< typename Json_Io >
+	void
+	json_io( Json_Io & io )
+	{
+		io & mandatory( "value", m_value, min_max_constraint( 0, 10 ) );
+	}
+};
+
+struct outer_validated_t
+{
+	validated_t m_inner;
+
+	template< typename Json_Io >
+	void
+	json_io( Json_Io & io )
+	{
+		io & mandatory( "inner", m_inner );
+	}
+};
+
+TEST_CASE( "errors" , "[sax][errors]" )
+{
+	const outer_validated_t dto;
+
+	std::string dom_error;
+	try { (void)to_json( dto ); }
+	catch( const ex_t & ex ) { dom_error = ex.what(); }
+
+	std::string sax_error;
+	try { (void)to_json_sax( dto ); }
+	catch( const ex_t & ex ) { sax_error = ex.what(); }
+
+	REQUIRE( !dom_error.empty() );
+	REQUIRE( dom_error == sax_error );
+}
+
+struct nan_t
+{
+	double m_value{ std::numeric_limits< double >::quiet_NaN() };
+
+	template< typename Json_Io >
+	void
+	json_io( Json_Io & io )
+	{
+		io & mandatory( "value", m_value );
+	}
+};
+
+TEST_CASE( "writer returns false" , "[sax][errors]" )
+{
+	REQUIRE_THROWS_AS( to_json_sax( nan_t{} ), ex_t );
+}
+
+namespace test_stuff
+{
+
+template< typename F >
+struct legacy_field_t
+{
+	F & m_field;
+};
+
+template< typename F >
+legacy_field_t< F > legacy( F & field ) noexcept { return { field }; }
+
+} /* namespace test_stuff */
+
+namespace json_dto
+{
+
+// A specialization without write_to_sax() method.
+template<
+	typename Reader_Writer,
+	typename Field_Type,
+	typename Manopt_Policy,
+	typename Validator >
+struct binder_write_to_implementation_t<
+		binder_data_holder_t<
+			Reader_Writer,
+			const test_stuff::legacy_field_t< Field_Type >,
+			Manopt_Policy,
+			Validator
+		>
+	>
+{
+	using data_holder_t = binder_data_holder_t<
+			Reader_Writer,
+			const test_stuff::legacy_field_t< Field_Type >,
+			Manopt_Policy,
+			Validator >;
+
+	static void
+	write_to(
+		const data_holder_t & binder_data,
+		rapidjson::Value & object,
+		rapidjson::MemoryPoolAllocator<> & allocator )
+	{
+		rapidjson::Value value;
+		write_json_value(
+				binder_data.field_for_serialization().m_field, value, allocator );
+
+		object.AddMember( binder_data.field_name(), value, allocator );
+		object.AddMember( "legacy", true, allocator );
+	}
+};
+
+} /* namespace json_dto */
+
+struct with_legacy_field_t
+{
+	int m_first{ 1 };
+	std::vector< int > m_legacy{ 2, 3 };
+	int m_last{ 4 };
+
+	template< typename Json_Io >
+	void
+	json_io( Json_Io & io )
+	{
+		io
+			& mandatory( "first", m_first )
+			& mandatory( "legacy_values", test_stuff::legacy( m_legacy ) )
+			& mandatory( "last", m_last );
+	}
+};
+
+TEST_CASE( "binder without write_to_sax" , "[sax][custom_binder]" )
+{
+	const with_legacy_field_t dto;
+
+	REQUIRE( to_json( dto ) == to_json_sax( dto ) );
+	REQUIRE( R"({"first":1,"legacy_values":[2,3],"legacy":true,"last":4})" ==
+			to_json_sax( dto ) );
+}
+
+// A type with json_io and with a more specific write_json_value.
+struct version_t
+{
+	int m_major{ 1 };
+	int m_minor{ 2 };
+
+	template< typename Json_Io >
+	void
+	json_io( Json_Io & io )
+	{
+		io
+			& mandatory( "major", m_major )
+			& mandatory( "minor", m_minor );
+	}
+};
+
+void
+write_json_value(
+	const version_t & v,
+	rapidjson::Value & to,
+	rapidjson::MemoryPoolAllocator<> & allocator )
+{
+	const std::string s =
+			std::to_string( v.m_major ) + "." + std::to_string( v.m_minor );
+	json_dto::write_json_value( s, to, allocator );
+}
+
+struct with_version_t
+{
+	version_t m_version;
+	std::vector< version_t > m_history{ version_t{ 0, 9 } };
+
+	template< typename Json_Io >
+	void
+	json_io( Json_Io & io )
+	{
+		io
+			& mandatory( "version", m_version )
+			& mandatory( "history", m_history );
+	}
+};
+
+TEST_CASE( "user write_json_value for DTO" , "[sax][user_write]" )
+{
+	const with_version_t dto;
+
+	REQUIRE( to_json( dto ) == to_json_sax( dto ) );
+	REQUIRE( R"({"version":"1.2","history":["0.9"]})" == to_json_sax( dto ) );
+	REQUIRE( to_json( version_t{} ) == to_json_sax( version_t{} ) );
+}
@@ -0,0 +1,200 @@
+#include <catch2/catch.hpp>
+
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include <json_dto/pub.hpp>
+
+#include <test/helper.hpp>
+#include <test/allocations.hpp>
+
+using namespace json_dto;
+
+struct item_t
+{
+	int m_id{};
+	std::string m_name;
+	std::vector< int > m_values;
+	nullable_t< double > m_price;
+
+	template< typename Json_Io >
+	void
+	json_io( Json_Io & io )
+	{
+		io
+			& mandatory( "id", m_id )
+			& mandatory( "name", m_name )
+			& mandatory( "values", m_values )
+			& optional_null( "price", m_price );
+	}
+};
+
+item_t
+make_item( int id, std::size_t values )
+{
+	item_t item;
+	item.m_id = id;
+	item.m_name = "item \"" + std::to_string( id ) + "\"";
+	for( std::size_t i = 0u; i != values; ++i )
+		item.m_values.push_back( static_cast< int >( i ) );
+	if( id % 2 )
+		item.m_price = 1.5 * id;
+
+	return item;
+}
+
+// Writes an item as an array [id, name].
+struct short_item_writer_t
+{
+	void
+	read( item_t & v, const rapidjson::Value & from ) const
+	{
+		read_json_value( v.m_id, from[ 0 ] );
+		read_json_value( v.m_name, from[ 1 ] );
+	}
+
+	void
+	write(
+		const item_t & v,
+		rapidjson::Value & to,
+		rapidjson::MemoryPoolAllocator<> & allocator ) const
+	{
+		to.SetArray();
+
+		rapidjson::Value id;
+		write_json_value( v.m_id, id, allocator );
+		to.PushBack( id, allocator );
+
+		rapidjson::Value name;
+		write_json_value( v.m_name, name, allocator );
+		to.PushBack( name, allocator );
+	}
+};
+
+TEST_CASE( "serializer gives the same results as to_json" , "[serializer]" )
+{
+	serializer_t serializer{ 512u };
+	REQUIRE( 512u == serializer.chunk_size() );
+
+	const auto params = pretty_writer_params_t{}
+			.indent_char( '\t' ).indent_char_count( 1u );
+
+	// Objects of different sizes, so memory of the serializer is enlarged.
+	for( std::size_t size : { 0u, 1000u, 10u, 1000u, 0u } )
+	{
+		const auto item = make_item( static_cast< int >( size ), size );
+
+		REQUIRE( to_json( item ) == serializer.to_json( item ) );
+		REQUIRE( to_json( item, params ) ==
+				serializer.to_json( item, params ) );
+		REQUIRE( to_json( short_item_writer_t{}, item ) ==
+				serializer.to_json( short_item_writer_t{}, item ) );
+		REQUIRE( to_json( short_item_writer_t{}, item, params ) ==
+				serializer.to_json( short_item_writer_t{}, item, params ) );
+	}
+
+	const std::vector< item_t > items{ make_item( 1, 2u ), make_item( 2, 0u ) };
+	REQUIRE( to_json( items ) == serializer.to_json( items ) );
+}
+
+TEST_CASE( "retained memory" , "[serializer]" )
+{
+	serializer_t serializer{ 512u };
+
+	const auto big = make_item( 1, 1000u );
+	const auto small = make_item( 2, 1u );
+
+	const auto expected = to_json( big );
+	REQUIRE( expected == serializer.to_json( big ) );
+	REQUIRE( expected == serializer.to_json( big ) );
+
+	const auto retained = serializer.bytes_retained();
+	const auto * data = serializer.to_json( big ).data();
+	for( int i = 0; i != 5; ++i )
+	{
+		REQUIRE( to_json( small ) == serializer.to_json( small ) );
+		REQUIRE( expected == serializer.to_json( big ) );
+	}
+
+	REQUIRE( retained == serializer.bytes_retained() );
+	REQUIRE( data == serializer.to_json( big ).data() );
+}
+
+TEST_CASE( "to_json_append" , "[serializer]" )
+{
+	const auto item = make_item( 3, 3u );
+	const auto params = pretty_writer_params_t{}.indent_char_count( 2u );
+
+	std::string result = "prefix:";
+	to_json_append( result, item );
+	REQUIRE( "prefix:" + to_json( item ) == result );
+
+	to_json_append( result, item, params );
+	REQUIRE( "prefix:" + to_json( item ) + to_json( item, params ) == result );
+
+	result.clear();
+	to_json_append( short_item_writer_t{}, result, item );
+	to_json_append( short_item_writer_t{}, result, item, params );
+	REQUIRE( to_json( short_item_writer_t{}, item ) +
+			to_json( short_item_writer_t{}, item, params ) == result );
+
+	serializer_t serializer;
+	std::string from_serializer = "prefix:";
+	serializer.to_json_append( from_serializer, item );
+	serializer.to_json_append( from_serializer, item, params );
+	REQUIRE( "prefix:" + to_json( item ) + to_json( item, params ) ==
+			from_serializer );
+
+	from_serializer.clear();
+	serializer.to_json_append( short_item_writer_t{}, from_serializer, item );
+	serializer.to_json_append(
+			short_item_writer_t{}, from_serializer, item, params );
+	REQUIRE( to_json( short_item_writer_t{}, item ) +
+			to_json( short_item_writer_t{}, item, params ) == from_serializer );
+}
+
+TEST_CASE( "to_json_into" , "[serializer]" )
+{
+	const auto item = make_item( 4, 3u );
+	const auto params = pretty_writer_params_t{}.indent_char_count( 2u );
+
+	const auto expected = to_json( item ) + to_json( item, params ) +
+			to_json( short_item_writer_t{}, item ) +
+			to_json( short_item_writer_t{}, item, params );
+
+	rapidjson::StringBuffer buffer;
+	to_json_into( buffer, item );
+	to_json_into( buffer, item, params );
+	to_json_into( short_item_writer_t{}, buffer, item );
+	to_json_into( short_item_writer_t{}, buffer, item, params );
+	REQUIRE( expected == std::string( buffer.GetString(), buffer.GetSize() ) );
+
+	serializer_t serializer;
+	rapidjson::StringBuffer from_serializer;
+	serializer.to_json_into( from_serializer, item );
+	serializer.to_json_into( from_serializer, item, params );
+	serializer.to_json_into( short_item_writer_t{}, from_serializer, item );
+	serializer.to_json_into(
+			short_item_writer_t{}, from_serializer, item, params );
+	REQUIRE( expected == std::string(
+			from_serializer.GetString(), from_serializer.GetSize() ) );
+}
+
+TEST_CASE( "allocation budgets" , "[serializer]" )
+{
+	const auto item = make_item( 5, 10u );
+
+	// Only objects of rapidjson's allocators are created.
+	std::string result;
+	result.reserve( 1024u );
+	REQUIRE( 3u >= allocations_of( [&] { to_json_append( result, item ); } ) );
+
+	serializer_t serializer;
+	const std::string expected = serializer.to_json( item );
+	REQUIRE( 0u == allocations_of( [&] { serializer.to_json( item ); } ) );
+	REQUIRE( 0u == allocations_of( [&] {
+			serializer.to_json( short_item_writer_t{}, item );
+		} ) );
+	REQUIRE( expected == serializer.to_json( item ) );
+}
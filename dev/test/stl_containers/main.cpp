@@ -2,9 +2,12 @@
 
 #include <json_dto/pub.hpp>
 
+#include <test/allocations.hpp>
+
 #include <deque>
 #include <list>
 #include <forward_list>
+#include <vector>
 
 #include <set>
 #include <unordered_set>
@@ -419,3 +422,109 @@ TEST_CASE( "hash_multimap<string, int>: write to json" , "write-hash_multimap-st
 			Contains(R"("three":3)") );
 }
 
+
+// A custom sequence container with reserve().
+class reserving_vector_t
+{
+	std::vector<int> m_items;
+
+public:
+	using value_type = int;
+	using size_type = std::size_t;
+	using iterator = std::vector<int>::iterator;
+	using const_iterator = std::vector<int>::const_iterator;
+
+	static std::size_t last_reserved;
+
+	iterator begin() { return m_items.begin(); }
+	iterator end() { return m_items.end(); }
+	const_iterator begin() const { return m_items.begin(); }
+	const_iterator end() const { return m_items.end(); }
+
+	size_type size() const { return m_items.size(); }
+	void clear() { m_items.clear(); }
+	int & back() { return m_items.back(); }
+	const int & back() const { return m_items.back(); }
+
+	iterator erase( const_iterator first, const_iterator last )
+	{
+		return m_items.erase( first, last );
+	}
+
+	template<typename... Args>
+	void emplace_back( Args &&... args )
+	{
+		m_items.emplace_back( std::forward<Args>(args)... );
+	}
+
+	void reserve( size_type n )
+	{
+		last_reserved = n;
+		m_items.reserve( n );
+	}
+};
+
+std::size_t reserving_vector_t::last_reserved = 0u;
+
+TEST_CASE( "custom container with reserve(): read/write" , "reserve" )
+{
+	const auto obj = json_dto::from_json<
+			data_with_t< reserving_vector_t > >( R"({"data":[3,2,1]})" );
+	REQUIRE( 3u == reserving_vector_t::last_reserved );
+	REQUIRE( 3u == obj.m_data.size() );
+	REQUIRE( 1 == obj.m_data.back() );
+
+	REQUIRE( R"({"data":[3,2,1]})" == json_dto::to_json( obj ) );
+}
+
+TEST_CASE( "space in JSON arrays is reserved" , "reserve" )
+{
+	rapidjson::Document doc;
+
+	rapidjson::Value list;
+	json_dto::write_json_value(
+			std::list<int>{ 1, 2, 3 }, list, doc.GetAllocator() );
+	REQUIRE( 3u == list.Capacity() );
+
+	rapidjson::Value set;
+	json_dto::write_json_value(
+			std::set<int>{ 1, 2 }, set, doc.GetAllocator() );
+	REQUIRE( 2u == set.Capacity() );
+
+	// There is no size() in std::forward_list.
+	rapidjson::Value forward_list;
+	json_dto::write_json_value(
+			std::forward_list<int>{ 1, 2 }, forward_list, doc.GetAllocator() );
+	REQUIRE( 2u == forward_list.Size() );
+}
+
+TEST_CASE( "allocation budgets" , "allocations" )
+{
+	rapidjson::Document doc;
+	doc.Parse( R"([1,2,3,4,5,6,7,8,9,10])" );
+
+	// Only the space for all items is allocated.
+	std::vector< int > vector;
+	REQUIRE( 1u == allocations_of( [&] { json_dto::from_json( doc, vector ); } ) );
+	REQUIRE( 0u == allocations_of( [&] { json_dto::from_json( doc, vector ); } ) );
+
+	std::deque< int > deque;
+	json_dto::from_json( doc, deque );
+	REQUIRE( 0u == allocations_of( [&] { json_dto::from_json( doc, deque ); } ) );
+
+	std::list< int > list;
+	REQUIRE( 10u == allocations_of( [&] { json_dto::from_json( doc, list ); } ) );
+	{
+		json_dto::reuse_mode_t reuse;
+		REQUIRE( 0u == allocations_of( [&] { json_dto::from_json( doc, list ); } ) );
+	}
+
+	std::map< std::string, int > map{ { "a", 1 }, { "b", 2 } };
+	buffered_allocator_t<> values;
+	rapidjson::Value value;
+	REQUIRE( 0u == allocations_of( [&] {
+			json_dto::write_json_value( vector, value, values.m_allocator );
+			json_dto::write_json_value( list, value, values.m_allocator );
+			json_dto::write_json_value( map, value, values.m_allocator );
+		} ) );
+}
@@ -227,3 +227,37 @@ TEST_CASE( "unordered_multimap-values" )
 	check_values( e1 );
 }
 
+
+TEST_CASE( "map-unsorted-keys" )
+{
+	const auto m = json_dto::from_json< std::map< std::string, int > >(
+			R"({"c":3,"a":1,"b":2,"a":4})" );
+	REQUIRE( R"({"a":1,"b":2,"c":3})" == json_dto::to_json( m ) );
+
+	const auto mm = json_dto::from_json< std::multimap< std::string, int > >(
+			R"({"b":1,"a":2,"b":3,"a":4})" );
+	REQUIRE( R"({"a":2,"a":4,"b":1,"b":3})" == json_dto::to_json( mm ) );
+
+	const auto s = json_dto::from_json< std::multiset< int > >(
+			R"([3,1,2,1])" );
+	REQUIRE( R"([1,1,2,3])" == json_dto::to_json( s ) );
+}
+
+TEST_CASE( "unordered_map-reserve" )
+{
+	std::string json = "{";
+	for( int i = 0; i != 1000; ++i )
+		json += ( i ? ",\"" : "\"" ) + std::to_string( i ) + "\":" +
+				std::to_string( i );
+	json += "}";
+
+	const auto m = json_dto::from_json<
+			std::unordered_map< std::string, int > >( json );
+	REQUIRE( 1000u == m.size() );
+	REQUIRE( 999 == m.at( "999" ) );
+	REQUIRE( m.load_factor() <= m.max_load_factor() );
+
+	const auto s = json_dto::from_json< std::unordered_set< int > >(
+			"[1,2,3,2]" );
+	REQUIRE( 3u == s.size() );
+}
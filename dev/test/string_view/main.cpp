@@ -0,0 +1,171 @@
+#include <catch2/catch.hpp>
+
+#include <iostream>
+#include <map>
+#include <string>
+#include <vector>
+
+#include <json_dto/pub.hpp>
+
+#include <test/helper.hpp>
+
+using namespace json_dto;
+
+struct request_t
+{
+	string_view_t m_method;
+	std::vector< string_view_t > m_args;
+	nullable_t< string_view_t > m_comment;
+	std::map< string_view_t, string_view_t > m_headers;
+
+	template< typename Json_Io >
+	void
+	json_io( Json_Io & io )
+	{
+		io
+			& mandatory( "method", m_method )
+			& mandatory( "args", m_args )
+			& optional_null( "comment", m_comment )
+			& optional( "headers", m_headers,
+					std::map< string_view_t, string_view_t >{} );
+	}
+};
+
+const std::string request_json =
+		R"({"method":"get","args":["a","b\tc"],"comment":null,)"
+		R"("headers":{"X-Key":"value"}})";
+
+bool
+points_into( string_view_t v, const char * begin, std::size_t size )
+{
+	return v.data() >= begin && v.data() + v.size() <= begin + size;
+}
+
+TEST_CASE( "string_view_t" , "[string_view]" )
+{
+	string_view_t empty;
+	REQUIRE( empty.empty() );
+	REQUIRE( 0u == empty.size() );
+	REQUIRE( "" == empty.to_string() );
+
+	const std::string str = "abc";
+	const string_view_t v = str;
+	REQUIRE( str.data() == v.data() );
+	REQUIRE( 3u == v.size() );
+	REQUIRE( v == "abc" );
+	REQUIRE( "abc" == v );
+	REQUIRE( v != "abd" );
+	REQUIRE( v != "ab" );
+	REQUIRE( v < string_view_t{ "abd" } );
+	REQUIRE( string_view_t{ "ab" } < v );
+	REQUIRE( str == v.to_string() );
+	REQUIRE( str == std::string( v.begin(), v.end() ) );
+}
+
+TEST_CASE( "read from a document" , "[string_view]" )
+{
+	rapidjson::Document document;
+	document.Parse( request_json.c_str() );
+
+	request_t request;
+	from_json( document, request );
+
+	REQUIRE( "get" == request.m_method );
+	REQUIRE( document[ "method" ].GetString() == request.m_method.data() );
+	REQUIRE( 2u == request.m_args.size() );
+	REQUIRE( "b\tc" == request.m_args[ 1 ] );
+	REQUIRE( !request.m_comment );
+	REQUIRE( 1u == request.m_headers.size() );
+	REQUIRE( "value" == request.m_headers.begin()->second );
+
+	rapidjson::Document wrong;
+	wrong.Parse( R"({"method":1,"args":[]})" );
+	REQUIRE_THROWS_WITH(
+			from_json< request_t >( wrong ),
+			"error reading field \"method\": value is not a string" );
+}
+
+TEST_CASE( "read in-situ" , "[string_view]" )
+{
+	std::string buffer = request_json;
+
+	request_t request;
+	from_json_insitu( &buffer[ 0 ], buffer.size(), request );
+
+	REQUIRE( "get" == request.m_method );
+	REQUIRE( points_into( request.m_method, buffer.data(), buffer.size() ) );
+	REQUIRE( "b\tc" == request.m_args[ 1 ] );
+	REQUIRE( points_into( request.m_args[ 1 ], buffer.data(), buffer.size() ) );
+	REQUIRE( points_into(
+			request.m_headers.begin()->first, buffer.data(), buffer.size() ) );
+}
+
+TEST_CASE( "parsed_t" , "[string_view]" )
+{
+	auto parsed = make_parsed< request_t >( std::string{ request_json } );
+	REQUIRE( "get" == parsed->m_method );
+	REQUIRE( "b\tc" == ( *parsed ).m_args[ 1 ] );
+	REQUIRE( "X-Key" == parsed.get().m_headers.begin()->first );
+	REQUIRE( parsed.document().IsObject() );
+
+	// Moving doesn't invalidate the views.
+	const auto * method = parsed->m_method.data();
+	auto moved = std::move(parsed);
+	REQUIRE( method == moved->m_method.data() );
+	REQUIRE( "get" == moved->m_method );
+
+	// Short strings in the source aren't a problem too.
+	const auto small = make_parsed< std::vector< string_view_t > >(
+			std::string{ R"(["x"])" } );
+	REQUIRE( 1u == small->size() );
+	REQUIRE( "x" == small->front() );
+
+	const auto from_copy = make_parsed< request_t >( request_json );
+	REQUIRE( "a" == from_copy->m_args[ 0 ] );
+
+	const auto from_ref = make_parsed< request_t >(
+			make_string_ref( request_json ) );
+	REQUIRE( "a" == from_ref->m_args[ 0 ] );
+
+	REQUIRE_THROWS_AS( make_parsed< request_t >( std::string{ "{" } ),
+			json_dto::ex_t );
+	REQUIRE( "a" == make_parsed< std::vector< string_view_t >,
+			rapidjson::kParseTrailingCommasFlag >(
+					std::string{ R"(["a",])" } )->front() );
+}
+
+TEST_CASE( "write" , "[string_view]" )
+{
+	const auto parsed = make_parsed< request_t >( request_json );
+
+	// Null optional fields aren't written.
+	const std::string expected =
+			R"({"method":"get","args":["a","b\tc"],)"
+			R"("headers":{"X-Key":"value"}})";
+	REQUIRE( expected == to_json( *parsed ) );
+	REQUIRE( expected == to_json_sax( *parsed ) );
+}
+
+#if defined( JSON_DTO_SUPPORTS_STD_STRING_VIEW )
+struct std_view_t
+{
+	std::string_view m_name;
+
+	template< typename Json_Io >
+	void
+	json_io( Json_Io & io )
+	{
+		io & mandatory( "name", m_name );
+	}
+};
+
+TEST_CASE( "std::string_view" , "[string_view]" )
+{
+	const auto parsed = make_parsed< std_view_t >(
+			std::string{ R"({"name":"n"})" } );
+	REQUIRE( "n" == parsed->m_name );
+
+	REQUIRE( R"({"name":"n"})" == to_json( *parsed ) );
+	REQUIRE( R"({"name":"n"})" == to_json_sax( *parsed ) );
+}
+#endif
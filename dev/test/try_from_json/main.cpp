@@ -0,0 +1,395 @@
+#include <catch2/catch.hpp>
+
+#include <array>
+#include <iostream>
+#include <map>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include <json_dto/pub.hpp>
+#include <json_dto/validators.hpp>
+
+#include <test/helper.hpp>
+
+using namespace json_dto;
+
+struct inner_t
+{
+	std::int8_t m_small{};
+	std::string m_name;
+	std::array< int, 2 > m_pair{};
+	int m_limited{};
+
+	template< typename Json_Io >
+	void
+	json_io( Json_Io & io )
+	{
+		io
+			& mandatory( "small", m_small )
+			& mandatory( "name", m_name )
+			& mandatory( "pair", m_pair )
+			& optional( "limited", m_limited, 0, min_max_constraint( 0, 10 ) );
+	}
+};
+
+struct outer_t
+{
+	int m_id{};
+	inner_t m_inner;
+	std::vector< inner_t > m_items;
+
+	template< typename Json_Io >
+	void
+	json_io( Json_Io & io )
+	{
+		io
+			& mandatory( "id", m_id )
+			& mandatory( "inner", m_inner )
+			& optional( "items", m_items, std::vector< inner_t >{} );
+	}
+};
+
+const std::string inner_json = R"({"small":1,"name":"a","pair":[1,2]})";
+
+std::string
+make_json( const std::string & inner )
+{
+	return R"({"id":1,"inner":)" + inner + "}";
+}
+
+// Checks that try_from_json returns the same message as from_json throws.
+template< typename Type >
+error_info_t
+check_error( const std::string & json, error_code_t expected_code )
+{
+	Type o;
+	const auto error = try_from_json( json, o );
+	REQUIRE( error );
+	REQUIRE( expected_code == error.code() );
+
+	std::string exception_message;
+	try
+	{
+		Type other;
+		from_json( json, other );
+	}
+	catch( const ex_t & ex )
+	{
+		exception_message = ex.what();
+		REQUIRE( expected_code == ex.code() );
+	}
+	REQUIRE( exception_message == error.message() );
+
+	return error;
+}
+
+TEST_CASE( "no errors" , "[try_from_json]" )
+{
+	outer_t outer;
+	const auto error = try_from_json( make_json( inner_json ), outer );
+	REQUIRE_FALSE( error );
+	REQUIRE( error_code_t::ok == error.code() );
+	REQUIRE( 1 == outer.m_id );
+	REQUIRE( "a" == outer.m_inner.m_name );
+
+	rapidjson::Document document;
+	document.Parse( inner_json.c_str() );
+	inner_t inner;
+	REQUIRE_FALSE( try_from_json( document, inner ) );
+	REQUIRE( 2 == inner.m_pair[ 1 ] );
+
+	parse_context_t context;
+	REQUIRE_FALSE( try_from_json( context, inner_json.c_str(), inner ) );
+}
+
+TEST_CASE( "parse errors" , "[try_from_json]" )
+{
+	const auto error = check_error< outer_t >(
+			R"({"id":1,"inner":{)", error_code_t::parse_error );
+	REQUIRE( 17u == error.offset() );
+	REQUIRE( error.json_pointer().empty() );
+
+	inner_t inner;
+	parse_context_t context;
+	const auto context_error = try_from_json( context, "[1,", inner );
+	REQUIRE( error_code_t::parse_error == context_error.code() );
+	REQUIRE( 3u == context_error.offset() );
+}
+
+TEST_CASE( "errors of fields" , "[try_from_json]" )
+{
+	{
+		const auto error = check_error< outer_t >(
+				R"({"id":"1"})", error_code_t::type_mismatch );
+		REQUIRE( "/id" == error.json_pointer() );
+		REQUIRE( "value is not std::int32_t" == error.description() );
+		REQUIRE( 0u == error.offset() );
+	}
+	{
+		const auto error = check_error< outer_t >(
+				make_json( R"({"small":128,"name":"a","pair":[1,2]})" ),
+				error_code_t::out_of_range );
+		REQUIRE( "/inner/small" == error.json_pointer() );
+	}
+
+	check_error< outer_t >(
+			make_json( R"({"small":1,"pair":[1,2]})" ),
+			error_code_t::missing_field );
+	check_error< outer_t >(
+			make_json( R"({"small":1,"name":null,"pair":[1,2]})" ),
+			error_code_t::null_value );
+	check_error< outer_t >(
+			make_json( R"({"small":1,"name":"a","pair":[1]})" ),
+			error_code_t::invalid_size );
+	check_error< outer_t >(
+			make_json( R"({"small":1,"name":"a","pair":[1,2],"limited":11})" ),
+			error_code_t::validation_failed );
+	check_error< outer_t >(
+			make_json( "[]" ), error_code_t::type_mismatch );
+	check_error< std::vector< int > >(
+			R"({})", error_code_t::type_mismatch );
+
+	// Only the first error is returned.
+	{
+		const auto error = check_error< outer_t >(
+				R"({"id":"1","inner":1,"items":[{}]})",
+				error_code_t::type_mismatch );
+		REQUIRE( "/id" == error.json_pointer() );
+	}
+	{
+		const auto error = check_error< outer_t >(
+				R"({"id":1,"inner":)" + inner_json + R"(,"items":[{}]})",
+				error_code_t::missing_field );
+		REQUIRE( "/items/0/small" == error.json_pointer() );
+	}
+}
+
+// Reads a positive number and reports errors.
+struct positive_reader_writer_t
+{
+	void
+	read( int & v, const rapidjson::Value & from ) const
+	{
+		if( !from.IsInt() )
+		{
+			report_error( error_code_t::type_mismatch, "not an int" );
+			return;
+		}
+		if( from.GetInt() <= 0 )
+			throw std::runtime_error{ "not positive" };
+
+		v = from.GetInt();
+	}
+
+	void
+	write(
+		const int & v,
+		rapidjson::Value & to,
+		rapidjson::MemoryPoolAllocator<> & ) const
+	{
+		if( v <= 0 )
+		{
+			report_error( error_code_t::write_failed, "not positive" );
+			return;
+		}
+
+		to.SetInt( v );
+	}
+};
+
+// Reads a number or a string with a number.
+struct lenient_reader_writer_t
+{
+	void
+	read( int & v, const rapidjson::Value & from ) const
+	{
+		// Reading functions called from Reader_Writers throw exceptions
+		// inside try_from_json() too.
+		try
+		{
+			read_json_value( v, from );
+		}
+		catch( const ex_t & )
+		{
+			std::string str;
+			read_json_value( str, from );
+			v = std::stoi( str );
+		}
+	}
+
+	void
+	write(
+		const int & v,
+		rapidjson::Value & to,
+		rapidjson::MemoryPoolAllocator<> & allocator ) const
+	{
+		write_json_value( v, to, allocator );
+	}
+};
+
+struct custom_t
+{
+	int m_positive{ 1 };
+	int m_lenient{};
+
+	template< typename Json_Io >
+	void
+	json_io( Json_Io & io )
+	{
+		io
+			& mandatory( positive_reader_writer_t{}, "positive", m_positive )
+			& optional( lenient_reader_writer_t{}, "lenient", m_lenient, 0 );
+	}
+};
+
+TEST_CASE( "custom Reader_Writer" , "[try_from_json]" )
+{
+	{
+		const auto error = check_error< custom_t >(
+				R"({"positive":"1"})", error_code_t::type_mismatch );
+		REQUIRE( "error reading field \"positive\": not an int" ==
+				error.message() );
+	}
+	{
+		// Exceptions from user's code are returned as errors too.
+		const auto error = check_error< custom_t >(
+				R"({"positive":0})", error_code_t::other );
+		REQUIRE( "not positive" == error.description() );
+	}
+
+	custom_t custom;
+	REQUIRE_FALSE( try_from_json( R"({"positive":2,"lenient":"3"})", custom ) );
+	REQUIRE( 3 == custom.m_lenient );
+
+	const auto error = try_from_json( R"({"positive":2,"lenient":[]})", custom );
+	REQUIRE( error_code_t::type_mismatch == error.code() );
+	REQUIRE( "/lenient" == error.json_pointer() );
+}
+
+// A number or a string, read by a user-defined read_json_value.
+struct number_or_text_t
+{
+	int m_number{};
+	std::string m_text;
+};
+
+namespace json_dto
+{
+
+template<>
+void
+read_json_value( number_or_text_t & v, const rapidjson::Value & from )
+{
+	try
+	{
+		read_json_value( v.m_number, from );
+	}
+	catch( const ex_t & )
+	{
+		read_json_value( v.m_text, from );
+	}
+}
+
+template<>
+void
+write_json_value(
+	const number_or_text_t & v,
+	rapidjson::Value & to,
+	rapidjson::MemoryPoolAllocator<> & allocator )
+{
+	write_json_value( v.m_number, to, allocator );
+}
+
+} /* namespace json_dto */
+
+enum class level_t : std::uint8_t { low, high };
+
+// Reads an enum via its numeric representation.
+struct numeric_reader_writer_t
+{
+	void
+	read( level_t & v, const rapidjson::Value & from ) const
+	{
+		std::uint8_t representation;
+		read_json_value( representation, from );
+
+		// It's not reached if the value can't be read.
+		v = static_cast< level_t >( representation );
+	}
+
+	void
+	write(
+		const level_t & v,
+		rapidjson::Value & to,
+		rapidjson::MemoryPoolAllocator<> & allocator ) const
+	{
+		write_json_value( static_cast< std::uint8_t >( v ), to, allocator );
+	}
+};
+
+struct user_reads_t
+{
+	number_or_text_t m_value;
+	level_t m_level{ level_t::high };
+
+	template< typename Json_Io >
+	void
+	json_io( Json_Io & io )
+	{
+		io
+			& mandatory( "v", m_value )
+			& optional( numeric_reader_writer_t{}, "level", m_level,
+					level_t::high );
+	}
+};
+
+TEST_CASE( "user-defined reading functions" , "[try_from_json]" )
+{
+	const std::string json = R"({"v":"text"})";
+
+	const auto expected = from_json< user_reads_t >( json );
+	REQUIRE( "text" == expected.m_value.m_text );
+
+	user_reads_t r;
+	REQUIRE_FALSE( try_from_json( json, r ) );
+	REQUIRE( "text" == r.m_value.m_text );
+
+	REQUIRE_THROWS_WITH( from_json< user_reads_t >( R"({"v":1,"level":"1"})" ),
+			"error reading field \"level\": value is not std::uint32_t" );
+
+	const auto error = try_from_json( R"({"v":1,"level":"1"})", r );
+	REQUIRE( error_code_t::type_mismatch == error.code() );
+	REQUIRE( "/level" == error.json_pointer() );
+	REQUIRE( level_t::high == r.m_level );
+}
+
+TEST_CASE( "try_to_json" , "[try_from_json]" )
+{
+	custom_t custom;
+	custom.m_lenient = 2;
+
+	std::string json{ "previous content" };
+	REQUIRE_FALSE( try_to_json( custom, json ) );
+	REQUIRE( R"({"positive":1,"lenient":2})" == json );
+
+	custom.m_positive = 0;
+	const auto error = try_to_json( custom, json );
+	REQUIRE( error_code_t::write_failed == error.code() );
+	REQUIRE( "error writing field \"positive\": not positive" ==
+			error.message() );
+	REQUIRE( json.empty() );
+
+	REQUIRE_THROWS_WITH( to_json( custom ),
+			"error writing field \"positive\": not positive" );
+}
+
+TEST_CASE( "exceptions outside try_from_json" , "[try_from_json]" )
+{
+	outer_t outer;
+	REQUIRE( try_from_json( R"({"id":"1"})", outer ) );
+
+	REQUIRE_THROWS_WITH( from_json< outer_t >( R"({"id":"1"})" ),
+			"error reading field \"id\": value is not std::int32_t" );
+	REQUIRE_THROWS_AS( report_error( error_code_t::other, "error" ), ex_t );
+}